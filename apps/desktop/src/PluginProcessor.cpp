@@ -27,6 +27,7 @@ PluginChainManagerProcessor::PluginChainManagerProcessor()
                      .withInput("Sidechain", juce::AudioChannelSet::stereo(), false)
                      .withOutput("Output", juce::AudioChannelSet::stereo(), true)),
       chainProcessor(pluginManager),
+      compareChainProcessor(pluginManager),
       presetManager(chainProcessor),
       groupTemplateManager(chainProcessor)
 {
@@ -35,38 +36,23 @@ PluginChainManagerProcessor::PluginChainManagerProcessor()
     // Pre-allocate proxy parameters for DAW automation (must be in constructor)
     parameterPool.createAndRegister(*this);
 
-    // Set up latency reporting callback
-    chainProcessor.onLatencyChanged = [this](int latencySamples) {
-        // Chain reports latency at its operating rate.
-        // When oversampling, convert from oversampled rate to original rate,
-        // then add the oversampling filter's own latency (already at original rate).
-        int totalLatency = latencySamples;
-        if (oversamplingEnabled && oversampling)
-        {
-            int osFactor = 1 << oversamplingFactor;  // 2^n
-            totalLatency = latencySamples / osFactor;  // Convert to original rate
-            totalLatency += static_cast<int>(oversampling->getLatencyInSamples());
-        }
-
-        setLatencySamples(totalLatency);
-        // Sync waveform display - delay input to match output
-        waveformCapture.setLatencyCompensation(totalLatency);
-        // Update dry signal delay to stay aligned with wet (chain-processed) signal
-        currentChainLatency = totalLatency;
-        if (totalLatency > 0)
-            dryDelayLine.setDelay(static_cast<float>(totalLatency));
-    };
+    // Set up latency reporting callback (either A/B chain can change the reported latency)
+    chainProcessor.onLatencyChanged = [this](int) { handleChainLatencyChanged(); };
+    compareChainProcessor.onLatencyChanged = [this](int) { handleChainLatencyChanged(); };
 
     // Rebind proxy parameters when plugins are added/removed/moved
     chainProcessor.onParameterBindingChanged = [this]() {
-        parameterPool.rebindAll(chainProcessor);
+        // While a staged preset swap is fading to slot B, automation drives the chain being heard
+        const bool bindB = presetSwap != nullptr && presetSwap->phase == PresetSwap::Phase::FadingToB;
+        parameterPool.rebindAll(bindB ? compareChainProcessor : chainProcessor);
         // Reset top-level counter so we capture audio calls after graph change
         topLevelProcessBlockCount = 0;
     };
 
-    // Unbind a specific slot (used after duplication to clear automation)
-    chainProcessor.onUnbindSlot = [this](int slotIndex) {
-        parameterPool.unbindSlot(slotIndex);
+    presetManager.stagedSwapHandler = [this](std::unique_ptr<juce::XmlElement> chainXml,
+                                             std::vector<StagedPluginInstance> staged,
+                                             std::function<void(ChainProcessor::RestoreResult)> onDone) {
+        swapInStagedPreset(std::move(chainXml), std::move(staged), std::move(onDone));
     };
 
     // Register with the shared instance registry
@@ -81,6 +67,19 @@ PluginChainManagerProcessor::PluginChainManagerProcessor()
     // Create mirror manager (Phase 3)
     mirrorManager = std::make_unique<MirrorManager>(*this, *instanceRegistry);
 
+    // Off-audio-thread work goes through the process-wide worker pool, never our own threads
+    schedulerClient = std::make_unique<RealtimeScheduler::Client>(*realtimeScheduler, instanceId);
+    fftProcessor.setScheduler(schedulerClient.get());
+
+    // Session overview: publish our loudness/spectrum to the registry's analysis bus
+    analysisPublisher = std::make_unique<AnalysisPublisher>(instanceRegistry->getAnalysisBus(), instanceId,
+                                                            outputMeter, fftProcessor);
+
+    // Cross-track sidechaining: publish our input, let our chains key from other instances
+    audioTap = instanceRegistry->getAudioTap(instanceId);
+    chainProcessor.setInstanceRegistry(instanceRegistry.get(), instanceId);
+    compareChainProcessor.setInstanceRegistry(instanceRegistry.get(), instanceId);
+
     PCLOG("PluginProcessor constructor — instance #" + juce::String(instanceId) + " ready");
 }
 
@@ -88,6 +87,8 @@ PluginChainManagerProcessor::~PluginChainManagerProcessor()
 {
     PCLOG("PluginProcessor destructor — instance #" + juce::String(instanceId) + " shutting down");
 
+    aliveFlag->store(false, std::memory_order_release);
+
     // CRITICAL: Stop audio thread from processing before destroying anything.
     // Without this, the audio thread can dereference freed plugin buffers
     // (EXC_BAD_ACCESS in AudioUnitPluginInstance::processAudio → AudioBuffer::clear).
@@ -99,6 +100,18 @@ PluginChainManagerProcessor::~PluginChainManagerProcessor()
 
     // Clear graph nodes while we still own them (before member destruction)
     chainProcessor.clearGraph();
+    compareChainProcessor.clearGraph();
+
+    analysisPublisher.reset();
+
+    // Our jobs reference members — finish them before anything is torn down
+    fftProcessor.setScheduler(nullptr);
+    schedulerClient.reset();
+
+    // Drop tap subscriptions and registry listeners before the registry may go away
+    chainProcessor.setInstanceRegistry(nullptr, -1);
+    compareChainProcessor.setInstanceRegistry(nullptr, -1);
+    audioTap.reset();
 
     // Leave mirror group before deregistering
     if (mirrorManager)
@@ -204,6 +217,22 @@ void PluginChainManagerProcessor::prepareToPlay(double sampleRate, int samplesPe
         effectiveBlock
     );
     chainProcessor.prepareToPlay(effectiveRate, effectiveBlock);
+
+    // A/B slot B runs in the same (possibly oversampled) domain as A
+    compareChainProcessor.setPlayConfigDetails(2, 2, effectiveRate, effectiveBlock);
+    compareChainProcessor.prepareToPlay(effectiveRate, effectiveBlock);
+    compareBuffer.setSize(2, effectiveBlock, false, false, true);
+
+    juce::dsp::ProcessSpec alignSpec;
+    alignSpec.sampleRate = effectiveRate;
+    alignSpec.maximumBlockSize = static_cast<juce::uint32>(effectiveBlock);
+    alignSpec.numChannels = 2;
+    for (auto* alignDelay : { &abAlignDelayA, &abAlignDelayB })
+    {
+        alignDelay->setMaximumDelayInSamples(static_cast<int>(effectiveRate * 2.0));
+        alignDelay->prepare(alignSpec);
+    }
+
     waveformCapture.reset();
 
     // Initialize gain processor and meters at original rate (they process before/after oversampling)
@@ -238,21 +267,53 @@ void PluginChainManagerProcessor::prepareToPlay(double sampleRate, int samplesPe
     dryDelayLine.setDelay(static_cast<float>(currentChainLatency));
 
     // Report initial latency to host (chain latency + oversampling filter latency)
-    // Chain latency is in oversampled samples when OS is active — convert to original rate
+    int latency = computeReportedLatency();
+    setLatencySamples(latency);
+    waveformCapture.setLatencyCompensation(latency);
+    handleChainLatencyChanged();
+}
+
+void PluginChainManagerProcessor::releaseResources()
+{
+    chainProcessor.releaseResources();
+    compareChainProcessor.releaseResources();
+}
+
+int PluginChainManagerProcessor::computeReportedLatency() const
+{
+    // Report the larger of the two chains so A/B switching never changes PDC
     int latency = chainProcessor.getTotalLatencySamples();
+    if (hasCompareSlot())
+        latency = juce::jmax(latency, compareChainProcessor.getTotalLatencySamples());
+
+    // Chain latency is in oversampled samples when OS is active — convert to original rate
     if (oversamplingEnabled && oversampling)
     {
         int osFactor = 1 << oversamplingFactor;  // 2^n
         latency = latency / osFactor;  // Convert chain latency from oversampled to original rate
         latency += static_cast<int>(oversampling->getLatencyInSamples());  // Already at original rate
     }
-    setLatencySamples(latency);
-    waveformCapture.setLatencyCompensation(latency);
+    return latency;
 }
 
-void PluginChainManagerProcessor::releaseResources()
+void PluginChainManagerProcessor::handleChainLatencyChanged()
 {
-    chainProcessor.releaseResources();
+    // Pad whichever chain is shorter up to the longer one (in the chains' own domain)
+    const int latencyA = chainProcessor.getTotalLatencySamples();
+    const int latencyB = hasCompareSlot() ? compareChainProcessor.getTotalLatencySamples() : latencyA;
+    const int longest = juce::jmax(latencyA, latencyB);
+    abAlignSamplesA.store(longest - latencyA, std::memory_order_release);
+    abAlignSamplesB.store(longest - latencyB, std::memory_order_release);
+
+    int totalLatency = computeReportedLatency();
+
+    setLatencySamples(totalLatency);
+    // Sync waveform display - delay input to match output
+    waveformCapture.setLatencyCompensation(totalLatency);
+    // Update dry signal delay to stay aligned with wet (chain-processed) signal
+    currentChainLatency = totalLatency;
+    if (totalLatency > 0)
+        dryDelayLine.setDelay(static_cast<float>(totalLatency));
 }
 
 bool PluginChainManagerProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
@@ -295,6 +356,31 @@ void PluginChainManagerProcessor::processBlock(juce::AudioBuffer<float>& buffer,
         sidechainBuffer.copyFrom(1, 0, buffer, 3, 0, buffer.getNumSamples());
     }
     chainProcessor.setSidechainBuffer(hasSC ? &sidechainBuffer : nullptr);
+    compareChainProcessor.setSidechainBuffer(hasSC ? &sidechainBuffer : nullptr);
+
+    // Inter-instance taps are keyed by timeline position so subscribers can align to our
+    // previous block regardless of the order the host renders tracks in (see AudioTap)
+    {
+        juce::int64 tapPosition = -1;
+        if (auto* playHead = getPlayHead())
+            if (auto position = playHead->getPosition())
+                if (auto samples = position->getTimeInSamples())
+                    tapPosition = *samples;
+
+        // Taps travel at host rate; the chains upsample what they read to their own domain
+        const int numSamples = buffer.getNumSamples();
+        const int chainOversampling = (oversamplingEnabled && oversampling) ? (1 << oversamplingFactor) : 1;
+        if (audioTap)
+            audioTap->write(buffer, numSamples, tapPosition);
+        chainProcessor.setAudioTapBlock(tapPosition, numSamples, chainOversampling);
+        compareChainProcessor.setAudioTapBlock(tapPosition, numSamples, chainOversampling);
+    }
+
+    // Apply mirrored partners' parameter changes and queue ours for them, block-synchronously
+    mirrorManager->processRealtimeParameters();
+
+    // Push macro values to their child parameters before the chain renders this block
+    parameterPool.processMacros();
 
     // Apply input gain first (operates on stereo ch0-1 only)
     gainProcessor.processInputGain(buffer);
@@ -353,13 +439,13 @@ void PluginChainManagerProcessor::processBlock(juce::AudioBuffer<float>& buffer,
             channelPtrs[ch] = oversampledBlock.getChannelPointer(static_cast<size_t>(ch));
         juce::AudioBuffer<float> osBuffer(channelPtrs, 2, osNumSamples);
 
-        chainProcessor.processBlock(osBuffer, midiMessages);
+        processChains(osBuffer, midiMessages);
 
         oversampling->processSamplesDown(block);
     }
     else
     {
-        chainProcessor.processBlock(processBuffer, midiMessages);
+        processChains(processBuffer, midiMessages);
     }
 
     if (needsStereoIsolation)
@@ -405,6 +491,374 @@ void PluginChainManagerProcessor::processBlock(juce::AudioBuffer<float>& buffer,
     outputMeter.process(buffer);
 }
 
+void PluginChainManagerProcessor::processChains(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi)
+{
+    const int numSamples = buffer.getNumSamples();
+    const int maxBlock = compareBuffer.getNumSamples();
+    if (maxBlock <= 0 || numSamples <= maxBlock)
+    {
+        processChainBlock(buffer, midi);
+        return;
+    }
+
+    // Host block larger than prepared: run prepared-size chunks rather than allocating here.
+    // MIDI goes with the first chunk (chains are effects only).
+    for (int start = 0; start < numSamples; start += maxBlock)
+    {
+        juce::AudioBuffer<float> chunk(buffer.getArrayOfWritePointers(), 2, start,
+                                       juce::jmin(maxBlock, numSamples - start));
+        chunkMidi.clear();
+        processChainBlock(chunk, start == 0 ? midi : chunkMidi);
+    }
+}
+
+void PluginChainManagerProcessor::processChainBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi)
+{
+    const int numSamples = buffer.getNumSamples();
+
+    // B needs its prepared copy buffer (not there before the first prepareToPlay)
+    const bool hasB = compareLoaded.load(std::memory_order_acquire) && compareBuffer.getNumSamples() >= numSamples;
+    const float target = (hasB && abTargetIsB.load(std::memory_order_acquire)) ? 1.0f : 0.0f;
+
+    // Fast path: no compare slot and not fading out of one — identical to a single chain
+    if (!hasB && abMix == 0.0f)
+    {
+        chainProcessor.processBlock(buffer, midi);
+        abRanA = true;
+        abRanB = false;
+        abSettledOn.store(0, std::memory_order_release);
+        return;
+    }
+
+    const bool fading = abMix != target;
+    const bool keepWarm = compareKeepWarm.load(std::memory_order_acquire);
+    const bool runA = keepWarm || fading || target == 0.0f;
+    const bool runB = hasB && (keepWarm || fading || target == 1.0f);
+
+    const int alignA = abAlignSamplesA.load(std::memory_order_acquire);
+    const int alignB = abAlignSamplesB.load(std::memory_order_acquire);
+    abAlignDelayA.setDelay(static_cast<float>(alignA));
+    abAlignDelayB.setDelay(static_cast<float>(alignB));
+
+    if (runB)
+    {
+        compareBuffer.copyFrom(0, 0, buffer, 0, 0, numSamples);
+        compareBuffer.copyFrom(1, 0, buffer, 1, 0, numSamples);
+        compareMidi.clear();
+        compareChainProcessor.processBlock(compareBuffer, compareMidi);
+
+        // Waking from sleep — don't replay stale samples from the alignment delay
+        if (!abRanB)
+            abAlignDelayB.reset();
+        if (alignB > 0)
+        {
+            juce::dsp::AudioBlock<float> blockB(compareBuffer.getArrayOfWritePointers(), 2, static_cast<size_t>(numSamples));
+            juce::dsp::ProcessContextReplacing<float> contextB(blockB);
+            abAlignDelayB.process(contextB);
+        }
+    }
+
+    if (runA)
+    {
+        chainProcessor.processBlock(buffer, midi);
+
+        if (!abRanA)
+            abAlignDelayA.reset();
+        if (alignA > 0)
+        {
+            juce::dsp::AudioBlock<float> blockA(buffer.getArrayOfWritePointers(), 2, static_cast<size_t>(numSamples));
+            juce::dsp::ProcessContextReplacing<float> contextA(blockA);
+            abAlignDelayA.process(contextA);
+        }
+    }
+
+    abRanA = runA;
+    abRanB = runB;
+
+    if (!fading)
+    {
+        // Settled on one chain — plain copy, no per-sample mixing
+        if (target == 1.0f)
+        {
+            buffer.copyFrom(0, 0, compareBuffer, 0, 0, numSamples);
+            buffer.copyFrom(1, 0, compareBuffer, 1, 0, numSamples);
+        }
+        abSettledOn.store(target == 1.0f ? 1 : 0, std::memory_order_release);
+        return;
+    }
+
+    // Sample-accurate linear crossfade starting at this block boundary
+    const double chainRate = getSampleRate() * (oversamplingEnabled ? (1 << oversamplingFactor) : 1);
+    const float step = 1.0f / juce::jmax(1.0f, static_cast<float>(chainRate * kABCrossfadeMs / 1000.0));
+
+    auto* outL = buffer.getWritePointer(0);
+    auto* outR = buffer.getWritePointer(1);
+    const auto* bL = compareBuffer.getReadPointer(0);
+    const auto* bR = compareBuffer.getReadPointer(1);
+    const bool haveB = runB;
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        abMix = target > abMix ? juce::jmin(target, abMix + step) : juce::jmax(target, abMix - step);
+        const float gainA = 1.0f - abMix;
+        const float gainB = haveB ? abMix : 0.0f;
+        outL[i] = outL[i] * gainA + (haveB ? bL[i] * gainB : 0.0f);
+        outR[i] = outR[i] * gainA + (haveB ? bR[i] * gainB : 0.0f);
+    }
+
+    abSettledOn.store(abMix == target ? (target == 1.0f ? 1 : 0) : -1, std::memory_order_release);
+}
+
+bool PluginChainManagerProcessor::storeCompareSlot()
+{
+    jassert(juce::MessageManager::getInstance()->isThisTheMessageThread());
+
+    if (presetSwap != nullptr)
+        return false;
+
+    auto snapshot = chainProcessor.captureSnapshot();
+    compareChainProcessor.restoreSnapshot(snapshot);
+    compareLoaded.store(true, std::memory_order_release);
+    handleChainLatencyChanged();
+
+    PCLOG("A/B — stored live chain in slot B (" + juce::String(compareChainProcessor.getNumSlots()) + " plugins)");
+    return true;
+}
+
+void PluginChainManagerProcessor::clearCompareSlot()
+{
+    jassert(juce::MessageManager::getInstance()->isThisTheMessageThread());
+
+    // Mid preset swap B is the incoming preset, not a comparison
+    if (presetSwap != nullptr)
+        return;
+
+    cancelCompareSwap();
+
+    // Return to A before unloading so the audio thread isn't mid-fade into B
+    abTargetIsB.store(false, std::memory_order_release);
+    compareLoaded.store(false, std::memory_order_release);
+
+    // Suspending holds the host callback lock, so the audio-thread fade state is safe to reset
+    suspendProcessing(true);
+    compareChainProcessor.clearGraph();
+    abMix = 0.0f;
+    suspendProcessing(false);
+
+    handleChainLatencyChanged();
+}
+
+bool PluginChainManagerProcessor::swapCompareSlot()
+{
+    jassert(juce::MessageManager::getInstance()->isThisTheMessageThread());
+
+    if (!hasCompareSlot() || isCompareSwapInProgress())
+        return false;
+
+    // Without suspending the host: the silent chain becomes a copy of the one being heard,
+    // the audio thread crossfades to that copy, and only then does the chain that just went
+    // silent take the other contents. Every restore happens on a chain nobody is hearing.
+    const bool hearingB = abTargetIsB.load(std::memory_order_acquire);
+    auto& audible = hearingB ? compareChainProcessor : chainProcessor;
+    auto& silent = hearingB ? chainProcessor : compareChainProcessor;
+
+    compareSwapSnapshot = silent.captureSnapshot();
+    silent.restoreSnapshot(audible.captureSnapshot());
+    handleChainLatencyChanged();
+
+    compareSwapInProgress = true;
+    abTargetIsB.store(!hearingB, std::memory_order_release);
+    finishCompareSwap(++compareSwapGeneration, 0);
+    return true;
+}
+
+void PluginChainManagerProcessor::finishCompareSwap(int generation, int attempt)
+{
+    auto alive = aliveFlag;
+    juce::Timer::callAfterDelay(static_cast<int>(kABCrossfadeMs), [this, alive, generation, attempt]() {
+        if (!alive->load(std::memory_order_acquire) || generation != compareSwapGeneration)
+            return;
+
+        // Wait for the audio thread to settle on the copy. If nothing is processing
+        // (transport stopped in some hosts), nobody hears the restore — go ahead.
+        const bool nowB = abTargetIsB.load(std::memory_order_acquire);
+        if (abSettledOn.load(std::memory_order_acquire) != (nowB ? 1 : 0) && attempt < 25)
+        {
+            finishCompareSwap(generation, attempt + 1);
+            return;
+        }
+
+        auto& nowSilent = nowB ? chainProcessor : compareChainProcessor;
+        nowSilent.restoreSnapshot(compareSwapSnapshot);
+        compareSwapSnapshot.reset();
+        compareSwapInProgress = false;
+        handleChainLatencyChanged();
+    });
+}
+
+void PluginChainManagerProcessor::cancelCompareSwap()
+{
+    ++compareSwapGeneration;
+    compareSwapInProgress = false;
+    compareSwapSnapshot.reset();
+}
+
+void PluginChainManagerProcessor::setActiveABSlot(ABSlot slot)
+{
+    // Mid-swap the target is the copy being faded to; moving it would make the
+    // pending restore land on the chain being heard
+    if ((slot == ABSlot::B && !hasCompareSlot()) || isCompareSwapInProgress())
+        return;
+
+    abTargetIsB.store(slot == ABSlot::B, std::memory_order_release);
+}
+
+void PluginChainManagerProcessor::swapInStagedPreset(std::unique_ptr<juce::XmlElement> chainXml,
+                                                     std::vector<StagedPluginInstance> staged,
+                                                     std::function<void(ChainProcessor::RestoreResult)> onDone)
+{
+    jassert(juce::MessageManager::getInstance()->isThisTheMessageThread());
+
+    // One swap at a time; stepping through presets quickly lands only the latest
+    if (presetSwap != nullptr)
+    {
+        if (queuedPresetSwap != nullptr && queuedPresetSwap->onDone)
+            queuedPresetSwap->onDone({});   // Superseded
+        queuedPresetSwap = std::make_unique<QueuedPresetSwap>();
+        queuedPresetSwap->chainXml = std::move(chainXml);
+        queuedPresetSwap->staged = std::move(staged);
+        queuedPresetSwap->onDone = std::move(onDone);
+        return;
+    }
+
+    // B holds the user's comparison (or isn't prepared yet): the chain swaps in place
+    if (hasCompareSlot() || compareSwapInProgress || compareBuffer.getNumSamples() == 0)
+    {
+        chainProcessor.restoreChainFromXmlAsync(std::move(chainXml), std::move(staged), std::move(onDone));
+        return;
+    }
+
+    // Nobody hears B until the crossfade starts, so A plays on undisturbed while it's built
+    auto result = compareChainProcessor.restoreChainFromXml(*chainXml, &staged);
+    if (!result.success)
+    {
+        if (onDone)
+            onDone(std::move(result));
+        return;
+    }
+
+    presetSwap = std::make_unique<PresetSwap>();
+    presetSwap->result = std::move(result);
+    presetSwap->onDone = std::move(onDone);
+
+    compareLoaded.store(true, std::memory_order_release);
+    handleChainLatencyChanged();
+    parameterPool.rebindAll(compareChainProcessor);
+
+    abTargetIsB.store(true, std::memory_order_release);
+    continuePresetSwap(++presetSwapGeneration, 0);
+}
+
+void PluginChainManagerProcessor::continuePresetSwap(int generation, int attempt)
+{
+    auto alive = aliveFlag;
+    juce::Timer::callAfterDelay(static_cast<int>(kABCrossfadeMs), [this, alive, generation, attempt]() {
+        if (!alive->load(std::memory_order_acquire) || generation != presetSwapGeneration || presetSwap == nullptr)
+            return;
+
+        // Same rule as finishCompareSwap: if nothing is processing, nobody hears what follows
+        const bool towardB = presetSwap->phase == PresetSwap::Phase::FadingToB;
+        if (abSettledOn.load(std::memory_order_acquire) != (towardB ? 1 : 0) && attempt < 25)
+        {
+            continuePresetSwap(generation, attempt + 1);
+            return;
+        }
+
+        if (towardB)
+        {
+            // Only B is heard: A takes a copy (its rebind moves automation back to A). Whatever
+            // automation does to B until then is replayed once the mix is back on A.
+            presetSwap->valuesB = captureParameterValues(compareChainProcessor);
+            presetSwap->phase = PresetSwap::Phase::FadingBackToA;
+            chainProcessor.restoreSnapshot(compareChainProcessor.captureSnapshot());
+            handleChainLatencyChanged();
+            abTargetIsB.store(false, std::memory_order_release);
+
+            // The live chain holds the preset now — PresetManager and the UI can move on
+            if (auto onDone = std::move(presetSwap->onDone))
+                onDone(presetSwap->result);
+
+            if (generation == presetSwapGeneration && presetSwap != nullptr)
+                continuePresetSwap(generation, 0);
+            return;
+        }
+
+        // Back on A. Replay B's edits that A's copy missed; A's own edits since are kept.
+        const auto& before = presetSwap->valuesB;
+        const auto now = captureParameterValues(compareChainProcessor);
+        size_t k = 0;
+        for (auto nodeId : compareChainProcessor.getFlatPluginNodeIds())
+        {
+            auto* from = compareChainProcessor.getNodeProcessor(nodeId);
+            if (from == nullptr)
+                continue;
+
+            auto* to = chainProcessor.getNodeProcessor(nodeId);
+            const int numParams = from->getParameters().size();
+            for (int i = 0; i < numParams; ++i, ++k)
+            {
+                if (to == nullptr || i >= to->getParameters().size() || k >= before.size() || k >= now.size())
+                    continue;
+                if (std::abs(now[k] - before[k]) > ParameterMirror::kChangeEpsilon)
+                    to->getParameters()[i]->setValueNotifyingHost(now[k]);
+            }
+        }
+
+        // Unload B: it is no longer run once compareLoaded drops; wait out a block in flight
+        compareLoaded.store(false, std::memory_order_release);
+        compareChainProcessor.suspendProcessing(true);
+        for (int i = 0; i < 500 && compareChainProcessor.isAudioThreadBusy(); ++i)
+            juce::Thread::sleep(1);
+        compareChainProcessor.clearGraph();
+        compareChainProcessor.suspendProcessing(false);
+        handleChainLatencyChanged();
+
+        presetSwap.reset();
+        if (auto next = std::move(queuedPresetSwap))
+            swapInStagedPreset(std::move(next->chainXml), std::move(next->staged), std::move(next->onDone));
+    });
+}
+
+void PluginChainManagerProcessor::cancelPresetSwap()
+{
+    ++presetSwapGeneration;
+    if (queuedPresetSwap != nullptr && queuedPresetSwap->onDone)
+        queuedPresetSwap->onDone({});
+    queuedPresetSwap.reset();
+
+    if (presetSwap == nullptr)
+        return;
+
+    // Whatever replaces A's state decides what B holds; the caller restores or clears it.
+    // Automation may still be on B if the swap hadn't got as far as copying it to A.
+    auto swap = std::move(presetSwap);
+    abTargetIsB.store(false, std::memory_order_release);
+    if (swap->phase == PresetSwap::Phase::FadingToB)
+        parameterPool.rebindAll(chainProcessor);
+    if (swap->onDone)
+        swap->onDone({});
+}
+
+std::vector<float> PluginChainManagerProcessor::captureParameterValues(ChainProcessor& chain)
+{
+    std::vector<float> values;
+    for (auto nodeId : chain.getFlatPluginNodeIds())
+        if (auto* processor = chain.getNodeProcessor(nodeId))
+            for (auto* param : processor->getParameters())
+                values.push_back(param->getValue());
+    return values;
+}
+
 bool PluginChainManagerProcessor::hasEditor() const
 {
     return true;
@@ -435,6 +889,20 @@ void PluginChainManagerProcessor::getStateInformation(juce::MemoryBlock& destDat
         auto* osXml = xml->createNewChildElement("Oversampling");
         osXml->setAttribute("factor", oversamplingFactor);
 
+        // Save host parameter mappings (slot assignments in the legacy layout)
+        xml->addChildElement(parameterPool.mappingsToXml().release());
+
+        // Save A/B compare slot (B's full chain state) — mid preset swap B is the incoming preset
+        if (hasCompareSlot() && presetSwap == nullptr)
+        {
+            juce::MemoryBlock compareData;
+            compareChainProcessor.getStateInformation(compareData);
+            auto* abXml = xml->createNewChildElement("CompareSlot");
+            abXml->setAttribute("active", getActiveABSlot() == ABSlot::B ? "B" : "A");
+            abXml->setAttribute("keepWarm", isCompareKeepWarm());
+            abXml->setAttribute("state", compareData.toBase64Encoding());
+        }
+
         copyXmlToBinary(*xml, destData);
     }
     else
@@ -450,6 +918,8 @@ void PluginChainManagerProcessor::setStateInformation(const void* data, int size
     int savedMirrorGroupId = -1;
     int savedOversamplingFactor = 0;
     bool savedWasLeader = false;
+    juce::MemoryBlock savedCompareState;
+    bool savedCompareActive = false;
 
     // Check for mirror group info and oversampling state in the state XML
     if (auto xml = getXmlFromBinary(data, sizeInBytes))
@@ -467,6 +937,25 @@ void PluginChainManagerProcessor::setStateInformation(const void* data, int size
             xml->removeChildElement(osXml, true);
         }
 
+        if (auto* abXml = xml->getChildByName("CompareSlot"))
+        {
+            savedCompareState.fromBase64Encoding(abXml->getStringAttribute("state"));
+            savedCompareActive = abXml->getStringAttribute("active") == "B";
+            setCompareKeepWarm(abXml->getBoolAttribute("keepWarm", true));
+            xml->removeChildElement(abXml, true);
+        }
+
+        // Restore parameter mappings before the chain — its rebind resolves them
+        if (auto* mapXml = xml->getChildByName("ParameterMap"))
+        {
+            parameterPool.mappingsFromXml(*mapXml);
+            xml->removeChildElement(mapXml, true);
+        }
+        else
+        {
+            parameterPool.clearMappings();
+        }
+
         // Restore oversampling before chain (so chain prepares at correct rate)
         if (savedOversamplingFactor != oversamplingFactor)
             setOversamplingFactor(savedOversamplingFactor);
@@ -481,6 +970,22 @@ void PluginChainManagerProcessor::setStateInformation(const void* data, int size
         chainProcessor.setStateInformation(data, sizeInBytes);
     }
 
+    // Restore (or drop) the A/B compare slot
+    cancelCompareSwap();
+    const bool abandonedPresetSwap = presetSwap != nullptr;
+    cancelPresetSwap();
+    if (savedCompareState.getSize() > 0)
+    {
+        compareChainProcessor.setStateInformation(savedCompareState.getData(), static_cast<int>(savedCompareState.getSize()));
+        compareLoaded.store(true, std::memory_order_release);
+        setActiveABSlot(savedCompareActive ? ABSlot::B : ABSlot::A);
+        handleChainLatencyChanged();
+    }
+    else if (hasCompareSlot() || abandonedPresetSwap)
+    {
+        clearCompareSlot();
+    }
+
     // Attempt to reconnect mirror group from saved DAW session
     if (savedMirrorGroupId > 0 && mirrorManager)
     {
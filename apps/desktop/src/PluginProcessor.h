@@ -7,10 +7,12 @@
 #include "core/PresetManager.h"
 #include "core/GroupTemplateManager.h"
 #include "core/InstanceRegistry.h"
+#include "core/RealtimeScheduler.h"
 #include "audio/WaveformCapture.h"
 #include "audio/GainProcessor.h"
 #include "audio/AudioMeter.h"
 #include "audio/FFTProcessor.h"
+#include "audio/AnalysisPublisher.h"
 #include "audio/DryWetMixProcessor.h"
 #include "automation/ParameterProxyPool.h"
 
@@ -62,6 +64,7 @@ public:
     AudioMeter& getOutputMeter() { return outputMeter; }
     FFTProcessor& getFFTProcessor() { return fftProcessor; }
     DryWetMixProcessor& getMasterDryWetProcessor() { return masterDryWetProcessor; }
+    ParameterProxyPool& getParameterPool() { return parameterPool; }
 
     // Oversampling control
     void setOversamplingFactor(int factor);
@@ -69,14 +72,42 @@ public:
     bool isOversamplingEnabled() const { return oversamplingEnabled; }
     float getOversamplingLatencyMs() const;
 
+    // A/B compare — a second, fully prepared chain held alongside the live one.
+    // Edits always go to the live chain (A); B holds the alternative being compared.
+    enum class ABSlot { A, B };
+    bool storeCompareSlot();                  // Copy the live chain into B
+    void clearCompareSlot();
+    bool swapCompareSlot();                   // Exchange A and B contents, finishing asynchronously
+    bool isCompareSwapInProgress() const { return compareSwapInProgress || presetSwap != nullptr; }
+    bool hasCompareSlot() const { return compareLoaded.load(std::memory_order_acquire); }
+    void setActiveABSlot(ABSlot slot);        // Crossfades on the audio thread
+    ABSlot getActiveABSlot() const { return abTargetIsB.load(std::memory_order_acquire) ? ABSlot::B : ABSlot::A; }
+    void setCompareKeepWarm(bool keepWarm) { compareKeepWarm.store(keepWarm, std::memory_order_release); }
+    bool isCompareKeepWarm() const { return compareKeepWarm.load(std::memory_order_acquire); }
+    ChainProcessor& getCompareChainProcessor() { return compareChainProcessor; }
+
+    /** Prefetched preset load (PresetManager::stagedSwapHandler). With slot B free, the preset
+        is restored into B and crossfaded in while A keeps playing; A then takes a copy unheard,
+        B's edits meanwhile are replayed onto it and the mix fades back. With B in use, falls
+        back to the chain's own fade-out/fade-in swap. onDone runs once A holds the preset. */
+    void swapInStagedPreset(std::unique_ptr<juce::XmlElement> chainXml, std::vector<StagedPluginInstance> staged,
+                            std::function<void(ChainProcessor::RestoreResult)> onDone);
+    bool isPresetSwapInProgress() const { return presetSwap != nullptr; }
+
+    /** Latency reported to the host: the larger of A/B (so switching never changes PDC),
+        converted to the host rate and including the oversampling filters. */
+    int computeReportedLatency() const;
+
     // Instance awareness
     InstanceRegistry& getInstanceRegistry() { return *instanceRegistry; }
     InstanceId getInstanceId() const { return instanceId; }
     MirrorManager& getMirrorManager() { return *mirrorManager; }
+    RealtimeScheduler::Client& getSchedulerClient() { return *schedulerClient; }
 
 private:
     PluginManager pluginManager;
     ChainProcessor chainProcessor;
+    ChainProcessor compareChainProcessor;  // A/B slot B
     PresetManager presetManager;
     GroupTemplateManager groupTemplateManager;
     WaveformCapture waveformCapture;
@@ -93,6 +124,65 @@ private:
     int currentChainLatency = 0;
     ParameterProxyPool parameterPool;
 
+    // A/B compare state
+    std::atomic<bool> compareLoaded{false};
+    std::atomic<bool> abTargetIsB{false};
+    std::atomic<bool> compareKeepWarm{true};
+    std::atomic<int> abAlignSamplesA{0};          // Pads the shorter chain up to the longer one
+    std::atomic<int> abAlignSamplesB{0};
+    float abMix = 0.0f;                           // Audio thread: 0 = A, 1 = B
+    bool abRanA = true, abRanB = false;           // Audio thread: detects wake from sleep
+    std::atomic<int> abSettledOn{0};              // Audio thread publishes: 0 = A, 1 = B, -1 = fading
+    juce::AudioBuffer<float> compareBuffer;       // B's copy of the chain input, sized for the prepared block
+    juce::MidiBuffer compareMidi;                 // Always empty — chains are effects only
+    juce::MidiBuffer chunkMidi;                   // Empty MIDI for the later chunks of an oversize block
+
+    // A/B swap in progress (message thread): the contents still to go into the chain
+    // that becomes silent once the crossfade to its copy has settled
+    bool compareSwapInProgress = false;
+    int compareSwapGeneration = 0;
+    juce::MemoryBlock compareSwapSnapshot;
+    std::shared_ptr<std::atomic<bool>> aliveFlag = std::make_shared<std::atomic<bool>>(true);
+    // Staged preset swap through slot B (message thread)
+    struct PresetSwap
+    {
+        enum class Phase { FadingToB, FadingBackToA };
+        Phase phase = Phase::FadingToB;
+        ChainProcessor::RestoreResult result;
+        std::function<void(ChainProcessor::RestoreResult)> onDone;
+        std::vector<float> valuesB;   // B's parameter values when A took its copy
+    };
+    struct QueuedPresetSwap
+    {
+        std::unique_ptr<juce::XmlElement> chainXml;
+        std::vector<StagedPluginInstance> staged;
+        std::function<void(ChainProcessor::RestoreResult)> onDone;
+    };
+    std::unique_ptr<PresetSwap> presetSwap;
+    std::unique_ptr<QueuedPresetSwap> queuedPresetSwap;   // Latest load requested mid-swap
+    int presetSwapGeneration = 0;
+
+    juce::dsp::DelayLine<float> abAlignDelayA { 1 };
+    juce::dsp::DelayLine<float> abAlignDelayB { 1 };
+    static constexpr float kABCrossfadeMs = 20.0f;
+
+    /** Run the chain(s) on the (possibly oversampled) stereo buffer, crossfading A/B.
+        Blocks larger than the prepared size are processed in prepared-size chunks. */
+    void processChains(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi);
+    void processChainBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi);
+
+    /** Second half of swapCompareSlot, once the audio thread has settled on the copy. */
+    void finishCompareSwap(int generation, int attempt);
+    void cancelCompareSwap();
+
+    /** Advance the staged preset swap once the audio thread has settled on its target. */
+    void continuePresetSwap(int generation, int attempt);
+    void cancelPresetSwap();
+    static std::vector<float> captureParameterValues(ChainProcessor& chain);
+
+    /** Recompute host latency, dry delay and A/B alignment after either chain changes. */
+    void handleChainLatencyChanged();
+
     // Oversampling
     std::unique_ptr<juce::dsp::Oversampling<float>> oversampling;
     int oversamplingFactor = 0;   // 0=off, 1=2x, 2=4x
@@ -106,6 +196,15 @@ private:
     juce::String trackName;
     std::unique_ptr<MirrorManager> mirrorManager;
 
+    // Shared real-time worker pool — one per process, like the registry
+    juce::SharedResourcePointer<RealtimeScheduler> realtimeScheduler;
+    std::unique_ptr<RealtimeScheduler::Client> schedulerClient;
+
+    std::unique_ptr<AnalysisPublisher> analysisPublisher;
+
+    // Our input, offered to other instances as a sidechain source (idle until subscribed)
+    std::shared_ptr<AudioTap> audioTap;
+
     /** Collect current chain info and push to registry. */
     void updateRegistryInfo();
 
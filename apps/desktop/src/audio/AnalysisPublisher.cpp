@@ -0,0 +1,93 @@
+#include "AnalysisPublisher.h"
+#include <cmath>
+
+namespace
+{
+    float toDb(float linear)
+    {
+        return linear > 0.0f ? juce::jmax(AnalysisBus::kFloorDb, 20.0f * std::log10(linear))
+                             : AnalysisBus::kFloorDb;
+    }
+}
+
+AnalysisPublisher::AnalysisPublisher(AnalysisBus& b, InstanceId id,
+                                     const AudioMeter& meter, const FFTProcessor& fft)
+    : bus(b), outputMeter(meter), fftProcessor(fft), instanceId(id)
+{
+    slot = bus.attach(instanceId);
+    jassert(slot >= 0);   // More instances than AnalysisBus::kMaxInstances — this one stays off the overview
+
+    viewed = bus.hasViewers();
+    startTimerHz(viewed ? kViewedHz : kUnviewedHz);
+}
+
+AnalysisPublisher::~AnalysisPublisher()
+{
+    stopTimer();
+    bus.detach(slot);
+}
+
+void AnalysisPublisher::timerCallback()
+{
+    publishNow();
+
+    const bool nowViewed = bus.hasViewers();
+    if (nowViewed != viewed)
+    {
+        viewed = nowViewed;
+        startTimerHz(viewed ? kViewedHz : kUnviewedHz);
+    }
+}
+
+void AnalysisPublisher::updateBandBins(double sampleRate)
+{
+    bandSampleRate = sampleRate;
+    const int numBins = fftProcessor.getNumBins();
+    const double binHz = sampleRate / (2.0 * numBins);
+
+    int previous = 1;   // Skip DC
+    for (int b = 0; b <= AnalysisBus::kNumBands; ++b)
+    {
+        const int bin = static_cast<int>(std::lround(AnalysisBus::getBandEdgeHz(b) / binHz));
+        // Low bands are narrower than a bin: give each at least one so none reads empty
+        const int first = b == 0 ? juce::jlimit(1, numBins - 1, bin)
+                                 : juce::jlimit(juce::jmin(previous + 1, numBins), numBins, bin);
+        bandFirstBin[static_cast<size_t>(b)] = first;
+        previous = first;
+    }
+}
+
+void AnalysisPublisher::publishNow()
+{
+    if (slot < 0)
+        return;
+
+    if (fftProcessor.getSampleRate() != bandSampleRate)
+        updateBandBins(fftProcessor.getSampleRate());
+
+    const auto readings = outputMeter.getReadings();
+
+    AnalysisBus::Frame frame;
+    frame.instanceId = instanceId;
+    frame.lufsShort = readings.lufsShort;
+    frame.peakDb = toDb(juce::jmax(readings.peakL, readings.peakR));
+    frame.rmsDb = toDb(juce::jmax(readings.rmsL, readings.rmsR));
+
+    // Band level = loudest bin in the band, averaged over L/R
+    const auto& magL = fftProcessor.getMagnitudesL();
+    const auto& magR = fftProcessor.getMagnitudesR();
+    for (int b = 0; b < AnalysisBus::kNumBands; ++b)
+    {
+        const int first = bandFirstBin[static_cast<size_t>(b)];
+        const int last = juce::jmax(first + 1, bandFirstBin[static_cast<size_t>(b + 1)]);
+
+        float peak = 0.0f;
+        for (int bin = first; bin < last && bin < fftProcessor.getNumBins(); ++bin)
+            peak = juce::jmax(peak, 0.5f * (magL[static_cast<size_t>(bin)] + magR[static_cast<size_t>(bin)]));
+
+        frame.bandsDb[static_cast<size_t>(b)] = toDb(peak);
+    }
+
+    frame.publishedAtMs = juce::Time::getMillisecondCounterHiRes();
+    bus.publish(slot, frame);
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <juce_events/juce_events.h>
+#include "../core/AnalysisBus.h"
+#include "AudioMeter.h"
+#include "FFTProcessor.h"
+#include <array>
+
+/**
+ * AnalysisPublisher - Feeds one instance's slot on the session AnalysisBus
+ *
+ * Reads the output meter and the spectrum analyser (both already thread-safe for UI
+ * access), reduces the 1024 FFT bins to AnalysisBus::kNumBands log-spaced bands and
+ * publishes the frame. Runs on the message thread at kViewedHz while any editor shows
+ * the session overview, kUnviewedHz otherwise — so the overview has data the moment it
+ * opens, without a hundred instances ticking at display rate in the background.
+ */
+class AnalysisPublisher : private juce::Timer
+{
+public:
+    static constexpr int kViewedHz = 30;
+    static constexpr int kUnviewedHz = 2;
+
+    AnalysisPublisher(AnalysisBus& bus, InstanceId instanceId,
+                      const AudioMeter& outputMeter, const FFTProcessor& fftProcessor);
+    ~AnalysisPublisher() override;
+
+    /** Build and publish a frame immediately (also called by the timer). */
+    void publishNow();
+
+private:
+    void timerCallback() override;
+    void updateBandBins(double sampleRate);
+
+    AnalysisBus& bus;
+    const AudioMeter& outputMeter;
+    const FFTProcessor& fftProcessor;
+    int slot = -1;
+    InstanceId instanceId;
+
+    bool viewed = false;
+    double bandSampleRate = 0.0;
+    std::array<int, AnalysisBus::kNumBands + 1> bandFirstBin {};   // Band b covers [first[b], first[b+1])
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AnalysisPublisher)
+};
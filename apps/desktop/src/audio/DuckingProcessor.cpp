@@ -63,6 +63,13 @@ void DuckingProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::Midi
     const float* scL = buffer.getReadPointer(2);
     const float* scR = buffer.getReadPointer(3);
 
+    if (auto* key = keyBuffer.load(std::memory_order_acquire);
+        key != nullptr && key->getNumChannels() >= 2 && key->getNumSamples() >= numSamples)
+    {
+        scL = key->getReadPointer(0);
+        scR = key->getReadPointer(1);
+    }
+
     float* outL = buffer.getWritePointer(0);
     float* outR = buffer.getWritePointer(1);
 
@@ -10,6 +10,9 @@
  * Channels 0-1: group audio signal (to be ducked)
  * Channels 2-3: sidechain reference (pre-group main chain signal)
  *
+ * setKeyBuffer() replaces channels 2-3 as the reference with an external buffer — another
+ * instance's AudioTap, filled by ChainProcessor before each block.
+ *
  * An envelope follower tracks the sidechain level and attenuates the output:
  *   outputGain = 1.0 - (envelopeLevel * duckAmount)
  *
@@ -28,6 +31,9 @@ public:
     void setReleaseMs(float ms);
     float getReleaseMs() const { return releaseMs.load(std::memory_order_relaxed); }
 
+    /** External key (not owned, must outlive this processor); nullptr = channels 2-3. */
+    void setKeyBuffer(juce::AudioBuffer<float>* buf) { keyBuffer.store(buf, std::memory_order_release); }
+
     // AudioProcessor overrides
     const juce::String getName() const override { return "Ducking"; }
     void prepareToPlay(double sampleRate, int samplesPerBlock) override;
@@ -53,6 +59,7 @@ public:
 private:
     std::atomic<float> duckAmount{0.0f};   // 0.0 = no ducking, 1.0 = full ducking
     std::atomic<float> releaseMs{200.0f};  // Envelope release time in ms
+    std::atomic<juce::AudioBuffer<float>*> keyBuffer{nullptr};
 
     // Envelope follower state (audio thread only)
     float envelopeLevel = 0.0f;
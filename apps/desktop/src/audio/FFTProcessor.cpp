@@ -1,6 +1,8 @@
 #include "FFTProcessor.h"
 #include "FastMath.h"
+#include <algorithm>
 #include <cmath>
+#include <thread>
 
 FFTProcessor::FFTProcessor()
     : forwardFFT(fftOrder),
@@ -8,6 +10,8 @@ FFTProcessor::FFTProcessor()
 {
     fifoL.fill(0.0f);
     fifoR.fill(0.0f);
+    snapshotL.fill(0.0f);
+    snapshotR.fill(0.0f);
     fftWorkBuffer.fill(0.0f);
     magnitudeLBufferA.fill(0.0f);
     magnitudeLBufferB.fill(0.0f);
@@ -22,8 +26,22 @@ void FFTProcessor::prepareToPlay(double sampleRate, int /*samplesPerBlock*/)
     reset();
 }
 
+void FFTProcessor::setScheduler(RealtimeScheduler::Client* client)
+{
+    waitForJob();
+    scheduler = client;
+}
+
+void FFTProcessor::waitForJob()
+{
+    while (jobBusy.load(std::memory_order_acquire))
+        std::this_thread::yield();
+}
+
 void FFTProcessor::reset()
 {
+    waitForJob();
+
     writePosL = 0;
     writePosR = 0;
     samplesInFifo = 0;
@@ -106,18 +124,45 @@ void FFTProcessor::process(const juce::AudioBuffer<float>& buffer)
 
         if (samplesInFifo >= fftSize)
         {
-            // Compute FFT for L channel
-            computeFFT(fifoL, writePosL, magnitudeLBufferA, magnitudeLBufferB, activeReadBufferL);
-
-            // Compute FFT for R channel (reuses fftWorkBuffer — sequential, not concurrent)
-            computeFFT(fifoR, writePosR, magnitudeRBufferA, magnitudeRBufferB, activeReadBufferR);
-
-            newDataReady.store(true, std::memory_order_release);
             samplesInFifo = 0;
+
+            // Previous frame still computing: drop this one
+            if (jobBusy.load(std::memory_order_acquire))
+                continue;
+
+            // Snapshot in time order so the job never touches the live FIFOs
+            const int tailL = fftSize - writePosL;
+            std::copy(fifoL.begin() + writePosL, fifoL.end(), snapshotL.begin());
+            std::copy(fifoL.begin(), fifoL.begin() + writePosL, snapshotL.begin() + tailL);
+            const int tailR = fftSize - writePosR;
+            std::copy(fifoR.begin() + writePosR, fifoR.end(), snapshotR.begin());
+            std::copy(fifoR.begin(), fifoR.begin() + writePosR, snapshotR.begin() + tailR);
+
+            jobBusy.store(true, std::memory_order_release);
+            if (scheduler == nullptr || !scheduler->submit(&FFTProcessor::computeSnapshotJob, this))
+                computeSnapshotJob(this);
         }
     }
 }
 
+void FFTProcessor::computeSnapshot()
+{
+    // Snapshots are already in time order, so they read from position 0
+    computeFFT(snapshotL, 0, magnitudeLBufferA, magnitudeLBufferB, activeReadBufferL);
+
+    // R reuses fftWorkBuffer — sequential, not concurrent
+    computeFFT(snapshotR, 0, magnitudeRBufferA, magnitudeRBufferB, activeReadBufferR);
+
+    newDataReady.store(true, std::memory_order_release);
+}
+
+void FFTProcessor::computeSnapshotJob(void* context)
+{
+    auto* self = static_cast<FFTProcessor*>(context);
+    self->computeSnapshot();
+    self->jobBusy.store(false, std::memory_order_release);
+}
+
 const std::array<float, FFTProcessor::numBins>& FFTProcessor::getMagnitudesL() const
 {
     int readBuf = activeReadBufferL.load(std::memory_order_acquire);
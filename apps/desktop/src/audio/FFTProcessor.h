@@ -2,6 +2,7 @@
 
 #include <juce_audio_basics/juce_audio_basics.h>
 #include <juce_dsp/juce_dsp.h>
+#include "../core/RealtimeScheduler.h"
 #include <atomic>
 #include <array>
 #include <vector>
@@ -13,6 +14,10 @@
  * is applied and the FFT is computed per channel. Results are stored in double-buffers
  * with atomic swap flags so the UI thread can read stable magnitude data without locking.
  *
+ * With a scheduler client set, the transforms run as a job on the shared real-time pool:
+ * the audio thread only snapshots the FIFOs. A frame that arrives while the previous
+ * job is still running is skipped — it's a display, not a measurement.
+ *
  * Thread safety:
  * - process() is called from the audio thread only
  * - getMagnitudesL/R() are safe to call from any thread (UI timer callback)
@@ -31,6 +36,10 @@ public:
     void prepareToPlay(double sampleRate, int samplesPerBlock);
     void reset();
 
+    /** Offload the transforms to the shared pool (nullptr = compute inline). Message thread,
+        while audio is stopped or before the first block; waits for a job in flight. */
+    void setScheduler(RealtimeScheduler::Client* client);
+
     /** Call from audio thread. Processes L and R channels independently for stereo FFT. */
     void process(const juce::AudioBuffer<float>& buffer);
 
@@ -64,6 +73,13 @@ private:
                     std::array<float, numBins>& targetBufferB,
                     std::atomic<int>& activeRead);
 
+    /** Both channels from the snapshots — the scheduler job, or inline. */
+    void computeSnapshot();
+    static void computeSnapshotJob(void* context);
+
+    /** Spin until a submitted job has finished (message thread only). */
+    void waitForJob();
+
     juce::dsp::FFT forwardFFT;
     juce::dsp::WindowingFunction<float> windowFunction;
 
@@ -74,6 +90,12 @@ private:
     int writePosR = 0;
     int samplesInFifo = 0;  // Shared counter (L and R advance together)
 
+    // Ordered copies of the FIFOs taken when a frame completes; owned by the job while jobBusy
+    std::array<float, fftSize> snapshotL;
+    std::array<float, fftSize> snapshotR;
+    RealtimeScheduler::Client* scheduler = nullptr;
+    std::atomic<bool> jobBusy{false};
+
     // FFT working buffer (2x size for real-only forward transform)
     std::array<float, fftSize * 2> fftWorkBuffer;
 
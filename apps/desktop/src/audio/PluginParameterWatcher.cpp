@@ -1,39 +1,19 @@
 #include "PluginParameterWatcher.h"
+#include <utility>
 
 PluginParameterWatcher::PluginParameterWatcher(
+    ParameterMirror& m,
     std::function<void(const juce::String& beforeSnapshotBase64)> onSettled)
-    : settledCallback(std::move(onSettled))
+    : mirror(m), settledCallback(std::move(onSettled))
 {
+    mirror.addListener(this);
     startTimer(kTimerIntervalMs);
 }
 
 PluginParameterWatcher::~PluginParameterWatcher()
 {
     stopTimer();
-    clearWatches();
-}
-
-void PluginParameterWatcher::watchProcessor(juce::AudioProcessor* processor)
-{
-    if (processor == nullptr) return;
-
-    for (auto* param : processor->getParameters())
-    {
-        param->addListener(this);
-        watchedParams.push_back({processor, param});
-    }
-}
-
-void PluginParameterWatcher::clearWatches()
-{
-    for (auto& [proc, param] : watchedParams)
-        param->removeListener(this);
-    watchedParams.clear();
-
-    // Reset state
-    changeDetected.store(false, std::memory_order_relaxed);
-    activeGestureCount.store(0, std::memory_order_relaxed);
-    waitingForSettle = false;
+    mirror.removeListener(this);
 }
 
 void PluginParameterWatcher::updateStableSnapshot(const juce::String& base64Snapshot)
@@ -42,7 +22,7 @@ void PluginParameterWatcher::updateStableSnapshot(const juce::String& base64Snap
     lastStableSnapshot = base64Snapshot;
 
     // Reset detection state since we have a new baseline
-    changeDetected.store(false, std::memory_order_relaxed);
+    changeDetected = false;
     waitingForSettle = false;
 }
 
@@ -53,25 +33,22 @@ void PluginParameterWatcher::setSuppressed(bool value)
     if (value)
     {
         // When suppressing, reset any pending detection
-        changeDetected.store(false, std::memory_order_relaxed);
+        changeDetected = false;
         waitingForSettle = false;
     }
 }
 
-// Called on the audio thread — must be lock-free
-void PluginParameterWatcher::parameterValueChanged(int /*parameterIndex*/, float /*newValue*/)
+void PluginParameterWatcher::parameterMirrorChanged(const ParameterMirror&, const std::vector<uint32_t>&)
 {
     if (!suppressed.load(std::memory_order_relaxed))
-        changeDetected.store(true, std::memory_order_relaxed);
+        changeDetected = true;
 }
 
-// Called on the audio thread for host-reported gestures
-void PluginParameterWatcher::parameterGestureChanged(int /*parameterIndex*/, bool gestureIsStarting)
+void PluginParameterWatcher::parameterMirrorRebuilt(const ParameterMirror&)
 {
-    if (gestureIsStarting)
-        activeGestureCount.fetch_add(1, std::memory_order_relaxed);
-    else
-        activeGestureCount.fetch_sub(1, std::memory_order_relaxed);
+    // New plugin set — pending changes belong to the old one
+    changeDetected = false;
+    waitingForSettle = false;
 }
 
 // Called on the message thread every 100ms
@@ -80,8 +57,8 @@ void PluginParameterWatcher::timerCallback()
     if (suppressed.load(std::memory_order_relaxed))
         return;
 
-    const bool changed = changeDetected.exchange(false, std::memory_order_relaxed);
-    const int gestures = activeGestureCount.load(std::memory_order_relaxed);
+    const bool changed = std::exchange(changeDetected, false);
+    const int gestures = mirror.getActiveGestureCount();
 
     if (changed)
     {
@@ -0,0 +1,58 @@
+#include "MacroParameter.h"
+#include <cmath>
+
+float MacroTarget::evaluate(float macroValue) const
+{
+    float x = juce::jlimit(0.0f, 1.0f, macroValue);
+
+    switch (curve)
+    {
+        case MacroCurve::Linear:  break;
+        case MacroCurve::Log:     x = std::log10(1.0f + 9.0f * x); break;
+        case MacroCurve::SCurve:  x = x * x * (3.0f - 2.0f * x); break;
+        case MacroCurve::Stepped:
+        {
+            const auto n = static_cast<float>(juce::jmax(2, steps));
+            x = juce::jmin(std::floor(x * n), n - 1.0f) / (n - 1.0f);
+            break;
+        }
+    }
+
+    return rangeStart + (rangeEnd - rangeStart) * x;
+}
+
+MacroParameter::MacroParameter(int macroIndex)
+    : AudioProcessorParameterWithID("macro" + juce::String(macroIndex + 1),
+                                     "Macro " + juce::String(macroIndex + 1)),
+      index(macroIndex)
+{
+}
+
+void MacroParameter::setDisplayName(const juce::String& name)
+{
+    const juce::SpinLock::ScopedLockType lock(displayNameLock);
+    displayName = name;
+}
+
+juce::String MacroParameter::getName(int maximumStringLength) const
+{
+    juce::String name;
+    {
+        const juce::SpinLock::ScopedLockType lock(displayNameLock);
+        name = displayName;
+    }
+
+    if (name.isEmpty())
+        name = "Macro " + juce::String(index + 1);
+    return name.substring(0, maximumStringLength);
+}
+
+juce::String MacroParameter::getText(float normalisedValue, int maximumStringLength) const
+{
+    return juce::String(juce::roundToInt(normalisedValue * 100.0f)).substring(0, maximumStringLength);
+}
+
+float MacroParameter::getValueForText(const juce::String& text) const
+{
+    return juce::jlimit(0.0f, 1.0f, text.getFloatValue() / 100.0f);
+}
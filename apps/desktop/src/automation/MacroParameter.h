@@ -0,0 +1,58 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include "../core/ChainNode.h"
+#include <atomic>
+
+enum class MacroCurve
+{
+    Linear = 0,
+    Log,        // Fast rise: log10(1 + 9x)
+    SCurve,     // Smoothstep: 3x^2 - 2x^3
+    Stepped     // Quantised to `steps` evenly spaced values
+};
+
+// One child parameter driven by a macro. The macro value (0-1) is shaped by the curve,
+// then mapped to rangeStart..rangeEnd (normalized child values; start > end inverts).
+struct MacroTarget
+{
+    ChainNodeId nodeId = -1;
+    int paramIndex = -1;
+    juce::String paramId;
+    juce::String paramName;
+    float rangeStart = 0.0f;
+    float rangeEnd = 1.0f;
+    MacroCurve curve = MacroCurve::Linear;
+    int steps = 4;              // Stepped only (>= 2)
+
+    float evaluate(float macroValue) const;   // Scalar reference for the batched pass
+};
+
+/**
+ * Host-facing macro knob. Holds its own value; ParameterProxyPool pushes it to the
+ * mapped child parameters once per block.
+ */
+class MacroParameter : public juce::AudioProcessorParameterWithID
+{
+public:
+    explicit MacroParameter(int macroIndex);
+
+    void setDisplayName(const juce::String& name);
+
+    float getValue() const override { return value.load(std::memory_order_relaxed); }
+    void setValue(float newValue) override { value.store(juce::jlimit(0.0f, 1.0f, newValue), std::memory_order_relaxed); }
+    float getDefaultValue() const override { return 0.0f; }
+    juce::String getName(int maximumStringLength) const override;
+    juce::String getLabel() const override { return "%"; }
+    juce::String getText(float normalisedValue, int maximumStringLength) const override;
+    float getValueForText(const juce::String& text) const override;
+
+private:
+    std::atomic<float> value { 0.0f };
+    int index;
+
+    juce::String displayName;
+    mutable juce::SpinLock displayNameLock;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MacroParameter)
+};
@@ -1,109 +1,900 @@
 #include "ParameterProxyPool.h"
 #include "ProxyParameter.h"
 #include "../core/ChainProcessor.h"
-#include "../audio/PluginWithMeterWrapper.h"
+#include "../utils/PlatformPaths.h"
 #include "../utils/ProChainLogger.h"
+#include <algorithm>
+#include <cmath>
+
+//==============================================================================
+// Learn: one listener per child parameter while learning. Holds the graph node
+// so the plugin (and its parameters) outlive the listener even if removed mid-learn.
+class ParameterProxyPool::LearnListener : public juce::AudioProcessorParameter::Listener
+{
+public:
+    LearnListener(ParameterProxyPool& p, juce::AudioProcessorGraph::Node::Ptr n,
+                  juce::AudioProcessorParameter* param, ChainNodeId id, int index)
+        : pool(p), node(std::move(n)), parameter(param), nodeId(id), paramIndex(index)
+    {
+        parameter->addListener(this);
+    }
+
+    ~LearnListener() override
+    {
+        parameter->removeListener(this);
+    }
+
+    // Values also move from automation, presets, mirroring and the plugin's own modulation;
+    // only a gesture (someone grabbing the control in the plugin's editor) means "this one".
+    void parameterValueChanged(int, float) override {}
+
+    void parameterGestureChanged(int, bool gestureIsStarting) override
+    {
+        if (gestureIsStarting)
+            pool.learnTriggered(nodeId, paramIndex);
+    }
+
+private:
+    ParameterProxyPool& pool;
+    juce::AudioProcessorGraph::Node::Ptr node;
+    juce::AudioProcessorParameter* parameter;
+    ChainNodeId nodeId;
+    int paramIndex;
+};
+
+//==============================================================================
+
+static juce::File getAutomationSettingsFile()
+{
+    return PlatformPaths::getPluginCacheDirectory().getChildFile("automation-settings.json");
+}
+
+ParameterProxyPool::Settings ParameterProxyPool::loadSettings()
+{
+    return loadSettings(getAutomationSettingsFile());
+}
+
+ParameterProxyPool::Settings ParameterProxyPool::loadSettings(const juce::File& file)
+{
+    // The layout is the build's, never the file's: it decides every parameter ID
+    Settings settings;
+    if (!file.existsAsFile())
+        return settings;
+
+    auto parsed = juce::JSON::parse(file.loadFileAsString());
+    if (parsed.isVoid())
+        return settings;
+
+    settings.hostParameterCount = juce::jlimit(kMinHostParameters, kMaxHostParameters,
+                                               static_cast<int>(parsed.getProperty("hostParameterCount", kDefaultHostParameters)));
+    return settings;
+}
+
+void ParameterProxyPool::saveSettings(const Settings& settings)
+{
+    saveSettings(settings, getAutomationSettingsFile());
+}
+
+void ParameterProxyPool::saveSettings(const Settings& settings, const juce::File& file)
+{
+    file.getParentDirectory().createDirectory();
+
+    auto* obj = new juce::DynamicObject();
+    obj->setProperty("hostParameterCount", juce::jlimit(kMinHostParameters, kMaxHostParameters, settings.hostParameterCount));
+    file.replaceWithText(juce::JSON::toString(juce::var(obj)));
+}
+
+ParameterProxyPool::ParameterProxyPool() = default;
+
+ParameterProxyPool::~ParameterProxyPool()
+{
+    aliveFlag->store(false, std::memory_order_release);
+    learnListeners.clear();
+
+    // Proxies outlive the pool (the host processor owns them) — detach them while the
+    // bound plugins are still held alive by slots/mappingNodes
+    for (auto* proxy : proxies)
+        proxy->unbind();
+
+    const juce::SpinLock::ScopedLockType lock(macroProgramLock);
+    macroProgram.reset();
+}
 
 void ParameterProxyPool::createAndRegister(juce::AudioProcessor& processor)
 {
-    proxies.reserve(static_cast<size_t>(kMaxSlots * kMaxParamsPerSlot));
+    createAndRegister(processor, loadSettings());
+}
+
+void ParameterProxyPool::createAndRegister(juce::AudioProcessor& processor, const Settings& settings)
+{
+    hostProcessor = &processor;
+    legacyLayout = settings.legacySlotLayout;
+
+    if (legacyLayout)
+    {
+        proxies.reserve(static_cast<size_t>(kMaxSlots * kMaxParamsPerSlot));
 
-    for (int slot = 0; slot < kMaxSlots; ++slot)
+        for (int slot = 0; slot < kMaxSlots; ++slot)
+        {
+            for (int param = 0; param < kMaxParamsPerSlot; ++param)
+            {
+                auto proxy = std::make_unique<ProxyParameter>(slot, param);
+                proxies.push_back(proxy.get());
+                processor.addParameter(proxy.release()); // processor takes ownership
+            }
+        }
+    }
+    else
     {
-        for (int param = 0; param < kMaxParamsPerSlot; ++param)
+        auto count = juce::jlimit(kMinHostParameters, kMaxHostParameters, settings.hostParameterCount);
+        proxies.reserve(static_cast<size_t>(count));
+        mappings.resize(static_cast<size_t>(count));
+        mappingNodes.resize(static_cast<size_t>(count));
+
+        for (int i = 0; i < count; ++i)
         {
-            auto proxy = std::make_unique<ProxyParameter>(slot, param);
+            auto proxy = std::make_unique<ProxyParameter>(i);
             proxies.push_back(proxy.get());
             processor.addParameter(proxy.release()); // processor takes ownership
         }
     }
+
+    // Macros come last so existing proxy indices never shift
+    for (int i = 0; i < kNumMacros; ++i)
+    {
+        auto macro = std::make_unique<MacroParameter>(i);
+        macroParams.push_back(macro.get());
+        processor.addParameter(macro.release()); // processor takes ownership
+    }
 }
 
-void ParameterProxyPool::bindSlot(int slotIndex, juce::AudioProcessor* childProcessor)
+bool ParameterProxyPool::bindProxy(size_t proxyIndex, juce::AudioProcessorParameter* target)
 {
-    if (slotIndex < 0 || slotIndex >= kMaxSlots)
-        return;
+    auto* proxy = proxies[proxyIndex];
+    if (proxy->isBoundTo(target))
+        return false;
+
+    if (target != nullptr)
+        proxy->bind(target);
+    else
+        proxy->unbind();
+    return true;
+}
 
-    int baseIndex = slotIndex * kMaxParamsPerSlot;
+int ParameterProxyPool::bindSlot(int slotIndex, juce::AudioProcessor* childProcessor)
+{
+    const auto baseIndex = static_cast<size_t>(slotIndex * kMaxParamsPerSlot);
+    const int numChildParams = childProcessor != nullptr
+        ? juce::jmin(childProcessor->getParameters().size(), kMaxParamsPerSlot) : 0;
 
-    // Unbind all proxies for this slot first
+    int changes = 0;
     for (int i = 0; i < kMaxParamsPerSlot; ++i)
-        proxies[static_cast<size_t>(baseIndex + i)]->unbind();
+    {
+        auto* target = i < numChildParams ? childProcessor->getParameters()[i] : nullptr;
+        if (bindProxy(baseIndex + static_cast<size_t>(i), target))
+            ++changes;
+    }
+    return changes;
+}
 
-    if (childProcessor == nullptr)
-        return;
+juce::AudioProcessorGraph::Node::Ptr ParameterProxyPool::findGraphNode(ChainProcessor& chain, ChainNodeId nodeId)
+{
+    auto* node = ChainNodeHelpers::findById(chain.getRootNode(), nodeId);
+    if (node == nullptr || !node->isPlugin())
+        return nullptr;
+    return chain.getNodeForId(node->getPlugin().graphNodeId);
+}
+
+void ParameterProxyPool::rebindAll(ChainProcessor& chain)
+{
+    // Any structural change ends a pending learn — the listener set is stale
+    cancelLearn();
+
+    lastRebindChanges = 0;
+    if (legacyLayout)
+        rebindSlots(chain);
+    else
+        rebindMappings(chain);
+
+    compileMacros(chain);
+
+    if (lastRebindChanges > 0)
+        notifyHostOfNameChanges();
+}
+
+void ParameterProxyPool::rebindSlots(ChainProcessor& chain)
+{
+    auto nodeIds = chain.getFlatPluginNodeIds();
+
+    // Release slots whose plugin left the chain, refresh slots whose node now holds
+    // a different processor (plugin replaced in place)
+    for (int s = 0; s < kMaxSlots; ++s)
+    {
+        auto& slot = slots[static_cast<size_t>(s)];
+        if (slot.nodeId < 0)
+            continue;
+
+        if (std::find(nodeIds.begin(), nodeIds.end(), slot.nodeId) == nodeIds.end())
+        {
+            lastRebindChanges += bindSlot(s, nullptr);
+            slot = SlotBinding();
+            continue;
+        }
+
+        auto* processor = chain.getNodeProcessor(slot.nodeId);
+        if (processor != slot.processor)
+        {
+            lastRebindChanges += bindSlot(s, processor);
+            slot.processor = processor;
+            slot.keepAlive = findGraphNode(chain, slot.nodeId);
+        }
+    }
+
+    // New plugins take the lowest free slot, in chain order
+    int unassigned = 0;
+    for (auto nodeId : nodeIds)
+    {
+        auto isAssigned = std::any_of(slots.begin(), slots.end(),
+                                      [nodeId](const SlotBinding& b) { return b.nodeId == nodeId; });
+        if (isAssigned)
+            continue;
 
-    auto& childParams = childProcessor->getParameters();
-    int numChildParams = juce::jmin(childParams.size(), kMaxParamsPerSlot);
+        auto freeSlot = std::find_if(slots.begin(), slots.end(),
+                                     [](const SlotBinding& b) { return b.nodeId < 0; });
+        if (freeSlot == slots.end())
+        {
+            ++unassigned;
+            continue;
+        }
 
-    for (int i = 0; i < numChildParams; ++i)
-        proxies[static_cast<size_t>(baseIndex + i)]->bind(childParams[i]);
+        auto s = static_cast<int>(std::distance(slots.begin(), freeSlot));
+        freeSlot->nodeId = nodeId;
+        freeSlot->processor = chain.getNodeProcessor(nodeId);
+        freeSlot->keepAlive = findGraphNode(chain, nodeId);
+        lastRebindChanges += bindSlot(s, freeSlot->processor);
+    }
+
+    if (unassigned > 0)
+    {
+        PCLOG("WARNING: chain has " + juce::String(static_cast<int>(nodeIds.size()))
+              + " plugins but only " + juce::String(kMaxSlots)
+              + " automation slots — " + juce::String(unassigned) + " plugin(s) will not be automatable");
+    }
 }
 
-void ParameterProxyPool::unbindSlot(int slotIndex)
+void ParameterProxyPool::rebindMappings(ChainProcessor& chain)
 {
-    bindSlot(slotIndex, nullptr);
+    for (size_t i = 0; i < mappings.size(); ++i)
+    {
+        auto& mapping = mappings[i];
+        auto* target = mapping.isFree() ? nullptr : resolve(chain, mapping);
+
+        if (proxies[i]->isBoundTo(target))
+            continue;
+
+        if (target != nullptr)
+        {
+            proxies[i]->setDisplayPrefix(mapping.pluginName);
+            mappingNodes[i] = findGraphNode(chain, mapping.nodeId);
+        }
+
+        bindProxy(i, target);
+        if (target == nullptr)
+            mappingNodes[i] = nullptr;
+        ++lastRebindChanges;
+    }
 }
 
-void ParameterProxyPool::rebindAll(ChainProcessor& chain)
+//==============================================================================
+// Dynamic mapping
+//==============================================================================
+
+juce::String ParameterProxyPool::getChildParameterId(juce::AudioProcessorParameter* param)
 {
-    PCLOG("rebindAll — starting");
+    if (auto* hosted = dynamic_cast<juce::HostedAudioProcessorParameter*>(param))
+        return hosted->getParameterID();
+    if (auto* withId = dynamic_cast<juce::AudioProcessorParameterWithID*>(param))
+        return withId->paramID;
+    return {};
+}
 
-    // Use DFS-flattened plugin list from tree model
-    auto plugins = chain.getFlatPluginList();
-    int numPlugins = static_cast<int>(plugins.size());
+juce::AudioProcessorParameter* ParameterProxyPool::resolve(ChainProcessor& chain, const Mapping& mapping) const
+{
+    return resolve(chain, mapping.nodeId, mapping.paramId, mapping.paramIndex);
+}
 
-    if (numPlugins > kMaxSlots)
+juce::AudioProcessorParameter* ParameterProxyPool::resolve(ChainProcessor& chain, ChainNodeId nodeId,
+                                                           const juce::String& paramId, int paramIndex) const
+{
+    auto* processor = chain.getNodeProcessor(nodeId);
+    if (processor == nullptr)
+        return nullptr;
+
+    const auto& params = processor->getParameters();
+
+    // Parameter ID first — survives plugin updates that reorder parameters
+    if (paramId.isNotEmpty())
     {
-        PCLOG("WARNING: chain has " + juce::String(numPlugins)
-              + " plugins but only " + juce::String(kMaxSlots)
-              + " automation slots — plugins beyond slot "
-              + juce::String(kMaxSlots - 1) + " will not be automatable");
+        if (juce::isPositiveAndBelow(paramIndex, params.size())
+            && getChildParameterId(params[paramIndex]) == paramId)
+            return params[paramIndex];
+
+        for (auto* param : params)
+            if (getChildParameterId(param) == paramId)
+                return param;
     }
 
-    int previousMax = maxBoundSlot;
-    int newMax = 0;
+    return juce::isPositiveAndBelow(paramIndex, params.size()) ? params[paramIndex] : nullptr;
+}
+
+int ParameterProxyPool::assign(ChainProcessor& chain, ChainNodeId nodeId, int paramIndex, int hostIndex)
+{
+    jassert(juce::MessageManager::getInstance()->isThisTheMessageThread());
+
+    if (legacyLayout)
+        return -1;
 
-    for (int i = 0; i < juce::jmin(numPlugins, kMaxSlots); ++i)
+    auto* processor = chain.getNodeProcessor(nodeId);
+    if (processor == nullptr || !juce::isPositiveAndBelow(paramIndex, processor->getParameters().size()))
+        return -1;
+
+    // Already mapped: move it rather than mapping the same parameter twice
+    auto existing = findHostIndex(nodeId, paramIndex);
+    if (existing >= 0 && hostIndex < 0)
+        hostIndex = existing;
+    else if (existing >= 0 && existing != hostIndex)
+        unassign(existing);
+
+    if (hostIndex < 0)
     {
-        auto& leaf = *plugins[static_cast<size_t>(i)];
-        if (auto node = chain.getNodeForId(leaf.graphNodeId))
+        for (size_t i = 0; i < mappings.size(); ++i)
         {
-            juce::AudioProcessor* processor = nullptr;
-            if (auto* wrapper = dynamic_cast<PluginWithMeterWrapper*>(node->getProcessor()))
+            if (mappings[i].isFree())
             {
-                processor = wrapper->getWrappedPlugin();
-            }
-            else
-            {
-                processor = node->getProcessor();
+                hostIndex = static_cast<int>(i);
+                break;
             }
+        }
+    }
 
-            if (processor == nullptr)
-            {
-                PCLOG("WARNING: rebindAll slot " + juce::String(i)
-                      + " — processor is null for " + leaf.description.name);
-            }
+    if (!juce::isPositiveAndBelow(hostIndex, static_cast<int>(mappings.size())))
+        return -1;
+
+    auto* param = processor->getParameters()[paramIndex];
+    auto* node = ChainNodeHelpers::findById(chain.getRootNode(), nodeId);
+
+    Mapping mapping;
+    mapping.nodeId = nodeId;
+    mapping.paramIndex = paramIndex;
+    mapping.paramId = getChildParameterId(param);
+    mapping.paramName = param->getName(64);
+    mapping.pluginName = node != nullptr && node->isPlugin() ? node->getPlugin().description.name : juce::String();
+    mappings[static_cast<size_t>(hostIndex)] = mapping;
+
+    proxies[static_cast<size_t>(hostIndex)]->setDisplayPrefix(mapping.pluginName);
+    bindProxy(static_cast<size_t>(hostIndex), param);
+    mappingNodes[static_cast<size_t>(hostIndex)] = findGraphNode(chain, nodeId);
+    notifyHostOfNameChanges();
+
+    return hostIndex;
+}
+
+void ParameterProxyPool::unassign(int hostIndex)
+{
+    if (legacyLayout || !juce::isPositiveAndBelow(hostIndex, static_cast<int>(mappings.size())))
+        return;
+
+    mappings[static_cast<size_t>(hostIndex)] = Mapping();
+    bindProxy(static_cast<size_t>(hostIndex), nullptr);
+    mappingNodes[static_cast<size_t>(hostIndex)] = nullptr;
+    notifyHostOfNameChanges();
+}
+
+void ParameterProxyPool::clearMappings()
+{
+    for (size_t i = 0; i < mappings.size(); ++i)
+    {
+        mappings[i] = Mapping();
+        bindProxy(i, nullptr);
+        mappingNodes[i] = nullptr;
+    }
+
+    overflowMappings.clear();
+
+    if (legacyLayout)
+    {
+        for (int s = 0; s < kMaxSlots; ++s)
+            bindSlot(s, nullptr);
+        slots.fill(SlotBinding());
+    }
+
+    for (int m = 0; m < kNumMacros; ++m)
+    {
+        macroDefs[static_cast<size_t>(m)] = Macro();
+        if (m < static_cast<int>(macroParams.size()))
+            macroParams[static_cast<size_t>(m)]->setDisplayName({});
+    }
+
+    std::unique_ptr<MacroProgram> old;
+    {
+        const juce::SpinLock::ScopedLockType lock(macroProgramLock);
+        old = std::move(macroProgram);
+    }
+}
+
+int ParameterProxyPool::findHostIndex(ChainNodeId nodeId, int paramIndex) const
+{
+    for (size_t i = 0; i < mappings.size(); ++i)
+        if (mappings[i].nodeId == nodeId && mappings[i].paramIndex == paramIndex)
+            return static_cast<int>(i);
+    return -1;
+}
 
-            bindSlot(i, processor);
-            newMax = i + 1;
+bool ParameterProxyPool::startLearn(ChainProcessor& chain, int hostIndex)
+{
+    jassert(juce::MessageManager::getInstance()->isThisTheMessageThread());
+
+    cancelLearn();
+    if (legacyLayout)
+        return false;
+
+    auto nodeIds = chain.getFlatPluginNodeIds();
+    auto plugins = chain.getFlatPluginList();
+
+    for (size_t i = 0; i < plugins.size() && i < nodeIds.size(); ++i)
+    {
+        auto node = chain.getNodeForId(plugins[i]->graphNodeId);
+        auto* processor = chain.getNodeProcessor(nodeIds[i]);
+        if (node == nullptr || processor == nullptr)
+            continue;
+
+        const auto& params = processor->getParameters();
+        for (int p = 0; p < params.size(); ++p)
+            learnListeners.push_back(std::make_unique<LearnListener>(*this, node, params[p], nodeIds[i], p));
+    }
+
+    learnChain = &chain;
+    learnHostIndex = hostIndex;
+    learnFired.store(false, std::memory_order_release);
+    return !learnListeners.empty();
+}
+
+void ParameterProxyPool::cancelLearn()
+{
+    learnListeners.clear();
+    learnChain = nullptr;
+    learnHostIndex = -1;
+}
+
+void ParameterProxyPool::learnTriggered(ChainNodeId nodeId, int paramIndex)
+{
+    // Any thread (parameter listeners) — only the first touch counts
+    if (learnFired.exchange(true, std::memory_order_acq_rel))
+        return;
+
+    auto alive = aliveFlag;
+    juce::MessageManager::callAsync([this, alive, nodeId, paramIndex]() {
+        if (!alive->load(std::memory_order_acquire) || learnChain == nullptr)
+            return;
+
+        auto* chain = learnChain;
+        auto hostIndex = learnHostIndex;
+        cancelLearn();
+
+        auto assigned = assign(*chain, nodeId, paramIndex, hostIndex);
+        if (assigned >= 0 && onLearned)
+            onLearned(assigned);
+    });
+}
+
+void ParameterProxyPool::notifyHostOfNameChanges()
+{
+    if (hostProcessor != nullptr)
+        hostProcessor->updateHostDisplay(juce::AudioProcessor::ChangeDetails().withParameterInfoChanged(true));
+}
+
+juce::var ParameterProxyPool::getMappingsAsJson() const
+{
+    juce::Array<juce::var> arr;
+    for (size_t i = 0; i < mappings.size(); ++i)
+    {
+        const auto& m = mappings[i];
+        if (m.isFree())
+            continue;
+
+        auto* obj = new juce::DynamicObject();
+        obj->setProperty("hostIndex", static_cast<int>(i));
+        obj->setProperty("nodeId", m.nodeId);
+        obj->setProperty("paramIndex", m.paramIndex);
+        obj->setProperty("paramName", m.paramName);
+        obj->setProperty("pluginName", m.pluginName);
+        obj->setProperty("bound", !proxies[i]->isBoundTo(nullptr));
+        arr.add(juce::var(obj));
+    }
+
+    auto* result = new juce::DynamicObject();
+    result->setProperty("legacyLayout", legacyLayout);
+    result->setProperty("numHostParameters", getNumHostParameters());
+    result->setProperty("learning", isLearning());
+    result->setProperty("mappings", arr);
+    return juce::var(result);
+}
+
+std::unique_ptr<juce::XmlElement> ParameterProxyPool::mappingsToXml() const
+{
+    auto xml = std::make_unique<juce::XmlElement>("ParameterMap");
+    for (size_t i = 0; i < mappings.size(); ++i)
+    {
+        const auto& m = mappings[i];
+        if (m.isFree())
+            continue;
+
+        auto* mapXml = xml->createNewChildElement("Map");
+        mapXml->setAttribute("host", static_cast<int>(i));
+        mapXml->setAttribute("node", m.nodeId);
+        mapXml->setAttribute("index", m.paramIndex);
+        mapXml->setAttribute("paramId", m.paramId);
+        mapXml->setAttribute("name", m.paramName);
+        mapXml->setAttribute("plugin", m.pluginName);
+    }
+
+    // Written by an instance with a larger host parameter count; keep them for it
+    for (auto* overflow : overflowMappings)
+        xml->addChildElement(new juce::XmlElement(*overflow));
+
+    for (int s = 0; s < kMaxSlots; ++s)
+    {
+        if (slots[static_cast<size_t>(s)].nodeId < 0)
+            continue;
+
+        auto* slotXml = xml->createNewChildElement("Slot");
+        slotXml->setAttribute("index", s);
+        slotXml->setAttribute("node", slots[static_cast<size_t>(s)].nodeId);
+    }
+
+    for (int m = 0; m < kNumMacros; ++m)
+    {
+        const auto& macro = macroDefs[static_cast<size_t>(m)];
+        if (macro.targets.empty() && macro.name.isEmpty())
+            continue;
+
+        auto* macroXml = xml->createNewChildElement("Macro");
+        macroXml->setAttribute("index", m);
+        macroXml->setAttribute("name", macro.name);
+        if (m < static_cast<int>(macroParams.size()))
+            macroXml->setAttribute("value", static_cast<double>(macroParams[static_cast<size_t>(m)]->getValue()));
+
+        for (const auto& t : macro.targets)
+        {
+            auto* targetXml = macroXml->createNewChildElement("Target");
+            targetXml->setAttribute("node", t.nodeId);
+            targetXml->setAttribute("index", t.paramIndex);
+            targetXml->setAttribute("paramId", t.paramId);
+            targetXml->setAttribute("name", t.paramName);
+            targetXml->setAttribute("start", static_cast<double>(t.rangeStart));
+            targetXml->setAttribute("end", static_cast<double>(t.rangeEnd));
+            targetXml->setAttribute("curve", static_cast<int>(t.curve));
+            targetXml->setAttribute("steps", t.steps);
         }
-        else
+    }
+    return xml;
+}
+
+void ParameterProxyPool::mappingsFromXml(const juce::XmlElement& xml)
+{
+    clearMappings();
+
+    for (auto* mapXml : xml.getChildWithTagNameIterator("Map"))
+    {
+        auto host = mapXml->getIntAttribute("host", -1);
+        if (!juce::isPositiveAndBelow(host, static_cast<int>(mappings.size())))
         {
-            PCLOG("WARNING: rebindAll slot " + juce::String(i)
-                  + " — graph node not found for nodeId=" + juce::String(leaf.graphNodeId.uid));
-            unbindSlot(i);
+            // Saved with a larger host parameter count than this instance has
+            if (!legacyLayout && host >= 0)
+                overflowMappings.add(new juce::XmlElement(*mapXml));
+            continue;
         }
+
+        auto& m = mappings[static_cast<size_t>(host)];
+        m.nodeId = mapXml->getIntAttribute("node", -1);
+        m.paramIndex = mapXml->getIntAttribute("index", -1);
+        m.paramId = mapXml->getStringAttribute("paramId");
+        m.paramName = mapXml->getStringAttribute("name");
+        m.pluginName = mapXml->getStringAttribute("plugin");
+    }
+
+    // Legacy layout: slot assignments, bound by the rebind that follows the chain restore
+    for (auto* slotXml : xml.getChildWithTagNameIterator("Slot"))
+    {
+        auto index = slotXml->getIntAttribute("index", -1);
+        if (legacyLayout && juce::isPositiveAndBelow(index, kMaxSlots))
+            slots[static_cast<size_t>(index)].nodeId = slotXml->getIntAttribute("node", -1);
     }
 
-    // Only unbind slots that were previously bound but are no longer needed
-    int unbindLimit = juce::jmax(previousMax, kMaxSlots);
-    for (int i = juce::jmin(numPlugins, kMaxSlots); i < unbindLimit; ++i)
+    // Macros: compiled by the rebind that follows the chain restore
+    for (auto* macroXml : xml.getChildWithTagNameIterator("Macro"))
     {
-        unbindSlot(i);
+        auto index = macroXml->getIntAttribute("index", -1);
+        if (!juce::isPositiveAndBelow(index, kNumMacros))
+            continue;
+
+        auto& macro = macroDefs[static_cast<size_t>(index)];
+        macro.name = macroXml->getStringAttribute("name");
+        if (index < static_cast<int>(macroParams.size()))
+        {
+            macroParams[static_cast<size_t>(index)]->setDisplayName(macro.name);
+            if (macroXml->hasAttribute("value"))
+                macroParams[static_cast<size_t>(index)]->setValue(static_cast<float>(macroXml->getDoubleAttribute("value")));
+        }
+
+        for (auto* targetXml : macroXml->getChildWithTagNameIterator("Target"))
+        {
+            MacroTarget t;
+            t.nodeId = targetXml->getIntAttribute("node", -1);
+            t.paramIndex = targetXml->getIntAttribute("index", -1);
+            t.paramId = targetXml->getStringAttribute("paramId");
+            t.paramName = targetXml->getStringAttribute("name");
+            t.rangeStart = juce::jlimit(0.0f, 1.0f, static_cast<float>(targetXml->getDoubleAttribute("start", 0.0)));
+            t.rangeEnd = juce::jlimit(0.0f, 1.0f, static_cast<float>(targetXml->getDoubleAttribute("end", 1.0)));
+            t.curve = static_cast<MacroCurve>(juce::jlimit(0, 3, targetXml->getIntAttribute("curve", 0)));
+            t.steps = juce::jmax(2, targetXml->getIntAttribute("steps", 4));
+            macro.targets.push_back(t);
+        }
     }
+}
+
+//==============================================================================
+// Macros
+//==============================================================================
+
+bool ParameterProxyPool::addMacroTarget(ChainProcessor& chain, int macroIndex, const MacroTarget& target)
+{
+    jassert(juce::MessageManager::getInstance()->isThisTheMessageThread());
+
+    if (!juce::isPositiveAndBelow(macroIndex, kNumMacros))
+        return false;
+
+    auto* param = resolve(chain, target.nodeId, target.paramId, target.paramIndex);
+    if (param == nullptr)
+        return false;
+
+    auto added = target;
+    added.paramId = getChildParameterId(param);
+    added.paramIndex = chain.getNodeProcessor(target.nodeId)->getParameters().indexOf(param);
+    added.paramName = param->getName(64);
+    added.rangeStart = juce::jlimit(0.0f, 1.0f, added.rangeStart);
+    added.rangeEnd = juce::jlimit(0.0f, 1.0f, added.rangeEnd);
+    added.steps = juce::jmax(2, added.steps);
+
+    // Re-adding a target replaces its range/curve
+    auto& targets = macroDefs[static_cast<size_t>(macroIndex)].targets;
+    auto existing = std::find_if(targets.begin(), targets.end(), [&](const MacroTarget& t) {
+        return t.nodeId == added.nodeId && t.paramIndex == added.paramIndex;
+    });
+    if (existing != targets.end())
+        *existing = added;
+    else
+        targets.push_back(added);
 
-    maxBoundSlot = newMax;
+    compileMacros(chain);
+    return true;
+}
+
+void ParameterProxyPool::removeMacroTarget(ChainProcessor& chain, int macroIndex, int targetIndex)
+{
+    if (!juce::isPositiveAndBelow(macroIndex, kNumMacros))
+        return;
 
-    PCLOG("rebindAll — done (" + juce::String(numPlugins) + " plugins)");
+    auto& targets = macroDefs[static_cast<size_t>(macroIndex)].targets;
+    if (juce::isPositiveAndBelow(targetIndex, static_cast<int>(targets.size())))
+    {
+        targets.erase(targets.begin() + targetIndex);
+        compileMacros(chain);
+    }
+}
+
+void ParameterProxyPool::setMacroName(int macroIndex, const juce::String& name)
+{
+    if (!juce::isPositiveAndBelow(macroIndex, kNumMacros))
+        return;
+
+    macroDefs[static_cast<size_t>(macroIndex)].name = name;
+    macroParams[static_cast<size_t>(macroIndex)]->setDisplayName(name);
+    notifyHostOfNameChanges();
+}
+
+void ParameterProxyPool::clearMacro(ChainProcessor& chain, int macroIndex)
+{
+    if (!juce::isPositiveAndBelow(macroIndex, kNumMacros))
+        return;
+
+    macroDefs[static_cast<size_t>(macroIndex)].targets.clear();
+    setMacroName(macroIndex, {});
+    compileMacros(chain);
+}
+
+void ParameterProxyPool::compileMacros(ChainProcessor& chain)
+{
+    auto program = std::make_unique<MacroProgram>();
+
+    // Bucket targets by curve so the shaping pass is one branch-free loop per curve
+    struct Resolved { int macro; const MacroTarget* target; juce::AudioProcessorParameter* param; };
+    std::array<std::vector<Resolved>, 4> byCurve;
+
+    for (int m = 0; m < kNumMacros; ++m)
+        for (const auto& target : macroDefs[static_cast<size_t>(m)].targets)
+            if (auto* param = resolve(chain, target.nodeId, target.paramId, target.paramIndex))
+                byCurve[static_cast<size_t>(target.curve)].push_back({ m, &target, param });
+
+    size_t count = 0;
+    for (const auto& bucket : byCurve)
+        count += bucket.size();
+
+    program->macroIndex.reserve(count);
+    program->params.reserve(count);
+    program->keepAlive.reserve(count);
+    program->start.reserve(count);
+    program->span.reserve(count);
+    program->steps.reserve(count);
+    program->maxStep.reserve(count);
+    program->stepScale.reserve(count);
+
+    for (size_t c = 0; c < byCurve.size(); ++c)
+    {
+        program->curveBegin[c] = program->params.size();
+        for (const auto& r : byCurve[c])
+        {
+            program->macroIndex.push_back(r.macro);
+            program->params.push_back(r.param);
+            program->keepAlive.push_back(findGraphNode(chain, r.target->nodeId));
+            program->start.push_back(r.target->rangeStart);
+            program->span.push_back(r.target->rangeEnd - r.target->rangeStart);
+            const auto steps = static_cast<float>(juce::jmax(2, r.target->steps));
+            program->steps.push_back(steps);
+            program->maxStep.push_back(steps - 1.0f);
+            program->stepScale.push_back(1.0f / (steps - 1.0f));
+        }
+    }
+    program->curveBegin[4] = count;
+
+    program->input.resize(count, 0.0f);
+    program->scratch.resize(count, 0.0f);
+    program->output.resize(count, 0.0f);
+    program->lastSent.resize(count, -1.0f);   // Unknown: the first pass sends
+
+    // Carry over what was already sent, so a recompile doesn't re-assert every child
+    {
+        const juce::SpinLock::ScopedLockType lock(macroProgramLock);
+        if (macroProgram != nullptr)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                auto& prev = macroProgram->params;
+                auto it = std::find(prev.begin(), prev.end(), program->params[i]);
+                if (it != prev.end())
+                    program->lastSent[i] = macroProgram->lastSent[static_cast<size_t>(std::distance(prev.begin(), it))];
+            }
+        }
+    }
+
+    std::unique_ptr<MacroProgram> old;
+    {
+        const juce::SpinLock::ScopedLockType lock(macroProgramLock);
+        old = std::move(macroProgram);
+        macroProgram = count > 0 ? std::move(program) : nullptr;
+    }
+    // `old` (and the graph nodes it kept alive) is released here, off the audio thread
+}
+
+void ParameterProxyPool::processMacros() noexcept
+{
+    const juce::SpinLock::ScopedTryLockType lock(macroProgramLock);
+    if (!lock.isLocked() || macroProgram == nullptr)
+        return;
+
+    auto& p = *macroProgram;
+
+    std::array<float, kNumMacros> values {};
+    bool changed = p.forceNext;
+    for (size_t m = 0; m < values.size(); ++m)
+    {
+        values[m] = macroParams[m]->getValue();
+        changed = changed || values[m] != p.lastMacroValues[m];
+    }
+    if (!changed)
+        return;
+
+    p.lastMacroValues = values;
+    p.forceNext = false;
+
+    const auto n = p.params.size();
+    auto* x = p.input.data();
+
+    for (size_t i = 0; i < n; ++i)
+        x[i] = values[static_cast<size_t>(p.macroIndex[i])];
+
+    // Curve shaping, one contiguous range per curve (Linear needs none). The arithmetic is
+    // FloatVectorOperations; log10 and floor have no vector form there and stay scalar loops.
+    const auto curveCount = [&p](size_t curve) {
+        return static_cast<int>(p.curveBegin[curve + 1] - p.curveBegin[curve]);
+    };
+
+    // Log: log10(1 + 9x)
+    if (const auto num = curveCount(1); num > 0)
+    {
+        auto* lx = x + p.curveBegin[1];
+        juce::FloatVectorOperations::multiply(lx, 9.0f, num);
+        juce::FloatVectorOperations::add(lx, 1.0f, num);
+        for (int i = 0; i < num; ++i)
+            lx[i] = std::log10(lx[i]);
+    }
+
+    // S-curve: x * x * (3 - 2x)
+    if (const auto num = curveCount(2); num > 0)
+    {
+        auto* sx = x + p.curveBegin[2];
+        auto* t = p.scratch.data() + p.curveBegin[2];
+        juce::FloatVectorOperations::multiply(t, sx, -2.0f, num);
+        juce::FloatVectorOperations::add(t, 3.0f, num);
+        juce::FloatVectorOperations::multiply(t, sx, num);
+        juce::FloatVectorOperations::multiply(sx, t, num);
+    }
+
+    // Stepped: min(floor(x * n), n - 1) / (n - 1)
+    if (const auto num = curveCount(3); num > 0)
+    {
+        const auto begin = p.curveBegin[3];
+        auto* qx = x + begin;
+        juce::FloatVectorOperations::multiply(qx, p.steps.data() + begin, num);
+        for (int i = 0; i < num; ++i)
+            qx[i] = std::floor(qx[i]);
+        juce::FloatVectorOperations::min(qx, qx, p.maxStep.data() + begin, num);
+        juce::FloatVectorOperations::multiply(qx, p.stepScale.data() + begin, num);
+    }
+
+    // output = start + span * x
+    const auto count = static_cast<int>(n);
+    juce::FloatVectorOperations::multiply(p.output.data(), p.span.data(), x, count);
+    juce::FloatVectorOperations::add(p.output.data(), p.start.data(), count);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        if (std::abs(p.output[i] - p.lastSent[i]) > kMacroChangeThreshold)
+        {
+            p.lastSent[i] = p.output[i];
+            p.params[i]->setValue(p.output[i]);
+        }
+    }
+}
+
+juce::var ParameterProxyPool::getMacrosAsJson() const
+{
+    static const char* curveNames[] = { "linear", "log", "scurve", "stepped" };
+
+    juce::Array<juce::var> arr;
+    for (int m = 0; m < kNumMacros; ++m)
+    {
+        const auto& macro = macroDefs[static_cast<size_t>(m)];
+        auto* obj = new juce::DynamicObject();
+        obj->setProperty("index", m);
+        obj->setProperty("name", macroParams.empty() ? macro.name : macroParams[static_cast<size_t>(m)]->getName(64));
+        obj->setProperty("value", macroParams.empty() ? 0.0f : macroParams[static_cast<size_t>(m)]->getValue());
+
+        juce::Array<juce::var> targets;
+        for (const auto& t : macro.targets)
+        {
+            auto* tObj = new juce::DynamicObject();
+            tObj->setProperty("nodeId", t.nodeId);
+            tObj->setProperty("paramIndex", t.paramIndex);
+            tObj->setProperty("paramName", t.paramName);
+            tObj->setProperty("rangeStart", t.rangeStart);
+            tObj->setProperty("rangeEnd", t.rangeEnd);
+            tObj->setProperty("curve", curveNames[static_cast<int>(t.curve)]);
+            tObj->setProperty("steps", t.steps);
+            targets.add(juce::var(tObj));
+        }
+        obj->setProperty("targets", targets);
+        arr.add(juce::var(obj));
+    }
+    return arr;
 }
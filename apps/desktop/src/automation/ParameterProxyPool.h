@@ -1,28 +1,212 @@
 #pragma once
 
 #include <juce_audio_processors/juce_audio_processors.h>
+#include "../core/ChainNode.h"
+#include "MacroParameter.h"
+#include <array>
+#include <atomic>
+#include <functional>
+#include <memory>
 #include <vector>
 
+#ifndef PROCHAIN_DYNAMIC_HOST_PARAMETERS
+ #define PROCHAIN_DYNAMIC_HOST_PARAMETERS 0
+#endif
+
 class ProxyParameter;
 class ChainProcessor;
 
+/**
+ * Host-facing automation parameters.
+ *
+ * Two layouts, fixed when an instance is constructed (hosts require a fixed parameter
+ * list for the lifetime of the instance, and sessions store automation against its IDs):
+ *
+ *  - Legacy (ProChain): kMaxSlots x kMaxParamsPerSlot parameters ("sNN_pNNN"), one slot
+ *    per plugin. A plugin keeps its slot (keyed by ChainNodeId) until it is removed, so
+ *    reordering doesn't move automation between plugins; new plugins take the lowest
+ *    free slot. Every existing session is automated against these IDs.
+ *  - Dynamic (ProChain Dynamic, PROCHAIN_DYNAMIC_HOST_PARAMETERS=1): hostParameterCount
+ *    generic host parameters ("pNNNN"). Each one is mapped on demand (UI assignment or
+ *    learn) to a child parameter identified by ChainNodeId + parameter ID, so mappings
+ *    survive reordering, grouping and other chain edits. Mappings whose plugin is
+ *    missing stay reserved (unbound) until reassigned.
+ *
+ * The layout changes every parameter ID, so it is the plugin's identity (a separate
+ * plugin code), never a runtime setting. hostParameterCount is a user setting applied to
+ * instances created after it changes; mappings saved by an instance with more host
+ * parameters than this one are carried through the state untouched rather than dropped.
+ *
+ * Rebinding is incremental: only proxies whose target changed are touched,
+ * so the host sees no parameter notifications for a pure reorder. Bound
+ * graph nodes are held by reference until unbound, so a proxy never points
+ * into a plugin that has already been destroyed.
+ */
 class ParameterProxyPool
 {
 public:
     static constexpr int kMaxSlots = 16;
     static constexpr int kMaxParamsPerSlot = 128;
 
-    ParameterProxyPool() = default;
+    static constexpr int kDefaultHostParameters = 64;
+    static constexpr int kMinHostParameters = 8;
+    static constexpr int kMaxHostParameters = 1024;
+
+    struct Settings
+    {
+        int hostParameterCount = kDefaultHostParameters;    // Dynamic layout only
+        bool legacySlotLayout = !PROCHAIN_DYNAMIC_HOST_PARAMETERS;
+    };
+
+    /** This build's layout with the saved hostParameterCount (defaults if there is no file). */
+    static Settings loadSettings();
+    static Settings loadSettings(const juce::File& file);
+    static void saveSettings(const Settings& settings);
+    static void saveSettings(const Settings& settings, const juce::File& file);
+
+    ParameterProxyPool();
+    ~ParameterProxyPool();
 
     void createAndRegister(juce::AudioProcessor& processor);
+    void createAndRegister(juce::AudioProcessor& processor, const Settings& settings);
 
-    void bindSlot(int slotIndex, juce::AudioProcessor* childProcessor);
-    void unbindSlot(int slotIndex);
+    bool isLegacyLayout() const { return legacyLayout; }
+    int getNumHostParameters() const { return static_cast<int>(proxies.size()); }
+
+    // Called after every structural chain change. Resolves slots (legacy) or mappings
+    // (dynamic) by node identity; proxies whose target didn't change are untouched.
     void rebindAll(ChainProcessor& chain);
 
+    // Proxy bind/unbind calls made by the last rebindAll (0 for a pure reorder)
+    int getLastRebindChangeCount() const { return lastRebindChanges; }
+
+    // Legacy layout: node assigned to a slot (-1 = free)
+    ChainNodeId getSlotNodeId(int slotIndex) const { return slots[static_cast<size_t>(slotIndex)].nodeId; }
+
+    // =============================================
+    // Dynamic mapping (message thread)
+    // =============================================
+
+    struct Mapping
+    {
+        ChainNodeId nodeId = -1;      // -1 = free
+        int paramIndex = -1;          // fallback when the parameter has no ID
+        juce::String paramId;
+        juce::String paramName;
+        juce::String pluginName;
+
+        bool isFree() const { return nodeId < 0; }
+    };
+
+    /** Map a child parameter to a host parameter (hostIndex -1 = first free one).
+        Returns the host index used, or -1 if none is free / the parameter doesn't exist.
+        A child parameter is only ever mapped once — an existing mapping is moved. */
+    int assign(ChainProcessor& chain, ChainNodeId nodeId, int paramIndex, int hostIndex = -1);
+    void unassign(int hostIndex);
+    void clearMappings();
+    int findHostIndex(ChainNodeId nodeId, int paramIndex) const;
+    const Mapping& getMapping(int hostIndex) const { return mappings[static_cast<size_t>(hostIndex)]; }
+
+    /** Map the next child parameter the user touches (hostIndex -1 = first free one). */
+    bool startLearn(ChainProcessor& chain, int hostIndex = -1);
+    void cancelLearn();
+    bool isLearning() const { return !learnListeners.empty(); }
+    std::function<void(int hostIndex)> onLearned;
+
+    juce::var getMappingsAsJson() const;
+
+    // =============================================
+    // Macros: one host parameter driving any number of child parameters
+    // =============================================
+
+    static constexpr int kNumMacros = 8;
+    static constexpr float kMacroChangeThreshold = 1.0e-4f;   // Below this, a child isn't touched
+
+    struct Macro
+    {
+        juce::String name;
+        std::vector<MacroTarget> targets;
+    };
+
+    // Message thread. Each edit recompiles the audio-thread program.
+    bool addMacroTarget(ChainProcessor& chain, int macroIndex, const MacroTarget& target);
+    void removeMacroTarget(ChainProcessor& chain, int macroIndex, int targetIndex);
+    void setMacroName(int macroIndex, const juce::String& name);
+    void clearMacro(ChainProcessor& chain, int macroIndex);
+    const Macro& getMacro(int macroIndex) const { return macroDefs[static_cast<size_t>(macroIndex)]; }
+    MacroParameter* getMacroParameter(int macroIndex) const { return macroParams[static_cast<size_t>(macroIndex)]; }
+    juce::var getMacrosAsJson() const;
+
+    /** Audio thread, once per block: evaluates every macro target in one batched pass and
+        calls setValue only on children whose mapped value moved past the threshold.
+        Skips the block if the program is being swapped. */
+    void processMacros() noexcept;
+
+    // Persisted in the processor state (<ParameterMap>: mappings or legacy slot assignments,
+    // plus macros). Restore before the chain so the rebind that follows resolves them.
+    std::unique_ptr<juce::XmlElement> mappingsToXml() const;
+    void mappingsFromXml(const juce::XmlElement& xml);
+
 private:
+    class LearnListener;
+
+    // Legacy slot: the node it belongs to and the processor its proxies are bound to
+    struct SlotBinding
+    {
+        ChainNodeId nodeId = -1;
+        juce::AudioProcessor* processor = nullptr;
+        juce::AudioProcessorGraph::Node::Ptr keepAlive;
+    };
+
+    void rebindSlots(ChainProcessor& chain);
+    void rebindMappings(ChainProcessor& chain);
+    int bindSlot(int slotIndex, juce::AudioProcessor* childProcessor);
+    bool bindProxy(size_t proxyIndex, juce::AudioProcessorParameter* target);
+    static juce::AudioProcessorGraph::Node::Ptr findGraphNode(ChainProcessor& chain, ChainNodeId nodeId);
+    juce::AudioProcessorParameter* resolve(ChainProcessor& chain, const Mapping& mapping) const;
+    juce::AudioProcessorParameter* resolve(ChainProcessor& chain, ChainNodeId nodeId,
+                                           const juce::String& paramId, int paramIndex) const;
+    static juce::String getChildParameterId(juce::AudioProcessorParameter* param);
+    void learnTriggered(ChainNodeId nodeId, int paramIndex);
+    void notifyHostOfNameChanges();
+
     std::vector<ProxyParameter*> proxies; // raw ptrs, owned by AudioProcessor
-    int maxBoundSlot = 0;
+    juce::AudioProcessor* hostProcessor = nullptr;
+    bool legacyLayout = false;
+    int lastRebindChanges = 0;
+
+    std::array<SlotBinding, kMaxSlots> slots;                        // Legacy layout
+    std::vector<Mapping> mappings;                                   // Dynamic layout: one per proxy
+    juce::OwnedArray<juce::XmlElement> overflowMappings;            // Saved beyond this instance's count
+    std::vector<juce::AudioProcessorGraph::Node::Ptr> mappingNodes;  // Parallel to mappings
+
+    // Macro evaluation program, structure-of-arrays sorted by curve so each curve's shaping
+    // and the final range mapping run as FloatVectorOperations over contiguous ranges.
+    struct MacroProgram
+    {
+        std::vector<int> macroIndex;
+        std::vector<float> start, span, input, output, lastSent, scratch;
+        std::vector<float> steps, maxStep, stepScale;   // Stepped: n, n - 1, 1 / (n - 1)
+        std::vector<juce::AudioProcessorParameter*> params;
+        std::vector<juce::AudioProcessorGraph::Node::Ptr> keepAlive;
+        std::array<size_t, 5> curveBegin {};           // Targets of curve c: [curveBegin[c], curveBegin[c + 1])
+        std::array<float, kNumMacros> lastMacroValues {};
+        bool forceNext = true;
+    };
+
+    void compileMacros(ChainProcessor& chain);
+
+    std::vector<MacroParameter*> macroParams;   // raw ptrs, owned by AudioProcessor
+    std::array<Macro, kNumMacros> macroDefs;
+    std::unique_ptr<MacroProgram> macroProgram;
+    juce::SpinLock macroProgramLock;            // Audio thread only ever try-locks
+
+    std::vector<std::unique_ptr<LearnListener>> learnListeners;
+    ChainProcessor* learnChain = nullptr;
+    int learnHostIndex = -1;
+    std::atomic<bool> learnFired { false };
+
+    std::shared_ptr<std::atomic<bool>> aliveFlag { std::make_shared<std::atomic<bool>>(true) };
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ParameterProxyPool)
 };
@@ -8,6 +8,14 @@ ProxyParameter::ProxyParameter(int slotIdx, int paramIdx)
 {
 }
 
+ProxyParameter::ProxyParameter(int hostIndex)
+    : AudioProcessorParameterWithID(makeDynamicParamID(hostIndex),
+                                     makeDynamicParamName(hostIndex)),
+      slotIndex(hostIndex),
+      paramIndex(-1)
+{
+}
+
 ProxyParameter::~ProxyParameter()
 {
     unbind();
@@ -24,6 +32,27 @@ juce::String ProxyParameter::makeParamName(int slot, int param)
     return "Slot " + juce::String(slot + 1) + " Param " + juce::String(param);
 }
 
+juce::String ProxyParameter::makeDynamicParamID(int hostIndex)
+{
+    return "p" + juce::String(hostIndex + 1).paddedLeft('0', 4);
+}
+
+juce::String ProxyParameter::makeDynamicParamName(int hostIndex)
+{
+    return "Param " + juce::String(hostIndex + 1);
+}
+
+juce::String ProxyParameter::getUnboundName() const
+{
+    return paramIndex < 0 ? makeDynamicParamName(slotIndex) : makeParamName(slotIndex, paramIndex);
+}
+
+void ProxyParameter::setDisplayPrefix(const juce::String& prefix)
+{
+    const juce::SpinLock::ScopedLockType lock(displayPrefixLock);
+    displayPrefix = prefix;
+}
+
 void ProxyParameter::bind(juce::AudioProcessorParameter* param)
 {
     unbind();
@@ -69,10 +98,23 @@ juce::String ProxyParameter::getName(int maximumStringLength) const
 {
     auto* t = target.load(std::memory_order_acquire);
     if (t != nullptr)
-        return ("[Slot" + juce::String(slotIndex + 1) + "] " + t->getName(maximumStringLength))
+    {
+        juce::String prefix;
+        if (paramIndex < 0)
+        {
+            const juce::SpinLock::ScopedLockType lock(displayPrefixLock);
+            prefix = displayPrefix;
+        }
+        else
+        {
+            prefix = "Slot" + juce::String(slotIndex + 1);
+        }
+
+        return ("[" + prefix + "] " + t->getName(maximumStringLength))
                    .substring(0, maximumStringLength);
+    }
 
-    return makeParamName(slotIndex, paramIndex).substring(0, maximumStringLength);
+    return getUnboundName().substring(0, maximumStringLength);
 }
 
 juce::String ProxyParameter::getLabel() const
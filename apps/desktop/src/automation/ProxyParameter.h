@@ -7,11 +7,18 @@ class ProxyParameter : public juce::AudioProcessorParameterWithID,
                        public juce::AudioProcessorParameter::Listener
 {
 public:
+    // Fixed slot layout (legacy): ID "sNN_pNNN", bound by slot position
     ProxyParameter(int slotIndex, int paramIndex);
+    // Dynamic layout: ID "pNNNN", bound to whatever child parameter is mapped to it
+    explicit ProxyParameter(int hostIndex);
     ~ProxyParameter() override;
 
     void bind(juce::AudioProcessorParameter* param);
     void unbind();
+    bool isBoundTo(const juce::AudioProcessorParameter* param) const { return target.load(std::memory_order_acquire) == param; }
+
+    // Shown before the child parameter name while bound (dynamic layout: the plugin name)
+    void setDisplayPrefix(const juce::String& prefix);
 
     // AudioProcessorParameter overrides
     float getValue() const override;
@@ -34,10 +41,17 @@ public:
 private:
     std::atomic<juce::AudioProcessorParameter*> target { nullptr };
     int slotIndex;
-    int paramIndex;
+    int paramIndex;   // -1 = dynamic layout (slotIndex is the host parameter index)
+
+    juce::String displayPrefix;
+    mutable juce::SpinLock displayPrefixLock;
+
+    juce::String getUnboundName() const;
 
     static juce::String makeParamID(int slot, int param);
     static juce::String makeParamName(int slot, int param);
+    static juce::String makeDynamicParamID(int hostIndex);
+    static juce::String makeDynamicParamName(int hostIndex);
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ProxyParameter)
 };
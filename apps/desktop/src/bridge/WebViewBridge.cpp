@@ -21,6 +21,7 @@ WebViewBridge::WebViewBridge(PluginManager& pm,
     , presetManager(prm)
     , groupTemplateManager(gtm)
 {
+    chainProcessor.getParameterMirror().addListener(this);
     bindCallbacks();
 }
 
@@ -30,14 +31,22 @@ WebViewBridge::~WebViewBridge() noexcept
     aliveFlag->store(false, std::memory_order_release);
 
     stopTimer();
+    chainProcessor.getParameterMirror().removeListener(this);
 
     // Clear all callbacks to prevent use-after-free
     chainProcessor.onChainChanged = nullptr;
     chainProcessor.onLatencyChanged = nullptr;
-    chainProcessor.onParameterBindingChanged = nullptr;
-    chainProcessor.onUnbindSlot = nullptr;
+    // onParameterBindingChanged belongs to the processor (automation rebinding) — leave it
     chainProcessor.onPluginParameterChangeSettled = nullptr;
 
+    if (auto* processor = dynamic_cast<PluginChainManagerProcessor*>(mainProcessor))
+    {
+        processor->getParameterPool().cancelLearn();
+        processor->getParameterPool().onLearned = nullptr;
+    }
+
+    setSessionOverviewEnabled(false);
+
     if (instanceRegistry)
         instanceRegistry->removeListener(this);
     if (mirrorManager)
@@ -144,10 +153,22 @@ juce::WebBrowserComponent::Options WebViewBridge::getOptions()
         .withNativeFunction("loadPreset", [this](const juce::Array<juce::var>& args,
                                                   juce::WebBrowserComponent::NativeFunctionCompletion completion) {
             if (args.size() >= 1)
-                completion(loadPreset(args[0].toString()));
+                loadPreset(args[0].toString(), std::move(completion));
+            else
+                completion(juce::var());
+        })
+        .withNativeFunction("prefetchPreset", [this](const juce::Array<juce::var>& args,
+                                                      juce::WebBrowserComponent::NativeFunctionCompletion completion) {
+            if (args.size() >= 1)
+                completion(prefetchPreset(args[0].toString()));
             else
                 completion(juce::var());
         })
+        .withNativeFunction("cancelPrefetch", [this](const juce::Array<juce::var>& args,
+                                                      juce::WebBrowserComponent::NativeFunctionCompletion completion) {
+            // No argument = cancel everything (user left the preset browser)
+            completion(cancelPrefetch(args.size() >= 1 ? args[0].toString() : juce::String()));
+        })
         .withNativeFunction("deletePreset", [this](const juce::Array<juce::var>& args,
                                                     juce::WebBrowserComponent::NativeFunctionCompletion completion) {
             if (args.size() >= 1)
@@ -691,13 +712,17 @@ juce::WebBrowserComponent::Options WebViewBridge::getOptions()
                     
                     juce::Array<juce::var> paramArray;
                     auto& params = processor->getParameters();
+                    auto& mirror = chainProcessor.getParameterMirror();
+                    const int mirrorBase = mirror.findIndex(nodeId, 0);
                     for (int i = 0; i < params.size(); ++i)
                     {
                         auto* param = params[i];
                         auto* paramObj = new juce::DynamicObject();
                         paramObj->setProperty("name", param->getName(256));
                         paramObj->setProperty("index", i);
-                        paramObj->setProperty("normalizedValue", param->getValue());
+                        paramObj->setProperty("normalizedValue", mirrorBase >= 0 && mirrorBase + i < mirror.getNumParameters()
+                                                                     ? mirror.getValue(static_cast<uint32_t>(mirrorBase + i))
+                                                                     : param->getValue());
                         paramObj->setProperty("label", param->getLabel());
                         paramObj->setProperty("text", param->getCurrentValueAsText());
                         paramObj->setProperty("numSteps", param->getNumSteps());
@@ -810,17 +835,14 @@ juce::WebBrowserComponent::Options WebViewBridge::getOptions()
                     return;
                 }
                 
-                // Find the new plugin description
-                auto pluginList = pluginManager.getKnownPlugins().getTypes();
-                const juce::PluginDescription* newDesc = nullptr;
-                for (auto& desc : pluginList)
+                // Find the new plugin description (identifier string, else numeric uid)
+                auto known = pluginManager.getSnapshot();
+                auto newDesc = known->findByIdentifier(newPluginUid);
+                if (!newDesc && juce::String(newPluginUid.getIntValue()) == newPluginUid)
                 {
-                    if (desc.createIdentifierString() == newPluginUid ||
-                        juce::String(desc.uniqueId) == newPluginUid)
-                    {
-                        newDesc = &desc;
-                        break;
-                    }
+                    auto byUid = known->findByUniqueId(newPluginUid.getIntValue());
+                    if (!byUid.empty())
+                        newDesc = byUid.front();
                 }
                 
                 if (!newDesc)
@@ -899,6 +921,11 @@ juce::WebBrowserComponent::Options WebViewBridge::getOptions()
             juce::ignoreUnused(args);
             completion(getOtherInstances());
         })
+        .withNativeFunction("getRealtimeBudget", [this](const juce::Array<juce::var>& args,
+                                                         juce::WebBrowserComponent::NativeFunctionCompletion completion) {
+            juce::ignoreUnused(args);
+            completion(getRealtimeBudget());
+        })
         .withNativeFunction("copyChainFromInstance", [this](const juce::Array<juce::var>& args,
                                                              juce::WebBrowserComponent::NativeFunctionCompletion completion) {
             if (args.size() >= 1)
@@ -996,6 +1023,64 @@ juce::WebBrowserComponent::Options WebViewBridge::getOptions()
                 completion(juce::var(result));
             }
         })
+        // ============================================
+        // A/B Compare Slots
+        // ============================================
+        .withNativeFunction("getABState", [this](const juce::Array<juce::var>& args,
+                                                  juce::WebBrowserComponent::NativeFunctionCompletion completion) {
+            juce::ignoreUnused(args);
+            completion(getABState());
+        })
+        .withNativeFunction("abCommand", [this](const juce::Array<juce::var>& args,
+                                                 juce::WebBrowserComponent::NativeFunctionCompletion completion) {
+            // args[0] = "store" | "clear" | "swap" | "select" | "keepWarm", args[1] = optional argument
+            if (args.size() >= 1)
+                completion(abCommand(args[0].toString(), args.size() > 1 ? args[1] : juce::var()));
+            else
+                completion(juce::var());
+        })
+        // ============================================
+        // Parameter Scenes
+        // ============================================
+        .withNativeFunction("getScenes", [this](const juce::Array<juce::var>& args,
+                                                 juce::WebBrowserComponent::NativeFunctionCompletion completion) {
+            juce::ignoreUnused(args);
+            completion(getScenes());
+        })
+        .withNativeFunction("sceneCommand", [this](const juce::Array<juce::var>& args,
+                                                    juce::WebBrowserComponent::NativeFunctionCompletion completion) {
+            // args[0] = "capture" | "recall" | "morph" | "clear", remaining args per command
+            if (args.size() >= 2)
+                completion(sceneCommand(args[0].toString(), args));
+            else
+                completion(juce::var());
+        })
+        .withNativeFunction("getParameterMappings", [this](const juce::Array<juce::var>& args,
+                                                            juce::WebBrowserComponent::NativeFunctionCompletion completion) {
+            juce::ignoreUnused(args);
+            completion(getParameterMappings());
+        })
+        .withNativeFunction("parameterMappingCommand", [this](const juce::Array<juce::var>& args,
+                                                               juce::WebBrowserComponent::NativeFunctionCompletion completion) {
+            // args[0] = "assign" | "unassign" | "learn" | "cancelLearn" | "settings", remaining args per command
+            if (args.size() >= 1)
+                completion(parameterMappingCommand(args[0].toString(), args));
+            else
+                completion(juce::var());
+        })
+        .withNativeFunction("getMacros", [this](const juce::Array<juce::var>& args,
+                                                 juce::WebBrowserComponent::NativeFunctionCompletion completion) {
+            juce::ignoreUnused(args);
+            completion(getMacros());
+        })
+        .withNativeFunction("macroCommand", [this](const juce::Array<juce::var>& args,
+                                                    juce::WebBrowserComponent::NativeFunctionCompletion completion) {
+            // args[0] = "addTarget" | "removeTarget" | "rename" | "clear" | "setValue", args[1] = macro index
+            if (args.size() >= 2)
+                completion(macroCommand(args[0].toString(), args));
+            else
+                completion(juce::var());
+        })
         .withNativeFunction("getOversamplingLatencyMs", [this](const juce::Array<juce::var>& args,
                                                                 juce::WebBrowserComponent::NativeFunctionCompletion completion) {
             juce::ignoreUnused(args);
@@ -1097,6 +1182,29 @@ juce::WebBrowserComponent::Options WebViewBridge::getOptions()
             juce::ignoreUnused(args);
             completion(checkForNewPluginsOp());
         })
+        .withNativeFunction("setBenchmarkDuringScan", [this](const juce::Array<juce::var>& args,
+                                                              juce::WebBrowserComponent::NativeFunctionCompletion completion) {
+            if (args.size() >= 1)
+                completion(setBenchmarkDuringScanOp(static_cast<bool>(args[0])));
+            else
+                completion(juce::var());
+        })
+        .withNativeFunction("estimateChainCpu", [this](const juce::Array<juce::var>& args,
+                                                        juce::WebBrowserComponent::NativeFunctionCompletion completion) {
+            completion(estimateChainCpu(args.size() > 0 ? args[0].toString() : juce::String()));
+        })
+        .withNativeFunction("getPrewarmStatus", [this](const juce::Array<juce::var>& args,
+                                                        juce::WebBrowserComponent::NativeFunctionCompletion completion) {
+            juce::ignoreUnused(args);
+            completion(pluginManager.getPrewarmStatusAsJson());
+        })
+        .withNativeFunction("setPrewarmSettings", [this](const juce::Array<juce::var>& args,
+                                                          juce::WebBrowserComponent::NativeFunctionCompletion completion) {
+            if (args.size() >= 1)
+                completion(setPrewarmSettingsOp(args[0]));
+            else
+                completion(juce::var());
+        })
         .withNativeFunction("setFFTEnabled", [this](const juce::Array<juce::var>& args,
                                                      juce::WebBrowserComponent::NativeFunctionCompletion completion) {
             if (fftProcessor && args.size() > 0)
@@ -1109,6 +1217,17 @@ juce::WebBrowserComponent::Options WebViewBridge::getOptions()
                 nodeMetersEnabled.store(static_cast<bool>(args[0]), std::memory_order_relaxed);
             completion(juce::var());
         })
+        .withNativeFunction("setSessionOverviewEnabled", [this](const juce::Array<juce::var>& args,
+                                                                 juce::WebBrowserComponent::NativeFunctionCompletion completion) {
+            if (args.size() > 0)
+                setSessionOverviewEnabled(static_cast<bool>(args[0]));
+            completion(juce::var());
+        })
+        .withNativeFunction("getSessionOverview", [this](const juce::Array<juce::var>& args,
+                                                          juce::WebBrowserComponent::NativeFunctionCompletion completion) {
+            juce::ignoreUnused(args);
+            completion(buildSessionOverview());
+        })
         // ============================================
         // Inline Editor Mode
         // ============================================
@@ -1363,6 +1482,10 @@ void WebViewBridge::timerCallback()
         chainProcessor.refreshLatencyCompensation();
     }
 
+    // One event covers every instance, whatever the session size
+    if (sessionOverviewEnabled && webBrowser)
+        emitEvent("sessionAnalysis", buildSessionOverview());
+
     if (!waveformStreamActive || !webBrowser)
         return;
 
@@ -1565,7 +1688,10 @@ void WebViewBridge::timerCallback()
         if (counter >= 15)
         {
             latencyCheckCounter.store(0, std::memory_order_relaxed);
-            int newLatency = chainProcessor.getTotalLatencySamples();
+            // Prefer the processor's figure: it accounts for oversampling and the A/B slot
+            auto* processor = dynamic_cast<PluginChainManagerProcessor*>(mainProcessor);
+            int newLatency = processor ? processor->computeReportedLatency()
+                                       : chainProcessor.getTotalLatencySamples();
             int lastLatency = lastReportedLatency.load(std::memory_order_relaxed);
 
             if (newLatency != lastLatency)
@@ -1732,11 +1858,21 @@ juce::var WebViewBridge::savePreset(const juce::String& name, const juce::String
     return juce::var(result);
 }
 
-juce::var WebViewBridge::loadPreset(const juce::String& path)
+void WebViewBridge::loadPreset(const juce::String& path,
+                               juce::WebBrowserComponent::NativeFunctionCompletion completion)
+{
+    // A prefetched preset lands after the old chain has faded out; answer once it has
+    presetManager.loadPreset(juce::File(path), [this, alive = aliveFlag, path, completion](bool success) {
+        if (alive->load(std::memory_order_acquire))
+            completion(getLoadPresetResult(path, success));
+    });
+}
+
+juce::var WebViewBridge::getLoadPresetResult(const juce::String& path, bool success)
 {
     auto* result = new juce::DynamicObject();
 
-    if (presetManager.loadPreset(juce::File(path)))
+    if (success)
     {
         result->setProperty("success", true);
         result->setProperty("chainState", getChainState());
@@ -1762,6 +1898,232 @@ juce::var WebViewBridge::loadPreset(const juce::String& path)
     return juce::var(result);
 }
 
+juce::var WebViewBridge::getABState()
+{
+    auto* result = new juce::DynamicObject();
+    auto* processor = dynamic_cast<PluginChainManagerProcessor*>(mainProcessor);
+    if (!processor)
+    {
+        result->setProperty("success", false);
+        result->setProperty("error", "Processor not available");
+        return juce::var(result);
+    }
+
+    result->setProperty("success", true);
+    result->setProperty("hasB", processor->hasCompareSlot());
+    result->setProperty("active", processor->getActiveABSlot() == PluginChainManagerProcessor::ABSlot::B ? "B" : "A");
+    result->setProperty("keepWarm", processor->isCompareKeepWarm());
+    result->setProperty("swapping", processor->isCompareSwapInProgress());
+    result->setProperty("latencySamples", processor->computeReportedLatency());
+    if (processor->hasCompareSlot())
+        result->setProperty("compareChainState", processor->getCompareChainProcessor().getChainStateAsJson());
+    return juce::var(result);
+}
+
+juce::var WebViewBridge::abCommand(const juce::String& command, const juce::var& arg)
+{
+    auto* processor = dynamic_cast<PluginChainManagerProcessor*>(mainProcessor);
+    if (!processor)
+    {
+        auto* result = new juce::DynamicObject();
+        result->setProperty("success", false);
+        result->setProperty("error", "Processor not available");
+        return juce::var(result);
+    }
+
+    bool ok = true;
+    if (command == "store")
+        ok = processor->storeCompareSlot();
+    else if (command == "clear")
+        processor->clearCompareSlot();
+    else if (command == "swap")
+        ok = processor->swapCompareSlot();
+    else if (command == "select")
+    {
+        ok = arg.toString() == "A" || processor->hasCompareSlot();
+        processor->setActiveABSlot(arg.toString() == "B" ? PluginChainManagerProcessor::ABSlot::B
+                                                         : PluginChainManagerProcessor::ABSlot::A);
+    }
+    else if (command == "keepWarm")
+        processor->setCompareKeepWarm(static_cast<bool>(arg));
+    else
+        ok = false;
+
+    auto state = getABState();
+    if (auto* obj = state.getDynamicObject())
+        obj->setProperty("success", ok);
+    return state;
+}
+
+juce::var WebViewBridge::getScenes()
+{
+    auto* result = new juce::DynamicObject();
+    result->setProperty("success", true);
+    result->setProperty("scenes", chainProcessor.getScenesAsJson());
+    return juce::var(result);
+}
+
+juce::var WebViewBridge::sceneCommand(const juce::String& command, const juce::Array<juce::var>& args)
+{
+    // capture: index, name | recall: index | morph: indexA, indexB, position | clear: index
+    const int index = static_cast<int>(args[1]);
+    bool ok = true;
+
+    if (command == "capture")
+        ok = chainProcessor.captureScene(index, args.size() > 2 ? args[2].toString() : juce::String());
+    else if (command == "recall")
+        ok = chainProcessor.recallScene(index);
+    else if (command == "morph" && args.size() >= 4)
+        ok = chainProcessor.morphScenes(index, static_cast<int>(args[2]), static_cast<float>(args[3]));
+    else if (command == "clear")
+        chainProcessor.clearScene(index);
+    else
+        ok = false;
+
+    auto state = getScenes();
+    if (auto* obj = state.getDynamicObject())
+        obj->setProperty("success", ok);
+    return state;
+}
+
+juce::var WebViewBridge::getParameterMappings()
+{
+    auto* processor = dynamic_cast<PluginChainManagerProcessor*>(mainProcessor);
+    if (!processor)
+    {
+        auto* result = new juce::DynamicObject();
+        result->setProperty("success", false);
+        result->setProperty("error", "Processor not available");
+        return juce::var(result);
+    }
+
+    auto state = processor->getParameterPool().getMappingsAsJson();
+    if (auto* obj = state.getDynamicObject())
+    {
+        obj->setProperty("success", true);
+        // Applies to instances created after the change (dynamic layout only)
+        obj->setProperty("settingsHostParameterCount", ParameterProxyPool::loadSettings().hostParameterCount);
+    }
+    return state;
+}
+
+juce::var WebViewBridge::parameterMappingCommand(const juce::String& command, const juce::Array<juce::var>& args)
+{
+    auto* processor = dynamic_cast<PluginChainManagerProcessor*>(mainProcessor);
+    if (!processor)
+        return getParameterMappings();
+
+    // assign: nodeId, paramIndex, [hostIndex] | unassign: hostIndex | learn: [hostIndex]
+    // cancelLearn | settings: hostParameterCount
+    auto& pool = processor->getParameterPool();
+    bool ok = true;
+
+    if (command == "assign" && args.size() >= 3)
+        ok = pool.assign(chainProcessor, static_cast<int>(args[1]), static_cast<int>(args[2]),
+                         args.size() > 3 ? static_cast<int>(args[3]) : -1) >= 0;
+    else if (command == "unassign" && args.size() >= 2)
+        pool.unassign(static_cast<int>(args[1]));
+    else if (command == "learn")
+    {
+        pool.onLearned = [this](int) { emitEvent("parameterMappingsChanged", getParameterMappings()); };
+        ok = pool.startLearn(chainProcessor, args.size() > 1 ? static_cast<int>(args[1]) : -1);
+    }
+    else if (command == "cancelLearn")
+        pool.cancelLearn();
+    else if (command == "settings" && args.size() >= 2)
+    {
+        auto settings = ParameterProxyPool::loadSettings();
+        settings.hostParameterCount = static_cast<int>(args[1]);
+        ParameterProxyPool::saveSettings(settings);
+    }
+    else
+        ok = false;
+
+    auto state = getParameterMappings();
+    if (auto* obj = state.getDynamicObject())
+        obj->setProperty("success", ok);
+    return state;
+}
+
+juce::var WebViewBridge::getMacros()
+{
+    auto* result = new juce::DynamicObject();
+    auto* processor = dynamic_cast<PluginChainManagerProcessor*>(mainProcessor);
+    if (!processor)
+    {
+        result->setProperty("success", false);
+        result->setProperty("error", "Processor not available");
+        return juce::var(result);
+    }
+
+    result->setProperty("success", true);
+    result->setProperty("macros", processor->getParameterPool().getMacrosAsJson());
+    return juce::var(result);
+}
+
+juce::var WebViewBridge::macroCommand(const juce::String& command, const juce::Array<juce::var>& args)
+{
+    auto* processor = dynamic_cast<PluginChainManagerProcessor*>(mainProcessor);
+    if (!processor)
+        return getMacros();
+
+    // addTarget: macro, nodeId, paramIndex, rangeStart, rangeEnd, curve, [steps] | removeTarget: macro, targetIndex
+    // rename: macro, name | clear: macro | setValue: macro, value
+    static const juce::StringArray curveNames { "linear", "log", "scurve", "stepped" };
+    auto& pool = processor->getParameterPool();
+    const int macroIndex = static_cast<int>(args[1]);
+    bool ok = true;
+
+    if (!juce::isPositiveAndBelow(macroIndex, ParameterProxyPool::kNumMacros))
+        ok = false;
+    else if (command == "addTarget" && args.size() >= 7)
+    {
+        MacroTarget target;
+        target.nodeId = static_cast<int>(args[2]);
+        target.paramIndex = static_cast<int>(args[3]);
+        target.rangeStart = static_cast<float>(args[4]);
+        target.rangeEnd = static_cast<float>(args[5]);
+        target.curve = static_cast<MacroCurve>(juce::jmax(0, curveNames.indexOf(args[6].toString())));
+        target.steps = args.size() > 7 ? static_cast<int>(args[7]) : 4;
+        ok = pool.addMacroTarget(chainProcessor, macroIndex, target);
+    }
+    else if (command == "removeTarget" && args.size() >= 3)
+        pool.removeMacroTarget(chainProcessor, macroIndex, static_cast<int>(args[2]));
+    else if (command == "rename" && args.size() >= 3)
+        pool.setMacroName(macroIndex, args[2].toString());
+    else if (command == "clear")
+        pool.clearMacro(chainProcessor, macroIndex);
+    else if (command == "setValue" && args.size() >= 3)
+        pool.getMacroParameter(macroIndex)->setValueNotifyingHost(juce::jlimit(0.0f, 1.0f, static_cast<float>(args[2])));
+    else
+        ok = false;
+
+    auto state = getMacros();
+    if (auto* obj = state.getDynamicObject())
+        obj->setProperty("success", ok);
+    return state;
+}
+
+juce::var WebViewBridge::prefetchPreset(const juce::String& path)
+{
+    auto* result = new juce::DynamicObject();
+    result->setProperty("success", presetManager.prefetchPreset(juce::File(path)));
+    result->setProperty("status", presetManager.getPrefetcher().getStatusAsJson());
+    return juce::var(result);
+}
+
+juce::var WebViewBridge::cancelPrefetch(const juce::String& path)
+{
+    if (path.isEmpty())
+        presetManager.cancelAllPrefetches();
+    else
+        presetManager.cancelPrefetch(juce::File(path));
+
+    auto* result = new juce::DynamicObject();
+    result->setProperty("success", true);
+    return juce::var(result);
+}
+
 juce::var WebViewBridge::deletePreset(const juce::String& path)
 {
     auto* result = new juce::DynamicObject();
@@ -2077,7 +2439,12 @@ juce::var WebViewBridge::setGroupDucking(const juce::var& args)
         ? static_cast<float>(obj->getProperty("releaseMs"))
         : 200.0f;
 
-    if (chainProcessor.setGroupDucking(groupId, amount, releaseMs))
+    // Optional key from another instance's tap (-1 = the pre-group signal)
+    bool ok = chainProcessor.setGroupDucking(groupId, amount, releaseMs);
+    if (ok && obj->hasProperty("keySourceInstanceId"))
+        ok = chainProcessor.setGroupDuckKeySource(groupId, static_cast<int>(obj->getProperty("keySourceInstanceId")));
+
+    if (ok)
     {
         result->setProperty("success", true);
         result->setProperty("chainState", getChainState());
@@ -2298,7 +2665,12 @@ juce::var WebViewBridge::setNodeSidechainSource(const juce::var& args)
     int nodeId = static_cast<int>(obj->getProperty("nodeId"));
     int source = static_cast<int>(obj->getProperty("source"));
 
-    if (chainProcessor.setNodeSidechainSource(nodeId, source))
+    // Source 2 keys from another instance's tap, named by sourceInstanceId
+    const bool ok = source == 2 && obj->hasProperty("sourceInstanceId")
+        ? chainProcessor.setNodeSidechainTap(nodeId, static_cast<int>(obj->getProperty("sourceInstanceId")))
+        : chainProcessor.setNodeSidechainSource(nodeId, source);
+
+    if (ok)
     {
         result->setProperty("success", true);
         result->setProperty("chainState", getChainState());
@@ -2843,28 +3215,22 @@ juce::var WebViewBridge::discoverPluginParameters(int nodeId)
         return juce::var(result);
     }
 
-    // Get plugin name and manufacturer from the chain node's PluginDescription
-    juce::String pluginName = processor->getName();
-    juce::String manufacturer;
-
-    // Look up the ChainNode to get the PluginDescription
+    // The chain node's PluginDescription names the plugin and keys the discovery cache
+    juce::PluginDescription desc;
     {
         const auto& rootNode = chainProcessor.getRootNode();
         const auto* chainNode = ChainNodeHelpers::findById(rootNode, nodeId);
         if (chainNode && chainNode->isPlugin())
-        {
-            const auto& desc = chainNode->getPlugin().description;
-            if (desc.name.isNotEmpty())
-                pluginName = desc.name;
-            manufacturer = desc.manufacturerName;
-        }
+            desc = chainNode->getPlugin().description;
     }
+    if (desc.name.isEmpty())
+        desc.name = processor->getName();
 
-    // Run discovery
-    auto discoveredMap = ParameterDiscovery::discoverParameterMap(processor, pluginName, manufacturer);
+    // Run discovery (or reuse the map from an earlier inspection or scan)
+    auto discoveredMap = discoveryCache->getOrDiscover(*processor, desc);
 
     result->setProperty("success", true);
-    result->setProperty("map", ParameterDiscovery::toJson(discoveredMap));
+    result->setProperty("map", ParameterDiscovery::toJson(*discoveredMap));
 
     return juce::var(result);
 }
@@ -2873,9 +3239,12 @@ juce::var WebViewBridge::discoverPluginParameters(int nodeId)
 // Instance Awareness & Chain Copy/Mirror
 //==============================================================================
 
-void WebViewBridge::instanceRegistryChanged()
+void WebViewBridge::instanceRegistryChanged(const InstanceRegistry::ChangeSet& changes)
 {
-    if (!instanceRegistry)
+    // The instance list shows the *other* instances — our own edits don't change it
+    if (!instanceRegistry || webBrowser == nullptr)
+        return;
+    if (!changes.mirrorGroupsChanged && changes.instanceIds.size() == 1 && changes.contains(instanceId))
         return;
 
     emitEvent("instancesChanged", getOtherInstances());
@@ -2891,6 +3260,34 @@ void WebViewBridge::mirrorUpdateApplied()
     emitEvent("mirrorUpdateApplied", juce::var());
 }
 
+void WebViewBridge::parameterMirrorChanged(const ParameterMirror& mirror, const std::vector<uint32_t>& changed)
+{
+    if (webBrowser == nullptr)
+        return;
+
+    // Bursts (preset loads, scene recalls) are capped; the UI re-reads the plugin when truncated
+    const int count = juce::jmin(static_cast<int>(changed.size()), kMaxParameterEventsPerTick);
+
+    juce::Array<juce::var> changes;
+    changes.ensureStorageAllocated(count);
+    for (int i = 0; i < count; ++i)
+    {
+        const auto index = changed[static_cast<size_t>(i)];
+        const auto location = mirror.getLocation(index);
+
+        auto* entry = new juce::DynamicObject();
+        entry->setProperty("nodeId", location.nodeId);
+        entry->setProperty("paramIndex", location.paramIndex);
+        entry->setProperty("value", mirror.getValue(index));
+        changes.add(juce::var(entry));
+    }
+
+    auto* result = new juce::DynamicObject();
+    result->setProperty("changes", changes);
+    result->setProperty("truncated", static_cast<int>(changed.size()) > count);
+    emitEvent("pluginParametersChanged", juce::var(result));
+}
+
 juce::var WebViewBridge::getOtherInstances()
 {
     if (!instanceRegistry)
@@ -2932,6 +3329,79 @@ juce::var WebViewBridge::getOtherInstances()
     return juce::var(result);
 }
 
+juce::var WebViewBridge::getRealtimeBudget()
+{
+    auto* result = new juce::DynamicObject();
+    result->setProperty("workers", realtimeScheduler->getNumWorkers());
+
+    juce::Array<juce::var> clients;
+    for (const auto& stats : realtimeScheduler->getStats())
+    {
+        auto* obj = new juce::DynamicObject();
+        obj->setProperty("instanceId", stats.ownerId);
+        obj->setProperty("isSelf", stats.ownerId == instanceId);
+        obj->setProperty("utilization", stats.utilization);
+        obj->setProperty("share", stats.share);
+        obj->setProperty("queued", stats.queued);
+        obj->setProperty("running", stats.running);
+        obj->setProperty("jobsCompleted", static_cast<juce::int64>(stats.jobsCompleted));
+        obj->setProperty("jobsRejected", static_cast<juce::int64>(stats.jobsRejected));
+        clients.add(juce::var(obj));
+    }
+    result->setProperty("instances", clients);
+
+    return juce::var(result);
+}
+
+void WebViewBridge::setSessionOverviewEnabled(bool enabled)
+{
+    if (enabled == sessionOverviewEnabled || !instanceRegistry)
+        return;
+
+    sessionOverviewEnabled = enabled;
+    if (enabled)
+        instanceRegistry->getAnalysisBus().addViewer();
+    else
+        instanceRegistry->getAnalysisBus().removeViewer();
+}
+
+juce::var WebViewBridge::buildSessionOverview()
+{
+    juce::Array<juce::var> result;
+    if (!instanceRegistry)
+        return juce::var(result);
+
+    overviewFrames.clear();
+    overviewFrames.reserve(static_cast<size_t>(AnalysisBus::kMaxInstances));
+    instanceRegistry->getAnalysisBus().readAll(overviewFrames);
+
+    const auto snapshot = instanceRegistry->getSnapshot();
+    const double now = juce::Time::getMillisecondCounterHiRes();
+
+    for (const auto& frame : overviewFrames)
+    {
+        auto* obj = new juce::DynamicObject();
+        obj->setProperty("instanceId", frame.instanceId);
+        obj->setProperty("isSelf", frame.instanceId == instanceId);
+        if (const auto* info = snapshot->find(frame.instanceId))
+            obj->setProperty("trackName", (*info)->trackName);
+        obj->setProperty("lufs", frame.lufsShort);
+        obj->setProperty("peakDb", frame.peakDb);
+        obj->setProperty("rmsDb", frame.rmsDb);
+
+        juce::Array<juce::var> bands;
+        bands.ensureStorageAllocated(AnalysisBus::kNumBands);
+        for (float db : frame.bandsDb)
+            bands.add(db);
+        obj->setProperty("bandsDb", bands);
+        obj->setProperty("ageMs", juce::jmax(0.0, now - frame.publishedAtMs));
+
+        result.add(juce::var(obj));
+    }
+
+    return juce::var(result);
+}
+
 juce::var WebViewBridge::copyChainFromInstance(int targetInstanceId)
 {
     PCLOG("copyChainFromInstance — targetId=" + juce::String(targetInstanceId));
@@ -3284,3 +3754,53 @@ juce::var WebViewBridge::checkForNewPluginsOp()
 {
     return pluginManager.checkForNewPlugins();
 }
+
+//==============================================================================
+// Plugin Profiling
+//==============================================================================
+
+juce::var WebViewBridge::setBenchmarkDuringScanOp(bool shouldBenchmark)
+{
+    pluginManager.setBenchmarkDuringScan(shouldBenchmark);
+
+    auto* result = new juce::DynamicObject();
+    result->setProperty("success", true);
+    result->setProperty("benchmarkDuringScan", pluginManager.isBenchmarkingDuringScan());
+    return juce::var(result);
+}
+
+juce::var WebViewBridge::estimateChainCpu(const juce::String& addingPluginId)
+{
+    // Optionally with a plugin the user is about to insert
+    auto adding = addingPluginId.isNotEmpty() ? pluginManager.findPluginByIdentifier(addingPluginId)
+                                              : std::optional<juce::PluginDescription>();
+    const auto estimate = chainProcessor.estimateChainCpu(adding ? &*adding : nullptr);
+
+    auto* result = new juce::DynamicObject();
+    result->setProperty("load", estimate.load);
+    result->setProperty("numProfiled", estimate.numProfiled);
+    result->setProperty("numUnprofiled", estimate.numUnprofiled);
+    result->setProperty("sampleRate", chainProcessor.getCurrentSampleRate());
+    result->setProperty("blockSize", chainProcessor.getCurrentBlockSize());
+    return juce::var(result);
+}
+
+//==============================================================================
+// Plugin Prewarming
+//==============================================================================
+
+juce::var WebViewBridge::setPrewarmSettingsOp(const juce::var& settings)
+{
+    // Fields left out keep their current value
+    auto updated = pluginManager.getPrewarmSettings();
+    updated.enabled = static_cast<bool>(settings.getProperty("enabled", updated.enabled));
+    updated.maxPlugins = static_cast<int>(settings.getProperty("maxPlugins", updated.maxPlugins));
+    updated.createInstances = static_cast<bool>(settings.getProperty("createInstances", updated.createInstances));
+    updated.maxBytes = static_cast<juce::int64>(settings.getProperty("maxBytes", updated.maxBytes));
+    pluginManager.setPrewarmSettings(updated);
+
+    auto* result = new juce::DynamicObject();
+    result->setProperty("success", true);
+    result->setProperty("status", pluginManager.getPrewarmStatusAsJson());
+    return juce::var(result);
+}
@@ -5,9 +5,10 @@
 #include "../core/ChainProcessor.h"
 #include "../core/PresetManager.h"
 #include "../core/GroupTemplateManager.h"
-#include "../core/ParameterDiscovery.h"
+#include "../core/ParameterDiscoveryCache.h"
 #include "../core/InstanceRegistry.h"
 #include "../core/MirrorManager.h"
+#include "../core/RealtimeScheduler.h"
 #include <atomic>
 #include <memory>
 
@@ -19,7 +20,8 @@ class PluginChainManagerEditor;
 
 class WebViewBridge : private juce::Timer,
                       private InstanceRegistry::Listener,
-                      private MirrorManager::Listener
+                      private MirrorManager::Listener,
+                      private ParameterMirror::Listener
 {
 public:
     WebViewBridge(PluginManager& pluginManager,
@@ -75,12 +77,16 @@ private:
     void timerCallback() override;
 
     // InstanceRegistry::Listener
-    void instanceRegistryChanged() override;
+    void instanceRegistryChanged(const InstanceRegistry::ChangeSet& changes) override;
 
     // MirrorManager::Listener
     void mirrorStateChanged() override;
     void mirrorUpdateApplied() override;
 
+    // ParameterMirror::Listener
+    void parameterMirrorChanged(const ParameterMirror& mirror, const std::vector<uint32_t>& changed) override;
+    static constexpr int kMaxParameterEventsPerTick = 256;
+
     // Native function implementations
     juce::var getPluginList();
     juce::var startScan(bool rescanAll);
@@ -94,7 +100,24 @@ private:
     juce::var getScanProgress();
     juce::var getPresetList();
     juce::var savePreset(const juce::String& name, const juce::String& category);
-    juce::var loadPreset(const juce::String& path);
+    void loadPreset(const juce::String& path, juce::WebBrowserComponent::NativeFunctionCompletion completion);
+    juce::var getLoadPresetResult(const juce::String& path, bool success);
+    juce::var prefetchPreset(const juce::String& path);
+    juce::var cancelPrefetch(const juce::String& path);
+
+    // A/B compare slots
+    juce::var getABState();
+    juce::var abCommand(const juce::String& command, const juce::var& arg);
+
+    // Parameter scenes
+    juce::var getScenes();
+    juce::var sceneCommand(const juce::String& command, const juce::Array<juce::var>& args);
+
+    // Host automation parameter mappings
+    juce::var getParameterMappings();
+    juce::var parameterMappingCommand(const juce::String& command, const juce::Array<juce::var>& args);
+    juce::var getMacros();
+    juce::var macroCommand(const juce::String& command, const juce::Array<juce::var>& args);
     juce::var deletePreset(const juce::String& path);
     juce::var renamePreset(const juce::String& path, const juce::String& newName);
     juce::var getCategories();
@@ -165,6 +188,11 @@ private:
     juce::var getOtherInstances();
     juce::var copyChainFromInstance(int targetInstanceId);
     juce::var sendChainToInstance(int targetInstanceId);
+    juce::var getRealtimeBudget();
+
+    // Session analysis overview (all instances, from the registry's AnalysisBus)
+    void setSessionOverviewEnabled(bool enabled);
+    juce::var buildSessionOverview();
 
     // Mirror management
     juce::var startMirrorOp(int targetInstanceId);
@@ -189,6 +217,13 @@ private:
     juce::var getAutoScanState();
     juce::var checkForNewPluginsOp();
 
+    // Plugin profiling
+    juce::var setBenchmarkDuringScanOp(bool shouldBenchmark);
+    juce::var estimateChainCpu(const juce::String& addingPluginId);
+
+    // Plugin prewarming
+    juce::var setPrewarmSettingsOp(const juce::var& settings);
+
     PluginManager& pluginManager;
     ChainProcessor& chainProcessor;
     PresetManager& presetManager;
@@ -204,8 +239,12 @@ private:
     InstanceRegistry* instanceRegistry = nullptr;
     InstanceId instanceId = -1;
     MirrorManager* mirrorManager = nullptr;
+    juce::SharedResourcePointer<RealtimeScheduler> realtimeScheduler;
+    juce::SharedResourcePointer<ParameterDiscoveryCache> discoveryCache;
     bool waveformStreamActive = false;
     std::atomic<bool> nodeMetersEnabled{true};
+    bool sessionOverviewEnabled = false;             // Counted as a viewer on the AnalysisBus
+    std::vector<AnalysisBus::Frame> overviewFrames;  // Reused by buildSessionOverview()
     std::atomic<bool> matchLockEnabled{false};
     std::atomic<float> matchLockReferenceOffset{0.0f};  // Target offset in dB, captured on enable
     std::atomic<int> matchLockStuckCounter{0};           // Frames at gain limit
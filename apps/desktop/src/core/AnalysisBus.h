@@ -0,0 +1,172 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using InstanceId = int;
+
+/**
+ * Session-wide analysis overview: one fixed slot per instance holding its latest compact
+ * analysis frame (short-term LUFS, peak, RMS and a reduced spectrum).
+ *
+ * Owned by InstanceRegistry. Each instance's AnalysisPublisher writes its own slot; any
+ * editor can read every slot at a cost that depends only on the number of instances, so
+ * one open editor can draw the whole session without the others opening a WebView.
+ *
+ * Slots are seqlocks: one writer per slot, any number of readers, no locks on either
+ * side. A reader that races a write retries, and after kMaxReadRetries skips that slot
+ * for the round.
+ *
+ * Viewers (editors showing the overview) register so publishers can tell whether anybody
+ * is looking: with no viewers, instances publish at a low rate.
+ */
+class AnalysisBus
+{
+public:
+    static constexpr int kMaxInstances = 256;
+    static constexpr int kNumBands = 32;          // Log-spaced, kMinBandHz..kMaxBandHz
+    static constexpr float kMinBandHz = 20.0f;
+    static constexpr float kMaxBandHz = 20000.0f;
+    static constexpr float kFloorDb = -100.0f;
+    static constexpr int kMaxReadRetries = 4;
+
+    struct Frame
+    {
+        InstanceId instanceId = -1;
+        float lufsShort = kFloorDb;
+        float peakDb = kFloorDb;
+        float rmsDb = kFloorDb;
+        std::array<float, kNumBands> bandsDb {};
+        double publishedAtMs = 0.0;     // juce::Time::getMillisecondCounterHiRes() of the write
+    };
+
+    AnalysisBus() = default;
+
+    /** Claim a slot for an instance. Returns the slot index, or -1 if the bus is full. */
+    int attach(InstanceId id)
+    {
+        for (int i = 0; i < kMaxInstances; ++i)
+        {
+            InstanceId expected = -1;
+            if (slots[static_cast<size_t>(i)].owner.compare_exchange_strong(expected, id))
+            {
+                slots[static_cast<size_t>(i)].published.store(false, std::memory_order_release);
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    void detach(int slot)
+    {
+        if (!juce::isPositiveAndBelow(slot, kMaxInstances))
+            return;
+
+        auto& s = slots[static_cast<size_t>(slot)];
+        s.published.store(false, std::memory_order_release);
+        s.owner.store(-1, std::memory_order_release);
+    }
+
+    /** Writer (the slot's owner only). Lock- and allocation-free. */
+    void publish(int slot, const Frame& frame) noexcept
+    {
+        if (!juce::isPositiveAndBelow(slot, kMaxInstances))
+            return;
+
+        auto& s = slots[static_cast<size_t>(slot)];
+        const auto seq = s.sequence.load(std::memory_order_relaxed);
+        s.sequence.store(seq + 1, std::memory_order_relaxed);   // Odd: write in progress
+        std::atomic_thread_fence(std::memory_order_release);
+
+        s.values[kLufs].store(frame.lufsShort, std::memory_order_relaxed);
+        s.values[kPeak].store(frame.peakDb, std::memory_order_relaxed);
+        s.values[kRms].store(frame.rmsDb, std::memory_order_relaxed);
+        for (int b = 0; b < kNumBands; ++b)
+            s.values[static_cast<size_t>(kFirstBand + b)].store(frame.bandsDb[static_cast<size_t>(b)], std::memory_order_relaxed);
+        s.publishedAtMs.store(frame.publishedAtMs, std::memory_order_relaxed);
+
+        s.sequence.store(seq + 2, std::memory_order_release);
+        s.published.store(true, std::memory_order_release);
+    }
+
+    /** Append every slot that has published at least once. Returns the number appended. */
+    int readAll(std::vector<Frame>& out) const
+    {
+        int count = 0;
+        for (int i = 0; i < kMaxInstances; ++i)
+        {
+            Frame frame;
+            if (read(i, frame))
+            {
+                out.push_back(frame);
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    /** Consistent copy of one slot. False if unowned, never published or still contended. */
+    bool read(int slot, Frame& out) const noexcept
+    {
+        if (!juce::isPositiveAndBelow(slot, kMaxInstances))
+            return false;
+
+        const auto& s = slots[static_cast<size_t>(slot)];
+        const auto owner = s.owner.load(std::memory_order_acquire);
+        if (owner < 0 || !s.published.load(std::memory_order_acquire))
+            return false;
+
+        for (int attempt = 0; attempt < kMaxReadRetries; ++attempt)
+        {
+            const auto before = s.sequence.load(std::memory_order_acquire);
+            if ((before & 1u) != 0)
+                continue;
+
+            out.instanceId = owner;
+            out.lufsShort = s.values[kLufs].load(std::memory_order_relaxed);
+            out.peakDb = s.values[kPeak].load(std::memory_order_relaxed);
+            out.rmsDb = s.values[kRms].load(std::memory_order_relaxed);
+            for (int b = 0; b < kNumBands; ++b)
+                out.bandsDb[static_cast<size_t>(b)] = s.values[static_cast<size_t>(kFirstBand + b)].load(std::memory_order_relaxed);
+            out.publishedAtMs = s.publishedAtMs.load(std::memory_order_relaxed);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (s.sequence.load(std::memory_order_relaxed) == before)
+                return true;
+        }
+
+        return false;
+    }
+
+    /** Lower edge of band b in Hz (b == kNumBands gives the top edge). */
+    static float getBandEdgeHz(int b) noexcept
+    {
+        return kMinBandHz * std::pow(kMaxBandHz / kMinBandHz, static_cast<float>(b) / static_cast<float>(kNumBands));
+    }
+
+    // Viewers
+    void addViewer() noexcept { viewers.fetch_add(1, std::memory_order_relaxed); }
+    void removeViewer() noexcept { viewers.fetch_sub(1, std::memory_order_relaxed); }
+    bool hasViewers() const noexcept { return viewers.load(std::memory_order_relaxed) > 0; }
+
+private:
+    enum : int { kLufs = 0, kPeak, kRms, kFirstBand, kNumValues = kFirstBand + kNumBands };
+
+    struct Slot
+    {
+        std::atomic<InstanceId> owner { -1 };
+        std::atomic<bool> published { false };
+        std::atomic<uint32_t> sequence { 0 };
+        std::array<std::atomic<float>, static_cast<size_t>(kNumValues)> values {};
+        std::atomic<double> publishedAtMs { 0.0 };
+    };
+
+    std::array<Slot, static_cast<size_t>(kMaxInstances)> slots;
+    std::atomic<int> viewers { 0 };
+
+    JUCE_DECLARE_NON_COPYABLE(AnalysisBus)
+};
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+/**
+ * One instance's input audio, offered to other instances as a sidechain source.
+ *
+ * The source's audio thread writes each block once into a small ring of block slots;
+ * every subscriber (a sidechained plugin or a ducking group in another instance) reads
+ * from the same ring, so one kick track can key twenty bass and pad instances with no
+ * host sends or extra buses. Owned by InstanceRegistry (one per source instance) and
+ * shared through shared_ptr, so either side can go away first.
+ *
+ * Alignment — subscribers get the source's previous block:
+ *   Blocks are tagged with the host timeline position (AudioPlayHead time in samples).
+ *   A subscriber rendering the block at position P reads the source block written at
+ *   P - numSamples, whether or not the host has already run the source for P this
+ *   cycle. The result is a fixed one-block delay that doesn't depend on the order in
+ *   which the host renders tracks. Without a usable position (transport stopped on hosts
+ *   that freeze it, or no playhead) the newest complete block is used instead: zero or
+ *   one block late depending on track order.
+ *
+ * Thread safety: addSubscriber/removeSubscriber on the message thread; write() from the
+ * source's audio thread only; read() from any number of subscriber audio threads. Slots
+ * are seqlocked — a read that overlaps a rewrite of the same slot (the subscriber lagging
+ * kNumBlocks behind) returns silence for that block rather than torn audio.
+ */
+class AudioTap
+{
+public:
+    static constexpr int kNumBlocks = 4;
+    static constexpr int kMaxBlockSamples = 8192;
+    static constexpr int kNumChannels = 2;
+
+    enum class ReadResult { aligned, newest, silent };
+
+    AudioTap() = default;
+
+    /** First subscriber allocates the ring; until then write() is a no-op. */
+    void addSubscriber()
+    {
+        if (!ready.load(std::memory_order_acquire))
+        {
+            samples.assign(static_cast<size_t>(kNumBlocks * kNumChannels * kMaxBlockSamples), 0.0f);
+            ready.store(true, std::memory_order_release);
+        }
+        subscribers.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void removeSubscriber()
+    {
+        jassert(subscribers.load(std::memory_order_relaxed) > 0);
+        subscribers.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    int getNumSubscribers() const noexcept { return subscribers.load(std::memory_order_relaxed); }
+
+    /** Source audio thread. position < 0 = no timeline position this block. */
+    void write(const juce::AudioBuffer<float>& source, int numSamples, int64_t position) noexcept
+    {
+        if (subscribers.load(std::memory_order_relaxed) == 0 || !ready.load(std::memory_order_acquire))
+            return;
+
+        const auto block = nextBlock++;
+        auto& slot = slots[static_cast<size_t>(block % kNumBlocks)];
+        const int n = juce::jmin(numSamples, kMaxBlockSamples);
+
+        const auto seq = slot.sequence.load(std::memory_order_relaxed);
+        slot.sequence.store(seq + 1, std::memory_order_relaxed);   // Odd: write in progress
+        std::atomic_thread_fence(std::memory_order_release);
+
+        for (int ch = 0; ch < kNumChannels; ++ch)
+        {
+            const int srcCh = juce::jmin(ch, source.getNumChannels() - 1);
+            auto* dest = channelData(block % kNumBlocks, ch);
+            if (srcCh >= 0)
+                juce::FloatVectorOperations::copy(dest, source.getReadPointer(srcCh), n);
+            else
+                juce::FloatVectorOperations::clear(dest, n);
+        }
+        slot.position.store(position, std::memory_order_relaxed);
+        slot.numSamples.store(n, std::memory_order_relaxed);
+        slot.block.store(block, std::memory_order_relaxed);
+
+        slot.sequence.store(seq + 2, std::memory_order_release);
+        latestBlock.store(static_cast<int64_t>(block), std::memory_order_release);
+    }
+
+    /** Subscriber audio thread. Fills numSamples of both channels of dest (zeros past the
+        source's block length). See the class comment for which block is returned. */
+    ReadResult read(juce::AudioBuffer<float>& dest, int numSamples, int64_t position) const noexcept
+    {
+        const int n = juce::jmin(numSamples, dest.getNumSamples());
+        const auto latest = latestBlock.load(std::memory_order_acquire);
+
+        if (!ready.load(std::memory_order_acquire) || latest < 0)
+        {
+            clear(dest, n);
+            return ReadResult::silent;
+        }
+
+        // Aligned: the block that started exactly one block before ours
+        if (position >= 0)
+        {
+            const auto wanted = position - numSamples;
+            for (int64_t b = latest; b > latest - kNumBlocks && b >= 0; --b)
+            {
+                const auto& slot = slots[static_cast<size_t>(b % kNumBlocks)];
+                if (slot.position.load(std::memory_order_relaxed) == wanted
+                    && copyBlock(b, dest, n))
+                    return ReadResult::aligned;
+            }
+        }
+
+        if (copyBlock(latest, dest, n))
+            return ReadResult::newest;
+
+        clear(dest, n);
+        return ReadResult::silent;
+    }
+
+private:
+    struct Slot
+    {
+        std::atomic<uint32_t> sequence { 0 };
+        std::atomic<int64_t> position { -1 };
+        std::atomic<int> numSamples { 0 };
+        std::atomic<uint64_t> block { 0 };
+    };
+
+    float* channelData(uint64_t slot, int ch) noexcept
+    {
+        return samples.data() + (slot * kNumChannels + static_cast<uint64_t>(ch)) * kMaxBlockSamples;
+    }
+
+    const float* channelData(uint64_t slot, int ch) const noexcept
+    {
+        return samples.data() + (slot * kNumChannels + static_cast<uint64_t>(ch)) * kMaxBlockSamples;
+    }
+
+    bool copyBlock(int64_t block, juce::AudioBuffer<float>& dest, int n) const noexcept
+    {
+        const auto index = static_cast<uint64_t>(block) % kNumBlocks;
+        const auto& slot = slots[static_cast<size_t>(index)];
+
+        const auto before = slot.sequence.load(std::memory_order_acquire);
+        if ((before & 1u) != 0 || slot.block.load(std::memory_order_relaxed) != static_cast<uint64_t>(block))
+            return false;
+
+        const int available = juce::jmin(n, slot.numSamples.load(std::memory_order_relaxed));
+        for (int ch = 0; ch < juce::jmin(kNumChannels, dest.getNumChannels()); ++ch)
+        {
+            juce::FloatVectorOperations::copy(dest.getWritePointer(ch), channelData(index, ch), available);
+            if (available < n)
+                juce::FloatVectorOperations::clear(dest.getWritePointer(ch) + available, n - available);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return slot.sequence.load(std::memory_order_relaxed) == before;
+    }
+
+    static void clear(juce::AudioBuffer<float>& dest, int n) noexcept
+    {
+        for (int ch = 0; ch < dest.getNumChannels(); ++ch)
+            juce::FloatVectorOperations::clear(dest.getWritePointer(ch), n);
+    }
+
+    std::vector<float> samples;                 // kNumBlocks x kNumChannels x kMaxBlockSamples
+    std::array<Slot, kNumBlocks> slots;
+    std::atomic<bool> ready { false };
+    std::atomic<int> subscribers { 0 };
+    std::atomic<int64_t> latestBlock { -1 };
+    uint64_t nextBlock = 0;                     // Source audio thread only
+
+    JUCE_DECLARE_NON_COPYABLE(AudioTap)
+};
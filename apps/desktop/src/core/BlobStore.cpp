@@ -0,0 +1,363 @@
+#include "BlobStore.h"
+#include "../utils/PlatformPaths.h"
+#include "../utils/ProChainLogger.h"
+#include <juce_cryptography/juce_cryptography.h>
+
+BlobStore::BlobStore()
+    : BlobStore(PlatformPaths::getPluginCacheDirectory().getChildFile("Blobs"))
+{
+}
+
+BlobStore::BlobStore(const juce::File& rootDirectory, size_t memoryBudgetBytes)
+    : rootDir(rootDirectory),
+      memoryBudget(memoryBudgetBytes)
+{
+    rootDir.createDirectory();
+    removeStaleSpillFiles();
+}
+
+juce::String BlobStore::hashOf(const juce::MemoryBlock& data)
+{
+    return juce::SHA256(data).toHexString();
+}
+
+juce::String BlobStore::store(const juce::MemoryBlock& data, bool persist)
+{
+    auto hash = hashOf(data);
+    auto key = hash.toStdString();
+
+    bool needsWrite = false;
+    Blob blob;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(key);
+        if (it != entries.end())
+        {
+            touchLocked(it->second, key);
+            needsWrite = persist && !it->second.persisted;
+            if (needsWrite)
+                it->second.persisted = true;
+            blob = it->second.data;
+        }
+        else
+        {
+            blob = std::make_shared<const juce::MemoryBlock>(data);
+            // Already on disk from an earlier session? Then nothing to write.
+            needsWrite = persist && !persistedFileFor(hash).existsAsFile();
+            insertLocked(key, blob, persist);
+        }
+    }
+
+    // Disk I/O outside the lock
+    writePendingSpills();
+    if (needsWrite && !writeAtomically(persistedFileFor(hash), *blob))
+        PCLOG("BlobStore — failed to write " + hash);
+
+    return hash;
+}
+
+BlobStore::Blob BlobStore::fetch(const juce::String& hash)
+{
+    auto key = hash.toStdString();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(key);
+        if (it != entries.end())
+        {
+            ++hits;
+            touchLocked(it->second, key);
+            return it->second.data;
+        }
+
+        // Evicted a moment ago and its spill file isn't written yet
+        auto spilling = spillsInFlight.find(key);
+        if (spilling != spillsInFlight.end())
+        {
+            ++hits;
+            return spilling->second;
+        }
+        ++misses;
+    }
+
+    // Disk tier: persisted first, then spilled snapshot chunks
+    bool persisted = true;
+    auto file = persistedFileFor(hash);
+    if (!file.existsAsFile())
+    {
+        file = spillFileFor(hash);
+        persisted = false;
+    }
+
+    juce::MemoryBlock data;
+    if (!file.existsAsFile() || !file.loadFileAsData(data))
+        return nullptr;
+
+    // Never hand out a corrupted chunk — plugins don't all validate their state
+    if (hashOf(data) != hash)
+    {
+        PCLOG("BlobStore — hash mismatch for " + file.getFileName() + ", ignoring");
+        return nullptr;
+    }
+
+    auto blob = std::make_shared<const juce::MemoryBlock>(std::move(data));
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (entries.find(key) == entries.end())
+            insertLocked(key, blob, persisted);
+    }
+    writePendingSpills();
+    return blob;
+}
+
+bool BlobStore::contains(const juce::String& hash)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        const auto key = hash.toStdString();
+        if (entries.count(key) > 0 || spillsInFlight.count(key) > 0)
+            return true;
+    }
+    return persistedFileFor(hash).existsAsFile() || spillFileFor(hash).existsAsFile();
+}
+
+int BlobStore::externaliseChunks(juce::XmlElement& tree, bool persist, size_t minBytes)
+{
+    int count = 0;
+
+    auto stateBase64 = tree.getStringAttribute("state");
+    if (stateBase64.isNotEmpty())
+    {
+        juce::MemoryBlock chunk;
+        if (chunk.fromBase64Encoding(stateBase64) && chunk.getSize() >= minBytes)
+        {
+            tree.setAttribute("stateRef", store(chunk, persist));
+            tree.removeAttribute("state");
+            ++count;
+        }
+    }
+
+    for (auto* child : tree.getChildIterator())
+        count += externaliseChunks(*child, persist, minBytes);
+
+    return count;
+}
+
+int BlobStore::resolveChunks(juce::XmlElement& tree)
+{
+    int unresolved = 0;
+
+    auto ref = tree.getStringAttribute("stateRef");
+    if (ref.isNotEmpty())
+    {
+        if (auto blob = fetch(ref))
+        {
+            tree.setAttribute("state", blob->toBase64Encoding());
+            tree.removeAttribute("stateRef");
+        }
+        else
+        {
+            PCLOG("BlobStore — unresolved chunk " + ref);
+            ++unresolved;
+        }
+    }
+
+    for (auto* child : tree.getChildIterator())
+        unresolved += resolveChunks(*child);
+
+    return unresolved;
+}
+
+void BlobStore::collectReferences(const juce::XmlElement& tree, std::set<juce::String>& out)
+{
+    auto ref = tree.getStringAttribute("stateRef");
+    if (ref.isNotEmpty())
+        out.insert(ref);
+
+    for (auto* child : tree.getChildIterator())
+        collectReferences(*child, out);
+}
+
+void BlobStore::collectReferencesInDirectory(const juce::File& directory, const juce::String& wildcard,
+                                             std::set<juce::String>& out)
+{
+    if (!directory.isDirectory())
+        return;
+
+    const juce::String marker = "stateRef=\"";
+    for (const auto& entry : juce::RangedDirectoryIterator(directory, true, wildcard))
+    {
+        auto text = entry.getFile().loadFileAsString();
+        for (int pos = text.indexOf(marker); pos >= 0; pos = text.indexOf(pos, marker))
+        {
+            pos += marker.length();
+            auto end = text.indexOfChar(pos, '"');
+            if (end < 0)
+                break;
+            out.insert(text.substring(pos, end));
+            pos = end;
+        }
+    }
+}
+
+int BlobStore::collectGarbage(const std::set<juce::String>& liveHashes, juce::RelativeTime minAge)
+{
+    int removed = 0;
+    auto cutoff = juce::Time::getCurrentTime() - minAge;
+
+    for (const auto& entry : juce::RangedDirectoryIterator(rootDir, true, "*.blob"))
+    {
+        auto file = entry.getFile();
+        if (file.getParentDirectory().getFileName() == "spill")
+            continue;
+
+        auto hash = file.getFileNameWithoutExtension();
+        if (liveHashes.count(hash) > 0 || entry.getModificationTime() > cutoff)
+            continue;
+
+        if (file.deleteFile())
+            ++removed;
+
+        // Keep the in-memory copy (a snapshot may still use it) but forget it was persisted
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(hash.toStdString());
+        if (it != entries.end())
+            it->second.persisted = false;
+    }
+
+    if (removed > 0)
+        PCLOG("BlobStore — removed " + juce::String(removed) + " unreferenced chunks");
+
+    return removed;
+}
+
+int BlobStore::collectLibraryGarbage()
+{
+    std::set<juce::String> live;
+    collectReferencesInDirectory(PlatformPaths::getPresetsDirectory(), "*.pcmpreset", live);
+    collectReferencesInDirectory(PlatformPaths::getGroupTemplatesDirectory(), "*.pcmgroup", live);
+    return collectGarbage(live);
+}
+
+void BlobStore::scheduleLibraryGarbageCollection()
+{
+    if (libraryCollectionQueued.exchange(true))
+        return;
+
+    backgroundPool.addJob([this]() {
+        // Cleared before the scan so a delete landing mid-scan queues another pass
+        libraryCollectionQueued.store(false);
+        collectLibraryGarbage();
+    });
+}
+
+void BlobStore::setMemoryBudget(size_t bytes)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        memoryBudget = bytes;
+        evictLocked();
+    }
+    writePendingSpills();
+}
+
+BlobStore::Stats BlobStore::getStats() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    Stats stats;
+    stats.hits = hits;
+    stats.misses = misses;
+    stats.memoryBytes = static_cast<juce::int64>(memoryBytes);
+    stats.memoryEntries = static_cast<int>(entries.size());
+    return stats;
+}
+
+juce::File BlobStore::persistedFileFor(const juce::String& hash) const
+{
+    return rootDir.getChildFile(hash.substring(0, 2)).getChildFile(hash + ".blob");
+}
+
+juce::File BlobStore::spillFileFor(const juce::String& hash) const
+{
+    return rootDir.getChildFile("spill").getChildFile(hash + ".blob");
+}
+
+bool BlobStore::writeAtomically(const juce::File& file, const juce::MemoryBlock& data)
+{
+    file.getParentDirectory().createDirectory();
+
+    // Write to temp then rename — a crash mid-write never leaves a truncated blob
+    auto tempFile = file.getSiblingFile(file.getFileName() + ".tmp");
+    if (!tempFile.replaceWithData(data.getData(), data.getSize()))
+        return false;
+    return tempFile.moveFileTo(file);
+}
+
+void BlobStore::insertLocked(const std::string& key, Blob data, bool persisted)
+{
+    lru.push_front(key);
+    memoryBytes += data->getSize();
+    entries[key] = Entry { std::move(data), persisted, lru.begin() };
+    evictLocked();
+}
+
+void BlobStore::touchLocked(Entry& entry, const std::string& key)
+{
+    lru.erase(entry.lruPosition);
+    lru.push_front(key);
+    entry.lruPosition = lru.begin();
+}
+
+void BlobStore::evictLocked()
+{
+    // Always keep the most recent entry, even if it alone exceeds the budget
+    while (memoryBytes > memoryBudget && lru.size() > 1)
+    {
+        auto key = lru.back();
+        lru.pop_back();
+
+        auto it = entries.find(key);
+        if (it == entries.end())
+            continue;
+
+        // Snapshot-only chunk: spill so the snapshot stays restorable. The write happens
+        // in writePendingSpills() once the lock is released.
+        if (!it->second.persisted && spillsInFlight.emplace(key, it->second.data).second)
+            pendingSpills.emplace_back(key, it->second.data);
+
+        memoryBytes -= it->second.data->getSize();
+        entries.erase(it);
+    }
+}
+
+void BlobStore::writePendingSpills()
+{
+    std::vector<std::pair<std::string, Blob>> work;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        work.swap(pendingSpills);
+    }
+
+    for (const auto& [key, blob] : work)
+    {
+        auto spill = spillFileFor(juce::String(key));
+        if (!spill.existsAsFile() && !writeAtomically(spill, *blob))
+            PCLOG("BlobStore — failed to spill " + juce::String(key));
+
+        std::lock_guard<std::mutex> lock(mutex);
+        spillsInFlight.erase(key);
+    }
+}
+
+void BlobStore::removeStaleSpillFiles()
+{
+    auto spillDir = rootDir.getChildFile("spill");
+    if (!spillDir.isDirectory())
+        return;
+
+    auto cutoff = juce::Time::getCurrentTime() - juce::RelativeTime::days(kSpillMaxAgeDays);
+    for (const auto& entry : juce::RangedDirectoryIterator(spillDir, false, "*.blob"))
+    {
+        if (entry.getModificationTime() < cutoff)
+            entry.getFile().deleteFile();
+    }
+}
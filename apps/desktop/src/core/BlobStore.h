@@ -0,0 +1,149 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * Content-addressed store for plugin state chunks.
+ *
+ * Chunks are keyed by the SHA-256 of their bytes. Presets and group templates
+ * reference chunks by hash (stateRef="...") instead of embedding base64, and
+ * in-memory chain snapshots share the same blobs, so a chunk that appears in
+ * ten presets and fifty undo steps is stored once.
+ *
+ * Two tiers:
+ *  - In-memory LRU bounded by a byte budget (hits counted in getStats()).
+ *  - On-disk directory: <root>/<2-char prefix>/<hash>.blob for persisted
+ *    chunks, <root>/spill/<hash>.blob for snapshot-only chunks evicted from
+ *    memory (so a snapshot never loses its state). Spill files are written
+ *    after the store lock is released; until then the evicted chunk stays
+ *    fetchable from the pending list. Spill files older than kSpillMaxAgeDays
+ *    are removed on construction.
+ *
+ * One store per process — share it via juce::SharedResourcePointer<BlobStore>,
+ * like InstanceRegistry. All methods are thread-safe.
+ */
+class BlobStore
+{
+public:
+    using Blob = std::shared_ptr<const juce::MemoryBlock>;
+
+    BlobStore();
+    explicit BlobStore(const juce::File& rootDirectory, size_t memoryBudgetBytes = kDefaultMemoryBudget);
+    ~BlobStore() = default;
+
+    /** SHA-256 of the bytes, lowercase hex. */
+    static juce::String hashOf(const juce::MemoryBlock& data);
+
+    /** Add a chunk and return its hash. persist = also write to the on-disk tier
+        (presets/templates); otherwise it lives in memory and spills on eviction. */
+    juce::String store(const juce::MemoryBlock& data, bool persist);
+
+    /** Look up a chunk by hash: memory first, then disk. nullptr if unknown. */
+    Blob fetch(const juce::String& hash);
+
+    bool contains(const juce::String& hash);
+
+    // =============================================
+    // XML helpers — chunk attribute "state" (MemoryBlock base64) <-> "stateRef" (hash)
+    // =============================================
+
+    /** Replace every state="..." at or below `tree` with stateRef="<hash>".
+        Chunks smaller than minBytes stay inline (no dedup win). Returns the number externalised. */
+    int externaliseChunks(juce::XmlElement& tree, bool persist, size_t minBytes = kMinExternalBytes);
+
+    /** Replace every stateRef="<hash>" with the chunk's state="...". Returns the number of
+        references that could not be resolved (left in place, logged). */
+    int resolveChunks(juce::XmlElement& tree);
+
+    /** Collect every stateRef hash at or below `tree` into `out`. */
+    static void collectReferences(const juce::XmlElement& tree, std::set<juce::String>& out);
+
+    /** Collect every stateRef hash in files matching `wildcard` below `directory`.
+        Plain text scan — much cheaper than parsing each file as XML. */
+    static void collectReferencesInDirectory(const juce::File& directory, const juce::String& wildcard,
+                                             std::set<juce::String>& out);
+
+    /** Delete persisted blobs not in `liveHashes`. Blobs written within `minAge` are kept,
+        so a save racing with the collection (another plugin instance) can't lose its chunks.
+        Returns the number removed. */
+    int collectGarbage(const std::set<juce::String>& liveHashes,
+                       juce::RelativeTime minAge = juce::RelativeTime::hours(1));
+
+    /** collectGarbage() with the live set taken from the preset and group template libraries. */
+    int collectLibraryGarbage();
+
+    /** Run collectLibraryGarbage() on the store's background thread. Requests made while one
+        is already queued are merged into it, so deleting many presets costs one library scan. */
+    void scheduleLibraryGarbageCollection();
+
+    // =============================================
+    // Budget / stats
+    // =============================================
+
+    void setMemoryBudget(size_t bytes);
+
+    struct Stats
+    {
+        juce::int64 hits = 0;
+        juce::int64 misses = 0;
+        juce::int64 memoryBytes = 0;
+        int memoryEntries = 0;
+    };
+    Stats getStats() const;
+
+    juce::File getRootDirectory() const { return rootDir; }
+
+    static constexpr size_t kDefaultMemoryBudget = 64 * 1024 * 1024;
+    static constexpr size_t kMinExternalBytes = 1024;
+    static constexpr int kSpillMaxAgeDays = 2;
+
+private:
+    struct Entry
+    {
+        Blob data;
+        bool persisted = false;
+        std::list<std::string>::iterator lruPosition;
+    };
+
+    juce::File persistedFileFor(const juce::String& hash) const;
+    juce::File spillFileFor(const juce::String& hash) const;
+    static bool writeAtomically(const juce::File& file, const juce::MemoryBlock& data);
+
+    // Caller holds mutex
+    void insertLocked(const std::string& key, Blob data, bool persisted);
+    void touchLocked(Entry& entry, const std::string& key);
+    void evictLocked();
+
+    /** Write the spill files queued by evictLocked(). Caller must NOT hold mutex. */
+    void writePendingSpills();
+
+    void removeStaleSpillFiles();
+
+    juce::File rootDir;
+    size_t memoryBudget;
+
+    mutable std::mutex mutex;
+    std::unordered_map<std::string, Entry> entries;
+    std::list<std::string> lru;  // front = most recently used
+    size_t memoryBytes = 0;
+    juce::int64 hits = 0;
+    juce::int64 misses = 0;
+
+    // Evicted snapshot-only chunks waiting for their spill file (guarded by mutex)
+    std::vector<std::pair<std::string, Blob>> pendingSpills;
+    std::unordered_map<std::string, Blob> spillsInFlight;
+
+    std::atomic<bool> libraryCollectionQueued { false };
+    juce::ThreadPool backgroundPool { 1 };  // Last: joined before the state it uses is destroyed
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BlobStore)
+};
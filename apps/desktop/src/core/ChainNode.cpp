@@ -129,4 +129,40 @@ bool isDescendant(const ChainNode& ancestor, ChainNodeId descendantId)
     return false;
 }
 
+bool getPath(const ChainNode& root, ChainNodeId id, std::vector<int>& path)
+{
+    if (root.id == id)
+        return true;
+
+    if (root.isGroup())
+    {
+        const auto& children = root.getGroup().children;
+        for (int i = 0; i < static_cast<int>(children.size()); ++i)
+        {
+            path.push_back(i);
+            if (getPath(*children[static_cast<size_t>(i)], id, path))
+                return true;
+            path.pop_back();
+        }
+    }
+    return false;
+}
+
+ChainNode* findByPath(ChainNode& root, const std::vector<int>& path)
+{
+    ChainNode* node = &root;
+    for (int index : path)
+    {
+        if (!node->isGroup())
+            return nullptr;
+
+        auto& children = node->getGroup().children;
+        if (!juce::isPositiveAndBelow(index, static_cast<int>(children.size())))
+            return nullptr;
+
+        node = children[static_cast<size_t>(index)].get();
+    }
+    return node;
+}
+
 } // namespace ChainNodeHelpers
@@ -48,7 +48,9 @@ struct PluginLeaf
     float inputGainDb = 0.0f;
     float outputGainDb = 0.0f;
     float dryWetMix = 1.0f;          // 0.0=dry, 1.0=wet
-    int sidechainSource = 0;          // 0=none, 1=external (host SC bus)
+    int sidechainSource = 0;          // 0=none, 1=external (host SC bus), 2=another instance's audio tap
+    int sidechainTapSource = -1;      // InstanceId of the tap source (sidechainSource == 2)
+    juce::String sidechainTapTrack;   // Its track name — re-resolves the tap after a session reload
     MidSideMode midSideMode = MidSideMode::Off;  // M/S processing mode
 
     // Utility graph node IDs (created during wiring, NOT serialized)
@@ -72,6 +74,8 @@ struct GroupData
     float dryWetMix = 1.0f;
     float duckAmount = 0.0f;       // 0.0 = no ducking, 1.0 = full ducking (serial and parallel groups)
     float duckReleaseMs = 200.0f;  // Envelope release time in ms (50-1000)
+    int duckKeySource = -1;        // InstanceId whose audio tap keys the ducking; -1 = pre-group signal
+    juce::String duckKeyTrack;     // Its track name — re-resolves the tap after a session reload
     std::vector<std::unique_ptr<ChainNode>> children;
 
     // Internal graph node IDs created during rebuildGraph (not serialized)
@@ -123,4 +127,11 @@ namespace ChainNodeHelpers
 
     // Check if a node is a descendant of another
     bool isDescendant(const ChainNode& ancestor, ChainNodeId descendantId);
+
+    // Child-index path from root to a node (empty for the root). Paths identify the same
+    // position in another instance's tree, where ChainNodeIds differ. False if not found.
+    bool getPath(const ChainNode& root, ChainNodeId id, std::vector<int>& path);
+
+    // Resolve a child-index path (returns nullptr if it leaves the tree)
+    ChainNode* findByPath(ChainNode& root, const std::vector<int>& path);
 }
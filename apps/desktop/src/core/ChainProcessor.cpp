@@ -97,6 +97,7 @@ ChainProcessor::ChainProcessor(PluginManager& pm)
 
     // Initialize parameter watcher for tracking child plugin knob changes
     parameterWatcher = std::make_unique<PluginParameterWatcher>(
+        parameterMirror,
         [this](const juce::String& beforeSnapshot) {
             if (onPluginParameterChangeSettled)
                 onPluginParameterChangeSettled(beforeSnapshot);
@@ -121,8 +122,19 @@ ChainProcessor::~ChainProcessor() noexcept
 
     hideAllPluginWindows();
 
+    // Scene recall batches hold Node::Ptr references into the graph
+    delete pendingSceneRecall.exchange(nullptr);
+    retireSceneRecalls();
+
     // Clean up crash recovery temp file on normal exit
     cleanupCrashRecoveryFile();
+
+    // Owners normally detach first (setInstanceRegistry(nullptr, -1)); this covers the rest
+    if (instanceRegistry != nullptr)
+        instanceRegistry->removeListener(this);
+    for (auto& input : tapInputs)
+        if (input->tap != nullptr)
+            input->tap->removeSubscriber();
 }
 
 void ChainProcessor::setParameterWatcherSuppressed(bool suppressed)
@@ -159,8 +171,18 @@ void ChainProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBu
         return;
     }
 
+    // Scene recall lands on a block boundary, before this block renders
+    if (pendingSceneRecall.load(std::memory_order_relaxed) != nullptr)
+        applyPendingSceneRecall();
+
+    // One copy per subscribed source per block, shared by every node keyed from it
+    pullAudioTaps();
+
     AudioProcessorGraph::processBlock(buffer, midi);
 
+    if (swapFadeState.load(std::memory_order_acquire) != SwapFadeIdle)
+        applySwapFade(buffer);
+
     // Check if any hosted plugin reported a latency change.
     // Done inside the audioThreadBusy bracket so getNodes() is safe to iterate
     // (the message thread spin-waits on this flag before modifying the graph).
@@ -179,6 +201,204 @@ void ChainProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBu
     audioThreadBusy.store(false, std::memory_order_release);
 }
 
+void ChainProcessor::applySwapFade(juce::AudioBuffer<float>& buffer)
+{
+    const int numSamples = buffer.getNumSamples();
+    const int fadeLength = juce::jmax(1, static_cast<int>(currentSampleRate * swapFadeMs.load(std::memory_order_relaxed) / 1000.0));
+    auto state = swapFadeState.load(std::memory_order_acquire);
+
+    // A new phase was requested (possibly interrupting the previous ramp)
+    if (state != swapFadeLastState)
+    {
+        swapFadePosition = 0;
+        swapFadeLastState = state;
+    }
+
+    if (state == SwapFadeSilent)
+    {
+        buffer.clear();
+        return;
+    }
+
+    if (state == SwapFadeOut || state == SwapFadeIn)
+    {
+        const int remaining = fadeLength - swapFadePosition;
+        const int rampSamples = juce::jmin(numSamples, juce::jmax(0, remaining));
+
+        const float start = static_cast<float>(swapFadePosition) / static_cast<float>(fadeLength);
+        const float end = static_cast<float>(swapFadePosition + rampSamples) / static_cast<float>(fadeLength);
+
+        if (state == SwapFadeOut)
+        {
+            for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+            {
+                buffer.applyGainRamp(ch, 0, rampSamples, 1.0f - start, 1.0f - end);
+                if (rampSamples < numSamples)
+                    buffer.clear(ch, rampSamples, numSamples - rampSamples);
+            }
+        }
+        else
+        {
+            for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+                buffer.applyGainRamp(ch, 0, rampSamples, start, end);
+        }
+
+        swapFadePosition += rampSamples;
+        if (swapFadePosition >= fadeLength)
+        {
+            // Only advance if the message thread hasn't moved the state on meanwhile
+            const bool fadedOut = state == SwapFadeOut;
+            if (swapFadeState.compare_exchange_strong(state, fadedOut ? SwapFadeSilent : SwapFadeIdle,
+                                                      std::memory_order_acq_rel)
+                && fadedOut)
+            {
+                swapFadeNotifier.triggerAsyncUpdate();
+            }
+        }
+    }
+}
+
+void ChainProcessor::restoreChainFromXmlAsync(std::unique_ptr<juce::XmlElement> chainXml,
+                                              std::vector<StagedPluginInstance> staged,
+                                              std::function<void(RestoreResult)> onDone)
+{
+    jassert(juce::MessageManager::getInstance()->isThisTheMessageThread());
+
+    // The earlier request is already fading; let it land before queueing this one
+    completePendingSwap();
+
+    pendingSwap = std::make_unique<PendingSwap>();
+    pendingSwap->chainXml = std::move(chainXml);
+    pendingSwap->staged = std::move(staged);
+    pendingSwap->onDone = std::move(onDone);
+
+    const auto fadeMs = swapFadeMs.load(std::memory_order_relaxed);
+    if (fadeMs <= 0.0f)
+    {
+        completePendingSwap();
+        return;
+    }
+
+    swapFadeState.store(SwapFadeOut, std::memory_order_release);
+
+    // The audio thread normally reports silence first. If the host isn't calling
+    // processBlock (transport stopped offline, no device) the swap goes ahead anyway.
+    const auto generation = ++swapGeneration;
+    juce::Timer::callAfterDelay(static_cast<int>(fadeMs * 4.0f) + 20, [this, alive = aliveFlag, generation]() {
+        if (alive->load(std::memory_order_acquire) && generation == swapGeneration)
+            completePendingSwap();
+    });
+}
+
+void ChainProcessor::completePendingSwap()
+{
+    if (pendingSwap == nullptr)
+        return;
+
+    auto swap = std::move(pendingSwap);
+    auto result = restoreChainFromXml(*swap->chainXml, &swap->staged);
+    if (swap->onDone)
+        swap->onDone(std::move(result));
+}
+
+void ChainProcessor::collectReusablePlugins()
+{
+    reusablePlugins.clear();
+    restoreFlatIndex = 0;
+
+    std::vector<PluginLeaf*> allPlugins;
+    ChainNodeHelpers::collectPluginsMut(rootNode, allPlugins);
+
+    int flatIndex = 0;
+    for (auto* plug : allPlugins)
+    {
+        if (plug->isDryPath)
+            continue;
+        if (plug->graphNodeId != NodeID())
+            reusablePlugins.push_back({ plug->description, plug->graphNodeId, flatIndex, false });
+        ++flatIndex;
+    }
+}
+
+juce::AudioProcessorGraph::NodeID ChainProcessor::claimReusablePlugin(const juce::String& fileOrIdentifier,
+                                                                     juce::PluginDescription& descOut)
+{
+    const int position = restoreFlatIndex++;
+    ReusablePlugin* match = nullptr;
+
+    for (auto& candidate : reusablePlugins)
+    {
+        if (candidate.claimed || candidate.description.fileOrIdentifier != fileOrIdentifier)
+            continue;
+
+        // Same plugin at the same position is the best match; otherwise first unclaimed
+        if (candidate.flatIndex == position)
+        {
+            match = &candidate;
+            break;
+        }
+        if (match == nullptr)
+            match = &candidate;
+    }
+
+    if (match == nullptr)
+        return {};
+
+    match->claimed = true;
+    descOut = match->description;
+    return match->graphNodeId;
+}
+
+void ChainProcessor::removeUnclaimedPlugins()
+{
+    for (const auto& candidate : reusablePlugins)
+    {
+        if (!candidate.claimed)
+            AudioProcessorGraph::removeNode(candidate.graphNodeId);
+    }
+
+    reusablePlugins.clear();
+}
+
+bool ChainProcessor::pluginStateMatches(NodeID graphNodeId, const juce::String& stateBase64)
+{
+    auto gNode = getNodeForId(graphNodeId);
+    if (gNode == nullptr || gNode->getProcessor() == nullptr)
+        return false;
+
+    juce::MemoryBlock incoming;
+    if (!incoming.fromBase64Encoding(stateBase64))
+        return false;
+
+    juce::MemoryBlock current;
+    gNode->getProcessor()->getStateInformation(current);
+
+    // Size check first — most differing chunks differ in length too
+    return current.getSize() == incoming.getSize() && current == incoming;
+}
+
+std::unique_ptr<juce::AudioPluginInstance> ChainProcessor::takeStagedInstance(juce::PluginDescription& desc,
+                                                                              juce::int64& appliedStateHash)
+{
+    appliedStateHash = 0;
+    if (stagedInstances == nullptr)
+        return nullptr;
+
+    for (auto it = stagedInstances->begin(); it != stagedInstances->end(); ++it)
+    {
+        if (it->instance != nullptr && it->fileOrIdentifier == desc.fileOrIdentifier)
+        {
+            auto instance = std::move(it->instance);
+            desc = it->description;
+            appliedStateHash = it->appliedStateHash;
+            stagedInstances->erase(it);
+            return instance;
+        }
+    }
+
+    return nullptr;
+}
+
 //==============================================================================
 // Tree-based API
 //==============================================================================
@@ -187,6 +407,9 @@ bool ChainProcessor::addPlugin(const juce::PluginDescription& desc, ChainNodeId
 {
     jassert(juce::MessageManager::getInstance()->isThisTheMessageThread());
 
+    // Pre-edit path for the structural operation log
+    const auto parentPath = getNodePathVar(parentId);
+
     // Validate parent BEFORE acquiring lock (read-only check)
     ChainNode* parent = nullptr;
     {
@@ -196,6 +419,13 @@ bool ChainProcessor::addPlugin(const juce::PluginDescription& desc, ChainNodeId
             return false;
     }
 
+    // Heads-up before committing to a plugin that would push the chain past real time
+    const auto cpu = estimateChainCpu(&desc);
+    if (cpu.load > 0.8)
+        PCLOG("addPlugin — estimated chain CPU with " + desc.name + ": "
+              + juce::String(cpu.load * 100.0, 1) + "% of a core ("
+              + juce::String(cpu.numUnprofiled) + " plugins unprofiled)");
+
     // Create plugin instance WITHOUT holding lock (can take seconds!)
     PCLOG("addPlugin — loading " + desc.name + " (" + desc.pluginFormatName + ")");
     juce::String errorMessage;
@@ -269,6 +499,17 @@ bool ChainProcessor::addPlugin(const juce::PluginDescription& desc, ChainNodeId
         PCLOG("addPlugin — rebinding parameters");
         onParameterBindingChanged();
     }
+    if (onStructuralOperation)
+    {
+        juce::DynamicObject::Ptr op = new juce::DynamicObject();
+        op->setProperty("type", "add");
+        op->setProperty("parent", parentPath);
+        op->setProperty("index", insertIndex);
+        if (auto descXml = desc.createXml())
+            op->setProperty("plugin", descXml->toString(juce::XmlElement::TextFormat().singleLine()));
+        onStructuralOperation(juce::var(op.get()));
+    }
+
     PCLOG("addPlugin — done for " + desc.name);
     return true;
 }
@@ -278,6 +519,8 @@ ChainNodeId ChainProcessor::addDryPath(ChainNodeId parentId, int insertIndex)
     jassert(juce::MessageManager::getInstance()->isThisTheMessageThread());
     PCLOG("addDryPath — parentId=" + juce::String(parentId));
 
+    const auto parentPath = getNodePathVar(parentId);
+
     suspendProcessing(true);
 
     ChainNodeId newId = -1;
@@ -315,6 +558,15 @@ ChainNodeId ChainProcessor::addDryPath(ChainNodeId parentId, int insertIndex)
     suspendProcessing(false);
     notifyChainChanged();
 
+    if (onStructuralOperation)
+    {
+        juce::DynamicObject::Ptr op = new juce::DynamicObject();
+        op->setProperty("type", "dryPath");
+        op->setProperty("parent", parentPath);
+        op->setProperty("index", insertIndex);
+        onStructuralOperation(juce::var(op.get()));
+    }
+
     PCLOG("addDryPath — done, new nodeId=" + juce::String(newId));
     return newId;
 }
@@ -327,6 +579,8 @@ bool ChainProcessor::removeNode(ChainNodeId nodeId)
     if (nodeId == 0)
         return false; // Can't remove root
 
+    const auto nodePath = getNodePathVar(nodeId);
+
     suspendProcessing(true);
 
     // Perform tree manipulation with lock held briefly
@@ -394,6 +648,14 @@ bool ChainProcessor::removeNode(ChainNodeId nodeId)
     notifyChainChanged();
     if (onParameterBindingChanged)
         onParameterBindingChanged();
+
+    if (onStructuralOperation)
+    {
+        juce::DynamicObject::Ptr op = new juce::DynamicObject();
+        op->setProperty("type", "remove");
+        op->setProperty("node", nodePath);
+        onStructuralOperation(juce::var(op.get()));
+    }
     return true;
 }
 
@@ -522,20 +784,9 @@ bool ChainProcessor::duplicateNode(ChainNodeId nodeId)
 
     suspendProcessing(false);
 
-    // Clear automation bindings for the duplicated slot
-    // The duplicated plugin is inserted at childIndex + 1, which becomes
-    // a new slot index after rebuildGraph() recalculates the flat list.
-    // We call onUnbindSlot to ensure the duplicated plugin starts without
-    // inherited DAW automation mappings.
-    if (onUnbindSlot)
-    {
-        // Calculate the flat slot index for the duplicated node
-        // This is approximate - the exact index depends on the tree structure
-        // The onParameterBindingChanged callback will do a full rebind anyway
-        onUnbindSlot(childIndex + 1);
-    }
-
     notifyChainChanged();
+    // The duplicate is a new node: rebinding gives it its own automation slot rather
+    // than the original's automation
     if (onParameterBindingChanged)
         onParameterBindingChanged();
     return true;
@@ -548,6 +799,9 @@ bool ChainProcessor::moveNode(ChainNodeId nodeId, ChainNodeId newParentId, int n
     if (nodeId == 0)
         return false;
 
+    const auto nodePath = getNodePathVar(nodeId);
+    const auto parentPath = getNodePathVar(newParentId);
+
     suspendProcessing(true);
 
     // Perform tree manipulation with lock held briefly
@@ -619,6 +873,16 @@ bool ChainProcessor::moveNode(ChainNodeId nodeId, ChainNodeId newParentId, int n
     notifyChainChanged();
     if (onParameterBindingChanged)
         onParameterBindingChanged();
+
+    if (onStructuralOperation)
+    {
+        juce::DynamicObject::Ptr op = new juce::DynamicObject();
+        op->setProperty("type", "move");
+        op->setProperty("node", nodePath);
+        op->setProperty("parent", parentPath);
+        op->setProperty("index", newIndex);
+        onStructuralOperation(juce::var(op.get()));
+    }
     return true;
 }
 
@@ -707,6 +971,10 @@ ChainNodeId ChainProcessor::createGroup(const std::vector<ChainNodeId>& childIds
     if (childIds.empty())
         return -1;
 
+    juce::Array<juce::var> childPaths;
+    for (auto id : childIds)
+        childPaths.add(getNodePathVar(id));
+
     suspendProcessing(true);
 
     ChainNodeId groupId = -1;
@@ -811,6 +1079,16 @@ ChainNodeId ChainProcessor::createGroup(const std::vector<ChainNodeId>& childIds
     notifyChainChanged();
     if (onParameterBindingChanged)
         onParameterBindingChanged();
+
+    if (onStructuralOperation)
+    {
+        juce::DynamicObject::Ptr op = new juce::DynamicObject();
+        op->setProperty("type", "group");
+        op->setProperty("nodes", childPaths);
+        op->setProperty("mode", static_cast<int>(mode));
+        op->setProperty("name", name);
+        onStructuralOperation(juce::var(op.get()));
+    }
     return groupId;
 }
 
@@ -821,6 +1099,8 @@ bool ChainProcessor::dissolveGroup(ChainNodeId groupId)
     if (groupId == 0)
         return false;
 
+    const auto groupPath = getNodePathVar(groupId);
+
     suspendProcessing(true);
 
     // Perform tree manipulation with lock held briefly
@@ -875,6 +1155,14 @@ bool ChainProcessor::dissolveGroup(ChainNodeId groupId)
     notifyChainChanged();
     if (onParameterBindingChanged)
         onParameterBindingChanged();
+
+    if (onStructuralOperation)
+    {
+        juce::DynamicObject::Ptr op = new juce::DynamicObject();
+        op->setProperty("type", "dissolve");
+        op->setProperty("node", groupPath);
+        onStructuralOperation(juce::var(op.get()));
+    }
     return true;
 }
 
@@ -892,6 +1180,15 @@ bool ChainProcessor::setGroupMode(ChainNodeId groupId, GroupMode mode)
     suspendProcessing(false);
 
     notifyChainChanged();
+
+    if (onStructuralOperation)
+    {
+        juce::DynamicObject::Ptr op = new juce::DynamicObject();
+        op->setProperty("type", "setMode");
+        op->setProperty("node", getNodePathVar(groupId));   // Mode changes don't move nodes
+        op->setProperty("mode", static_cast<int>(mode));
+        onStructuralOperation(juce::var(op.get()));
+    }
     return true;
 }
 
@@ -1181,139 +1478,467 @@ bool ChainProcessor::setNodeSidechainSource(ChainNodeId nodeId, int source)
         return false;
 
     auto& leaf = node->getPlugin();
-    leaf.sidechainSource = juce::jlimit(0, 1, source);
+    const int previous = leaf.sidechainSource;
+    leaf.sidechainSource = juce::jlimit(0, 2, source);
+
+    // Switching to/from a tap (re)subscribes; the tap source itself is set by setNodeSidechainTap
+    if ((previous == 2) != (leaf.sidechainSource == 2))
+        updateTapInputs();
 
     // Update the wrapper's SC buffer assignment
     if (auto gNode = getNodeForId(leaf.graphNodeId))
     {
         if (auto* wrapper = dynamic_cast<PluginWithMeterWrapper*>(gNode->getProcessor()))
-            wrapper->setSidechainBuffer(leaf.sidechainSource == 1 ? externalSidechainBuffer : nullptr);
+            wrapper->setSidechainBuffer(getSidechainBufferFor(leaf));
     }
 
     notifyChainChanged();
     return true;
 }
 
-bool ChainProcessor::setNodeMidSideMode(ChainNodeId nodeId, int mode)
+//==============================================================================
+// Inter-instance audio taps
+
+void ChainProcessor::setInstanceRegistry(InstanceRegistry* registry, InstanceId selfId)
 {
-    if (mode < 0 || mode > 3)
-        return false;
+    jassert(juce::MessageManager::getInstance()->isThisTheMessageThread());
+
+    if (instanceRegistry != nullptr)
+        instanceRegistry->removeListener(this);
+
+    instanceRegistry = registry;
+    selfInstanceId = selfId;
+
+    if (instanceRegistry != nullptr)
+        instanceRegistry->addListener(this);
+
+    // Without a registry nothing resolves, so this also drops every subscription
+    updateTapInputs();
+    applySidechainBuffers();
+}
+
+bool ChainProcessor::setNodeSidechainTap(ChainNodeId nodeId, InstanceId sourceInstance)
+{
+    jassert(juce::MessageManager::getInstance()->isThisTheMessageThread());
 
     auto* node = ChainNodeHelpers::findById(rootNode, nodeId);
-    if (!node || !node->isPlugin())
+    if (!node || !node->isPlugin() || instanceRegistry == nullptr || sourceInstance == selfInstanceId)
+        return false;
+
+    auto info = instanceRegistry->findInstance(sourceInstance);
+    if (!info)
         return false;
 
     auto& leaf = node->getPlugin();
-    leaf.midSideMode = static_cast<MidSideMode>(mode);
+    leaf.sidechainSource = 2;
+    leaf.sidechainTapSource = sourceInstance;
+    leaf.sidechainTapTrack = info->trackName;
 
-    // Requires graph rebuild to insert/remove M/S encode/decode nodes
-    suspendProcessing(true);
-    rebuildGraph();
-    suspendProcessing(false);
+    // Only the subscription and the wrapper's buffer pointer change — no rebuild
+    updateTapInputs();
+    applySidechainBuffers();
 
     notifyChainChanged();
     return true;
 }
 
-void ChainProcessor::setNodeBypassed(ChainNodeId nodeId, bool bypassed)
+bool ChainProcessor::setGroupDuckKeySource(ChainNodeId groupId, InstanceId sourceInstance)
 {
+    jassert(juce::MessageManager::getInstance()->isThisTheMessageThread());
+
+    auto* node = ChainNodeHelpers::findById(rootNode, groupId);
+    if (!node || !node->isGroup())
+        return false;
+
+    auto& group = node->getGroup();
+    if (sourceInstance < 0)
     {
-        const juce::SpinLock::ScopedLockType lock(treeLock);
-        auto* node = ChainNodeHelpers::findById(rootNode, nodeId);
-        if (!node || !node->isPlugin())
-            return;
+        group.duckKeySource = -1;
+        group.duckKeyTrack = {};
+    }
+    else
+    {
+        if (instanceRegistry == nullptr || sourceInstance == selfInstanceId)
+            return false;
 
-        node->getPlugin().bypassed = bypassed;
+        auto info = instanceRegistry->findInstance(sourceInstance);
+        if (!info)
+            return false;
+
+        group.duckKeySource = sourceInstance;
+        group.duckKeyTrack = info->trackName;
     }
 
-    // Deferred rebuild — coalesces rapid bypass toggles (e.g. setAllBypass).
-    // ~16ms delay is imperceptible. Full rebuild needed because bypassed plugins
-    // are disconnected in wireNode() for zero CPU and correct latency reporting.
-    scheduleRebuild();
-}
+    updateTapInputs();
+    applySidechainBuffers();
 
-std::vector<PluginLeaf*> ChainProcessor::getFlatPluginList()
-{
-    std::vector<PluginLeaf*> result;
-    ChainNodeHelpers::collectPluginsMut(rootNode, result);
-    return result;
+    notifyChainChanged();
+    return true;
 }
 
-std::vector<const PluginLeaf*> ChainProcessor::getFlatPluginList() const
+void ChainProcessor::instanceRegistryChanged(const InstanceRegistry::ChangeSet& changes)
 {
-    std::vector<const PluginLeaf*> result;
-    ChainNodeHelpers::collectPlugins(rootNode, result);
-    return result;
-}
+    // Sources come, go and get renamed with other tracks: re-resolve against the new snapshot,
+    // but only when the change involves something this tree taps
+    if (changes.instanceIds.empty() || !tapReferencesAffectedBy(changes))
+        return;
 
-std::vector<ChainNodeId> ChainProcessor::getFlatPluginNodeIds() const
-{
-    std::vector<ChainNodeId> result;
-    struct Collector {
-        static void collect(const ChainNode& node, std::vector<ChainNodeId>& ids) {
-            if (node.isPlugin())
-                ids.push_back(node.id);
-            else if (node.isGroup())
-                for (const auto& child : node.getGroup().children)
-                    collect(*child, ids);
-        }
-    };
-    Collector::collect(rootNode, result);
-    return result;
+    updateTapInputs();
+    applySidechainBuffers();
 }
 
-//==============================================================================
-// Backward-compatible flat API
-//==============================================================================
-
-bool ChainProcessor::addPlugin(const juce::PluginDescription& desc, int insertIndex)
+InstanceId ChainProcessor::resolveTapSource(InstanceId source, const juce::String& trackName) const
 {
-    return addPlugin(desc, 0, insertIndex); // Add to root group
-}
+    if (instanceRegistry == nullptr || source < 0)
+        return -1;
 
-bool ChainProcessor::removePlugin(int slotIndex)
-{
-    auto nodeId = getNodeIdByFlatIndex(slotIndex);
-    if (nodeId < 0)
-        return false;
+    // Instance ids don't survive a session reload, track names usually do: prefer the
+    // stored id while it still names the same track, then the track, then the bare id
+    const auto snapshot = instanceRegistry->getSnapshot();
+    const auto* byId = source != selfInstanceId ? snapshot->find(source) : nullptr;
 
-    // Hide window by slot index before removing
-    hidePluginWindow(slotIndex);
+    if (byId != nullptr && (trackName.isEmpty() || (*byId)->trackName == trackName))
+        return source;
 
-    return removeNode(nodeId);
+    if (trackName.isNotEmpty())
+    {
+        for (const auto& info : snapshot->instances)
+            if (info->id != selfInstanceId && info->trackName == trackName)
+                return info->id;
+    }
+
+    return byId != nullptr ? source : -1;
 }
 
-bool ChainProcessor::movePlugin(int fromIndex, int toIndex)
+void ChainProcessor::updateTapInputs()
 {
     jassert(juce::MessageManager::getInstance()->isThisTheMessageThread());
 
-    suspendProcessing(true);
-
-    // Perform tree manipulation with lock held briefly
+    // Resolve every tap reference in the tree. Unresolved references keep their stored
+    // id/track so they reconnect when the source instance (re)appears.
+    std::set<InstanceId> wanted;
+    tapReferenceIds.clear();
+    tapReferenceTracks.clear();
+    const auto resolve = [this, &wanted](int& source, juce::String& track)
     {
-        const juce::SpinLock::ScopedLockType lock(treeLock);
+        tapReferenceIds.insert(source);
+        if (track.isNotEmpty())
+            tapReferenceTracks.addIfNotAlreadyThere(track);
 
-        // For flat API compat, move within the root group
-        auto& rootChildren = rootNode.getGroup().children;
-        if (fromIndex < 0 || fromIndex >= static_cast<int>(rootChildren.size()) ||
-            toIndex < 0 || toIndex >= static_cast<int>(rootChildren.size()) ||
-            fromIndex == toIndex)
+        const auto resolved = resolveTapSource(source, track);
+        if (resolved < 0)
+            return;
+
+        source = resolved;
+        if (auto info = instanceRegistry->findInstance(resolved))
+            track = info->trackName;
+        wanted.insert(resolved);
+        tapReferenceIds.insert(resolved);
+        if (track.isNotEmpty())
+            tapReferenceTracks.addIfNotAlreadyThere(track);
+    };
+
+    std::function<void(ChainNode&)> collect = [&](ChainNode& node)
+    {
+        if (node.isPlugin())
         {
-            suspendProcessing(false);
-            return false;
+            auto& leaf = node.getPlugin();
+            if (leaf.sidechainSource == 2)
+                resolve(leaf.sidechainTapSource, leaf.sidechainTapTrack);
+            return;
         }
 
-        auto node = std::move(rootChildren[static_cast<size_t>(fromIndex)]);
-        rootChildren.erase(rootChildren.begin() + fromIndex);
-        rootChildren.insert(rootChildren.begin() + toIndex, std::move(node));
+        auto& group = node.getGroup();
+        if (group.duckKeySource >= 0)
+            resolve(group.duckKeySource, group.duckKeyTrack);
+        for (auto& child : group.children)
+            collect(*child);
+    };
+    collect(rootNode);
 
-        cachedSlotsDirty = true;
-    }  // Release lock before rebuildGraph
+    // Taps and new inputs are created here, outside the lock the audio thread takes
+    std::map<InstanceId, std::shared_ptr<AudioTap>> taps;
+    for (auto id : wanted)
+        if (auto tap = instanceRegistry->getAudioTap(id))
+            taps.emplace(id, std::move(tap));
 
-    // Rebuild graph WITHOUT holding lock (can take 100-500ms)
-    rebuildGraph();
+    std::vector<std::unique_ptr<TapInput>> spare;
+    while (spare.size() + tapInputs.size() < taps.size())
+        spare.push_back(std::make_unique<TapInput>());
 
-    suspendProcessing(false);
+    std::vector<std::shared_ptr<AudioTap>> released, attached;
+    {
+        const juce::SpinLock::ScopedLockType lock(tapLock);
+
+        for (auto& input : tapInputs)
+        {
+            if (input->source < 0)
+                continue;
+
+            const auto it = taps.find(input->source);
+            if (it != taps.end() && it->second == input->tap)
+            {
+                taps.erase(it);   // Already attached
+                continue;
+            }
+
+            released.push_back(std::move(input->tap));
+            input->tap = nullptr;
+            input->source = -1;
+        }
+
+        for (auto& [id, tap] : taps)
+        {
+            auto slot = std::find_if(tapInputs.begin(), tapInputs.end(),
+                                     [](const auto& input) { return input->source < 0; });
+            if (slot == tapInputs.end())
+            {
+                jassert(!spare.empty());
+                tapInputs.push_back(std::move(spare.back()));
+                spare.pop_back();
+                slot = std::prev(tapInputs.end());
+            }
+
+            (*slot)->source = id;
+            (*slot)->tap = tap;
+            attached.push_back(tap);
+        }
+    }
+
+    for (auto& tap : released)
+        tap->removeSubscriber();
+    for (auto& tap : attached)
+        tap->addSubscriber();
+}
+
+bool ChainProcessor::tapReferencesAffectedBy(const InstanceRegistry::ChangeSet& changes) const
+{
+    if (tapReferenceIds.empty() || instanceRegistry == nullptr)
+        return false;
+
+    // A referenced instance changed or went away, or another one now carries a track we follow
+    for (auto id : changes.instanceIds)
+    {
+        if (tapReferenceIds.count(id) != 0)
+            return true;
+
+        if (auto info = instanceRegistry->findInstance(id))
+            if (tapReferenceTracks.contains(info->trackName))
+                return true;
+    }
+    return false;
+}
+
+void ChainProcessor::applySidechainBuffers()
+{
+    std::function<void(const ChainNode&)> apply = [&](const ChainNode& node)
+    {
+        if (node.isPlugin())
+        {
+            const auto& leaf = node.getPlugin();
+            if (auto gNode = getNodeForId(leaf.graphNodeId))
+                if (auto* wrapper = dynamic_cast<PluginWithMeterWrapper*>(gNode->getProcessor()))
+                    wrapper->setSidechainBuffer(getSidechainBufferFor(leaf));
+            return;
+        }
+
+        const auto& group = node.getGroup();
+        if (group.duckingNodeId.uid != 0)
+            if (auto gNode = getNodeForId(group.duckingNodeId))
+                if (auto* duckProc = dynamic_cast<DuckingProcessor*>(gNode->getProcessor()))
+                    duckProc->setKeyBuffer(group.duckKeySource >= 0 ? getTapBuffer(group.duckKeySource) : nullptr);
+
+        for (const auto& child : group.children)
+            apply(*child);
+    };
+    apply(rootNode);
+}
+
+juce::AudioBuffer<float>* ChainProcessor::getSidechainBufferFor(const PluginLeaf& leaf) const
+{
+    switch (leaf.sidechainSource)
+    {
+        case 1:  return externalSidechainBuffer;
+        case 2:  return getTapBuffer(leaf.sidechainTapSource);
+        default: return nullptr;
+    }
+}
+
+juce::AudioBuffer<float>* ChainProcessor::getTapBuffer(InstanceId source) const
+{
+    if (source < 0)
+        return nullptr;
+
+    for (const auto& input : tapInputs)
+        if (input->source == source)
+            return &input->buffer;
+    return nullptr;
+}
+
+void ChainProcessor::pullAudioTaps() noexcept
+{
+    const int numSamples = juce::jmin(tapBlockSamples, AudioTap::kMaxBlockSamples);
+    if (numSamples <= 0)
+        return;
+
+    // Contended only while updateTapInputs reassigns inputs: keep the previous block
+    const juce::SpinLock::ScopedTryLockType lock(tapLock);
+    if (!lock.isLocked())
+        return;
+
+    const int factor = tapBlockOversampling;
+    for (const auto& input : tapInputs)
+    {
+        if (input->source < 0 || input->tap == nullptr)
+            continue;
+
+        if (factor == 1)
+        {
+            input->tap->read(input->buffer, numSamples, tapBlockPosition);
+            continue;
+        }
+
+        // Oversampled chain: plugins keyed from the tap expect numSamples * factor samples at
+        // the chain's rate. Linear interpolation is plenty for a key signal.
+        input->tap->read(input->hostRate, numSamples, tapBlockPosition);
+        for (int ch = 0; ch < AudioTap::kNumChannels; ++ch)
+        {
+            const auto* src = input->hostRate.getReadPointer(ch);
+            auto* dst = input->buffer.getWritePointer(ch);
+            float previous = input->lastSample[ch];
+
+            for (int i = 0; i < numSamples; ++i)
+            {
+                const float step = (src[i] - previous) / static_cast<float>(factor);
+                for (int j = 1; j <= factor; ++j)
+                    *dst++ = previous + step * static_cast<float>(j);
+                previous = src[i];
+            }
+            input->lastSample[ch] = previous;
+        }
+    }
+}
+
+bool ChainProcessor::setNodeMidSideMode(ChainNodeId nodeId, int mode)
+{
+    if (mode < 0 || mode > 3)
+        return false;
+
+    auto* node = ChainNodeHelpers::findById(rootNode, nodeId);
+    if (!node || !node->isPlugin())
+        return false;
+
+    auto& leaf = node->getPlugin();
+    leaf.midSideMode = static_cast<MidSideMode>(mode);
+
+    // Requires graph rebuild to insert/remove M/S encode/decode nodes
+    suspendProcessing(true);
+    rebuildGraph();
+    suspendProcessing(false);
+
+    notifyChainChanged();
+    return true;
+}
+
+void ChainProcessor::setNodeBypassed(ChainNodeId nodeId, bool bypassed)
+{
+    {
+        const juce::SpinLock::ScopedLockType lock(treeLock);
+        auto* node = ChainNodeHelpers::findById(rootNode, nodeId);
+        if (!node || !node->isPlugin())
+            return;
+
+        node->getPlugin().bypassed = bypassed;
+    }
+
+    // Deferred rebuild — coalesces rapid bypass toggles (e.g. setAllBypass).
+    // ~16ms delay is imperceptible. Full rebuild needed because bypassed plugins
+    // are disconnected in wireNode() for zero CPU and correct latency reporting.
+    scheduleRebuild();
+}
+
+std::vector<PluginLeaf*> ChainProcessor::getFlatPluginList()
+{
+    std::vector<PluginLeaf*> result;
+    ChainNodeHelpers::collectPluginsMut(rootNode, result);
+    return result;
+}
+
+std::vector<const PluginLeaf*> ChainProcessor::getFlatPluginList() const
+{
+    std::vector<const PluginLeaf*> result;
+    ChainNodeHelpers::collectPlugins(rootNode, result);
+    return result;
+}
+
+std::vector<ChainNodeId> ChainProcessor::getFlatPluginNodeIds() const
+{
+    std::vector<ChainNodeId> result;
+    struct Collector {
+        static void collect(const ChainNode& node, std::vector<ChainNodeId>& ids) {
+            if (node.isPlugin())
+                ids.push_back(node.id);
+            else if (node.isGroup())
+                for (const auto& child : node.getGroup().children)
+                    collect(*child, ids);
+        }
+    };
+    Collector::collect(rootNode, result);
+    return result;
+}
+
+//==============================================================================
+// Backward-compatible flat API
+//==============================================================================
+
+bool ChainProcessor::addPlugin(const juce::PluginDescription& desc, int insertIndex)
+{
+    return addPlugin(desc, 0, insertIndex); // Add to root group
+}
+
+bool ChainProcessor::removePlugin(int slotIndex)
+{
+    auto nodeId = getNodeIdByFlatIndex(slotIndex);
+    if (nodeId < 0)
+        return false;
+
+    // Hide window by slot index before removing
+    hidePluginWindow(slotIndex);
+
+    return removeNode(nodeId);
+}
+
+bool ChainProcessor::movePlugin(int fromIndex, int toIndex)
+{
+    jassert(juce::MessageManager::getInstance()->isThisTheMessageThread());
+
+    suspendProcessing(true);
+
+    // Perform tree manipulation with lock held briefly
+    {
+        const juce::SpinLock::ScopedLockType lock(treeLock);
+
+        // For flat API compat, move within the root group
+        auto& rootChildren = rootNode.getGroup().children;
+        if (fromIndex < 0 || fromIndex >= static_cast<int>(rootChildren.size()) ||
+            toIndex < 0 || toIndex >= static_cast<int>(rootChildren.size()) ||
+            fromIndex == toIndex)
+        {
+            suspendProcessing(false);
+            return false;
+        }
+
+        auto node = std::move(rootChildren[static_cast<size_t>(fromIndex)]);
+        rootChildren.erase(rootChildren.begin() + fromIndex);
+        rootChildren.insert(rootChildren.begin() + toIndex, std::move(node));
+
+        cachedSlotsDirty = true;
+    }  // Release lock before rebuildGraph
+
+    // Rebuild graph WITHOUT holding lock (can take 100-500ms)
+    rebuildGraph();
+
+    suspendProcessing(false);
 
     notifyChainChanged();
     if (onParameterBindingChanged)
@@ -1630,6 +2255,9 @@ void ChainProcessor::rebuildGraph()
     PCLOG("rebuildGraph — start (nodes=" + juce::String(getNodes().size()) + ")");
     jassert(juce::MessageManager::getInstance()->isThisTheMessageThread());
 
+    // Tap buffers must exist before wiring hands their pointers to wrappers/duckers
+    updateTapInputs();
+
     // JUCE's rebuild() uses RenderSequenceExchange which does a wait-free
     // try-lock swap of the render sequence pointer. The audio thread finishes
     // its current callback on the old sequence; the new one takes effect next call.
@@ -1696,25 +2324,35 @@ void ChainProcessor::rebuildGraph()
     PCLOG("rebuildGraph — done (nodes=" + juce::String(getNodes().size())
           + " latency=" + juce::String(totalLatency) + ")");
 
-    // Re-register parameter watcher on all plugin instances
-    if (parameterWatcher)
+    // Re-map the parameter mirror onto the new plugin set (DFS order, like the flat slots)
     {
-        parameterWatcher->clearWatches();
+        std::vector<ParameterMirror::PluginEntry> entries;
         auto plugins = getFlatPluginList();
-        for (auto* leaf : plugins)
+        auto nodeIds = getFlatPluginNodeIds();
+        entries.reserve(plugins.size());
+        for (size_t i = 0; i < plugins.size() && i < nodeIds.size(); ++i)
         {
-            if (leaf && leaf->graphNodeId.uid != 0)
+            ParameterMirror::PluginEntry entry;
+            entry.nodeId = nodeIds[i];
+            if (plugins[i]->graphNodeId.uid != 0)
             {
-                if (auto* graphNode = getNodeForId(leaf->graphNodeId))
+                if (auto graphNode = getNodeForId(plugins[i]->graphNodeId))
                 {
-                    // Unwrap to watch the raw plugin's parameters (wrapper has none)
+                    // Unwrap to mirror the raw plugin's parameters (wrapper has none)
                     if (auto* wrapper = dynamic_cast<PluginWithMeterWrapper*>(graphNode->getProcessor()))
-                        parameterWatcher->watchProcessor(wrapper->getWrappedPlugin());
-                    else if (auto* proc = graphNode->getProcessor())
-                        parameterWatcher->watchProcessor(proc);
+                        entry.processor = wrapper->getWrappedPlugin();
+                    else
+                        entry.processor = graphNode->getProcessor();
+                    entry.keepAlive = graphNode;
                 }
             }
+            entries.push_back(std::move(entry));
         }
+        parameterMirror.rebuild(std::move(entries));
+    }
+
+    if (parameterWatcher)
+    {
 
         // Schedule deferred stable snapshot update (after prepareToPlay settles)
         auto alive = aliveFlag;
@@ -1902,11 +2540,11 @@ WireResult ChainProcessor::wireNode(ChainNode& node, NodeID audioIn)
         leaf.msDecodeNodeId = {};
         leaf.msBypassDelayNodeId = {};
 
-        // Set sidechain buffer on the wrapper if SC source is external
+        // Set sidechain buffer on the wrapper (host SC bus or another instance's tap)
         if (auto gNode = getNodeForId(pluginNodeId))
         {
             if (auto* wrapper = dynamic_cast<PluginWithMeterWrapper*>(gNode->getProcessor()))
-                wrapper->setSidechainBuffer(leaf.sidechainSource == 1 ? externalSidechainBuffer : nullptr);
+                wrapper->setSidechainBuffer(getSidechainBufferFor(leaf));
         }
 
         bool useInputGain = true;   // Always wire to avoid rebuild when gain changes from 0
@@ -2157,6 +2795,7 @@ WireResult ChainProcessor::wireSerialGroup(ChainNode& node, NodeID audioIn)
             auto duckProc = std::make_unique<DuckingProcessor>();
             duckProc->setDuckAmount(group.duckAmount);
             duckProc->setReleaseMs(group.duckReleaseMs);
+            duckProc->setKeyBuffer(group.duckKeySource >= 0 ? getTapBuffer(group.duckKeySource) : nullptr);
 
             auto duckNode = addNode(std::move(duckProc), {}, UpdateKind::none);
             if (duckNode)
@@ -2231,6 +2870,7 @@ WireResult ChainProcessor::wireSerialGroup(ChainNode& node, NodeID audioIn)
         auto duckProc = std::make_unique<DuckingProcessor>();
         duckProc->setDuckAmount(group.duckAmount);
         duckProc->setReleaseMs(group.duckReleaseMs);
+        duckProc->setKeyBuffer(group.duckKeySource >= 0 ? getTapBuffer(group.duckKeySource) : nullptr);
 
         auto duckNode = addNode(std::move(duckProc), {}, UpdateKind::none);
         if (duckNode)
@@ -2410,6 +3050,7 @@ WireResult ChainProcessor::wireParallelGroup(ChainNode& node, NodeID audioIn)
         auto duckProc = std::make_unique<DuckingProcessor>();
         duckProc->setDuckAmount(group.duckAmount);
         duckProc->setReleaseMs(group.duckReleaseMs);
+        duckProc->setKeyBuffer(group.duckKeySource >= 0 ? getTapBuffer(group.duckKeySource) : nullptr);
 
         auto duckNode = addNode(std::move(duckProc), {}, UpdateKind::none);
         if (duckNode)
@@ -2512,6 +3153,36 @@ int ChainProcessor::getTotalLatencySamples() const
     return latency;
 }
 
+ChainProcessor::CpuEstimate ChainProcessor::estimateChainCpu(const juce::PluginDescription* adding) const
+{
+    CpuEstimate estimate;
+    auto known = pluginManager.getSnapshot();
+
+    auto add = [&](const juce::PluginDescription& desc) {
+        const auto* profile = known->findProfile(desc);
+        const auto load = profile != nullptr ? profile->estimateLoad(currentSampleRate, currentBlockSize)
+                                             : std::optional<double>();
+        if (load)
+        {
+            estimate.load += *load;
+            ++estimate.numProfiled;
+        }
+        else
+        {
+            ++estimate.numUnprofiled;
+        }
+    };
+
+    for (const auto* leaf : getFlatPluginList())
+        if (!leaf->isDryPath && !leaf->bypassed)
+            add(leaf->description);
+
+    if (adding != nullptr)
+        add(*adding);
+
+    return estimate;
+}
+
 void ChainProcessor::invalidateLatencyCache()
 {
     latencyCacheDirty.store(true, std::memory_order_release);
@@ -2705,6 +3376,11 @@ void ChainProcessor::nodeToXml(const ChainNode& node, juce::XmlElement& parent)
         nodeXml->setAttribute("outputGainDb", static_cast<double>(node.getPlugin().outputGainDb));
         nodeXml->setAttribute("pluginDryWet", static_cast<double>(node.getPlugin().dryWetMix));
         nodeXml->setAttribute("sidechainSource", node.getPlugin().sidechainSource);
+        if (node.getPlugin().sidechainSource == 2)
+        {
+            nodeXml->setAttribute("sidechainTap", node.getPlugin().sidechainTapSource);
+            nodeXml->setAttribute("sidechainTapTrack", node.getPlugin().sidechainTapTrack);
+        }
         nodeXml->setAttribute("midSideMode", static_cast<int>(node.getPlugin().midSideMode));
 
         if (auto descXml = node.getPlugin().description.createXml())
@@ -2748,6 +3424,11 @@ void ChainProcessor::nodeToXml(const ChainNode& node, juce::XmlElement& parent)
         nodeXml->setAttribute("dryWet", static_cast<double>(node.getGroup().dryWetMix));
         nodeXml->setAttribute("duckAmount", static_cast<double>(node.getGroup().duckAmount));
         nodeXml->setAttribute("duckReleaseMs", static_cast<double>(node.getGroup().duckReleaseMs));
+        if (node.getGroup().duckKeySource >= 0)
+        {
+            nodeXml->setAttribute("duckKeySource", node.getGroup().duckKeySource);
+            nodeXml->setAttribute("duckKeyTrack", node.getGroup().duckKeyTrack);
+        }
         nodeXml->setAttribute("name", node.name);
         nodeXml->setAttribute("collapsed", node.collapsed);
 
@@ -2780,6 +3461,8 @@ std::unique_ptr<ChainNode> ChainProcessor::xmlToNode(const juce::XmlElement& xml
         leaf.outputGainDb = static_cast<float>(xml.getDoubleAttribute("outputGainDb", 0.0));
         leaf.dryWetMix = static_cast<float>(xml.getDoubleAttribute("pluginDryWet", 1.0));
         leaf.sidechainSource = xml.getIntAttribute("sidechainSource", 0);
+        leaf.sidechainTapSource = xml.getIntAttribute("sidechainTap", -1);
+        leaf.sidechainTapTrack = xml.getStringAttribute("sidechainTapTrack");
         leaf.midSideMode = static_cast<MidSideMode>(xml.getIntAttribute("midSideMode", 0));
         leaf.bypassed = xml.getBoolAttribute("bypassed", false);
         leaf.isDryPath = xml.getBoolAttribute("isDryPath", false);
@@ -2797,9 +3480,29 @@ std::unique_ptr<ChainNode> ChainProcessor::xmlToNode(const juce::XmlElement& xml
             leaf.description.loadFromXml(*descXml);
             node->name = leaf.description.name;
 
+            // Whole-chain load: keep the outgoing instance if it's the same plugin,
+            // and only push the chunk when it actually differs.
+            if (auto reused = claimReusablePlugin(leaf.description.fileOrIdentifier, leaf.description);
+                reused != NodeID())
+            {
+                leaf.graphNodeId = reused;
+                auto stateBase64 = xml.getStringAttribute("state");
+                if (stateBase64.isNotEmpty() && !pluginStateMatches(reused, stateBase64))
+                    leaf.pendingPresetData = stateBase64;
+
+                node->data = std::move(leaf);
+                return node;
+            }
+
+            // Preset prefetch: adopt a pre-built (already prepared) instance if one was staged
+            juce::int64 stagedStateHash = 0;
+            auto instance = takeStagedInstance(leaf.description, stagedStateHash);
+            const bool wasStaged = instance != nullptr;
+
             juce::String errorMessage;
-            auto instance = pluginManager.createPluginInstance(
-                leaf.description, currentSampleRate, currentBlockSize, errorMessage);
+            if (!instance)
+                instance = pluginManager.createPluginInstance(
+                    leaf.description, currentSampleRate, currentBlockSize, errorMessage);
 
             // Fallback: if direct instantiation failed, try matching by name+manufacturer
             // from the known plugins list (handles cross-format presets, e.g. VST3→AU)
@@ -2808,7 +3511,8 @@ std::unique_ptr<ChainNode> ChainProcessor::xmlToNode(const juce::XmlElement& xml
                 PCLOG("xmlToNode — direct load failed for \"" + leaf.description.name
                       + "\" (" + leaf.description.pluginFormatName + "): " + errorMessage
                       + " — trying name match...");
-                for (const auto& knownDesc : pluginManager.getKnownPlugins().getTypes())
+                auto known = pluginManager.getSnapshot();
+                for (const auto& knownDesc : known->findByManufacturer(leaf.description.manufacturerName))
                 {
                     if (knownDesc.name.equalsIgnoreCase(leaf.description.name) &&
                         knownDesc.manufacturerName.equalsIgnoreCase(leaf.description.manufacturerName))
@@ -2832,11 +3536,13 @@ std::unique_ptr<ChainNode> ChainProcessor::xmlToNode(const juce::XmlElement& xml
             if (instance)
             {
                 // Pre-prepare so bus layout is initialized (sidechain plugins need correct channel count)
-                instance->prepareToPlay(currentSampleRate, currentBlockSize);
+                if (!wasStaged)
+                    instance->prepareToPlay(currentSampleRate, currentBlockSize);
 
-                // Store preset data to be applied AFTER prepareToPlay (deferred state restoration)
+                // Store preset data to be applied AFTER prepareToPlay (deferred state restoration).
+                // Staged instances already hold this exact chunk.
                 auto stateBase64 = xml.getStringAttribute("state");
-                if (stateBase64.isNotEmpty())
+                if (stateBase64.isNotEmpty() && !(wasStaged && stagedStateHash == stateBase64.hashCode64()))
                 {
                     juce::MemoryBlock state;
                     state.fromBase64Encoding(stateBase64);
@@ -2872,6 +3578,8 @@ std::unique_ptr<ChainNode> ChainProcessor::xmlToNode(const juce::XmlElement& xml
         group.dryWetMix = static_cast<float>(xml.getDoubleAttribute("dryWet", 1.0));
         group.duckAmount = static_cast<float>(xml.getDoubleAttribute("duckAmount", 0.0));
         group.duckReleaseMs = static_cast<float>(xml.getDoubleAttribute("duckReleaseMs", 200.0));
+        group.duckKeySource = xml.getIntAttribute("duckKeySource", -1);
+        group.duckKeyTrack = xml.getStringAttribute("duckKeyTrack");
 
         for (auto* childXml : xml.getChildWithTagNameIterator("Node"))
         {
@@ -2910,6 +3618,8 @@ juce::var ChainProcessor::nodeToJson(const ChainNode& node) const
         obj->setProperty("outputGainDb", leaf.outputGainDb);
         obj->setProperty("pluginDryWet", leaf.dryWetMix);
         obj->setProperty("sidechainSource", leaf.sidechainSource);
+        obj->setProperty("sidechainTapSource", leaf.sidechainTapSource);
+        obj->setProperty("sidechainTapTrack", leaf.sidechainTapTrack);
         obj->setProperty("midSideMode", static_cast<int>(leaf.midSideMode));
 
         // Detect SC support from wrapped plugin
@@ -2928,6 +3638,8 @@ juce::var ChainProcessor::nodeToJson(const ChainNode& node) const
         obj->setProperty("dryWet", node.getGroup().dryWetMix);
         obj->setProperty("duckAmount", node.getGroup().duckAmount);
         obj->setProperty("duckReleaseMs", node.getGroup().duckReleaseMs);
+        obj->setProperty("duckKeySource", node.getGroup().duckKeySource);
+        obj->setProperty("duckKeyTrack", node.getGroup().duckKeyTrack);
         obj->setProperty("collapsed", node.collapsed);
 
         juce::Array<juce::var> childrenArr;
@@ -2968,6 +3680,8 @@ juce::var ChainProcessor::nodeToJsonWithPresets(const ChainNode& node) const
         obj->setProperty("outputGainDb", leaf.outputGainDb);
         obj->setProperty("pluginDryWet", leaf.dryWetMix);
         obj->setProperty("sidechainSource", leaf.sidechainSource);
+        obj->setProperty("sidechainTapSource", leaf.sidechainTapSource);
+        obj->setProperty("sidechainTapTrack", leaf.sidechainTapTrack);
         obj->setProperty("midSideMode", static_cast<int>(leaf.midSideMode));
 
         if (auto gNode = getNodeForId(leaf.graphNodeId))
@@ -2989,6 +3703,8 @@ juce::var ChainProcessor::nodeToJsonWithPresets(const ChainNode& node) const
         obj->setProperty("dryWet", node.getGroup().dryWetMix);
         obj->setProperty("duckAmount", node.getGroup().duckAmount);
         obj->setProperty("duckReleaseMs", node.getGroup().duckReleaseMs);
+        obj->setProperty("duckKeySource", node.getGroup().duckKeySource);
+        obj->setProperty("duckKeyTrack", node.getGroup().duckKeyTrack);
         obj->setProperty("collapsed", node.collapsed);
 
         juce::Array<juce::var> childrenArr;
@@ -3000,6 +3716,30 @@ juce::var ChainProcessor::nodeToJsonWithPresets(const ChainNode& node) const
     return juce::var(obj);
 }
 
+// Parameter hints from seeded chains: [{ name, semantic, unit, value, normalizedValue }]
+static void parsePendingParameters(const juce::var& paramsVar, std::vector<PendingParameter>& out)
+{
+    if (!paramsVar.isArray())
+        return;
+
+    for (const auto& pVar : *paramsVar.getArray())
+    {
+        if (!pVar.isObject()) continue;
+        PendingParameter pp;
+        pp.name = pVar.getProperty("name", "").toString();
+        pp.semantic = pVar.getProperty("semantic", "").toString();
+        pp.unit = pVar.getProperty("unit", "").toString();
+        auto valStr = pVar.getProperty("value", "").toString();
+        if (valStr.isNotEmpty())
+        {
+            pp.physicalValue = valStr.getFloatValue();
+            pp.hasPhysicalValue = true;
+        }
+        pp.normalizedValue = static_cast<float>(pVar.getProperty("normalizedValue", 0.0));
+        out.push_back(pp);
+    }
+}
+
 std::unique_ptr<ChainNode> ChainProcessor::jsonToNode(const juce::var& json)
 {
     if (!json.isObject())
@@ -3041,6 +3781,9 @@ std::unique_ptr<ChainNode> ChainProcessor::jsonToNode(const juce::var& json)
         leaf.dryWetMix = obj->hasProperty("pluginDryWet")
             ? static_cast<float>(obj->getProperty("pluginDryWet")) : 1.0f;
         leaf.sidechainSource = static_cast<int>(obj->getProperty("sidechainSource"));
+        leaf.sidechainTapSource = obj->hasProperty("sidechainTapSource")
+            ? static_cast<int>(obj->getProperty("sidechainTapSource")) : -1;
+        leaf.sidechainTapTrack = obj->getProperty("sidechainTapTrack").toString();
         leaf.midSideMode = obj->hasProperty("midSideMode")
             ? static_cast<MidSideMode>(static_cast<int>(obj->getProperty("midSideMode"))) : MidSideMode::Off;
 
@@ -3058,20 +3801,26 @@ std::unique_ptr<ChainNode> ChainProcessor::jsonToNode(const juce::var& json)
         leaf.description = desc;
 
         // Try to find matching plugin in user's system
-        auto& knownPlugins = pluginManager.getKnownPlugins();
-        juce::PluginDescription* matchedDesc = nullptr;
+        auto matchedDesc = pluginManager.findPluginByNameAndManufacturer(desc.name, desc.manufacturerName);
+        const auto& descToUse = matchedDesc ? *matchedDesc : desc;
 
-        for (auto& knownType : knownPlugins.getTypes())
+        // Keep the outgoing instance if it's the same plugin (state pushed only if it differs)
+        juce::PluginDescription reusedDesc;
+        if (auto reused = claimReusablePlugin(descToUse.fileOrIdentifier, reusedDesc); reused != NodeID())
         {
-            if (knownType.name.equalsIgnoreCase(desc.name) &&
-                knownType.manufacturerName.equalsIgnoreCase(desc.manufacturerName))
-            {
-                matchedDesc = &knownType;
-                break;
-            }
-        }
+            leaf.description = reusedDesc;
+            leaf.graphNodeId = reused;
 
-        const auto& descToUse = matchedDesc ? *matchedDesc : desc;
+            auto presetData = obj->getProperty("presetData").toString();
+            if (presetData.isNotEmpty() && !pluginStateMatches(reused, presetData))
+                leaf.pendingPresetData = presetData;
+            if (presetData.isEmpty())
+                parsePendingParameters(obj->getProperty("parameters"), leaf.pendingParameters);
+
+            importSlotCounter++;
+            node->data = std::move(leaf);
+            return node;
+        }
 
         juce::String errorMessage;
         auto instance = pluginManager.createPluginInstance(
@@ -3090,26 +3839,8 @@ std::unique_ptr<ChainNode> ChainProcessor::jsonToNode(const juce::var& json)
             }
 
             // Parse parameter hints from seeded chains (only when no binary preset)
-            auto paramsVar = obj->getProperty("parameters");
-            if (paramsVar.isArray() && presetData.isEmpty())
-            {
-                for (const auto& pVar : *paramsVar.getArray())
-                {
-                    if (!pVar.isObject()) continue;
-                    PendingParameter pp;
-                    pp.name = pVar.getProperty("name", "").toString();
-                    pp.semantic = pVar.getProperty("semantic", "").toString();
-                    pp.unit = pVar.getProperty("unit", "").toString();
-                    auto valStr = pVar.getProperty("value", "").toString();
-                    if (valStr.isNotEmpty())
-                    {
-                        pp.physicalValue = valStr.getFloatValue();
-                        pp.hasPhysicalValue = true;
-                    }
-                    pp.normalizedValue = static_cast<float>(pVar.getProperty("normalizedValue", 0.0));
-                    leaf.pendingParameters.push_back(pp);
-                }
-            }
+            if (presetData.isEmpty())
+                parsePendingParameters(obj->getProperty("parameters"), leaf.pendingParameters);
 
             auto wrapper = std::make_unique<PluginWithMeterWrapper>(std::move(instance));
             if (auto graphNode = addNode(std::move(wrapper)))
@@ -3137,6 +3868,9 @@ std::unique_ptr<ChainNode> ChainProcessor::jsonToNode(const juce::var& json)
         group.duckReleaseMs = obj->hasProperty("duckReleaseMs")
             ? static_cast<float>(obj->getProperty("duckReleaseMs"))
             : 200.0f;
+        group.duckKeySource = obj->hasProperty("duckKeySource")
+            ? static_cast<int>(obj->getProperty("duckKeySource")) : -1;
+        group.duckKeyTrack = obj->getProperty("duckKeyTrack").toString();
 
         auto childrenVar = obj->getProperty("children");
         if (childrenVar.isArray())
@@ -3225,6 +3959,8 @@ void ChainProcessor::getStateInformation(juce::MemoryBlock& destData)
         DBG("ERROR: rootNode is not a group in getStateInformation!");
     }
 
+    scenesToXml(*xml);
+
     copyXmlToBinary(*xml, destData);
 
     suspendProcessing(false);
@@ -3267,17 +4003,16 @@ void ChainProcessor::setStateInformation(const void* data, int sizeInBytes)
     {
         if (xml->hasTagName("ChainState"))
         {
+            // Snapshots carry stateRef attributes — inline the chunks before parsing
+            blobStore->resolveChunks(*xml);
+
             // CRITICAL: Suspend audio BEFORE any graph modifications.
             suspendProcessing(true);
 
-            // Clear existing chain
+            // Clear existing chain. Plugin graph nodes are kept until the incoming
+            // tree has claimed the ones it can reuse (undo/redo, snapshot rollback).
             hideAllPluginWindows();
-
-            // Remove all plugin graph nodes
-            std::vector<PluginLeaf*> allPlugins;
-            ChainNodeHelpers::collectPluginsMut(rootNode, allPlugins);
-            for (auto* plug : allPlugins)
-                AudioProcessorGraph::removeNode(plug->graphNodeId);
+            collectReusablePlugins();
 
             // Defensive check: rootNode should always be a group
             if (!rootNode.isGroup())
@@ -3327,6 +4062,9 @@ void ChainProcessor::setStateInformation(const void* data, int sizeInBytes)
                 }
             }
 
+            removeUnclaimedPlugins();
+            scenesFromXml(*xml);
+
             cachedSlotsDirty = true;
             rebuildGraph();
 
@@ -3383,26 +4121,29 @@ std::unique_ptr<juce::XmlElement> ChainProcessor::serializeChainToXml() const
         DBG("ERROR: rootNode is not a group in serializeChainToXml!");
     }
 
+    scenesToXml(*xml);
+
     return xml;
 }
 
-ChainProcessor::RestoreResult ChainProcessor::restoreChainFromXml(const juce::XmlElement& chainXml)
+ChainProcessor::RestoreResult ChainProcessor::restoreChainFromXml(const juce::XmlElement& chainXml,
+                                                                  std::vector<StagedPluginInstance>* staged)
 {
     RestoreResult result;
     int version = chainXml.getIntAttribute("version", 1);
 
+    // Staged swap: the old chain was ramped out by restoreChainFromXmlAsync()
+    stagedInstances = staged;
+
     // CRITICAL: Suspend audio processing BEFORE modifying the graph.
     // xmlToNode() calls addNode() which triggers sync render-sequence updates;
     // without suspending first, the audio thread processes partial chains → crash.
     suspendProcessing(true);
 
-    // Clear existing chain (same logic as setStateInformation)
+    // Clear existing chain. Plugin nodes stay in the graph until the incoming tree
+    // has had a chance to claim them (see claimReusablePlugin).
     hideAllPluginWindows();
-
-    std::vector<PluginLeaf*> allPlugins;
-    ChainNodeHelpers::collectPluginsMut(rootNode, allPlugins);
-    for (auto* plug : allPlugins)
-        AudioProcessorGraph::removeNode(plug->graphNodeId);
+    collectReusablePlugins();
 
     // Defensive check: rootNode should always be a group
     if (!rootNode.isGroup())
@@ -3446,6 +4187,14 @@ ChainProcessor::RestoreResult ChainProcessor::restoreChainFromXml(const juce::Xm
         }
     }
 
+    // Any staged instance not adopted (preset changed shape) is released here
+    stagedInstances = nullptr;
+    if (staged != nullptr)
+        staged->clear();
+
+    removeUnclaimedPlugins();
+    scenesFromXml(chainXml);
+
     // Scan for missing plugins (failed to instantiate = no valid graph node)
     std::vector<const PluginLeaf*> flatPlugins;
     ChainNodeHelpers::collectPlugins(rootNode, flatPlugins);
@@ -3481,6 +4230,11 @@ ChainProcessor::RestoreResult ChainProcessor::restoreChainFromXml(const juce::Xm
         }
     }
 
+    // Ramp back in only if restoreChainFromXmlAsync() ramped the old chain out. A chain
+    // restored while nobody hears it (the processor's slot-B swap) starts at full level.
+    if (staged != nullptr && swapFadeState.load(std::memory_order_acquire) != SwapFadeIdle)
+        swapFadeState.store(SwapFadeIn, std::memory_order_release);
+
     suspendProcessing(false);
 
     notifyChainChanged();
@@ -3493,9 +4247,19 @@ ChainProcessor::RestoreResult ChainProcessor::restoreChainFromXml(const juce::Xm
 
 juce::MemoryBlock ChainProcessor::captureSnapshot() const
 {
-    juce::MemoryBlock snapshot;
+    juce::MemoryBlock fullState;
     // const_cast needed because JUCE's getStateInformation isn't const
-    const_cast<ChainProcessor*>(this)->getStateInformation(snapshot);
+    const_cast<ChainProcessor*>(this)->getStateInformation(fullState);
+
+    // Swap embedded chunks for blob references — identical chunks across snapshots are stored once
+    auto xml = getXmlFromBinary(fullState.getData(), static_cast<int>(fullState.getSize()));
+    if (!xml)
+        return fullState;
+
+    blobStore->externaliseChunks(*xml, false);
+
+    juce::MemoryBlock snapshot;
+    copyXmlToBinary(*xml, snapshot);
     return snapshot;
 }
 
@@ -3504,6 +4268,378 @@ void ChainProcessor::restoreSnapshot(const juce::MemoryBlock& snapshot)
     setStateInformation(snapshot.getData(), static_cast<int>(snapshot.getSize()));
 }
 
+//==============================================================================
+// Scenes
+//==============================================================================
+
+bool ChainProcessor::captureScene(int index, const juce::String& name)
+{
+    jassert(juce::MessageManager::getInstance()->isThisTheMessageThread());
+
+    if (index < 0 || index >= kMaxScenes)
+        return false;
+
+    ChainScene scene;
+    scene.name = name.isNotEmpty() ? name : "Scene " + juce::String(index + 1);
+
+    std::function<void(const ChainNode&)> capture = [&](const ChainNode& node)
+    {
+        if (node.isGroup())
+        {
+            for (const auto& child : node.getGroup().children)
+                capture(*child);
+            return;
+        }
+
+        const auto& leaf = node.getPlugin();
+        if (leaf.isDryPath)
+            return;
+
+        auto gNode = getNodeForId(leaf.graphNodeId);
+        if (!gNode)
+            return;
+
+        SceneLeaf sceneLeaf;
+        sceneLeaf.nodeId = node.id;
+        sceneLeaf.fileOrIdentifier = leaf.description.fileOrIdentifier;
+        sceneLeaf.inputGainDb = leaf.inputGainDb;
+        sceneLeaf.outputGainDb = leaf.outputGainDb;
+        sceneLeaf.dryWetMix = leaf.dryWetMix;
+        sceneLeaf.midSideMode = leaf.midSideMode;
+        sceneLeaf.bypassed = leaf.bypassed;
+
+        auto* processor = gNode->getProcessor();
+        if (auto* wrapper = dynamic_cast<PluginWithMeterWrapper*>(processor))
+            processor = wrapper->getWrappedPlugin();
+
+        const auto& params = processor->getParameters();
+        sceneLeaf.values.reserve(static_cast<size_t>(params.size()));
+        for (auto* param : params)
+            sceneLeaf.values.push_back(param->getValue());
+
+        juce::MemoryBlock chunk;
+        gNode->getProcessor()->getStateInformation(chunk);
+        if (chunk.getSize() > 0)
+            sceneLeaf.chunkRef = blobStore->store(chunk, false);
+
+        scene.leaves.push_back(std::move(sceneLeaf));
+    };
+    capture(rootNode);
+
+    // Coverage check: if another scene has the exact same parameter values for a plugin
+    // but a different chunk, the parameters don't describe the whole state — use the chunk.
+    for (auto& sceneLeaf : scene.leaves)
+    {
+        for (int i = 0; i < kMaxScenes; ++i)
+        {
+            if (i == index || !scenes[static_cast<size_t>(i)])
+                continue;
+
+            auto* other = scenes[static_cast<size_t>(i)]->findLeaf(sceneLeaf.nodeId);
+            if (other != nullptr
+                && other->fileOrIdentifier == sceneLeaf.fileOrIdentifier
+                && other->values == sceneLeaf.values
+                && other->chunkRef != sceneLeaf.chunkRef)
+            {
+                sceneLeaf.chunkRequired = true;
+                other->chunkRequired = true;
+            }
+        }
+    }
+
+    scenes[static_cast<size_t>(index)] = std::move(scene);
+    return true;
+}
+
+bool ChainProcessor::recallScene(int index)
+{
+    jassert(juce::MessageManager::getInstance()->isThisTheMessageThread());
+
+    if (!hasScene(index))
+        return false;
+
+    // An explicit recall always restores chunks, even if the plugin was edited since
+    lastSceneChunkApplied.clear();
+    publishSceneRecall(buildSceneRecall(*scenes[static_cast<size_t>(index)], nullptr, 0.0f));
+    notifyChainChanged();
+    return true;
+}
+
+bool ChainProcessor::morphScenes(int indexA, int indexB, float position)
+{
+    jassert(juce::MessageManager::getInstance()->isThisTheMessageThread());
+
+    if (!hasScene(indexA) || !hasScene(indexB))
+        return false;
+
+    // No notifyChainChanged() — morphs are driven continuously; the UI picks up
+    // slot control changes on the next chain refresh.
+    publishSceneRecall(buildSceneRecall(*scenes[static_cast<size_t>(indexA)],
+                                        &*scenes[static_cast<size_t>(indexB)],
+                                        juce::jlimit(0.0f, 1.0f, position)));
+    return true;
+}
+
+void ChainProcessor::clearScene(int index)
+{
+    if (index >= 0 && index < kMaxScenes)
+        scenes[static_cast<size_t>(index)].reset();
+}
+
+bool ChainProcessor::hasScene(int index) const
+{
+    return index >= 0 && index < kMaxScenes && scenes[static_cast<size_t>(index)].has_value();
+}
+
+juce::var ChainProcessor::getScenesAsJson() const
+{
+    juce::Array<juce::var> arr;
+    for (int i = 0; i < kMaxScenes; ++i)
+    {
+        auto* obj = new juce::DynamicObject();
+        obj->setProperty("index", i);
+        obj->setProperty("empty", !hasScene(i));
+        if (hasScene(i))
+        {
+            const auto& scene = *scenes[static_cast<size_t>(i)];
+            int chunkLeaves = 0;
+            for (const auto& leaf : scene.leaves)
+                if (leaf.chunkRequired || leaf.values.empty())
+                    ++chunkLeaves;
+
+            obj->setProperty("name", scene.name);
+            obj->setProperty("numPlugins", static_cast<int>(scene.leaves.size()));
+            obj->setProperty("numChunkPlugins", chunkLeaves);
+        }
+        arr.add(juce::var(obj));
+    }
+    return juce::var(arr);
+}
+
+std::unique_ptr<ChainProcessor::SceneRecallBatch> ChainProcessor::buildSceneRecall(const ChainScene& sceneA,
+                                                                                   const ChainScene* sceneB,
+                                                                                   float position)
+{
+    auto batch = std::make_unique<SceneRecallBatch>();
+    const bool nearerB = sceneB != nullptr && position >= 0.5f;
+    bool needsRebuild = false;
+
+    std::function<void(ChainNode&)> visit = [&](ChainNode& node)
+    {
+        if (node.isGroup())
+        {
+            for (auto& child : node.getGroup().children)
+                visit(*child);
+            return;
+        }
+
+        auto& leaf = node.getPlugin();
+        const auto* a = sceneA.findLeaf(node.id);
+        if (a == nullptr || a->fileOrIdentifier != leaf.description.fileOrIdentifier)
+            return;
+
+        const auto* b = sceneB != nullptr ? sceneB->findLeaf(node.id) : nullptr;
+        if (b != nullptr && b->fileOrIdentifier != a->fileOrIdentifier)
+            b = nullptr;
+
+        const auto& nearest = (b != nullptr && nearerB) ? *b : *a;
+        const float t = b != nullptr ? position : 0.0f;
+        auto blend = [t](float from, float to) { return from + (to - from) * t; };
+
+        auto gNode = getNodeForId(leaf.graphNodeId);
+        if (!gNode)
+            return;
+
+        auto* processor = gNode->getProcessor();
+        if (auto* wrapper = dynamic_cast<PluginWithMeterWrapper*>(processor))
+            processor = wrapper->getWrappedPlugin();
+        const auto& params = processor->getParameters();
+
+        // Parameters can't reproduce this state — fall back to the chunk (message thread).
+        // A morph calls this continuously, so the chunk only goes in when the nearest
+        // scene for this leaf flips, not on every position update.
+        const bool useChunk = nearest.chunkRequired || params.isEmpty()
+                           || nearest.values.size() != static_cast<size_t>(params.size());
+        if (useChunk)
+        {
+            auto& applied = lastSceneChunkApplied[node.id];
+            if (applied != nearest.chunkRef)
+            {
+                if (auto chunk = blobStore->fetch(nearest.chunkRef))
+                {
+                    // Same bracket as the other per-plugin state restores: waits out a
+                    // processBlock in flight on the plugin's callback lock
+                    auto* target = gNode->getProcessor();
+                    target->suspendProcessing(true);
+                    target->setStateInformation(chunk->getData(), static_cast<int>(chunk->getSize()));
+                    target->suspendProcessing(false);
+                    applied = nearest.chunkRef;
+                }
+            }
+        }
+        else
+        {
+            const bool canBlend = b != nullptr && b->values.size() == a->values.size() && !b->chunkRequired;
+            bool anyChanged = false;
+
+            for (int i = 0; i < params.size(); ++i)
+            {
+                auto* param = params[i];
+                const auto idx = static_cast<size_t>(i);
+                float value = nearest.values[idx];
+                if (canBlend && !param->isDiscrete() && !param->isBoolean())
+                    value = blend(a->values[idx], b->values[idx]);
+
+                if (std::abs(param->getValue() - value) < 1.0e-6f)
+                    continue;
+
+                batch->parameters.push_back(param);
+                batch->values.push_back(value);
+                anyChanged = true;
+            }
+
+            if (anyChanged)
+                batch->keepAlive.push_back(gNode);
+        }
+
+        // Slot controls — model updated here, processors at the block boundary
+        const auto& gainsFrom = *a;
+        const auto& gainsTo = b != nullptr ? *b : *a;
+        leaf.inputGainDb = blend(gainsFrom.inputGainDb, gainsTo.inputGainDb);
+        leaf.outputGainDb = blend(gainsFrom.outputGainDb, gainsTo.outputGainDb);
+        leaf.dryWetMix = blend(gainsFrom.dryWetMix, gainsTo.dryWetMix);
+
+        if (auto gainNode = getNodeForId(leaf.inputGainNodeId))
+        {
+            if (auto* proc = dynamic_cast<BranchGainProcessor*>(gainNode->getProcessor()))
+            {
+                batch->gains.emplace_back(proc, leaf.inputGainDb);
+                batch->keepAlive.push_back(gainNode);
+            }
+        }
+        if (auto gainNode = getNodeForId(leaf.outputGainNodeId))
+        {
+            if (auto* proc = dynamic_cast<BranchGainProcessor*>(gainNode->getProcessor()))
+            {
+                batch->gains.emplace_back(proc, leaf.outputGainDb);
+                batch->keepAlive.push_back(gainNode);
+            }
+        }
+        // Muted nodes keep their mix processor at fully dry (see setNodeDryWet)
+        if (!node.mute.load(std::memory_order_relaxed))
+        {
+            if (auto mixNode = getNodeForId(leaf.pluginDryWetNodeId))
+            {
+                if (auto* proc = dynamic_cast<DryWetMixProcessor*>(mixNode->getProcessor()))
+                {
+                    batch->mixes.emplace_back(proc, leaf.dryWetMix);
+                    batch->keepAlive.push_back(mixNode);
+                }
+            }
+        }
+
+        // M/S and bypass change the wiring
+        if (leaf.midSideMode != nearest.midSideMode || leaf.bypassed != nearest.bypassed)
+        {
+            const juce::SpinLock::ScopedLockType lock(treeLock);
+            leaf.midSideMode = nearest.midSideMode;
+            leaf.bypassed = nearest.bypassed;
+            needsRebuild = true;
+        }
+    };
+    visit(rootNode);
+
+    if (needsRebuild)
+        scheduleRebuild();
+
+    return batch;
+}
+
+void ChainProcessor::publishSceneRecall(std::unique_ptr<SceneRecallBatch> batch)
+{
+    retireSceneRecalls();
+
+    // Replaces a batch the audio thread hasn't picked up yet — the newer one wins
+    delete pendingSceneRecall.exchange(batch.release(), std::memory_order_acq_rel);
+
+    // Nothing is processing (transport stopped in some hosts, offline, suspended):
+    // apply on the message thread so the recall still lands.
+    auto alive = aliveFlag;
+    juce::Timer::callAfterDelay(100, [this, alive]() {
+        if (!alive->load(std::memory_order_acquire))
+            return;
+        if (pendingSceneRecall.load(std::memory_order_acquire) != nullptr && !isAudioThreadBusy())
+            applyPendingSceneRecall();
+        retireSceneRecalls();
+    });
+}
+
+void ChainProcessor::applyPendingSceneRecall()
+{
+    // The previous batch must be collected first — one retire slot, no allocation here
+    if (retiredSceneRecall.load(std::memory_order_acquire) != nullptr)
+        return;
+
+    auto* batch = pendingSceneRecall.exchange(nullptr, std::memory_order_acq_rel);
+    if (batch == nullptr)
+        return;
+
+    for (size_t i = 0; i < batch->parameters.size(); ++i)
+        batch->parameters[i]->setValue(batch->values[i]);
+    for (const auto& [proc, gainDb] : batch->gains)
+        proc->setGainDb(gainDb);
+    for (const auto& [proc, mix] : batch->mixes)
+        proc->setMix(mix);
+
+    retiredSceneRecall.store(batch, std::memory_order_release);
+}
+
+void ChainProcessor::retireSceneRecalls()
+{
+    delete retiredSceneRecall.exchange(nullptr, std::memory_order_acq_rel);
+}
+
+void ChainProcessor::scenesToXml(juce::XmlElement& parent) const
+{
+    bool any = false;
+    for (const auto& scene : scenes)
+        any = any || scene.has_value();
+    if (!any)
+        return;
+
+    auto* scenesXml = parent.createNewChildElement("Scenes");
+    for (int i = 0; i < kMaxScenes; ++i)
+    {
+        if (hasScene(i))
+            scenesXml->addChildElement(scenes[static_cast<size_t>(i)]->toXml(i).release());
+    }
+
+    // Self-contained: inline the chunks (snapshot/preset paths externalise them again)
+    blobStore->resolveChunks(*scenesXml);
+}
+
+void ChainProcessor::scenesFromXml(const juce::XmlElement& parent)
+{
+    for (auto& scene : scenes)
+        scene.reset();
+    lastSceneChunkApplied.clear();
+
+    auto* scenesXml = parent.getChildByName("Scenes");
+    if (!scenesXml)
+        return;
+
+    // Chunks back into the store; scenes only hold references
+    juce::XmlElement working(*scenesXml);
+    blobStore->externaliseChunks(working, false, 0);
+
+    for (auto* sceneXml : working.getChildWithTagNameIterator("Scene"))
+    {
+        auto index = sceneXml->getIntAttribute("index", -1);
+        if (index >= 0 && index < kMaxScenes)
+            scenes[static_cast<size_t>(index)] = ChainScene::fromXml(*sceneXml);
+    }
+}
+
 //==============================================================================
 // Cloud Sharing
 //==============================================================================
@@ -3571,28 +4707,23 @@ juce::var ChainProcessor::exportChainWithPresets() const
 void ChainProcessor::applyPendingParameters(
     juce::AudioProcessor* processor,
     const std::vector<PendingParameter>& pending,
-    const juce::String& pluginName,
-    const juce::String& manufacturer)
+    const juce::PluginDescription& description)
 {
     auto& params = processor->getParameters();
     if (params.isEmpty()) return;
 
-    // Try semantic matching via ParameterDiscovery
-    auto discoveredMap = ParameterDiscovery::discoverParameterMap(
-        processor, pluginName, manufacturer);
+    const auto& pluginName = description.name;
 
-    // Build semantic→index lookup from discovered map
-    std::map<juce::String, int> semanticToIndex;
-    for (const auto& dp : discoveredMap.parameters)
-        if (dp.matched && dp.semantic.isNotEmpty())
-            semanticToIndex[dp.semantic] = dp.juceParamIndex;
+    // Semantic and name lookups via the discovered map's index (cached per plugin type and version)
+    auto index = discoveryCache->getNameIndex(*processor, description);
 
     PCLOG("applyPendingParameters: " + pluginName +
           " — " + juce::String(static_cast<int>(pending.size())) + " pending, " +
           juce::String(params.size()) + " plugin params, " +
-          juce::String(static_cast<int>(semanticToIndex.size())) + " semantic matches");
+          juce::String(index->getNumSemantics()) + " semantic matches");
 
     int applied = 0;
+    int fuzzyMatched = 0;
 
     for (const auto& pp : pending)
     {
@@ -3602,10 +4733,9 @@ void ChainProcessor::applyPendingParameters(
         // Tier 1: Semantic match
         if (pp.semantic.isNotEmpty())
         {
-            auto it = semanticToIndex.find(pp.semantic);
-            if (it != semanticToIndex.end())
+            targetIndex = index->findBySemantic(pp.semantic);
+            if (targetIndex >= 0)
             {
-                targetIndex = it->second;
                 // If we have a physical value, renormalize using the plugin's actual range
                 if (pp.hasPhysicalValue && targetIndex >= 0 && targetIndex < params.size())
                 {
@@ -3620,20 +4750,14 @@ void ChainProcessor::applyPendingParameters(
             }
         }
 
-        // Tier 2: Fuzzy name match fallback
+        // Tier 2: Fuzzy name match fallback (best-ranked candidate above the confidence floor)
         if (targetIndex < 0 && pp.name.isNotEmpty())
         {
-            auto ppName = pp.name.toLowerCase();
-            for (int i = 0; i < params.size(); ++i)
+            auto matches = index->findSimilar(pp.name);
+            if (!matches.empty())
             {
-                auto paramName = params[i]->getName(256).toLowerCase();
-                if (paramName == ppName ||
-                    paramName.contains(ppName) ||
-                    ppName.contains(paramName))
-                {
-                    targetIndex = i;
-                    break;
-                }
+                targetIndex = matches.front().paramIndex;
+                fuzzyMatched++;
             }
         }
 
@@ -3659,17 +4783,13 @@ void ChainProcessor::applyPendingParameters(
             int bandNum = afterPrefix.getIntValue();
             if (bandNum > 0 && activatedBands.find(bandNum) == activatedBands.end())
             {
-                // Search for "Band N Used" parameter
-                auto usedName = "Band " + juce::String(bandNum) + " Used";
-                for (int i = 0; i < params.size(); ++i)
+                // Look up the "Band N Used" parameter
+                int usedIndex = index->findByName("Band " + juce::String(bandNum) + " Used");
+                if (usedIndex >= 0 && usedIndex < params.size())
                 {
-                    if (params[i]->getName(64).equalsIgnoreCase(usedName))
-                    {
-                        if (params[i]->getValue() < 0.5f)
-                            params[i]->setValueNotifyingHost(1.0f);
-                        activatedBands.insert(bandNum);
-                        break;
-                    }
+                    if (params[usedIndex]->getValue() < 0.5f)
+                        params[usedIndex]->setValueNotifyingHost(1.0f);
+                    activatedBands.insert(bandNum);
                 }
             }
         }
@@ -3677,7 +4797,8 @@ void ChainProcessor::applyPendingParameters(
 
     PCLOG("applyPendingParameters: " + pluginName + " — applied " +
           juce::String(applied) + "/" + juce::String(static_cast<int>(pending.size())) +
-          " bands activated: " + juce::String(static_cast<int>(activatedBands.size())));
+          " (" + juce::String(fuzzyMatched) + " by name), bands activated: " +
+          juce::String(static_cast<int>(activatedBands.size())));
 }
 
 ChainProcessor::ImportResult ChainProcessor::importChainWithPresets(const juce::var& data)
@@ -3700,12 +4821,9 @@ ChainProcessor::ImportResult ChainProcessor::importChainWithPresets(const juce::
     // CRITICAL: Suspend audio BEFORE any graph modifications.
     suspendProcessing(true);
 
-    // Clear existing chain
+    // Clear existing chain (matching plugin instances are reused, see claimReusablePlugin)
     hideAllPluginWindows();
-    std::vector<PluginLeaf*> allPlugins;
-    ChainNodeHelpers::collectPluginsMut(rootNode, allPlugins);
-    for (auto* plug : allPlugins)
-        AudioProcessorGraph::removeNode(plug->graphNodeId);
+    collectReusablePlugins();
 
     // Defensive check: rootNode should always be a group
     if (!rootNode.isGroup())
@@ -3736,6 +4854,9 @@ ChainProcessor::ImportResult ChainProcessor::importChainWithPresets(const juce::
         auto slotsVar = obj->getProperty("slots");
         if (!slotsVar.isArray())
         {
+            removeUnclaimedPlugins();
+            cachedSlotsDirty = true;
+            rebuildGraph();
             suspendProcessing(false);
             return result;
         }
@@ -3747,6 +4868,8 @@ ChainProcessor::ImportResult ChainProcessor::importChainWithPresets(const juce::
         }
     }
 
+    removeUnclaimedPlugins();
+
     cachedSlotsDirty = true;
     rebuildGraph();
 
@@ -3789,9 +4912,7 @@ ChainProcessor::ImportResult ChainProcessor::importChainWithPresets(const juce::
 
                 if (proc != nullptr)
                 {
-                    applyPendingParameters(proc, plug->pendingParameters,
-                                           plug->description.name,
-                                           plug->description.manufacturerName);
+                    applyPendingParameters(proc, plug->pendingParameters, plug->description);
                 }
             }
             plug->pendingParameters.clear();
@@ -4028,6 +5149,109 @@ void ChainProcessor::rebuildCachedSlots() const
     cachedSlotsDirty = false;
 }
 
+//==============================================================================
+// Structural operation log (mirroring)
+//==============================================================================
+
+juce::var ChainProcessor::getNodePathVar(ChainNodeId nodeId) const
+{
+    if (!onStructuralOperation)
+        return {};
+
+    std::vector<int> path;
+    if (!ChainNodeHelpers::getPath(rootNode, nodeId, path))
+        return {};
+
+    juce::Array<juce::var> result;
+    for (int index : path)
+        result.add(index);
+    return juce::var(result);
+}
+
+ChainNodeId ChainProcessor::resolveNodePathVar(const juce::var& pathVar)
+{
+    auto* array = pathVar.getArray();
+    if (array == nullptr)
+        return -1;
+
+    std::vector<int> path;
+    for (const auto& index : *array)
+        path.push_back(static_cast<int>(index));
+
+    auto* node = ChainNodeHelpers::findByPath(rootNode, path);
+    return node != nullptr ? node->id : -1;
+}
+
+bool ChainProcessor::applyStructuralOperation(const juce::var& op)
+{
+    jassert(juce::MessageManager::getInstance()->isThisTheMessageThread());
+
+    const auto type = op.getProperty("type", {}).toString();
+    const int index = static_cast<int>(op.getProperty("index", -1));
+
+    if (type == "add")
+    {
+        juce::PluginDescription desc;
+        auto descXml = juce::XmlDocument::parse(op.getProperty("plugin", {}).toString());
+        const auto parentId = resolveNodePathVar(op.getProperty("parent", {}));
+        if (descXml == nullptr || !desc.loadFromXml(*descXml) || parentId < 0)
+            return false;
+        return addPlugin(desc, parentId, index);
+    }
+
+    if (type == "dryPath")
+    {
+        const auto parentId = resolveNodePathVar(op.getProperty("parent", {}));
+        return parentId >= 0 && addDryPath(parentId, index) >= 0;
+    }
+
+    if (type == "remove")
+    {
+        const auto nodeId = resolveNodePathVar(op.getProperty("node", {}));
+        return nodeId > 0 && removeNode(nodeId);
+    }
+
+    if (type == "move")
+    {
+        const auto nodeId = resolveNodePathVar(op.getProperty("node", {}));
+        const auto parentId = resolveNodePathVar(op.getProperty("parent", {}));
+        return nodeId > 0 && parentId >= 0 && moveNode(nodeId, parentId, index);
+    }
+
+    if (type == "group")
+    {
+        std::vector<ChainNodeId> childIds;
+        if (auto* paths = op.getProperty("nodes", {}).getArray())
+        {
+            for (const auto& path : *paths)
+            {
+                const auto id = resolveNodePathVar(path);
+                if (id <= 0)
+                    return false;
+                childIds.push_back(id);
+            }
+        }
+        const auto mode = static_cast<GroupMode>(static_cast<int>(op.getProperty("mode", 0)));
+        return createGroup(childIds, mode, op.getProperty("name", {}).toString()) >= 0;
+    }
+
+    if (type == "dissolve")
+    {
+        const auto groupId = resolveNodePathVar(op.getProperty("node", {}));
+        return groupId > 0 && dissolveGroup(groupId);
+    }
+
+    if (type == "setMode")
+    {
+        const auto groupId = resolveNodePathVar(op.getProperty("node", {}));
+        const auto mode = static_cast<GroupMode>(static_cast<int>(op.getProperty("mode", 0)));
+        return groupId >= 0 && setGroupMode(groupId, mode);
+    }
+
+    PCLOG("applyStructuralOperation — unknown operation: " + type);
+    return false;
+}
+
 //==============================================================================
 // Notifications
 //==============================================================================
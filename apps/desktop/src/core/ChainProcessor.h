@@ -4,11 +4,19 @@
 #include "ChainNode.h"
 #include "PluginSlot.h"
 #include "PluginManager.h"
+#include "BlobStore.h"
+#include "ParameterDiscoveryCache.h"
+#include "ChainScene.h"
+#include "ParameterMirror.h"
+#include "InstanceRegistry.h"
 #include "../audio/PluginParameterWatcher.h"
 #include <vector>
 #include <memory>
 #include <functional>
 #include <set>
+#include <map>
+#include <array>
+#include <optional>
 
 struct WireResult
 {
@@ -16,7 +24,18 @@ struct WireResult
     int latency = 0;  // Total latency (samples) of the wired subtree
 };
 
-class ChainProcessor : public juce::AudioProcessorGraph
+// A plugin instance created ahead of a restore (preset prefetch) — already prepared
+// and, if appliedStateHash is set, already holding the preset chunk.
+struct StagedPluginInstance
+{
+    juce::String fileOrIdentifier;       // identifier as written in the preset
+    juce::PluginDescription description; // what was actually instantiated (may be a fallback format)
+    std::unique_ptr<juce::AudioPluginInstance> instance;
+    juce::int64 appliedStateHash = 0;    // hashCode64() of the base64 state applied, 0 = none
+};
+
+class ChainProcessor : public juce::AudioProcessorGraph,
+                       private InstanceRegistry::Listener
 {
 public:
     ChainProcessor(PluginManager& pluginManager);
@@ -72,6 +91,33 @@ public:
     // Sidechain buffer from host
     void setSidechainBuffer(juce::AudioBuffer<float>* buf) { externalSidechainBuffer = buf; }
 
+    // =============================================
+    // Inter-instance audio taps (see AudioTap)
+    // =============================================
+
+    /** Enables tap sources; selfId is never offered as a source. Message thread. */
+    void setInstanceRegistry(InstanceRegistry* registry, InstanceId selfId);
+
+    /** Key a plugin from another instance's tap (sets sidechainSource = 2). */
+    bool setNodeSidechainTap(ChainNodeId nodeId, InstanceId sourceInstance);
+
+    /** Key a group's ducking from another instance's tap; -1 = the pre-group signal. */
+    bool setGroupDuckKeySource(ChainNodeId groupId, InstanceId sourceInstance);
+
+    /** Highest chain-to-host rate ratio taps are upsampled for (the processor's 4x mode). */
+    static constexpr int kMaxTapOversampling = 4;
+
+    /** Host timeline position (-1 if unknown) and host-rate length of the block about to
+        render, plus how many chain samples each host sample becomes (2^n when oversampled).
+        Taps are read at host rate and upsampled to the chain's block. Audio thread, before
+        processBlock — like setSidechainBuffer. */
+    void setAudioTapBlock(juce::int64 position, int numSamples, int oversampling = 1) noexcept
+    {
+        tapBlockPosition = position;
+        tapBlockSamples = numSamples;
+        tapBlockOversampling = juce::jlimit(1, kMaxTapOversampling, oversampling);
+    }
+
     // Set bypass on a node (must be a plugin leaf)
     void setNodeBypassed(ChainNodeId nodeId, bool bypassed);
 
@@ -156,6 +202,16 @@ public:
     // Latency reporting
     int getTotalLatencySamples() const;
 
+    // CPU estimate from the catalog's plugin profiles, at the current rate and block size.
+    // load is a share of one core (1.0 = all of it); plugins never benchmarked count as unprofiled.
+    struct CpuEstimate
+    {
+        double load = 0.0;
+        int numProfiled = 0;
+        int numUnprofiled = 0;
+    };
+    CpuEstimate estimateChainCpu(const juce::PluginDescription* adding = nullptr) const;
+
     // PHASE 7: Force latency refresh (for plugins like Auto-Tune that change latency dynamically)
     // Call this after toggling plugin settings that affect latency
     void refreshLatencyCompensation();
@@ -182,10 +238,41 @@ public:
         juce::StringArray missingPlugins;
     };
     std::unique_ptr<juce::XmlElement> serializeChainToXml() const;
-    RestoreResult restoreChainFromXml(const juce::XmlElement& chainXml);
+    // If staged instances are supplied they are adopted (matched by identifier in document
+    // order) instead of instantiating; after restoreChainFromXmlAsync()'s fade-out the new
+    // chain ramps back in with a short output fade.
+    RestoreResult restoreChainFromXml(const juce::XmlElement& chainXml,
+                                      std::vector<StagedPluginInstance>* staged = nullptr);
+    // Staged swap with a fade-out first: the restore runs once the audio thread reports the
+    // old chain silent (or after a short timeout when nothing is processing). onDone gets the
+    // result on the message thread — before this returns if the swap fade is 0 ms. A swap
+    // requested while another is pending completes the pending one first.
+    void restoreChainFromXmlAsync(std::unique_ptr<juce::XmlElement> chainXml,
+                                  std::vector<StagedPluginInstance> staged,
+                                  std::function<void(RestoreResult)> onDone);
+    // Snapshots reference plugin chunks in the shared BlobStore (stateRef) instead of embedding
+    // them, so undo steps and A/B/C/D recall share memory. DAW state stays self-contained.
     juce::MemoryBlock captureSnapshot() const;
     void restoreSnapshot(const juce::MemoryBlock& snapshot);
 
+    // =============================================
+    // Scenes — packed normalized parameter values + slot controls per leaf.
+    // Recall is a setValue sweep applied by the audio thread at the next block
+    // boundary; plugin chunks are only loaded where the parameters can't express
+    // the state. Scenes are saved with the chain (DAW state, presets, snapshots).
+    // =============================================
+
+    static constexpr int kMaxScenes = 8;
+
+    bool captureScene(int index, const juce::String& name);
+    bool recallScene(int index);
+    // Interpolate between two scenes (0 = A, 1 = B). Continuous parameters and gains/mix
+    // are blended; discrete parameters, M/S, bypass and chunk-only plugins switch at 0.5.
+    bool morphScenes(int indexA, int indexB, float position);
+    void clearScene(int index);
+    bool hasScene(int index) const;
+    juce::var getScenesAsJson() const;
+
     // Cloud sharing
     juce::var exportChainWithPresets() const;
 
@@ -220,14 +307,33 @@ public:
     // Access child processor by node ID
     juce::AudioProcessor* getNodeProcessor(ChainNodeId nodeId);
 
+    // Shared child parameter value mirror (message thread)
+    ParameterMirror& getParameterMirror() { return parameterMirror; }
+
     // Access plugin manager
     PluginManager& getPluginManager() { return pluginManager; }
 
+    // Audio config the chain was last prepared with (used to prepare staged instances)
+    double getCurrentSampleRate() const { return currentSampleRate; }
+    int getCurrentBlockSize() const { return currentBlockSize; }
+
+    // Length of the fade-out/fade-in applied around a staged preset swap
+    void setSwapFadeMs(float ms) { swapFadeMs.store(juce::jlimit(0.0f, 100.0f, ms), std::memory_order_relaxed); }
+
     // Callbacks
     std::function<void()> onChainChanged;
     std::function<void(int)> onLatencyChanged;
     std::function<void()> onParameterBindingChanged;
-    std::function<void(int)> onUnbindSlot;  // Called after duplication to clear automation
+
+    /** Fired after each successful structural edit (add, dry path, remove, move, group,
+     *  dissolve, set-mode) with a self-contained description addressing nodes by their
+     *  child-index path *before* the edit, so replaying it on an identical tree with
+     *  applyStructuralOperation() yields an identical tree. Whole-chain loads, duplicates
+     *  and template inserts are not reported. */
+    std::function<void(const juce::var& op)> onStructuralOperation;
+
+    /** Replay an onStructuralOperation description. False if a path doesn't resolve or the edit fails. */
+    bool applyStructuralOperation(const juce::var& op);
 
     /** Fired when child plugin parameters settle after user edits.
      *  Argument is the Base64 snapshot from *before* the parameter changes. */
@@ -261,6 +367,10 @@ private:
     void removeUtilityNodes(UpdateKind update = UpdateKind::sync);
     void notifyChainChanged();
 
+    // Structural operation log: paths are only built while onStructuralOperation is set
+    juce::var getNodePathVar(ChainNodeId nodeId) const;
+    ChainNodeId resolveNodePathVar(const juce::var& path);
+
     // Helper to check if a node is in a parallel group
     bool isInParallelGroup(ChainNodeId id) const;
 
@@ -280,8 +390,48 @@ private:
     // Apply pending parameters from seeded chains (semantic match + fuzzy fallback)
     void applyPendingParameters(juce::AudioProcessor* processor,
                                 const std::vector<PendingParameter>& pending,
-                                const juce::String& pluginName,
-                                const juce::String& manufacturer);
+                                const juce::PluginDescription& description);
+
+    // Instance reuse across whole-chain loads (restoreChainFromXml / importChainWithPresets):
+    // the outgoing chain's plugin nodes stay in the graph and are claimed by matching incoming
+    // leaves (same identifier, same flat position preferred). Unclaimed ones are removed after.
+    struct ReusablePlugin
+    {
+        juce::PluginDescription description;
+        NodeID graphNodeId;
+        int flatIndex = 0;
+        bool claimed = false;
+    };
+    void collectReusablePlugins();
+    NodeID claimReusablePlugin(const juce::String& fileOrIdentifier, juce::PluginDescription& descOut);
+    void removeUnclaimedPlugins();
+    bool pluginStateMatches(NodeID graphNodeId, const juce::String& stateBase64);
+
+    // Adopt a staged instance for this description, if one was supplied to restoreChainFromXml
+    std::unique_ptr<juce::AudioPluginInstance> takeStagedInstance(juce::PluginDescription& desc,
+                                                                  juce::int64& appliedStateHash);
+
+    // Preset swap fade (message thread requests, audio thread ramps and reports silence)
+    void completePendingSwap();
+    void applySwapFade(juce::AudioBuffer<float>& buffer);
+
+    // Scene recall: built on the message thread, handed to the audio thread through
+    // pendingSceneRecall, handed back through retiredSceneRecall for deletion.
+    // Node::Ptr keeps processors alive if a plugin is removed before the batch is applied.
+    struct SceneRecallBatch
+    {
+        std::vector<Node::Ptr> keepAlive;
+        std::vector<juce::AudioProcessorParameter*> parameters;
+        std::vector<float> values;
+        std::vector<std::pair<class BranchGainProcessor*, float>> gains;
+        std::vector<std::pair<class DryWetMixProcessor*, float>> mixes;
+    };
+    std::unique_ptr<SceneRecallBatch> buildSceneRecall(const ChainScene& sceneA, const ChainScene* sceneB, float position);
+    void publishSceneRecall(std::unique_ptr<SceneRecallBatch> batch);
+    void applyPendingSceneRecall();   // Audio thread (or message thread if audio isn't running)
+    void retireSceneRecalls();
+    void scenesToXml(juce::XmlElement& parent) const;
+    void scenesFromXml(const juce::XmlElement& parent);
 
     // Temporary accumulator for per-slot failures during importChainWithPresets
     std::vector<SlotFailure> importFailures;
@@ -294,6 +444,16 @@ private:
 
     PluginManager& pluginManager;
 
+    // Process-wide chunk store shared with presets/templates
+    juce::SharedResourcePointer<BlobStore> blobStore;
+
+    // Process-wide discovered parameter maps, so seeded imports don't rediscover each plugin
+    juce::SharedResourcePointer<ParameterDiscoveryCache> discoveryCache;
+
+    // Contiguous mirror of every child parameter value; its per-tick diff feeds the
+    // watcher, MirrorManager and the bridge. Declared before its consumers.
+    ParameterMirror parameterMirror;
+
     // Plugin parameter watcher for undo/redo of child plugin knob changes
     std::unique_ptr<PluginParameterWatcher> parameterWatcher;
 
@@ -327,6 +487,39 @@ private:
     // Sidechain buffer from host (set before processBlock, not owned)
     juce::AudioBuffer<float>* externalSidechainBuffer = nullptr;
 
+    // Inter-instance taps: one input per distinct source, read once per block at the top of
+    // processBlock and shared by every node keyed from that source. Inputs are recycled,
+    // never freed while the chain lives — wrappers hold raw pointers to their buffers.
+    struct TapInput
+    {
+        InstanceId source = -1;   // -1 = free
+        std::shared_ptr<AudioTap> tap;
+        juce::AudioBuffer<float> buffer { AudioTap::kNumChannels, AudioTap::kMaxBlockSamples * kMaxTapOversampling };
+        juce::AudioBuffer<float> hostRate { AudioTap::kNumChannels, AudioTap::kMaxBlockSamples };   // Before upsampling
+        float lastSample[AudioTap::kNumChannels] {};   // Interpolation carries across blocks
+    };
+    std::vector<std::unique_ptr<TapInput>> tapInputs;   // Guarded by tapLock against the audio thread
+    juce::SpinLock tapLock;
+    InstanceRegistry* instanceRegistry = nullptr;
+    InstanceId selfInstanceId = -1;
+    juce::int64 tapBlockPosition = -1;   // Audio thread
+    int tapBlockSamples = 0;             // Audio thread
+    int tapBlockOversampling = 1;        // Audio thread
+    std::set<InstanceId> tapReferenceIds;       // Stored and resolved tap sources in the tree
+    juce::StringArray tapReferenceTracks;       // Their track names, for reconnecting by name
+
+    /** Resolve tap sources in the tree, (un)subscribe inputs to match. Message thread. */
+    void updateTapInputs();
+    /** True if a registry change touches an instance or track the tree taps. */
+    bool tapReferencesAffectedBy(const InstanceRegistry::ChangeSet& changes) const;
+    /** Point every wrapper and ducking processor at its current sidechain buffer. */
+    void applySidechainBuffers();
+    juce::AudioBuffer<float>* getSidechainBufferFor(const PluginLeaf& leaf) const;
+    juce::AudioBuffer<float>* getTapBuffer(InstanceId source) const;
+    InstanceId resolveTapSource(InstanceId source, const juce::String& trackName) const;
+    void pullAudioTaps() noexcept;
+    void instanceRegistryChanged(const InstanceRegistry::ChangeSet& changes) override;
+
     double currentSampleRate = 44100.0;
     int currentBlockSize = 512;
 
@@ -356,6 +549,50 @@ private:
     // Polled by the message thread (WebViewBridge timer) to trigger graph rebuild.
     std::atomic<bool> latencyRefreshNeeded{false};
 
+    // Outgoing plugins available for reuse during a whole-chain load (message thread only)
+    std::vector<ReusablePlugin> reusablePlugins;
+    int restoreFlatIndex = 0;
+
+    // Staged instances being adopted by the current restoreChainFromXml() call (message thread only)
+    std::vector<StagedPluginInstance>* stagedInstances = nullptr;
+
+    // Swap fade: Idle → FadingOut → Silent (swap happens) → FadingIn → Idle
+    enum SwapFadeState { SwapFadeIdle = 0, SwapFadeOut, SwapFadeSilent, SwapFadeIn };
+    std::atomic<int> swapFadeState{SwapFadeIdle};
+    int swapFadePosition = 0;                 // Audio thread only
+    int swapFadeLastState = SwapFadeIdle;     // Audio thread only
+    std::atomic<float> swapFadeMs{15.0f};
+
+    // Staged swap waiting for the fade-out (message thread only)
+    struct PendingSwap
+    {
+        std::unique_ptr<juce::XmlElement> chainXml;
+        std::vector<StagedPluginInstance> staged;
+        std::function<void(RestoreResult)> onDone;
+    };
+    std::unique_ptr<PendingSwap> pendingSwap;
+    int swapGeneration = 0;
+
+    // Audio thread → message thread: the fade-out reached silence
+    struct SwapFadeNotifier : juce::AsyncUpdater
+    {
+        explicit SwapFadeNotifier(ChainProcessor& o) : owner(o) {}
+        void handleAsyncUpdate() override
+        {
+            // A stale signal (the swap already went ahead on the timeout) mustn't cut the next one short
+            if (owner.swapFadeState.load(std::memory_order_acquire) == SwapFadeSilent)
+                owner.completePendingSwap();
+        }
+        ChainProcessor& owner;
+    };
+    SwapFadeNotifier swapFadeNotifier{*this};
+
+    // Scenes (message thread) and the recall hand-off (see SceneRecallBatch)
+    std::array<std::optional<ChainScene>, kMaxScenes> scenes;
+    std::atomic<SceneRecallBatch*> pendingSceneRecall{nullptr};
+    std::atomic<SceneRecallBatch*> retiredSceneRecall{nullptr};
+    std::map<ChainNodeId, juce::String> lastSceneChunkApplied;   // Message thread: chunkRef last restored per leaf
+
     // Crash recovery state - throttling and background save tracking
     std::atomic<bool> pendingCrashRecoverySave{false};
     std::atomic<int64_t> lastCrashRecoverySaveTime{0};
@@ -0,0 +1,84 @@
+#include "ChainScene.h"
+
+const SceneLeaf* ChainScene::findLeaf(ChainNodeId nodeId) const
+{
+    for (const auto& leaf : leaves)
+        if (leaf.nodeId == nodeId)
+            return &leaf;
+    return nullptr;
+}
+
+SceneLeaf* ChainScene::findLeaf(ChainNodeId nodeId)
+{
+    for (auto& leaf : leaves)
+        if (leaf.nodeId == nodeId)
+            return &leaf;
+    return nullptr;
+}
+
+std::unique_ptr<juce::XmlElement> ChainScene::toXml(int index) const
+{
+    auto xml = std::make_unique<juce::XmlElement>("Scene");
+    xml->setAttribute("index", index);
+    xml->setAttribute("name", name);
+
+    for (const auto& leaf : leaves)
+    {
+        auto* leafXml = xml->createNewChildElement("Leaf");
+        leafXml->setAttribute("nodeId", leaf.nodeId);
+        leafXml->setAttribute("uid", leaf.fileOrIdentifier);
+        leafXml->setAttribute("inputGainDb", static_cast<double>(leaf.inputGainDb));
+        leafXml->setAttribute("outputGainDb", static_cast<double>(leaf.outputGainDb));
+        leafXml->setAttribute("dryWetMix", static_cast<double>(leaf.dryWetMix));
+        leafXml->setAttribute("midSideMode", static_cast<int>(leaf.midSideMode));
+        leafXml->setAttribute("bypassed", leaf.bypassed);
+
+        juce::MemoryOutputStream packed;
+        for (auto v : leaf.values)
+            packed.writeFloat(v);
+        leafXml->setAttribute("numValues", static_cast<int>(leaf.values.size()));
+        leafXml->setAttribute("values", packed.getMemoryBlock().toBase64Encoding());
+
+        if (leaf.chunkRef.isNotEmpty())
+            leafXml->setAttribute("stateRef", leaf.chunkRef);
+        if (leaf.chunkRequired)
+            leafXml->setAttribute("chunkRequired", true);
+    }
+
+    return xml;
+}
+
+ChainScene ChainScene::fromXml(const juce::XmlElement& xml)
+{
+    ChainScene scene;
+    scene.name = xml.getStringAttribute("name");
+
+    for (auto* leafXml : xml.getChildWithTagNameIterator("Leaf"))
+    {
+        SceneLeaf leaf;
+        leaf.nodeId = leafXml->getIntAttribute("nodeId", 0);
+        leaf.fileOrIdentifier = leafXml->getStringAttribute("uid");
+        leaf.inputGainDb = static_cast<float>(leafXml->getDoubleAttribute("inputGainDb", 0.0));
+        leaf.outputGainDb = static_cast<float>(leafXml->getDoubleAttribute("outputGainDb", 0.0));
+        leaf.dryWetMix = static_cast<float>(leafXml->getDoubleAttribute("dryWetMix", 1.0));
+        leaf.midSideMode = static_cast<MidSideMode>(juce::jlimit(0, 3, leafXml->getIntAttribute("midSideMode", 0)));
+        leaf.bypassed = leafXml->getBoolAttribute("bypassed", false);
+        leaf.chunkRef = leafXml->getStringAttribute("stateRef");
+        leaf.chunkRequired = leafXml->getBoolAttribute("chunkRequired", false);
+
+        juce::MemoryBlock packed;
+        if (packed.fromBase64Encoding(leafXml->getStringAttribute("values")))
+        {
+            const int numValues = juce::jmin(leafXml->getIntAttribute("numValues", 0),
+                                             static_cast<int>(packed.getSize() / sizeof(float)));
+            juce::MemoryInputStream in(packed, false);
+            leaf.values.reserve(static_cast<size_t>(numValues));
+            for (int i = 0; i < numValues; ++i)
+                leaf.values.push_back(juce::jlimit(0.0f, 1.0f, in.readFloat()));
+        }
+
+        scene.leaves.push_back(std::move(leaf));
+    }
+
+    return scene;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include "ChainNode.h"
+#include <vector>
+
+// One plugin leaf as captured in a scene. Parameter values are normalized (0-1) in the
+// plugin's getParameters() order, so recall is a setValue sweep instead of a chunk load.
+struct SceneLeaf
+{
+    ChainNodeId nodeId = 0;
+    juce::String fileOrIdentifier;   // recall skips the leaf if the node now holds another plugin
+    std::vector<float> values;
+
+    // Slot controls
+    float inputGainDb = 0.0f;
+    float outputGainDb = 0.0f;
+    float dryWetMix = 1.0f;
+    MidSideMode midSideMode = MidSideMode::Off;
+    bool bypassed = false;
+
+    // Full chunk at capture time (BlobStore hash). Only applied when the parameter set
+    // can't reproduce the state: no parameters, a changed parameter layout, or chunkRequired.
+    juce::String chunkRef;
+    bool chunkRequired = false;      // Two scenes with identical values but different chunks
+};
+
+struct ChainScene
+{
+    juce::String name;
+    std::vector<SceneLeaf> leaves;
+
+    const SceneLeaf* findLeaf(ChainNodeId nodeId) const;
+    SceneLeaf* findLeaf(ChainNodeId nodeId);
+
+    // <Scene name=""> with one <Leaf> per plugin. Values are packed little-endian floats
+    // (MemoryBlock base64); the chunk is written as stateRef so the BlobStore helpers
+    // inline/externalise it along with the rest of the chain.
+    std::unique_ptr<juce::XmlElement> toXml(int index) const;
+    static ChainScene fromXml(const juce::XmlElement& xml);
+};
@@ -127,6 +127,9 @@ bool GroupTemplateManager::saveGroupTemplate(ChainNodeId groupId, const juce::St
     if (!xml)
         return false;
 
+    // Plugin chunks go to the blob store; the template references them by hash
+    blobStore->externaliseChunks(*xml, true);
+
     // Create category directory if needed
     auto categoryName = category.isEmpty() ? "Uncategorized" : category;
     auto categoryDir = getTemplatesDirectory().getChildFile(categoryName);
@@ -150,6 +153,9 @@ ChainNodeId GroupTemplateManager::loadGroupTemplate(const juce::File& templateFi
     if (!xml || !xml->hasTagName("GroupTemplate"))
         return -1;
 
+    if (blobStore->resolveChunks(*xml) > 0)
+        DBG("Template " + templateFile.getFileName() + " references missing chunks, those plugins load with default state");
+
     // Check plugin availability before loading
     juce::StringArray missingPlugins;
     std::function<void(const juce::XmlElement&)> checkNode = [&](const juce::XmlElement& nodeXml)
@@ -211,6 +217,8 @@ bool GroupTemplateManager::deleteTemplate(const juce::File& templateFile)
     if (!templateFile.deleteFile())
         return false;
 
+    blobStore->scheduleLibraryGarbageCollection();
+
     scanTemplates();
     return true;
 }
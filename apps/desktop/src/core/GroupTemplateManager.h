@@ -63,6 +63,7 @@ private:
 
     ChainProcessor& chain;
     juce::Array<GroupTemplateInfo> templates;
+    juce::SharedResourcePointer<BlobStore> blobStore;
 
     static constexpr const char* TEMPLATE_EXTENSION = ".pcmgroup";
     static constexpr const char* TEMPLATE_VERSION = "1.0";
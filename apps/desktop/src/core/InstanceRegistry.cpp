@@ -11,14 +11,14 @@ InstanceId InstanceRegistry::registerInstance(juce::AudioProcessor* processor, c
 
     {
         std::lock_guard<std::mutex> lock(mutex);
-        InstanceInfo info;
-        info.id = id;
-        info.trackName = trackName.isEmpty() ? ("Instance #" + juce::String(id)) : trackName;
-        info.processor = processor;
-        instances.push_back(info);
+        auto info = std::make_shared<InstanceInfo>();
+        info->id = id;
+        info->trackName = trackName.isEmpty() ? ("Instance #" + juce::String(id)) : trackName;
+        info->processor = processor;
+        instances.push_back(std::move(info));
+        publishLocked({ id }, false);
     }
 
-    notifyListeners();
     return id;
 }
 
@@ -26,11 +26,12 @@ void InstanceRegistry::deregisterInstance(InstanceId id)
 {
     {
         std::lock_guard<std::mutex> lock(mutex);
+        bool groupsChanged = false;
 
         // Remove from mirror groups first
         for (auto it = mirrorGroups.begin(); it != mirrorGroups.end();)
         {
-            it->members.erase(id);
+            groupsChanged |= it->members.erase(id) > 0;
             if (it->members.size() <= 1)
             {
                 it = mirrorGroups.erase(it);
@@ -44,6 +45,9 @@ void InstanceRegistry::deregisterInstance(InstanceId id)
             }
         }
 
+        dropParameterChannelsLocked(id);
+        audioTaps.erase(id);   // Subscribers keep their shared_ptr and read silence
+
         // Remove any pending deferred reconnection
         deferredReconnections.erase(
             std::remove_if(deferredReconnections.begin(), deferredReconnections.end(),
@@ -53,45 +57,52 @@ void InstanceRegistry::deregisterInstance(InstanceId id)
 
         instances.erase(
             std::remove_if(instances.begin(), instances.end(),
-                [id](const InstanceInfo& info) { return info.id == id; }),
+                [id](const std::shared_ptr<const InstanceInfo>& info) { return info->id == id; }),
             instances.end()
         );
-    }
 
-    notifyListeners();
+        publishLocked({ id }, groupsChanged);
+    }
 }
 
 void InstanceRegistry::updateInstanceInfo(InstanceId id, const InstanceInfo& updatedInfo)
 {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto& info : instances)
     {
-        std::lock_guard<std::mutex> lock(mutex);
-        for (auto& info : instances)
-        {
-            if (info.id == id)
-            {
-                info.trackName = updatedInfo.trackName;
-                info.trackColour = updatedInfo.trackColour;
-                info.pluginCount = updatedInfo.pluginCount;
-                info.pluginNames = updatedInfo.pluginNames;
-                // Don't overwrite processor pointer
-                break;
-            }
-        }
+        if (info->id != id)
+            continue;
+
+        // Nothing visible changed — no snapshot, nobody woken
+        if (info->trackName == updatedInfo.trackName && info->trackColour == updatedInfo.trackColour
+            && info->pluginCount == updatedInfo.pluginCount && info->pluginNames == updatedInfo.pluginNames)
+            return;
+
+        // Entries are immutable once published: replace, don't modify
+        auto replacement = std::make_shared<InstanceInfo>(*info);
+        replacement->trackName = updatedInfo.trackName;
+        replacement->trackColour = updatedInfo.trackColour;
+        replacement->pluginCount = updatedInfo.pluginCount;
+        replacement->pluginNames = updatedInfo.pluginNames;
+        // Don't overwrite processor pointer
+        info = std::move(replacement);
+
+        publishLocked({ id }, false);
+        return;
     }
-
-    notifyListeners();
 }
 
 std::vector<InstanceInfo> InstanceRegistry::getOtherInstances(InstanceId excludeId) const
 {
-    std::lock_guard<std::mutex> lock(mutex);
+    auto current = getSnapshot();
     std::vector<InstanceInfo> result;
-    for (const auto& info : instances)
+    result.reserve(current->instances.size());
+    for (const auto& info : current->instances)
     {
-        if (info.id != excludeId)
+        if (info->id != excludeId)
         {
             // Return a copy without the processor pointer (for safety)
-            InstanceInfo copy = info;
+            InstanceInfo copy = *info;
             copy.processor = nullptr;
             result.push_back(copy);
         }
@@ -115,19 +126,41 @@ void InstanceRegistry::cleanupStaleReconnections()
 
 InstanceInfo InstanceRegistry::getInstanceInfo(InstanceId id) const
 {
-    std::lock_guard<std::mutex> lock(mutex);
-    for (const auto& info : instances)
-    {
-        if (info.id == id)
-            return info;
-    }
-    return {};
+    auto info = findInstance(id);
+    return info != nullptr ? *info : InstanceInfo {};
+}
+
+std::shared_ptr<const InstanceInfo> InstanceRegistry::findInstance(InstanceId id) const
+{
+    auto current = getSnapshot();
+    auto* entry = current->find(id);
+    return entry != nullptr ? *entry : nullptr;
 }
 
 int InstanceRegistry::getInstanceCount() const
 {
-    std::lock_guard<std::mutex> lock(mutex);
-    return static_cast<int>(instances.size());
+    return static_cast<int>(getSnapshot()->instances.size());
+}
+
+std::shared_ptr<const InstanceRegistry::Snapshot> InstanceRegistry::getSnapshot() const
+{
+    return std::atomic_load(&snapshot);
+}
+
+const std::shared_ptr<const InstanceInfo>* InstanceRegistry::Snapshot::find(InstanceId id) const
+{
+    for (const auto& info : instances)
+        if (info->id == id)
+            return &info;
+    return nullptr;
+}
+
+const InstanceRegistry::MirrorGroup* InstanceRegistry::Snapshot::findGroupFor(InstanceId id) const
+{
+    for (const auto& group : mirrorGroups)
+        if (group.members.count(id) > 0)
+            return &group;
+    return nullptr;
 }
 
 void InstanceRegistry::addListener(Listener* listener)
@@ -140,8 +173,29 @@ void InstanceRegistry::removeListener(Listener* listener)
     listeners.remove(listener);
 }
 
-void InstanceRegistry::notifyListeners()
+void InstanceRegistry::publishLocked(std::initializer_list<InstanceId> changedIds, bool mirrorGroupsChanged)
 {
+    auto next = std::make_shared<Snapshot>();
+    next->version = publishedVersion.load(std::memory_order_relaxed) + 1;
+    next->instances = instances;   // Pointer copies — entries are shared
+    next->mirrorGroups = mirrorGroups;
+    std::atomic_store(&snapshot, std::shared_ptr<const Snapshot>(std::move(next)));
+    publishedVersion.fetch_add(1, std::memory_order_release);
+
+    // Coalesce into the pending notification
+    auto& ids = pendingChanges.instanceIds;
+    for (auto id : changedIds)
+    {
+        auto pos = std::lower_bound(ids.begin(), ids.end(), id);
+        if (pos == ids.end() || *pos != id)
+            ids.insert(pos, id);
+    }
+    pendingChanges.mirrorGroupsChanged |= mirrorGroupsChanged;
+
+    if (notificationScheduled)
+        return;
+    notificationScheduled = true;
+
     // Dispatch on message thread to avoid callback from audio thread or mutex holder
     std::weak_ptr<std::atomic<bool>> weak = aliveFlag;
     juce::MessageManager::callAsync([this, weak]()
@@ -149,10 +203,23 @@ void InstanceRegistry::notifyListeners()
         auto alive = weak.lock();
         if (!alive || !alive->load(std::memory_order_acquire))
             return;  // InstanceRegistry was destroyed
-        listeners.call([](Listener& l) { l.instanceRegistryChanged(); });
+        dispatchNotification();
     });
 }
 
+void InstanceRegistry::dispatchNotification()
+{
+    ChangeSet changes;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::swap(changes, pendingChanges);
+        notificationScheduled = false;
+    }
+
+    changes.version = getVersion();
+    listeners.call([&changes](Listener& l) { l.instanceRegistryChanged(changes); });
+}
+
 // ============================================
 // Mirror group management
 // ============================================
@@ -182,7 +249,9 @@ int InstanceRegistry::createMirrorGroup(InstanceId initiator, InstanceId partner
             }
             // Add initiator to partner's existing group, preserve existing leader
             group.members.insert(initiator);
-            return group.groupId;
+            const int groupId = group.groupId;
+            publishLocked({ initiator, partner }, true);
+            return groupId;
         }
     }
 
@@ -207,7 +276,9 @@ int InstanceRegistry::createMirrorGroup(InstanceId initiator, InstanceId partner
             }
             // Add partner to initiator's existing group, preserve existing leader
             group.members.insert(partner);
-            return group.groupId;
+            const int groupId = group.groupId;
+            publishLocked({ initiator, partner }, true);
+            return groupId;
         }
     }
 
@@ -219,6 +290,7 @@ int InstanceRegistry::createMirrorGroup(InstanceId initiator, InstanceId partner
     group.leaderId = leaderId;
     group.version = 0;
     mirrorGroups.push_back(group);
+    publishLocked({ initiator, partner }, true);
 
     return group.groupId;
 }
@@ -231,6 +303,7 @@ bool InstanceRegistry::joinMirrorGroup(int groupId, InstanceId id)
         if (group.groupId == groupId)
         {
             group.members.insert(id);
+            publishLocked({ id }, true);
             return true;
         }
     }
@@ -240,9 +313,11 @@ bool InstanceRegistry::joinMirrorGroup(int groupId, InstanceId id)
 void InstanceRegistry::leaveMirrorGroup(InstanceId id)
 {
     std::lock_guard<std::mutex> lock(mutex);
+    dropParameterChannelsLocked(id);
+    bool groupsChanged = false;
     for (auto it = mirrorGroups.begin(); it != mirrorGroups.end();)
     {
-        it->members.erase(id);
+        groupsChanged |= it->members.erase(id) > 0;
         if (it->members.size() <= 1)
         {
             it = mirrorGroups.erase(it);
@@ -255,16 +330,16 @@ void InstanceRegistry::leaveMirrorGroup(InstanceId id)
             ++it;
         }
     }
+
+    if (groupsChanged)
+        publishLocked({ id }, true);
 }
 
 std::optional<InstanceRegistry::MirrorGroup> InstanceRegistry::getMirrorGroupForInstance(InstanceId id) const
 {
-    std::lock_guard<std::mutex> lock(mutex);
-    for (const auto& group : mirrorGroups)
-    {
-        if (group.members.count(id) > 0)
-            return group;  // Return copy
-    }
+    auto current = getSnapshot();
+    if (auto* group = current->findGroupFor(id))
+        return *group;  // Return copy
     return std::nullopt;
 }
 
@@ -292,8 +367,8 @@ uint64_t InstanceRegistry::incrementMirrorGroupVersion(InstanceId id)
 
 std::optional<InstanceRegistry::MirrorGroup> InstanceRegistry::getMirrorGroup(int groupId) const
 {
-    std::lock_guard<std::mutex> lock(mutex);
-    for (const auto& group : mirrorGroups)
+    auto current = getSnapshot();
+    for (const auto& group : current->mirrorGroups)
     {
         if (group.groupId == groupId)
             return group;  // Return copy
@@ -350,6 +425,7 @@ int InstanceRegistry::requestMirrorReconnection(int savedGroupId, InstanceId ins
                 group.version = 0;
                 mirrorGroups.push_back(group);
                 newGroupId = group.groupId;
+                publishLocked({ instanceId, partnerId }, true);
                 break;
             }
         }
@@ -365,7 +441,6 @@ int InstanceRegistry::requestMirrorReconnection(int savedGroupId, InstanceId ins
             juce::MessageManager::callAsync([partnerCallback, newGroupId]() { partnerCallback(newGroupId); });
         if (callback)
             juce::MessageManager::callAsync([callback, newGroupId]() { callback(newGroupId); });
-        notifyListeners();
     }
 
     return newGroupId;
@@ -373,13 +448,9 @@ int InstanceRegistry::requestMirrorReconnection(int savedGroupId, InstanceId ins
 
 InstanceId InstanceRegistry::getLeaderForInstance(InstanceId id) const
 {
-    std::lock_guard<std::mutex> lock(mutex);
-    for (const auto& group : mirrorGroups)
-    {
-        if (group.members.count(id) > 0)
-            return group.leaderId;
-    }
-    return -1;
+    auto current = getSnapshot();
+    auto* group = current->findGroupFor(id);
+    return group != nullptr ? group->leaderId : -1;
 }
 
 void InstanceRegistry::cancelDeferredReconnection(InstanceId id)
@@ -391,3 +462,37 @@ void InstanceRegistry::cancelDeferredReconnection(InstanceId id)
         deferredReconnections.end()
     );
 }
+
+std::shared_ptr<MirrorParameterChannel> InstanceRegistry::getParameterChannel(InstanceId from, InstanceId to)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& channel = parameterChannels[{ from, to }];
+    if (channel == nullptr)
+        channel = std::make_shared<MirrorParameterChannel>();
+    return channel;
+}
+
+std::shared_ptr<AudioTap> InstanceRegistry::getAudioTap(InstanceId source)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto registered = std::any_of(instances.begin(), instances.end(),
+                                  [source](const auto& info) { return info->id == source; });
+    if (!registered)
+        return nullptr;
+
+    auto& tap = audioTaps[source];
+    if (tap == nullptr)
+        tap = std::make_shared<AudioTap>();
+    return tap;
+}
+
+void InstanceRegistry::dropParameterChannelsLocked(InstanceId id)
+{
+    for (auto it = parameterChannels.begin(); it != parameterChannels.end();)
+    {
+        if (it->first.first == id || it->first.second == id)
+            it = parameterChannels.erase(it);
+        else
+            ++it;
+    }
+}
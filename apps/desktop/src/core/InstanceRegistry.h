@@ -1,6 +1,13 @@
 #pragma once
 
 #include <juce_audio_processors/juce_audio_processors.h>
+#include "AnalysisBus.h"
+#include "AudioTap.h"
+#include "MirrorParameterChannel.h"
+#include <algorithm>
+#include <map>
+#include <set>
+#include <optional>
 #include <vector>
 #include <mutex>
 #include <atomic>
@@ -24,8 +31,14 @@ struct InstanceInfo
  * Used via juce::SharedResourcePointer<InstanceRegistry> so the first instance creates it
  * and the last instance to be destroyed cleans it up.
  *
- * All public methods are thread-safe (mutex-protected). All callbacks are dispatched
- * on the message thread via MessageManager::callAsync.
+ * Writers (register/update/mirror group changes) serialize on a mutex and publish an
+ * immutable, versioned Snapshot; readers load the current snapshot atomically and never
+ * take the mutex. Unchanged InstanceInfo entries are shared between snapshots, so an
+ * update costs one entry plus a vector of pointers.
+ *
+ * Change notifications are coalesced: however many writes happen before the message
+ * thread gets to it, listeners receive one callback carrying the affected instance IDs,
+ * so instances a change doesn't concern can return immediately.
  */
 class InstanceRegistry
 {
@@ -48,6 +61,9 @@ public:
     /** Get info for a specific instance. Returns empty InstanceInfo if not found. */
     InstanceInfo getInstanceInfo(InstanceId id) const;
 
+    /** Shared, immutable entry for an instance (no copy), or nullptr if not registered. */
+    std::shared_ptr<const InstanceInfo> findInstance(InstanceId id) const;
+
     /** Get the total number of registered instances. */
     int getInstanceCount() const;
 
@@ -55,12 +71,24 @@ public:
     // Listener interface for change notifications
     // ============================================
 
+    struct ChangeSet
+    {
+        uint64_t version = 0;                  // Snapshot version the notification reflects
+        std::vector<InstanceId> instanceIds;   // Registered, deregistered or updated (sorted, unique)
+        bool mirrorGroupsChanged = false;      // Any group formed, changed membership or dissolved
+
+        bool contains(InstanceId id) const
+        {
+            return std::binary_search(instanceIds.begin(), instanceIds.end(), id);
+        }
+    };
+
     class Listener
     {
     public:
         virtual ~Listener() = default;
-        /** Called on the message thread when an instance is added, removed, or updated. */
-        virtual void instanceRegistryChanged() = 0;
+        /** Called on the message thread, once per batch of coalesced registry writes. */
+        virtual void instanceRegistryChanged(const ChangeSet& changes) = 0;
     };
 
     void addListener(Listener* listener);
@@ -75,9 +103,29 @@ public:
         int groupId = -1;
         std::set<InstanceId> members;
         InstanceId leaderId = -1;
+        uint64_t version = 0;   // Not republished on increment — incrementMirrorGroupVersion is authoritative
+    };
+
+    // ============================================
+    // Snapshots
+    // ============================================
+
+    struct Snapshot
+    {
         uint64_t version = 0;
+        std::vector<std::shared_ptr<const InstanceInfo>> instances;
+        std::vector<MirrorGroup> mirrorGroups;
+
+        const std::shared_ptr<const InstanceInfo>* find(InstanceId id) const;
+        const MirrorGroup* findGroupFor(InstanceId id) const;
     };
 
+    /** Current published snapshot (never null). Lock-free for readers. */
+    std::shared_ptr<const Snapshot> getSnapshot() const;
+
+    /** Version of the current snapshot; bumps on every published write. */
+    uint64_t getVersion() const { return publishedVersion.load(std::memory_order_acquire); }
+
     /** Create a mirror group between two instances (or join an existing group). Returns the group ID. */
     int createMirrorGroup(InstanceId initiator, InstanceId partner, InstanceId leaderId);
 
@@ -119,11 +167,36 @@ public:
     /** Clean up stale deferred reconnections older than 30 seconds. */
     void cleanupStaleReconnections();
 
+    /**
+     * Realtime parameter channel carrying hosted parameter changes from one mirror
+     * member to another. Created on first request; dropped when either side leaves
+     * its mirror group or deregisters (holders keep their shared_ptr until they let go).
+     */
+    std::shared_ptr<MirrorParameterChannel> getParameterChannel(InstanceId from, InstanceId to);
+
+    /**
+     * The source instance's audio tap, created on first request (the source itself asks
+     * for it at construction). nullptr if the instance isn't registered. Dropped from the
+     * registry when the source deregisters.
+     */
+    std::shared_ptr<AudioTap> getAudioTap(InstanceId source);
+
+    /** Per-instance analysis frames for the session overview (lock-free, see AnalysisBus). */
+    AnalysisBus& getAnalysisBus() { return analysisBus; }
+
 private:
     mutable std::mutex mutex;
-    std::vector<InstanceInfo> instances;
+    std::vector<std::shared_ptr<const InstanceInfo>> instances;
     std::atomic<InstanceId> nextId { 1 };
 
+    // Published snapshot — read with std::atomic_load, written under mutex with std::atomic_store
+    std::shared_ptr<const Snapshot> snapshot = std::make_shared<Snapshot>();
+    std::atomic<uint64_t> publishedVersion { 0 };
+
+    // Coalesced notification state (guarded by mutex)
+    ChangeSet pendingChanges;
+    bool notificationScheduled = false;
+
     // Mirror groups
     std::vector<MirrorGroup> mirrorGroups;
     int nextMirrorGroupId = 1;
@@ -139,12 +212,23 @@ private:
     };
     std::vector<DeferredMirrorReconnection> deferredReconnections;
 
+    // Realtime parameter channels, keyed by (from, to)
+    std::map<std::pair<InstanceId, InstanceId>, std::shared_ptr<MirrorParameterChannel>> parameterChannels;
+    void dropParameterChannelsLocked(InstanceId id);
+
+    // Inter-instance audio taps, keyed by source
+    std::map<InstanceId, std::shared_ptr<AudioTap>> audioTaps;
+
+    AnalysisBus analysisBus;
+
     juce::ListenerList<Listener> listeners;
 
     // Weak lifetime guard for async callbacks
     std::shared_ptr<std::atomic<bool>> aliveFlag = std::make_shared<std::atomic<bool>>(true);
 
-    void notifyListeners();
+    /** Publish the current state as a new snapshot and queue a coalesced notification. Caller holds mutex. */
+    void publishLocked(std::initializer_list<InstanceId> changedIds, bool mirrorGroupsChanged);
+    void dispatchNotification();
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(InstanceRegistry)
 };
@@ -3,12 +3,16 @@
 #include "../utils/ProChainLogger.h"
 #include "ChainProcessor.h"
 #include "ChainNode.h"
+#include <algorithm>
 
 MirrorManager::MirrorManager(PluginChainManagerProcessor& proc, InstanceRegistry& reg)
     : processor(proc)
     , registry(reg)
 {
     registry.addListener(this);
+    processor.getChainProcessor().onStructuralOperation = [this](const juce::var& op) {
+        onLocalStructuralOperation(op);
+    };
 }
 
 MirrorManager::~MirrorManager() noexcept
@@ -17,8 +21,14 @@ MirrorManager::~MirrorManager() noexcept
     aliveFlag->store(false, std::memory_order_release);
 
     registry.removeListener(this);
+    processor.getChainProcessor().onStructuralOperation = nullptr;
     stopTimer();
 
+    {
+        const juce::SpinLock::ScopedLockType lock(realtimeLinkLock);
+        realtimeLinks = {};
+    }
+
     // Inline leave logic to avoid callAsync in leaveMirrorGroup during destruction
     if (isMirrored())
     {
@@ -63,6 +73,8 @@ int MirrorManager::startMirror(InstanceId partnerId)
     PCLOG("MirrorManager::startMirror — localPlugins=" + juce::String(localCount)
           + " partnerPlugins=" + juce::String(partnerCount));
 
+    updateRealtimeLinks();
+
     // Start param diff timer at 15Hz
     startTimerHz(15);
 
@@ -117,6 +129,7 @@ void MirrorManager::leaveMirrorGroup()
 
     stopTimer();
     registry.leaveMirrorGroup(processor.getInstanceId());
+    updateRealtimeLinks();
     lastAppliedVersion = 0;
     previousParamSnapshot.clear();
     lastPropagatedFingerprint.clear();
@@ -136,6 +149,7 @@ void MirrorManager::rejoinMirror()
     // Start parameter diff timer
     startTimerHz(15);
     previousParamSnapshot = captureParameterSnapshot();
+    updateRealtimeLinks();
 
     std::weak_ptr<std::atomic<bool>> weak = aliveFlag;
     juce::MessageManager::callAsync([this, weak]() {
@@ -144,9 +158,20 @@ void MirrorManager::rejoinMirror()
     });
 }
 
-void MirrorManager::instanceRegistryChanged()
+PluginChainManagerProcessor* MirrorManager::findProcessor(InstanceId id) const
 {
+    auto info = registry.findInstance(id);
+    return info != nullptr ? dynamic_cast<PluginChainManagerProcessor*>(info->processor) : nullptr;
+}
+
+void MirrorManager::instanceRegistryChanged(const InstanceRegistry::ChangeSet& changes)
+{
+    // Only group membership drives mirroring state; track names/plugin lists don't
+    if (!changes.mirrorGroupsChanged)
+        return;
+
     bool currentlyMirrored = isMirrored();
+    updateRealtimeLinks();
 
     // Detect when we've just been added to a mirror group (by partner's startMirror call).
     // The partner starts its own timer in startMirror(), but we need to start ours too.
@@ -221,7 +246,9 @@ void MirrorManager::onLocalChainChanged()
         return;
     }
 
-    // Only propagate if the chain structure actually changed (plugin add/remove/move).
+    // Only propagate if the chain structure changed in a way no structural operation
+    // already carried (whole-chain load, duplicate, template insert) — operations move
+    // lastPropagatedFingerprint along as they are sent.
     // Property changes (bypass, gain, dry/wet) are synced by the 15Hz parameter timer.
     auto currentFp = computeStructuralFingerprint();
     if (currentFp == lastPropagatedFingerprint)
@@ -244,6 +271,7 @@ void MirrorManager::applyMirrorUpdate(const juce::var& chainData, uint64_t versi
     PCLOG("MirrorManager::applyMirrorUpdate — version=" + juce::String(version));
 
     lastAppliedVersion = version;
+    updateRealtimeLinks();
 
     // Suppress the onChainChanged callback from re-propagating this change
     suppressLocalNotification.store(true, std::memory_order_release);
@@ -284,21 +312,8 @@ void MirrorManager::applyParameterDiffs(const std::vector<std::tuple<int, int, f
 
     for (const auto& [slotIndex, paramIndex, value] : paramDiffs)
     {
-        if (paramIndex >= 0)
-        {
-            // Hosted plugin parameter — setValue + notify listeners so plugin editor UI updates
-            auto* proc = chainProcessor.getSlotProcessor(slotIndex);
-            if (!proc)
-                continue;
-
-            auto& params = proc->getParameters();
-            if (paramIndex < params.size())
-            {
-                params[paramIndex]->setValue(value);
-                params[paramIndex]->sendValueChangedMessageToListeners(value);
-            }
-        }
-        else if (slotIndex >= 0 && slotIndex < static_cast<int>(nodeIds.size()))
+        // Hosted plugin parameters arrive through the realtime channels
+        if (paramIndex < 0 && slotIndex >= 0 && slotIndex < static_cast<int>(nodeIds.size()))
         {
             // Slot-level control — use ChainProcessor setters (updates leaf + DSP node + UI)
             auto nodeId = nodeIds[static_cast<size_t>(slotIndex)];
@@ -327,6 +342,83 @@ void MirrorManager::applyParameterDiffs(const std::vector<std::tuple<int, int, f
     });
 }
 
+void MirrorManager::processRealtimeParameters() noexcept
+{
+    const juce::SpinLock::ScopedTryLockType lock(realtimeLinkLock);
+    if (!lock.isLocked() || realtimeLinks.outbound.empty())
+        return;
+
+    auto& mirror = processor.getChainProcessor().getParameterMirror();
+
+    for (auto& channel : realtimeLinks.inbound)
+        mirror.applyRealtimeChanges(*channel);
+
+    const int count = mirror.collectRealtimeChanges(outgoingChanges.data(), kMaxRealtimeChangesPerBlock);
+
+    for (auto& link : realtimeLinks.outbound)
+    {
+        auto& channel = *link.channel;
+
+        // A stalled partner: don't keep overfilling its queue. Once it has caught up,
+        // send it the full state (what it missed was dropped for it alone).
+        if (link.overflowed)
+        {
+            if (channel.getNumReady() > 0)
+                continue;
+
+            link.overflowed = false;
+            link.resyncing = true;
+            link.resyncCursor = 0;
+        }
+
+        if (count > 0 && channel.push(outgoingChanges.data(), count) < count)
+        {
+            link.overflowed = true;
+            link.resyncing = false;
+            continue;
+        }
+
+        if (link.resyncing)
+        {
+            bool finished = false;
+            const int space = juce::jmin(kMaxRealtimeChangesPerBlock, channel.getFreeSpace());
+            const int sent = mirror.collectRealtimeState(resyncEntries.data(), space, link.resyncCursor, finished);
+            channel.push(resyncEntries.data(), sent);
+            link.resyncing = !finished;
+        }
+    }
+}
+
+void MirrorManager::updateRealtimeLinks()
+{
+    RealtimeLinks links;
+    const auto myId = processor.getInstanceId();
+    for (auto partnerId : getPartnerIds())
+    {
+        links.inbound.push_back(registry.getParameterChannel(partnerId, myId));
+        links.outbound.push_back({ registry.getParameterChannel(myId, partnerId) });
+    }
+
+    auto sameChannels = [](const std::vector<OutboundLink>& a, const std::vector<OutboundLink>& b)
+    {
+        return std::equal(a.begin(), a.end(), b.begin(), b.end(),
+                          [](const OutboundLink& x, const OutboundLink& y) { return x.channel == y.channel; });
+    };
+
+    // Unchanged: keep the per-partner overflow/resync state the audio thread is tracking
+    if (links.inbound == realtimeLinks.inbound && sameChannels(links.outbound, realtimeLinks.outbound))
+        return;
+
+    PCLOG("MirrorManager::updateRealtimeLinks — " + juce::String(static_cast<int>(links.outbound.size()))
+          + " partner channel(s)");
+
+    {
+        const juce::SpinLock::ScopedLockType lock(realtimeLinkLock);
+        std::swap(realtimeLinks, links);
+    }
+    // Old links are released here, outside the lock
+}
+
 void MirrorManager::addListener(Listener* listener)
 {
     listeners.add(listener);
@@ -342,20 +434,150 @@ void MirrorManager::timerCallback()
     if (!isMirrored())
         return;
 
+    // Partner membership may change without a registry notification reaching us first
+    updateRealtimeLinks();
+
     propagateParameterDiffs();
 }
 
 juce::String MirrorManager::computeStructuralFingerprint() const
 {
-    auto& chainProcessor = processor.getChainProcessor();
-    const auto& flatPlugins = chainProcessor.getFlatPluginList();
+    // Tree shape, group modes and plugin identities — what structural operations change
+    std::function<void(const ChainNode&, juce::String&)> append = [&append](const ChainNode& node, juce::String& fp)
+    {
+        if (node.isPlugin())
+        {
+            const auto& leaf = node.getPlugin();
+            fp << (leaf.isDryPath ? juce::String("~dry") : leaf.description.fileOrIdentifier) << "|";
+            return;
+        }
+
+        fp << (node.getGroup().mode == GroupMode::Parallel ? "P[" : "S[");
+        for (const auto& child : node.getGroup().children)
+            append(*child, fp);
+        fp << "]";
+    };
+
+    const auto& root = processor.getChainProcessor().getRootNode();
     juce::String fp;
-    fp.preallocateBytes(flatPlugins.size() * 64);
-    for (const auto* leaf : flatPlugins)
-        fp << leaf->description.fileOrIdentifier << "|";
+    fp.preallocateBytes(static_cast<size_t>(ChainNodeHelpers::countPlugins(root)) * 64 + 16);
+    append(root, fp);
     return fp;
 }
 
+void MirrorManager::onLocalStructuralOperation(const juce::var& op)
+{
+    // Replays of a partner's operation (and full imports) run suppressed
+    if (!isMirrored() || suppressLocalNotification.load(std::memory_order_acquire))
+        return;
+
+    const auto myId = processor.getInstanceId();
+    const auto result = computeStructuralFingerprint();
+
+    auto* envelope = new juce::DynamicObject();
+    envelope->setProperty("origin", myId);
+    envelope->setProperty("seq", static_cast<juce::int64>(++localOperationSeq));
+    envelope->setProperty("base", lastPropagatedFingerprint);
+    envelope->setProperty("result", result);
+    envelope->setProperty("op", op);
+    juce::var envelopeVar(envelope);
+
+    lastPropagatedFingerprint = result;
+
+    PCLOG("MirrorManager::onLocalStructuralOperation — " + op.getProperty("type", {}).toString()
+          + " seq=" + juce::String(static_cast<juce::int64>(localOperationSeq)));
+
+    // Same ordering as propagateChainToPartners: delivered from the message queue, FIFO
+    std::weak_ptr<std::atomic<bool>> weak = aliveFlag;
+    juce::MessageManager::callAsync([this, weak, envelopeVar]()
+    {
+        auto alive = weak.lock();
+        if (!alive || !alive->load(std::memory_order_acquire))
+            return;
+
+        for (auto partnerId : getPartnerIds())
+        {
+            if (auto* partnerProcessor = findProcessor(partnerId))
+                partnerProcessor->getMirrorManager().applyStructuralOperation(envelopeVar);
+        }
+    });
+}
+
+void MirrorManager::applyStructuralOperation(const juce::var& envelope)
+{
+    if (!isMirrored())
+        return;
+
+    const auto origin = static_cast<InstanceId>(static_cast<int>(envelope.getProperty("origin", -1)));
+    const auto seq = static_cast<uint64_t>(static_cast<juce::int64>(envelope.getProperty("seq", 0)));
+    const auto& op = envelope["op"];
+
+    // Version vector: drop duplicates / stale deliveries from this origin
+    auto& lastSeq = appliedOperationSeq[origin];
+    if (seq <= lastSeq)
+        return;
+    lastSeq = seq;
+
+    // The operation's paths only mean something on the tree it was recorded against
+    if (computeStructuralFingerprint() != envelope.getProperty("base", {}).toString())
+    {
+        PCLOG("MirrorManager::applyStructuralOperation — base mismatch (concurrent edit), requesting re-sync from leader");
+        requestResyncFrom(registry.getLeaderForInstance(processor.getInstanceId()));
+        return;
+    }
+
+    auto& chainProcessor = processor.getChainProcessor();
+
+    suppressLocalNotification.store(true, std::memory_order_release);
+    const bool applied = chainProcessor.applyStructuralOperation(op);
+
+    lastPropagatedFingerprint = computeStructuralFingerprint();
+    previousParamSnapshot = captureParameterSnapshot();
+
+    // Clear via callAsync — runs AFTER the onChainChanged callback queued by the edit (FIFO)
+    std::weak_ptr<std::atomic<bool>> weak = aliveFlag;
+    juce::MessageManager::callAsync([this, weak]() {
+        if (auto alive = weak.lock(); alive && alive->load(std::memory_order_acquire))
+            suppressLocalNotification.store(false, std::memory_order_release);
+    });
+
+    juce::MessageManager::callAsync([this, weak]() {
+        if (auto alive = weak.lock(); alive && alive->load(std::memory_order_acquire))
+            listeners.call([](Listener& l) { l.mirrorUpdateApplied(); });
+    });
+
+    // Sender had structural changes we never received (or the replay failed): its tree is newest
+    if (!applied || lastPropagatedFingerprint != envelope.getProperty("result", {}).toString())
+    {
+        PCLOG("MirrorManager::applyStructuralOperation — result mismatch, requesting re-sync from origin");
+        requestResyncFrom(origin);
+    }
+}
+
+void MirrorManager::requestResyncFrom(InstanceId source)
+{
+    std::weak_ptr<std::atomic<bool>> weak = aliveFlag;
+    juce::MessageManager::callAsync([this, weak, source]()
+    {
+        auto alive = weak.lock();
+        if (!alive || !alive->load(std::memory_order_acquire))
+            return;
+
+        if (auto* sourceProcessor = findProcessor(source))
+            sourceProcessor->getMirrorManager().resyncPartners();
+    });
+}
+
+void MirrorManager::resyncPartners()
+{
+    if (!isMirrored())
+        return;
+
+    PCLOG("MirrorManager::resyncPartners — full chain re-sync");
+    lastPropagatedFingerprint = computeStructuralFingerprint();
+    propagateChainToPartners();
+}
+
 void MirrorManager::propagateChainToPartners()
 {
     auto myId = processor.getInstanceId();
@@ -382,8 +604,7 @@ void MirrorManager::propagateChainToPartners()
             return;  // MirrorManager was destroyed
 
         // Re-validate that this instance still exists before accessing processor
-        auto myInfo = registry.getInstanceInfo(myId);
-        if (myInfo.processor == nullptr)
+        if (registry.findInstance(myId) == nullptr)
             return;  // Instance was destroyed
 
         auto& chainProcessor = processor.getChainProcessor();
@@ -392,13 +613,8 @@ void MirrorManager::propagateChainToPartners()
         auto partners = getPartnerIds();
         for (auto partnerId : partners)
         {
-            auto partnerInfo = registry.getInstanceInfo(partnerId);
-            if (partnerInfo.processor != nullptr)
-            {
-                auto* partnerProcessor = dynamic_cast<PluginChainManagerProcessor*>(partnerInfo.processor);
-                if (partnerProcessor)
-                    partnerProcessor->getMirrorManager().applyMirrorUpdate(chainData, version);
-            }
+            if (auto* partnerProcessor = findProcessor(partnerId))
+                partnerProcessor->getMirrorManager().applyMirrorUpdate(chainData, version);
         }
     });
 }
@@ -409,10 +625,11 @@ void MirrorManager::propagateParameterDiffs()
         return;
 
     // timerCallback already runs on the message thread, so no callAsync needed.
-    auto currentSnapshot = captureParameterSnapshot();
-
-    // Build diff: compare by index (same order guaranteed since same chain structure)
     std::vector<std::tuple<int, int, float>> diffs;
+
+    // Slot-level controls: a handful per plugin, diffed by index. Hosted plugin
+    // parameters are not in here — they go through the realtime channels.
+    auto currentSnapshot = captureParameterSnapshot();
     size_t minSize = std::min(currentSnapshot.size(), previousParamSnapshot.size());
     for (size_t i = 0; i < minSize; ++i)
     {
@@ -429,12 +646,8 @@ void MirrorManager::propagateParameterDiffs()
     if (diffs.empty())
         return;
 
-    // Log diff breakdown
-    int slotDiffs = 0;
-    for (const auto& [s, p, v] : diffs)
-        if (p < 0) ++slotDiffs;
     PCLOG("MirrorManager::propagateParameterDiffs — " + juce::String(static_cast<int>(diffs.size()))
-          + " diffs (" + juce::String(slotDiffs) + " slot-level), snapshotSize="
+          + " slot-level diffs, snapshotSize="
           + juce::String(static_cast<int>(currentSnapshot.size()))
           + " prevSize=" + juce::String(static_cast<int>(previousParamSnapshot.size())));
 
@@ -442,13 +655,8 @@ void MirrorManager::propagateParameterDiffs()
     auto partners = getPartnerIds();
     for (auto partnerId : partners)
     {
-        auto partnerInfo = registry.getInstanceInfo(partnerId);
-        if (partnerInfo.processor != nullptr)
-        {
-            auto* partnerProcessor = dynamic_cast<PluginChainManagerProcessor*>(partnerInfo.processor);
-            if (partnerProcessor)
-                partnerProcessor->getMirrorManager().applyParameterDiffs(diffs);
-        }
+        if (auto* partnerProcessor = findProcessor(partnerId))
+            partnerProcessor->getMirrorManager().applyParameterDiffs(diffs);
     }
 }
 
@@ -458,17 +666,10 @@ std::vector<MirrorManager::ParamSnapshot> MirrorManager::captureParameterSnapsho
     auto& chainProcessor = processor.getChainProcessor();
     const auto& flatPlugins = chainProcessor.getFlatPluginList();
 
+    snapshot.reserve(flatPlugins.size() * 4);
+
     for (int slotIndex = 0; slotIndex < static_cast<int>(flatPlugins.size()); ++slotIndex)
     {
-        // Hosted plugin parameters (paramIndex >= 0)
-        auto* proc = chainProcessor.getSlotProcessor(slotIndex);
-        if (proc)
-        {
-            auto& params = proc->getParameters();
-            for (int i = 0; i < params.size(); ++i)
-                snapshot.push_back({ slotIndex, i, params[i]->getValue() });
-        }
-
         // Slot-level controls (paramIndex < 0)
         // These are PluginLeaf properties not exposed as AudioProcessorParameters
         const auto* leaf = flatPlugins[static_cast<size_t>(slotIndex)];
@@ -2,6 +2,8 @@
 
 #include <juce_audio_processors/juce_audio_processors.h>
 #include "InstanceRegistry.h"
+#include "MirrorParameterChannel.h"
+#include <map>
 #include <vector>
 #include <atomic>
 #include <memory>
@@ -14,10 +16,21 @@ class ChainProcessor;
  * When two instances are mirrored, structural changes (add/remove/move plugin)
  * and parameter changes are synchronized bidirectionally.
  *
- * Structural changes use exportChainWithPresets/importChainWithPresets.
- * Parameter changes use a 15Hz timer to diff and propagate.
+ * Structural edits (add/remove/move/group/dissolve/set-mode) are replicated as
+ * operations: ChainProcessor reports each one, partners replay it on their own tree.
+ * Every operation carries its origin and a per-origin sequence number (version
+ * vector, for dedupe) plus the structural fingerprints before and after; a partner
+ * whose tree doesn't match falls back to a full re-sync via
+ * exportChainWithPresets/importChainWithPresets. Edits with no operation form
+ * (whole-chain loads, duplicates, templates) also fall back to the full re-sync.
+ * Hosted parameter changes travel block-synchronously: each audio block drains the
+ * chain's ParameterMirror into lock-free channels (one per partner, owned by the
+ * InstanceRegistry) and applies whatever partners queued, so mirrored tracks never
+ * drift by more than a block. Only slot-level controls (bypass/gains/mix), which are
+ * not realtime parameters, are still diffed and sent at 15Hz on the message thread.
  */
-class MirrorManager : private juce::Timer, private InstanceRegistry::Listener
+class MirrorManager : private juce::Timer,
+                      private InstanceRegistry::Listener
 {
 public:
     MirrorManager(PluginChainManagerProcessor& processor, InstanceRegistry& registry);
@@ -58,11 +71,28 @@ public:
     void applyMirrorUpdate(const juce::var& chainData, uint64_t version);
 
     /**
-     * Called by a remote MirrorManager to apply parameter diffs.
-     * @param paramDiffs Array of {nodeId, paramIndex, value} changes
+     * Called by a remote MirrorManager to replay one structural operation.
+     * @param envelope { origin, seq, base, result, op } — see ChainProcessor::onStructuralOperation
+     */
+    void applyStructuralOperation(const juce::var& envelope);
+
+    /** Push this instance's whole chain to all partners (structural fingerprint mismatch). */
+    void resyncPartners();
+
+    /**
+     * Called by a remote MirrorManager to apply slot-level control diffs.
+     * @param paramDiffs Array of {slotIndex, controlIndex (< 0), value} changes
      */
     void applyParameterDiffs(const std::vector<std::tuple<int, int, float>>& paramDiffs);
 
+    /**
+     * Audio thread, once per block before the chain renders: apply hosted parameter
+     * changes queued by partners, then queue this instance's own changes for them.
+     */
+    void processRealtimeParameters() noexcept;
+
+    static constexpr int kMaxRealtimeChangesPerBlock = 1024;
+
     // ============================================
     // Listener for mirror state changes
     // ============================================
@@ -80,12 +110,16 @@ public:
 
 private:
     void timerCallback() override;
-    void instanceRegistryChanged() override;
+    void instanceRegistryChanged(const InstanceRegistry::ChangeSet& changes) override;
+    PluginChainManagerProcessor* findProcessor(InstanceId id) const;
     void propagateChainToPartners();
     void propagateParameterDiffs();
+    void onLocalStructuralOperation(const juce::var& op);
+    void requestResyncFrom(InstanceId source);
     juce::String computeStructuralFingerprint() const;
 
-    /** Take a snapshot of all plugin parameter values for diff comparison. */
+    /** Slot-level control values (paramIndex < 0) for diff comparison. Hosted plugin
+        parameters go through the realtime channels instead. */
     struct ParamSnapshot
     {
         int nodeId;
@@ -111,9 +145,37 @@ private:
     // Parameter diff state
     std::vector<ParamSnapshot> previousParamSnapshot;
 
+    // Realtime channels to/from the current partners. Swapped on the message thread under
+    // realtimeLinkLock; the audio thread only try-locks and skips the block if contended.
+    // A partner whose channel filled up (its track stopped processing) is skipped until it
+    // has drained its queue, then gets the full state on its own — the others are untouched.
+    struct OutboundLink
+    {
+        std::shared_ptr<MirrorParameterChannel> channel;
+        bool overflowed = false;       // Audio thread only
+        bool resyncing = false;        // Audio thread only
+        uint32_t resyncCursor = 0;     // Audio thread only
+    };
+    struct RealtimeLinks
+    {
+        std::vector<std::shared_ptr<MirrorParameterChannel>> inbound;
+        std::vector<OutboundLink> outbound;
+    };
+    void updateRealtimeLinks();
+    RealtimeLinks realtimeLinks;
+    juce::SpinLock realtimeLinkLock;
+    std::vector<MirrorParameterChannel::Entry> outgoingChanges =
+        std::vector<MirrorParameterChannel::Entry>(static_cast<size_t>(kMaxRealtimeChangesPerBlock));
+    std::vector<MirrorParameterChannel::Entry> resyncEntries =
+        std::vector<MirrorParameterChannel::Entry>(static_cast<size_t>(kMaxRealtimeChangesPerBlock));
+
     // Structural fingerprint — only propagate chain when structure changes
     juce::String lastPropagatedFingerprint;
 
+    // Structural operation version vector: our own sequence and the last applied per origin
+    uint64_t localOperationSeq = 0;
+    std::map<InstanceId, uint64_t> appliedOperationSeq;
+
     juce::ListenerList<Listener> listeners;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MirrorManager)
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Lock-free single-producer/single-consumer queue of hosted parameter values from one
+ * mirrored instance to another. The producer is the sender's audio thread, the
+ * consumer the receiver's audio thread, so a change made in one instance's block is
+ * applied at the start of the partner's next block.
+ *
+ * Owned by InstanceRegistry (one per direction per partner pair) and shared with the
+ * two MirrorManagers through shared_ptr, so either instance can go away first.
+ */
+class MirrorParameterChannel
+{
+public:
+    static constexpr int kCapacity = 4096;
+
+    struct Entry
+    {
+        uint32_t layoutHash;   // Sender's ParameterMirror layout — receivers with another layout drop it
+        uint32_t index;        // ParameterMirror index
+        float value;           // Normalized
+    };
+
+    MirrorParameterChannel() : fifo(kCapacity), buffer(static_cast<size_t>(kCapacity)) {}
+
+    /** Producer. Returns how many entries fit; the rest are dropped. */
+    int push(const Entry* entries, int count) noexcept
+    {
+        const auto scope = fifo.write(juce::jmin(count, fifo.getFreeSpace()));
+        copyIn(entries, scope.startIndex1, scope.blockSize1);
+        copyIn(entries + scope.blockSize1, scope.startIndex2, scope.blockSize2);
+        return scope.blockSize1 + scope.blockSize2;
+    }
+
+    /** Consumer. Calls fn(const Entry&) for every queued entry, oldest first. */
+    template <typename Fn>
+    int drain(Fn&& fn) noexcept
+    {
+        const auto scope = fifo.read(fifo.getNumReady());
+        for (int i = 0; i < scope.blockSize1; ++i)
+            fn(buffer[static_cast<size_t>(scope.startIndex1 + i)]);
+        for (int i = 0; i < scope.blockSize2; ++i)
+            fn(buffer[static_cast<size_t>(scope.startIndex2 + i)]);
+        return scope.blockSize1 + scope.blockSize2;
+    }
+
+    int getNumReady() const noexcept { return fifo.getNumReady(); }
+    int getFreeSpace() const noexcept { return fifo.getFreeSpace(); }
+
+private:
+    void copyIn(const Entry* src, int start, int count) noexcept
+    {
+        for (int i = 0; i < count; ++i)
+            buffer[static_cast<size_t>(start + i)] = src[i];
+    }
+
+    juce::AbstractFifo fifo;
+    std::vector<Entry> buffer;
+
+    JUCE_DECLARE_NON_COPYABLE(MirrorParameterChannel)
+};
@@ -1,4 +1,11 @@
 #include "ParameterDiscovery.h"
+#include <algorithm>
+#include <bitset>
+#include <limits>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 // ============================================
 // Helper: Parse float from text string
@@ -31,27 +38,6 @@ float ParameterDiscovery::parseFloatFromText(const juce::String& text)
     return hasDigit ? numStr.getFloatValue() : 0.0f;
 }
 
-// ============================================
-// Helper: Check if input matches regex pattern (case-insensitive)
-// ============================================
-bool ParameterDiscovery::matchesPattern(const juce::String& input, const std::string& pattern)
-{
-    try
-    {
-        // Cache compiled regex objects to avoid recompilation on every call.
-        // Patterns are static string literals, so the cache grows to a fixed size.
-        static std::unordered_map<std::string, std::regex> cache;
-        auto it = cache.find(pattern);
-        if (it == cache.end())
-            it = cache.emplace(pattern, std::regex(pattern, std::regex_constants::icase)).first;
-        return std::regex_search(input.toStdString(), it->second);
-    }
-    catch (...)
-    {
-        return false;
-    }
-}
-
 // ============================================
 // Extract physical range from JUCE parameter
 // ============================================
@@ -75,422 +61,395 @@ void ParameterDiscovery::extractPhysicalRange(juce::AudioProcessorParameter* par
 }
 
 // ============================================
-// Extract band number from parameter name
+// Compiled name patterns
 // ============================================
-int ParameterDiscovery::extractBandNumber(const juce::String& name)
+//
+// Every name pattern is a case-insensitive whole-word alternation, \b(a|b|c.?d)\b. Instead
+// of a std::regex search per pattern, they're compiled once into a keyword table over the
+// name's word tokens (runs of [A-Za-z0-9_], which is what \b sees): a single pass over the
+// name sets one bit per pattern that any of its words belongs to, and the rules test bits.
+// "c.?d" matches the token "cd", a token of c, one word character and d, or the tokens c
+// and d with exactly one character between them.
+namespace
 {
-    try
-    {
-        // Try patterns: "Band 3", "Band3", "B3", "3", "#3"
-        std::regex bandRegex(R"((?:band|b)\s*(\d+))", std::regex_constants::icase);
-        std::smatch match;
-        auto nameStr = name.toStdString();
-
-        if (std::regex_search(nameStr, match, bandRegex) && match.size() > 1)
-            return std::stoi(match[1].str());
-
-        // Try bare number at end: "LF 1", "HF 2"
-        std::regex trailingNum(R"(\s+(\d+)\s*$)");
-        if (std::regex_search(nameStr, match, trailingNum) && match.size() > 1)
-            return std::stoi(match[1].str());
-
-        // Try specific band names
-        if (matchesPattern(name, R"(\b(low|lf|sub)\b)")) return 1;
-        if (matchesPattern(name, R"(\b(low.?mid|lmf)\b)")) return 2;
-        if (matchesPattern(name, R"(\b(mid|mf)\b)")) return 3;
-        if (matchesPattern(name, R"(\b(high.?mid|hmf)\b)")) return 4;
-        if (matchesPattern(name, R"(\b(high|hf|air)\b)")) return 5;
-    }
-    catch (...)
-    {
-    }
-
-    return -1;
-}
-
-// ============================================
-// Semantic parameter name matcher
-// ============================================
-ParameterDiscovery::SemanticMatch ParameterDiscovery::matchParameterName(const juce::String& name)
-{
-    SemanticMatch result;
-    auto nameLower = name.toLowerCase();
-
-    // Skip bypass parameters
-    if (matchesPattern(name, R"(\bbypass\b)"))
-        return result; // Empty semantic = skip
+    constexpr size_t kMaxPatterns = 128;
+    using PatternSet = std::bitset<kMaxPatterns>;
 
-    int bandNumber = extractBandNumber(name);
+    enum class BandRule { none, defaultFirst, required };
 
-    // ==========================================
-    // EQ Patterns
-    // ==========================================
-    if (matchesPattern(name, R"(\b(freq|frequency)\b)"))
+    struct Rule
     {
-        result.unit = "hz";
-        result.curve = "logarithmic";
-        if (bandNumber > 0)
-            result.semantic = "eq_band_" + juce::String(bandNumber) + "_freq";
-        else
-            result.semantic = "eq_band_1_freq";
-        result.bandNumber = bandNumber > 0 ? bandNumber : 1;
-        return result;
-    }
-
-    if (matchesPattern(name, R"(\b(gain|boost|cut)\b)") &&
-        !matchesPattern(name, R"(\b(input|output|makeup|make.?up|volume|level|drive|solo|auto|dynamic)\b)"))
-    {
-        result.unit = "db";
-        result.curve = "linear";
-        if (bandNumber > 0)
-            result.semantic = "eq_band_" + juce::String(bandNumber) + "_gain";
-        else
-            result.semantic = "eq_band_1_gain";
-        result.bandNumber = bandNumber > 0 ? bandNumber : 1;
-        return result;
-    }
-
-    if (matchesPattern(name, R"(\b(q|bandwidth|width|resonance)\b)") &&
-        !matchesPattern(name, R"(\b(freq|frequency|equal)\b)"))
-    {
-        result.unit = "ratio";
-        result.curve = "logarithmic";
-        if (bandNumber > 0)
-            result.semantic = "eq_band_" + juce::String(bandNumber) + "_q";
-        else
-            result.semantic = "eq_band_1_q";
-        result.bandNumber = bandNumber > 0 ? bandNumber : 1;
-        return result;
-    }
+        const char* require;
+        const char* alsoRequire;
+        const char* exclude;
+        BandRule band;
+        const char* semantic;       // After "eq_band_N_" for band rules; nullptr = skip the parameter
+        const char* unit;
+        const char* curve;
+    };
 
-    if (matchesPattern(name, R"(\b(type|shape|mode|filter)\b)") &&
-        !matchesPattern(name, R"(\b(freq|frequency|gain|comp|attack|release|ratio|thresh|reverb|delay|sat|drive|ceiling)\b)"))
-    {
-        result.unit = "stepped";
-        result.curve = "stepped";
-        if (bandNumber > 0)
-            result.semantic = "eq_band_" + juce::String(bandNumber) + "_type";
-        else
-            result.semantic = "eq_band_1_type";
-        result.bandNumber = bandNumber > 0 ? bandNumber : 1;
-        return result;
-    }
+    // In priority order — the first rule that holds names the parameter
+    const Rule kRules[] = {
+        // Bypass parameters are skipped
+        { R"(\bbypass\b)", nullptr, nullptr, BandRule::none, nullptr, nullptr, nullptr },
+
+        // EQ
+        { R"(\b(freq|frequency)\b)", nullptr, nullptr,
+          BandRule::defaultFirst, "freq", "hz", "logarithmic" },
+        { R"(\b(gain|boost|cut)\b)", nullptr,
+          R"(\b(input|output|makeup|make.?up|volume|level|drive|solo|auto|dynamic)\b)",
+          BandRule::defaultFirst, "gain", "db", "linear" },
+        { R"(\b(q|bandwidth|width|resonance)\b)", nullptr, R"(\b(freq|frequency|equal)\b)",
+          BandRule::defaultFirst, "q", "ratio", "logarithmic" },
+        { R"(\b(type|shape|mode|filter)\b)", nullptr,
+          R"(\b(freq|frequency|gain|comp|attack|release|ratio|thresh|reverb|delay|sat|drive|ceiling)\b)",
+          BandRule::defaultFirst, "type", "stepped", "stepped" },
+        { R"(\b(used|active|enable|enabled|on|off)\b)", nullptr, nullptr,
+          BandRule::required, "active", "boolean", "stepped" },
+        { R"(\b(slope|order|db.?oct)\b)", nullptr, nullptr,
+          BandRule::required, "slope", "stepped", "stepped" },
+
+        // Compressor
+        { R"(\b(thresh|threshold)\b)", nullptr, nullptr, BandRule::none, "comp_threshold", "db", "linear" },
+        { R"(\bratio\b)", nullptr, nullptr, BandRule::none, "comp_ratio", "ratio", "logarithmic" },
+        { R"(\battack\b)", nullptr, nullptr, BandRule::none, "comp_attack", "ms", "logarithmic" },
+        { R"(\brelease\b)", nullptr, nullptr, BandRule::none, "comp_release", "ms", "logarithmic" },
+        { R"(\bknee\b)", nullptr, nullptr, BandRule::none, "comp_knee", "db", "linear" },
+        { R"(\b(makeup|make.?up)\b)", nullptr, nullptr, BandRule::none, "comp_makeup", "db", "linear" },
+        // Compressor mix (dry/wet, parallel, blend) — before general mix
+        { R"(\b(mix|dry.?wet|blend|parallel)\b)", R"(\b(comp|dyn|limit)\b)", nullptr,
+          BandRule::none, "comp_mix", "percent", "linear" },
+
+        // Reverb
+        { R"(\b(decay|reverb.?time|rt60|tail)\b)", nullptr, R"(\b(attack|comp|gate|ratio)\b)",
+          BandRule::none, "reverb_decay", "ms", "logarithmic" },
+        { R"(\b(pre.?delay|predelay)\b)", nullptr, nullptr, BandRule::none, "reverb_predelay", "ms", "logarithmic" },
+        { R"(\b(damp|damping|brightness)\b)", nullptr, R"(\b(freq|comp|gate)\b)",
+          BandRule::none, "reverb_damping", "percent", "linear" },
+        { R"(\b(room|hall|plate|space|size)\b)", nullptr, R"(\b(type|mode|select|algorithm)\b)",
+          BandRule::none, "reverb_size", "percent", "linear" },
+        { R"(\b(diffusion|density)\b)", nullptr, nullptr, BandRule::none, "reverb_diffusion", "percent", "linear" },
+        { R"(\b(reverb.?type|algorithm|character)\b)", nullptr, nullptr,
+          BandRule::none, "reverb_type", "stepped", "stepped" },
+
+        // Delay ("time" alone needs delay/echo context)
+        { R"(\b(delay.?time)\b)", nullptr, R"(\b(attack|release|decay|reverb|predelay)\b)",
+          BandRule::none, "delay_time", "ms", "logarithmic" },
+        { R"(\btime\b)", R"(\b(delay|echo)\b)", R"(\b(attack|release|decay|reverb|predelay)\b)",
+          BandRule::none, "delay_time", "ms", "logarithmic" },
+        { R"(\b(feedback|regen|regeneration)\b)", nullptr, nullptr,
+          BandRule::none, "delay_feedback", "percent", "linear" },
+        { R"(\b(spread|ping.?pong|offset)\b)", R"(\b(delay|echo|stereo)\b)", nullptr,
+          BandRule::none, "delay_spread", "percent", "linear" },
+        { R"(\b(sync|tempo|note)\b)", R"(\b(delay|echo)\b)", nullptr,
+          BandRule::none, "delay_sync", "stepped", "stepped" },
+        { R"(\b(mod|modulation)\b)", R"(\b(delay|echo)\b)", nullptr,
+          BandRule::none, "delay_modulation", "percent", "linear" },
+
+        // Saturation (before general input/drive)
+        { R"(\b(drive|saturation|distortion|overdrive|warmth|heat)\b)", nullptr, R"(\b(freq|type|mode|filter)\b)",
+          BandRule::none, "sat_drive", "db", "linear" },
+        { R"(\b(tone|color|colour|tilt|bright)\b)", nullptr, R"(\b(freq|band|eq|comp|reverb)\b)",
+          BandRule::none, "sat_tone", "percent", "linear" },
+        { R"(\b(sat.?type|mode|character|style)\b)", R"(\b(tube|tape|transistor|type|mode|character|style|diode)\b)",
+          nullptr, BandRule::none, "sat_type", "stepped", "stepped" },
+
+        // Limiter
+        { R"(\b(ceiling|output.?ceiling)\b)", nullptr, nullptr, BandRule::none, "limiter_ceiling", "db", "linear" },
+        { R"(\b(lookahead|look.?ahead)\b)", nullptr, nullptr,
+          BandRule::none, "limiter_lookahead", "ms", "logarithmic" },
+
+        // Gate / expander
+        { R"(\bhold\b)", nullptr, R"(\b(freq|peak)\b)", BandRule::none, "gate_hold", "ms", "logarithmic" },
+        { R"(\b(range|depth)\b)", R"(\b(gate|expander)\b)", R"(\b(freq|eq|band)\b)",
+          BandRule::none, "gate_range", "db", "linear" },
+
+        // General
+        { R"(\binput\b)", nullptr, R"(\b(freq|frequency|type|mode)\b)",
+          BandRule::none, "input_gain", "db", "linear" },
+        { R"(\b(output|volume|level)\b)", nullptr, R"(\b(freq|frequency|type|mode|meter)\b)",
+          BandRule::none, "output_gain", "db", "linear" },
+        { R"(\b(mix|dry.?wet)\b)", nullptr, nullptr, BandRule::none, "dry_wet_mix", "percent", "linear" },
+        { R"(\b(stereo.?width|width|mono|stereo)\b)", nullptr, R"(\b(band|eq|q|bandwidth|delay|reverb|freq)\b)",
+          BandRule::none, "stereo_width", "percent", "linear" },
+        { R"(\b(pan|balance)\b)", nullptr, R"(\b(freq|type|mode)\b)", BandRule::none, "pan", "percent", "linear" },
+        { R"(\b(phase|polarity|invert)\b)", nullptr, nullptr, BandRule::none, "phase_invert", "boolean", "stepped" },
+    };
 
-    // EQ Active/Slope (require band context)
-    if (matchesPattern(name, R"(\b(used|active|enable|enabled|on|off)\b)") && bandNumber > 0)
-    {
-        result.semantic = "eq_band_" + juce::String(bandNumber) + "_active";
-        result.unit = "boolean";
-        result.curve = "stepped";
-        result.bandNumber = bandNumber;
-        return result;
-    }
+    // Named bands, for names without a number
+    const std::pair<const char*, int> kBandNames[] = {
+        { R"(\b(low|lf|sub)\b)", 1 },
+        { R"(\b(low.?mid|lmf)\b)", 2 },
+        { R"(\b(mid|mf)\b)", 3 },
+        { R"(\b(high.?mid|hmf)\b)", 4 },
+        { R"(\b(high|hf|air)\b)", 5 },
+    };
 
-    if (matchesPattern(name, R"(\b(slope|order|db.?oct)\b)") && bandNumber > 0)
+    bool isWordByte(char c)
     {
-        result.semantic = "eq_band_" + juce::String(bandNumber) + "_slope";
-        result.unit = "stepped";
-        result.curve = "stepped";
-        result.bandNumber = bandNumber;
-        return result;
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
     }
 
-    // ==========================================
-    // Compressor Patterns
-    // ==========================================
-    if (matchesPattern(name, R"(\b(thresh|threshold)\b)"))
-    {
-        result.semantic = "comp_threshold";
-        result.unit = "db";
-        result.curve = "linear";
-        return result;
-    }
+    bool isDigitByte(char c) { return c >= '0' && c <= '9'; }
 
-    if (matchesPattern(name, R"(\bratio\b)"))
-    {
-        result.semantic = "comp_ratio";
-        result.unit = "ratio";
-        result.curve = "logarithmic";
-        return result;
-    }
+    // What \s means to std::regex in the classic locale
+    bool isSpaceByte(char c) { return c == ' ' || (c >= '\t' && c <= '\r'); }
 
-    if (matchesPattern(name, R"(\battack\b)"))
+    std::string toLowerAscii(const juce::String& name)
     {
-        result.semantic = "comp_attack";
-        result.unit = "ms";
-        result.curve = "logarithmic";
-        return result;
+        std::string s = name.toStdString();
+        for (auto& c : s)
+            if (c >= 'A' && c <= 'Z')
+                c = static_cast<char>(c - 'A' + 'a');
+        return s;
     }
 
-    if (matchesPattern(name, R"(\brelease\b)"))
+    /** Digits from pos; -1 if there are none or they don't fit an int (std::stoi would throw). */
+    int parseDigits(const std::string& s, size_t pos)
     {
-        result.semantic = "comp_release";
-        result.unit = "ms";
-        result.curve = "logarithmic";
-        return result;
-    }
+        if (pos >= s.size() || !isDigitByte(s[pos]))
+            return -1;
 
-    if (matchesPattern(name, R"(\bknee\b)"))
-    {
-        result.semantic = "comp_knee";
-        result.unit = "db";
-        result.curve = "linear";
-        return result;
+        long long value = 0;
+        for (; pos < s.size() && isDigitByte(s[pos]); ++pos)
+        {
+            value = value * 10 + (s[pos] - '0');
+            if (value > std::numeric_limits<int>::max())
+                return -1;
+        }
+        return static_cast<int>(value);
     }
 
-    if (matchesPattern(name, R"(\b(makeup|make.?up)\b)"))
+    class CompiledPatterns
     {
-        result.semantic = "comp_makeup";
-        result.unit = "db";
-        result.curve = "linear";
-        return result;
-    }
+    public:
+        struct CompiledRule
+        {
+            int require = -1, alsoRequire = -1, exclude = -1;
+            const Rule* rule = nullptr;
+        };
 
-    // Compressor mix (dry/wet, parallel, blend) — check before general mix
-    if (matchesPattern(name, R"(\b(mix|dry.?wet|blend|parallel)\b)") &&
-        matchesPattern(name, R"(\b(comp|dyn|limit)\b)"))
-    {
-        result.semantic = "comp_mix";
-        result.unit = "percent";
-        result.curve = "linear";
-        return result;
-    }
+        static const CompiledPatterns& get()
+        {
+            static const CompiledPatterns instance;   // Built once, thread-safe; read-only after
+            return instance;
+        }
 
-    // ==========================================
-    // Reverb Patterns
-    // ==========================================
-    if (matchesPattern(name, R"(\b(decay|reverb.?time|rt60|tail)\b)") &&
-        !matchesPattern(name, R"(\b(attack|comp|gate|ratio)\b)"))
-    {
-        result.semantic = "reverb_decay";
-        result.unit = "ms";
-        result.curve = "logarithmic";
-        return result;
-    }
+        /** Bit i set = pattern i matches somewhere in the (ASCII-lowercased) name. */
+        PatternSet match(const std::string& lowered) const
+        {
+            PatternSet found;
+            size_t previousEnd = std::string::npos;
+            std::string previous, token;
 
-    if (matchesPattern(name, R"(\b(pre.?delay|predelay)\b)"))
-    {
-        result.semantic = "reverb_predelay";
-        result.unit = "ms";
-        result.curve = "logarithmic";
-        return result;
-    }
+            for (size_t i = 0; i < lowered.size();)
+            {
+                if (!isWordByte(lowered[i]))
+                {
+                    ++i;
+                    continue;
+                }
+
+                const size_t start = i;
+                while (i < lowered.size() && isWordByte(lowered[i]))
+                    ++i;
+                token.assign(lowered, start, i - start);
+
+                if (auto it = words.find(token); it != words.end())
+                    found |= it->second;
+
+                // c?d inside one token
+                for (const auto& j : joined)
+                    if (token.size() == j.left.size() + j.right.size() + 1
+                        && token.compare(0, j.left.size(), j.left) == 0
+                        && token.compare(token.size() - j.right.size(), j.right.size(), j.right) == 0)
+                        found |= j.patterns;
+
+                // c and d one character apart ('.' doesn't match line breaks)
+                if (previousEnd != std::string::npos && start == previousEnd + 1
+                    && lowered[previousEnd] != '\n' && lowered[previousEnd] != '\r')
+                {
+                    if (auto it = pairs.find(previous + ' ' + token); it != pairs.end())
+                        found |= it->second;
+                }
+
+                previous.swap(token);
+                previousEnd = i;
+            }
+            return found;
+        }
 
-    if (matchesPattern(name, R"(\b(damp|damping|brightness)\b)") &&
-        !matchesPattern(name, R"(\b(freq|comp|gate)\b)"))
-    {
-        result.semantic = "reverb_damping";
-        result.unit = "percent";
-        result.curve = "linear";
-        return result;
-    }
+        int findBandNumber(const std::string& lowered, const PatternSet& found) const
+        {
+            // "Band 3", "band3", "B3" — (?:band|b)\s*(\d+), leftmost
+            for (size_t i = 0; i < lowered.size(); ++i)
+            {
+                if (lowered[i] != 'b')
+                    continue;
+
+                for (size_t pos : { lowered.compare(i + 1, 3, "and") == 0 ? i + 4 : std::string::npos, i + 1 })
+                {
+                    if (pos == std::string::npos)
+                        continue;
+                    while (pos < lowered.size() && isSpaceByte(lowered[pos]))
+                        ++pos;
+                    if (pos < lowered.size() && isDigitByte(lowered[pos]))
+                        return parseDigits(lowered, pos);
+                }
+            }
 
-    if (matchesPattern(name, R"(\b(room|hall|plate|space|size)\b)") &&
-        !matchesPattern(name, R"(\b(type|mode|select|algorithm)\b)"))
-    {
-        result.semantic = "reverb_size";
-        result.unit = "percent";
-        result.curve = "linear";
-        return result;
-    }
+            // Trailing number: "LF 1", "HF 2" — \s+(\d+)\s*$
+            size_t end = lowered.size();
+            while (end > 0 && isSpaceByte(lowered[end - 1]))
+                --end;
+            size_t start = end;
+            while (start > 0 && isDigitByte(lowered[start - 1]))
+                --start;
+            if (start < end && start > 0 && isSpaceByte(lowered[start - 1]))
+                return parseDigits(lowered, start);
+
+            for (const auto& [pattern, band] : bandNames)
+                if (found.test(static_cast<size_t>(pattern)))
+                    return band;
+
+            return -1;
+        }
 
-    if (matchesPattern(name, R"(\b(diffusion|density)\b)"))
-    {
-        result.semantic = "reverb_diffusion";
-        result.unit = "percent";
-        result.curve = "linear";
-        return result;
-    }
+        std::vector<CompiledRule> rules;
+        std::vector<std::pair<int, int>> bandNames;     // Pattern index, band
 
-    if (matchesPattern(name, R"(\b(reverb.?type|algorithm|character)\b)"))
-    {
-        result.semantic = "reverb_type";
-        result.unit = "stepped";
-        result.curve = "stepped";
-        return result;
-    }
+    private:
+        CompiledPatterns()
+        {
+            for (const auto& rule : kRules)
+            {
+                CompiledRule compiled;
+                compiled.rule = &rule;
+                compiled.require = add(rule.require);
+                compiled.alsoRequire = add(rule.alsoRequire);
+                compiled.exclude = add(rule.exclude);
+                rules.push_back(compiled);
+            }
 
-    // ==========================================
-    // Delay Patterns
-    // ==========================================
-    if (matchesPattern(name, R"(\b(delay.?time)\b)") &&
-        !matchesPattern(name, R"(\b(attack|release|decay|reverb|predelay)\b)"))
-    {
-        result.semantic = "delay_time";
-        result.unit = "ms";
-        result.curve = "logarithmic";
-        return result;
-    }
+            for (const auto& [pattern, band] : kBandNames)
+                bandNames.emplace_back(add(pattern), band);
+        }
 
-    // "time" alone requires delay/echo context
-    if (matchesPattern(name, R"(\btime\b)") &&
-        matchesPattern(name, R"(\b(delay|echo)\b)") &&
-        !matchesPattern(name, R"(\b(attack|release|decay|reverb|predelay)\b)"))
-    {
-        result.semantic = "delay_time";
-        result.unit = "ms";
-        result.curve = "logarithmic";
-        return result;
-    }
+        /** Parse one \b(...)\b pattern into the tables; returns its index (-1 for nullptr). */
+        int add(const char* pattern)
+        {
+            if (pattern == nullptr)
+                return -1;
 
-    if (matchesPattern(name, R"(\b(feedback|regen|regeneration)\b)"))
-    {
-        result.semantic = "delay_feedback";
-        result.unit = "percent";
-        result.curve = "linear";
-        return result;
-    }
+            if (auto it = indexes.find(pattern); it != indexes.end())
+                return it->second;
 
-    if (matchesPattern(name, R"(\b(spread|ping.?pong|offset)\b)") &&
-        matchesPattern(name, R"(\b(delay|echo|stereo)\b)"))
-    {
-        result.semantic = "delay_spread";
-        result.unit = "percent";
-        result.curve = "linear";
-        return result;
-    }
+            const int index = static_cast<int>(indexes.size());
+            jassert(index < static_cast<int>(kMaxPatterns));
+            indexes.emplace(pattern, index);
 
-    if (matchesPattern(name, R"(\b(sync|tempo|note)\b)") &&
-        matchesPattern(name, R"(\b(delay|echo)\b)"))
-    {
-        result.semantic = "delay_sync";
-        result.unit = "stepped";
-        result.curve = "stepped";
-        return result;
-    }
+            std::string body(pattern);
+            jassert(body.size() > 4 && body.compare(0, 2, "\\b") == 0 && body.compare(body.size() - 2, 2, "\\b") == 0);
+            body = body.substr(2, body.size() - 4);
+            if (body.front() == '(' && body.back() == ')')
+                body = body.substr(1, body.size() - 2);
 
-    if (matchesPattern(name, R"(\b(mod|modulation)\b)") &&
-        matchesPattern(name, R"(\b(delay|echo)\b)"))
-    {
-        result.semantic = "delay_modulation";
-        result.unit = "percent";
-        result.curve = "linear";
-        return result;
-    }
-
-    // ==========================================
-    // Saturation Patterns (before general input/drive)
-    // ==========================================
-    if (matchesPattern(name, R"(\b(drive|saturation|distortion|overdrive|warmth|heat)\b)") &&
-        !matchesPattern(name, R"(\b(freq|type|mode|filter)\b)"))
-    {
-        result.semantic = "sat_drive";
-        result.unit = "db";
-        result.curve = "linear";
-        return result;
-    }
+            size_t from = 0;
+            while (from <= body.size())
+            {
+                auto to = body.find('|', from);
+                if (to == std::string::npos)
+                    to = body.size();
+                const auto alternative = body.substr(from, to - from);
+                from = to + 1;
+
+                const auto wildcard = alternative.find(".?");
+                if (wildcard == std::string::npos)
+                {
+                    jassert(std::all_of(alternative.begin(), alternative.end(), isWordByte));
+                    words[alternative].set(static_cast<size_t>(index));
+                    continue;
+                }
+
+                const auto left = alternative.substr(0, wildcard);
+                const auto right = alternative.substr(wildcard + 2);
+                jassert(!left.empty() && !right.empty() && right.find(".?") == std::string::npos);
+
+                words[left + right].set(static_cast<size_t>(index));
+                pairs[left + ' ' + right].set(static_cast<size_t>(index));
+
+                auto j = std::find_if(joined.begin(), joined.end(),
+                                      [&](const Joined& x) { return x.left == left && x.right == right; });
+                if (j == joined.end())
+                    j = joined.insert(joined.end(), Joined { left, right, {} });
+                j->patterns.set(static_cast<size_t>(index));
+            }
 
-    if (matchesPattern(name, R"(\b(tone|color|colour|tilt|bright)\b)") &&
-        !matchesPattern(name, R"(\b(freq|band|eq|comp|reverb)\b)"))
-    {
-        result.semantic = "sat_tone";
-        result.unit = "percent";
-        result.curve = "linear";
-        return result;
-    }
+            return index;
+        }
 
-    if (matchesPattern(name, R"(\b(sat.?type|mode|character|style)\b)") &&
-        matchesPattern(name, R"(\b(tube|tape|transistor|type|mode|character|style|diode)\b)"))
-    {
-        result.semantic = "sat_type";
-        result.unit = "stepped";
-        result.curve = "stepped";
-        return result;
-    }
+        struct Joined
+        {
+            std::string left, right;
+            PatternSet patterns;
+        };
+
+        std::map<std::string, int> indexes;
+        std::unordered_map<std::string, PatternSet> words;    // Whole token
+        std::unordered_map<std::string, PatternSet> pairs;    // "c d": adjacent tokens, one character apart
+        std::vector<Joined> joined;                           // c, one word character, d
+    };
+}
 
-    // ==========================================
-    // Limiter Patterns
-    // ==========================================
-    if (matchesPattern(name, R"(\b(ceiling|output.?ceiling)\b)"))
-    {
-        result.semantic = "limiter_ceiling";
-        result.unit = "db";
-        result.curve = "linear";
-        return result;
-    }
+// ============================================
+// Extract band number from parameter name
+// ============================================
+int ParameterDiscovery::extractBandNumber(const juce::String& name)
+{
+    const auto& patterns = CompiledPatterns::get();
+    const auto lowered = toLowerAscii(name);
+    return patterns.findBandNumber(lowered, patterns.match(lowered));
+}
 
-    if (matchesPattern(name, R"(\b(lookahead|look.?ahead)\b)"))
-    {
-        result.semantic = "limiter_lookahead";
-        result.unit = "ms";
-        result.curve = "logarithmic";
-        return result;
-    }
+// ============================================
+// Semantic parameter name matcher
+// ============================================
+ParameterDiscovery::SemanticMatch ParameterDiscovery::matchParameterName(const juce::String& name)
+{
+    SemanticMatch result;
 
-    // ==========================================
-    // Gate / Expander Patterns
-    // ==========================================
-    if (matchesPattern(name, R"(\bhold\b)") &&
-        !matchesPattern(name, R"(\b(freq|peak)\b)"))
-    {
-        result.semantic = "gate_hold";
-        result.unit = "ms";
-        result.curve = "logarithmic";
-        return result;
-    }
+    const auto& patterns = CompiledPatterns::get();
+    const auto lowered = toLowerAscii(name);
+    const auto found = patterns.match(lowered);
+    const int bandNumber = patterns.findBandNumber(lowered, found);
 
-    if (matchesPattern(name, R"(\b(range|depth)\b)") &&
-        matchesPattern(name, R"(\b(gate|expander)\b)") &&
-        !matchesPattern(name, R"(\b(freq|eq|band)\b)"))
+    for (const auto& compiled : patterns.rules)
     {
-        result.semantic = "gate_range";
-        result.unit = "db";
-        result.curve = "linear";
-        return result;
-    }
+        if (!found.test(static_cast<size_t>(compiled.require))
+            || (compiled.alsoRequire >= 0 && !found.test(static_cast<size_t>(compiled.alsoRequire)))
+            || (compiled.exclude >= 0 && found.test(static_cast<size_t>(compiled.exclude))))
+            continue;
 
-    // ==========================================
-    // General Patterns
-    // ==========================================
-    if (matchesPattern(name, R"(\binput\b)") &&
-        !matchesPattern(name, R"(\b(freq|frequency|type|mode)\b)"))
-    {
-        result.semantic = "input_gain";
-        result.unit = "db";
-        result.curve = "linear";
-        return result;
-    }
+        const auto& rule = *compiled.rule;
 
-    if (matchesPattern(name, R"(\b(output|volume|level)\b)") &&
-        !matchesPattern(name, R"(\b(freq|frequency|type|mode|meter)\b)"))
-    {
-        result.semantic = "output_gain";
-        result.unit = "db";
-        result.curve = "linear";
-        return result;
-    }
+        // EQ active/slope need band context
+        if (rule.band == BandRule::required && bandNumber <= 0)
+            continue;
 
-    if (matchesPattern(name, R"(\b(mix|dry.?wet)\b)"))
-    {
-        result.semantic = "dry_wet_mix";
-        result.unit = "percent";
-        result.curve = "linear";
-        return result;
-    }
+        if (rule.semantic == nullptr)
+            return result; // Empty semantic = skip
 
-    if (matchesPattern(name, R"(\b(stereo.?width|width|mono|stereo)\b)") &&
-        !matchesPattern(name, R"(\b(band|eq|q|bandwidth|delay|reverb|freq)\b)"))
-    {
-        result.semantic = "stereo_width";
-        result.unit = "percent";
-        result.curve = "linear";
-        return result;
-    }
+        result.unit = rule.unit;
+        result.curve = rule.curve;
 
-    if (matchesPattern(name, R"(\b(pan|balance)\b)") &&
-        !matchesPattern(name, R"(\b(freq|type|mode)\b)"))
-    {
-        result.semantic = "pan";
-        result.unit = "percent";
-        result.curve = "linear";
-        return result;
-    }
+        if (rule.band == BandRule::none)
+        {
+            result.semantic = rule.semantic;
+            return result;
+        }
 
-    if (matchesPattern(name, R"(\b(phase|polarity|invert)\b)"))
-    {
-        result.semantic = "phase_invert";
-        result.unit = "boolean";
-        result.curve = "stepped";
+        result.bandNumber = bandNumber > 0 ? bandNumber : 1;
+        result.semantic = "eq_band_" + juce::String(result.bandNumber) + "_" + rule.semantic;
         return result;
     }
 
@@ -928,3 +887,70 @@ juce::var ParameterDiscovery::toJson(const DiscoveredMap& map)
 
     return juce::var(root);
 }
+
+// ============================================
+// JSON deserialization (inverse of toJson)
+// ============================================
+ParameterDiscovery::DiscoveredMap ParameterDiscovery::fromJson(const juce::var& json)
+{
+    DiscoveredMap map;
+    if (!json.isObject())
+        return map;
+
+    map.pluginName = json.getProperty("pluginName", {}).toString();
+    map.manufacturer = json.getProperty("manufacturer", {}).toString();
+    map.category = json.getProperty("category", {}).toString();
+    map.confidence = json.getProperty("confidence", 0);
+    map.matchedCount = json.getProperty("matchedCount", 0);
+    map.totalCount = json.getProperty("totalCount", 0);
+    map.eqBandCount = json.getProperty("eqBandCount", 0);
+    map.compHasParallelMix = json.getProperty("compHasParallelMix", false);
+    map.reverbHasPredelay = json.getProperty("reverbHasPredelay", false);
+    map.reverbHasDiffusion = json.getProperty("reverbHasDiffusion", false);
+    map.delayHasSync = json.getProperty("delayHasSync", false);
+    map.delayHasModulation = json.getProperty("delayHasModulation", false);
+    map.satHasTypeSelector = json.getProperty("satHasTypeSelector", false);
+    map.limiterHasLookahead = json.getProperty("limiterHasLookahead", false);
+    map.gateHasHold = json.getProperty("gateHasHold", false);
+
+    if (auto* paramArray = json.getProperty("parameters", {}).getArray())
+    {
+        for (const auto& paramVar : *paramArray)
+        {
+            DiscoveredParameter p;
+            p.juceParamId = paramVar.getProperty("juceParamId", {}).toString();
+            p.juceParamIndex = paramVar.getProperty("juceParamIndex", -1);
+            p.semantic = paramVar.getProperty("semantic", {}).toString();
+            p.physicalUnit = paramVar.getProperty("physicalUnit", {}).toString();
+            p.mappingCurve = paramVar.getProperty("mappingCurve", {}).toString();
+            p.minValue = paramVar.getProperty("minValue", 0.0f);
+            p.maxValue = paramVar.getProperty("maxValue", 1.0f);
+            p.defaultValue = paramVar.getProperty("defaultValue", 0.0f);
+            p.numSteps = paramVar.getProperty("numSteps", 0);
+            p.label = paramVar.getProperty("label", {}).toString();
+            p.matched = paramVar.getProperty("matched", false);
+
+            // NormalisableRange fields
+            p.hasNormalisableRange = paramVar.getProperty("hasNormalisableRange", false);
+            if (p.hasNormalisableRange)
+            {
+                p.rangeStart = paramVar.getProperty("rangeStart", 0.0f);
+                p.rangeEnd = paramVar.getProperty("rangeEnd", 1.0f);
+                p.skewFactor = paramVar.getProperty("skewFactor", 1.0f);
+                p.symmetricSkew = paramVar.getProperty("symmetricSkew", false);
+                p.interval = paramVar.getProperty("interval", 0.0f);
+
+                if (auto* samplesArray = paramVar.getProperty("curveSamples", {}).getArray())
+                    for (const auto& sample : *samplesArray)
+                        p.curveSamples.add({ static_cast<float>(sample.getProperty("normalized", 0.0f)),
+                                             static_cast<float>(sample.getProperty("physical", 0.0f)) });
+
+                p.qRepresentation = paramVar.getProperty("qRepresentation", {}).toString();
+            }
+
+            map.parameters.add(p);
+        }
+    }
+
+    return map;
+}
@@ -2,8 +2,6 @@
 
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_core/juce_core.h>
-#include <regex>
-#include <unordered_map>
 
 /**
  * ParameterDiscovery — Auto-discovers and semantically classifies plugin parameters.
@@ -82,7 +80,12 @@ public:
      */
     static juce::var toJson(const DiscoveredMap& map);
 
-private:
+    /**
+     * Read back a map written by toJson() (ParameterDiscoveryCache stores them on disk).
+     * Missing fields keep their defaults.
+     */
+    static DiscoveredMap fromJson(const juce::var& json);
+
     // ============================================
     // Semantic matching
     // ============================================
@@ -95,12 +98,17 @@ private:
         int bandNumber = -1; // For EQ band parameters
     };
 
-    /** Pattern-match a parameter name against known semantic patterns. */
+    /**
+     * Pattern-match a parameter name against known semantic patterns.
+     * The patterns are compiled into one keyword table on first use; safe from any thread.
+     */
     static SemanticMatch matchParameterName(const juce::String& name);
 
     /** Extract a band number from a parameter name (e.g., "Band 3 Freq" → 3). */
     static int extractBandNumber(const juce::String& name);
 
+private:
+
     /** Infer the mapping curve from parameter range and JUCE metadata. */
     static juce::String inferMappingCurve(float minVal, float maxVal, int numSteps,
                                            const juce::String& label, const juce::String& textAtMin,
@@ -116,9 +124,6 @@ private:
     /** Calculate confidence score based on match quality. */
     static int calculateConfidence(const DiscoveredMap& map);
 
-    /** Check if a string matches a regex pattern (case-insensitive). */
-    static bool matchesPattern(const juce::String& input, const std::string& pattern);
-
     /** Extract physical range from JUCE parameter (getText at 0.0 and 1.0). */
     static void extractPhysicalRange(juce::AudioProcessorParameter* param,
                                       float& outMin, float& outMax,
@@ -0,0 +1,192 @@
+#include "ParameterDiscoveryCache.h"
+#include "../utils/PlatformPaths.h"
+#include <iostream>
+
+ParameterDiscoveryCache::ParameterDiscoveryCache()
+    : ParameterDiscoveryCache(PlatformPaths::getPluginCacheDirectory().getChildFile("ParameterMaps"))
+{
+}
+
+ParameterDiscoveryCache::ParameterDiscoveryCache(const juce::File& rootDirectory)
+    : rootDir(rootDirectory)
+{
+    rootDir.createDirectory();
+}
+
+juce::String ParameterDiscoveryCache::makeKey(const juce::PluginDescription& desc, int numParameters)
+{
+    return desc.createIdentifierString() + "|" + desc.version + "|" + juce::String(numParameters);
+}
+
+juce::String ParameterDiscoveryCache::computeValidationHash(juce::AudioProcessor& processor)
+{
+    // FNV-1a over what discovery reads cheaply; getText() is what we're trying to avoid
+    juce::uint64 hash = 14695981039346656037ULL;
+    auto mix = [&hash](const void* data, size_t size) {
+        for (size_t i = 0; i < size; ++i)
+        {
+            hash ^= static_cast<const juce::uint8*>(data)[i];
+            hash *= 1099511628211ULL;
+        }
+    };
+
+    for (auto* param : processor.getParameters())
+    {
+        const auto name = param->getName(256);
+        const auto label = param->getLabel();
+        const int numSteps = param->getNumSteps();
+        mix(name.toRawUTF8(), name.getNumBytesAsUTF8() + 1);
+        mix(label.toRawUTF8(), label.getNumBytesAsUTF8() + 1);
+        mix(&numSteps, sizeof(numSteps));
+    }
+
+    return juce::String::toHexString(static_cast<juce::int64>(hash));
+}
+
+juce::File ParameterDiscoveryCache::fileFor(const juce::String& key) const
+{
+    return rootDir.getChildFile(juce::String::toHexString(key.hashCode64()) + ".json");
+}
+
+std::shared_ptr<const ParameterDiscoveryCache::Map> ParameterDiscoveryCache::getOrDiscover(
+    juce::AudioProcessor& processor, const juce::PluginDescription& desc)
+{
+    if (desc.fileOrIdentifier.isNotEmpty())
+        if (auto cached = find(processor, desc))
+            return cached;
+
+    auto discovered = std::make_shared<const Map>(
+        ParameterDiscovery::discoverParameterMap(&processor, desc.name, desc.manufacturerName));
+    if (desc.fileOrIdentifier.isNotEmpty())
+        storeShared(processor, desc, discovered);
+
+    return discovered;
+}
+
+std::shared_ptr<const ParameterDiscoveryCache::Map> ParameterDiscoveryCache::find(
+    juce::AudioProcessor& processor, const juce::PluginDescription& desc)
+{
+    const auto key = makeKey(desc, processor.getParameters().size());
+    const auto validationHash = computeValidationHash(processor);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(key);
+        if (it != entries.end() && it->second.validationHash == validationHash)
+        {
+            ++stats.hits;
+            return it->second.map;
+        }
+    }
+
+    // Not in memory (or stale there): another process may have written it since
+    Entry loaded;
+    const bool onDisk = loadFromDisk(key, loaded);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (onDisk && loaded.validationHash == validationHash)
+    {
+        ++stats.hits;
+        entries[key] = loaded;
+        return loaded.map;
+    }
+
+    if (onDisk || entries.count(key) > 0)
+        ++stats.invalidated;
+    ++stats.misses;
+    return nullptr;
+}
+
+std::shared_ptr<const ParameterNameIndex> ParameterDiscoveryCache::getNameIndex(
+    juce::AudioProcessor& processor, const juce::PluginDescription& desc)
+{
+    auto map = getOrDiscover(processor, desc);
+    if (desc.fileOrIdentifier.isEmpty())
+        return std::make_shared<const ParameterNameIndex>(*map);
+
+    const auto key = makeKey(desc, processor.getParameters().size());
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(key);
+        if (it != entries.end() && it->second.map == map && it->second.index != nullptr)
+            return it->second.index;
+    }
+
+    // Built outside the lock; if two threads race, both indexes are equivalent
+    auto index = std::make_shared<const ParameterNameIndex>(*map);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entries.find(key);
+    if (it != entries.end() && it->second.map == map)
+        it->second.index = index;
+    return index;
+}
+
+void ParameterDiscoveryCache::store(juce::AudioProcessor& processor, const juce::PluginDescription& desc,
+                                    const Map& map)
+{
+    storeShared(processor, desc, std::make_shared<const Map>(map));
+}
+
+void ParameterDiscoveryCache::storeShared(juce::AudioProcessor& processor, const juce::PluginDescription& desc,
+                                          std::shared_ptr<const Map> map)
+{
+    const auto key = makeKey(desc, processor.getParameters().size());
+
+    Entry entry;
+    entry.validationHash = computeValidationHash(processor);
+    entry.map = std::move(map);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        entries[key] = entry;
+    }
+
+    auto* root = new juce::DynamicObject();
+    root->setProperty("formatVersion", kFormatVersion);
+    root->setProperty("key", key);
+    root->setProperty("validationHash", entry.validationHash);
+    root->setProperty("map", ParameterDiscovery::toJson(*entry.map));
+
+    // Through a uniquely named temporary: the scanner helper may be writing the same file
+    auto file = fileFor(key);
+    juce::TemporaryFile temp(file);
+    if (!temp.getFile().replaceWithText(juce::JSON::toString(juce::var(root), true))
+        || !temp.overwriteTargetFileWithTemporary())
+    {
+        #if JUCE_DEBUG
+        std::cerr << "ParameterDiscoveryCache: failed to write " << file.getFullPathName() << std::endl;
+        #endif
+    }
+}
+
+bool ParameterDiscoveryCache::loadFromDisk(const juce::String& key, Entry& out) const
+{
+    const auto file = fileFor(key);
+    if (!file.existsAsFile())
+        return false;
+
+    auto parsed = juce::JSON::parse(file.loadFileAsString());
+    if (!parsed.isObject()
+        || static_cast<int>(parsed.getProperty("formatVersion", 0)) != kFormatVersion
+        || parsed.getProperty("key", {}).toString() != key)   // Key hash collision
+        return false;
+
+    out.validationHash = parsed.getProperty("validationHash", {}).toString();
+    out.map = std::make_shared<const Map>(ParameterDiscovery::fromJson(parsed.getProperty("map", {})));
+    return out.validationHash.isNotEmpty();
+}
+
+void ParameterDiscoveryCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    for (const auto& file : rootDir.findChildFiles(juce::File::findFiles, false, "*.json"))
+        file.deleteFile();
+}
+
+ParameterDiscoveryCache::Stats ParameterDiscoveryCache::getStats() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include "ParameterDiscovery.h"
+#include "ParameterNameIndex.h"
+#include <map>
+#include <memory>
+#include <mutex>
+
+/**
+ * ParameterDiscoveryCache — Discovered parameter maps, kept across sessions.
+ *
+ * discoverParameterMap() probes getText() up to seven times per parameter and classifies
+ * every name; on a 400-parameter EQ that's a visible pause, and seeded imports used to
+ * pay it for every leaf. This keeps one map per plugin type:
+ *
+ *  - Keyed by PluginDescription::createIdentifierString(), version and parameter count.
+ *  - Validated against a hash of the live instance's parameter names, labels and step
+ *    counts (no getText() probing), so an update that renames or reorders parameters
+ *    without bumping its version is discovered again.
+ *  - In memory for the process, and on disk as <root>/<key hash>.json. Files are written
+ *    through a temporary, so the scanner helper can fill the cache in bulk from its own
+ *    process while benchmarking.
+ *  - The ParameterNameIndex for a map is built on first use and kept in memory with it.
+ *
+ * One cache per process — share it via juce::SharedResourcePointer, like BlobStore.
+ * All methods are thread-safe.
+ */
+class ParameterDiscoveryCache
+{
+public:
+    using Map = ParameterDiscovery::DiscoveredMap;
+
+    ParameterDiscoveryCache();
+    explicit ParameterDiscoveryCache(const juce::File& rootDirectory);
+    ~ParameterDiscoveryCache() = default;
+
+    /** The cached map for this instance if it's still valid, otherwise discover and store it.
+        Plugins without an identifier are discovered every time. */
+    std::shared_ptr<const Map> getOrDiscover(juce::AudioProcessor& processor, const juce::PluginDescription& desc);
+
+    /** Cached map (memory, then disk) if one matches this instance; nullptr otherwise. */
+    std::shared_ptr<const Map> find(juce::AudioProcessor& processor, const juce::PluginDescription& desc);
+
+    void store(juce::AudioProcessor& processor, const juce::PluginDescription& desc, const Map& map);
+
+    /** Name index over getOrDiscover()'s map, built once per cached map. */
+    std::shared_ptr<const ParameterNameIndex> getNameIndex(juce::AudioProcessor& processor,
+                                                           const juce::PluginDescription& desc);
+
+    /** Drop every map, in memory and on disk. */
+    void clear();
+
+    static juce::String makeKey(const juce::PluginDescription& desc, int numParameters);
+
+    /** Names, labels and step counts of every parameter, hashed (hex). */
+    static juce::String computeValidationHash(juce::AudioProcessor& processor);
+
+    struct Stats
+    {
+        juce::int64 hits = 0;
+        juce::int64 misses = 0;
+        juce::int64 invalidated = 0;    // Found, but the instance's parameters no longer match
+    };
+    Stats getStats() const;
+
+    juce::File getRootDirectory() const { return rootDir; }
+
+    static constexpr int kFormatVersion = 1;
+
+private:
+    struct Entry
+    {
+        juce::String validationHash;
+        std::shared_ptr<const Map> map;
+        std::shared_ptr<const ParameterNameIndex> index;    // Lazily, over map
+    };
+
+    /** Same as store(), keeping this exact map object (getNameIndex() keys on it). */
+    void storeShared(juce::AudioProcessor& processor, const juce::PluginDescription& desc,
+                     std::shared_ptr<const Map> map);
+    juce::File fileFor(const juce::String& key) const;
+    bool loadFromDisk(const juce::String& key, Entry& out) const;
+
+    juce::File rootDir;
+
+    mutable std::mutex mutex;
+    std::map<juce::String, Entry> entries;
+    Stats stats;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ParameterDiscoveryCache)
+};
@@ -0,0 +1,392 @@
+#include "ParameterMirror.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if JUCE_MSVC
+ #include <intrin.h>
+#endif
+
+static int lowestSetBit(uint64_t bits) noexcept
+{
+    jassert(bits != 0);
+   #if JUCE_MSVC
+    unsigned long index = 0;
+    _BitScanForward64(&index, bits);
+    return static_cast<int>(index);
+   #else
+    return __builtin_ctzll(bits);
+   #endif
+}
+
+// One per plugin: translates the plugin-local parameter index into the mirror index
+class ParameterMirror::PluginListener : public juce::AudioProcessorParameter::Listener
+{
+public:
+    PluginListener(ParameterMirror& m, juce::AudioProcessor& p, uint32_t firstIndex)
+        : mirror(m), processor(p), offset(firstIndex)
+    {
+        for (auto* param : processor.getParameters())
+            param->addListener(this);
+    }
+
+    ~PluginListener() override
+    {
+        for (auto* param : processor.getParameters())
+            param->removeListener(this);
+    }
+
+    void parameterValueChanged(int parameterIndex, float) override
+    {
+        mirror.markTouched(offset + static_cast<uint32_t>(parameterIndex));
+    }
+
+    void parameterGestureChanged(int, bool gestureIsStarting) override
+    {
+        mirror.gestureChanged(gestureIsStarting);
+    }
+
+private:
+    ParameterMirror& mirror;
+    juce::AudioProcessor& processor;
+    uint32_t offset;
+};
+
+ParameterMirror::ParameterMirror()
+{
+    startTimerHz(kTickHz);
+}
+
+ParameterMirror::~ParameterMirror()
+{
+    stopTimer();
+    clear();
+}
+
+void ParameterMirror::clear()
+{
+    pluginListeners.clear();   // Removes listeners while keepAlive still holds the plugins
+
+    std::unique_ptr<RealtimeView> oldView;
+    {
+        const juce::SpinLock::ScopedLockType lock(realtimeLock);
+        oldView = std::move(realtime);
+    }
+    oldView.reset();
+    keepAlive.clear();
+    ranges.clear();
+    params.clear();
+    values.clear();
+    scratch.clear();
+    dirty.clear();
+    changed.clear();
+    touched.reset();
+    numTouchedWords = 0;
+    anyTouched.store(false, std::memory_order_relaxed);
+    activeGestureCount.store(0, std::memory_order_relaxed);
+    sweepCursor = 0;
+    layoutHash = 0;
+}
+
+void ParameterMirror::rebuild(std::vector<PluginEntry> plugins)
+{
+    jassert(juce::MessageManager::getInstance()->isThisTheMessageThread());
+
+    clear();
+
+    for (int slot = 0; slot < static_cast<int>(plugins.size()); ++slot)
+    {
+        const auto& entry = plugins[static_cast<size_t>(slot)];
+        if (entry.processor == nullptr)
+            continue;
+
+        const auto& pluginParams = entry.processor->getParameters();
+        ranges.push_back({ entry.nodeId, slot, static_cast<uint32_t>(params.size()),
+                           static_cast<uint32_t>(pluginParams.size()) });
+        for (auto* param : pluginParams)
+            params.push_back(param);
+    }
+
+    const auto n = params.size();
+    values.resize(n);
+    for (size_t i = 0; i < n; ++i)
+        values[i] = params[i]->getValue();
+
+    scratch.resize(static_cast<size_t>(kSweepPerTick));
+    numTouchedWords = (n + 63) / 64;
+    dirty.assign(numTouchedWords, 0);
+    changed.reserve(n);
+    touched = std::make_unique<std::atomic<uint64_t>[]>(numTouchedWords);
+    for (size_t w = 0; w < numTouchedWords; ++w)
+        touched[w].store(0, std::memory_order_relaxed);
+
+    // Layout hash: plugin names and parameter counts in order (FNV-1a)
+    uint32_t hash = 2166136261u;
+    auto mix = [&hash](uint32_t v) { hash = (hash ^ v) * 16777619u; };
+    for (const auto& r : ranges)
+    {
+        mix(static_cast<uint32_t>(plugins[static_cast<size_t>(r.slotIndex)].processor->getName().hashCode()));
+        mix(r.count);
+    }
+    layoutHash = hash;
+
+    auto view = std::make_unique<RealtimeView>();
+    view->layoutHash = layoutHash;
+    view->params = params;
+    view->numWords = numTouchedWords;
+    view->pending = std::make_unique<std::atomic<uint64_t>[]>(numTouchedWords);
+    for (size_t w = 0; w < numTouchedWords; ++w)
+        view->pending[w].store(0, std::memory_order_relaxed);
+    view->received.assign(n, std::numeric_limits<float>::quiet_NaN());
+    {
+        const juce::SpinLock::ScopedLockType lock(realtimeLock);
+        realtime = std::move(view);
+    }
+
+    // Listeners last — the touched bitmaps must exist before the first callback
+    for (size_t r = 0; r < ranges.size(); ++r)
+    {
+        auto& entry = plugins[static_cast<size_t>(ranges[r].slotIndex)];
+        pluginListeners.push_back(std::make_unique<PluginListener>(*this, *entry.processor, ranges[r].offset));
+        keepAlive.push_back(std::move(entry.keepAlive));
+    }
+
+    listeners.call([this](Listener& l) { l.parameterMirrorRebuilt(*this); });
+}
+
+void ParameterMirror::markTouched(uint32_t index) noexcept
+{
+    const auto word = static_cast<size_t>(index >> 6);
+    if (word >= numTouchedWords)
+        return;
+
+    const auto bit = uint64_t { 1 } << (index & 63u);
+    touched[word].fetch_or(bit, std::memory_order_relaxed);
+    anyTouched.store(true, std::memory_order_release);
+
+    // Listeners are only attached while the view exists (see rebuild/clear)
+    if (auto* view = realtime.get())
+        view->pending[word].fetch_or(bit, std::memory_order_relaxed);
+}
+
+void ParameterMirror::gestureChanged(bool starting) noexcept
+{
+    if (starting)
+        activeGestureCount.fetch_add(1, std::memory_order_relaxed);
+    else
+        activeGestureCount.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void ParameterMirror::refresh()
+{
+    jassert(juce::MessageManager::getInstance()->isThisTheMessageThread());
+
+    lastReadCount = 0;
+    const auto n = static_cast<uint32_t>(params.size());
+    if (n == 0)
+        return;
+
+    std::fill(dirty.begin(), dirty.end(), uint64_t { 0 });
+    bool anyDirty = false;
+
+    // 1. Touched parameters: only these are re-read
+    if (anyTouched.exchange(false, std::memory_order_acquire))
+    {
+        for (size_t w = 0; w < numTouchedWords; ++w)
+        {
+            auto bits = touched[w].exchange(0, std::memory_order_relaxed);
+            while (bits != 0)
+            {
+                const int lowest = lowestSetBit(bits);
+                bits &= bits - 1;
+
+                const auto i = static_cast<uint32_t>(w * 64 + static_cast<size_t>(lowest));
+                if (i >= n)
+                    continue;
+
+                ++lastReadCount;
+                const float v = params[i]->getValue();
+                if (std::abs(v - values[i]) > kChangeEpsilon)
+                {
+                    values[i] = v;
+                    dirty[w] |= uint64_t { 1 } << lowest;
+                    anyDirty = true;
+                }
+            }
+        }
+    }
+
+    // 2. Round-robin sweep for values changed without a listener callback. The window wraps
+    //    at most once, so it is swept as two contiguous runs: each is read into scratch and
+    //    compared against the same run of the mirror with plain indexing, no modulo.
+    const auto sweepCount = std::min<uint32_t>(static_cast<uint32_t>(kSweepPerTick), n);
+    const auto headCount = std::min(sweepCount, n - sweepCursor);
+    const uint32_t runs[2][2] = { { sweepCursor, headCount }, { 0, sweepCount - headCount } };
+    lastReadCount += static_cast<int>(sweepCount);
+
+    for (const auto& run : runs)
+    {
+        const auto begin = run[0];
+        const auto count = run[1];
+        const float* mirrored = values.data() + begin;
+
+        for (uint32_t k = 0; k < count; ++k)
+            scratch[k] = params[begin + k]->getValue();
+
+        uint8_t moved[kSweepPerTick];
+        for (uint32_t k = 0; k < count; ++k)
+            moved[k] = std::abs(scratch[k] - mirrored[k]) > kChangeEpsilon ? 1 : 0;
+
+        for (uint32_t k = 0; k < count; ++k)
+        {
+            if (moved[k] == 0)
+                continue;
+
+            const auto i = begin + k;
+            values[i] = scratch[k];
+            dirty[i >> 6] |= uint64_t { 1 } << (i & 63u);
+            anyDirty = true;
+        }
+    }
+    sweepCursor = (sweepCursor + sweepCount) % n;
+
+    if (!anyDirty)
+        return;
+
+    changed.clear();
+    for (size_t w = 0; w < dirty.size(); ++w)
+        for (auto bits = dirty[w]; bits != 0; bits &= bits - 1)
+            changed.push_back(static_cast<uint32_t>(w * 64 + static_cast<size_t>(lowestSetBit(bits))));
+
+    listeners.call([this](Listener& l) { l.parameterMirrorChanged(*this, changed); });
+}
+
+ParameterMirror::Location ParameterMirror::getLocation(uint32_t index) const
+{
+    auto it = std::upper_bound(ranges.begin(), ranges.end(), index,
+                               [](uint32_t i, const Range& r) { return i < r.offset; });
+    if (it == ranges.begin())
+        return {};
+
+    --it;
+    if (index >= it->offset + it->count)
+        return {};
+
+    return { it->nodeId, it->slotIndex, static_cast<int>(index - it->offset) };
+}
+
+int ParameterMirror::findIndex(ChainNodeId nodeId, int paramIndex) const
+{
+    for (const auto& r : ranges)
+        if (r.nodeId == nodeId)
+            return juce::isPositiveAndBelow(paramIndex, static_cast<int>(r.count))
+                ? static_cast<int>(r.offset) + paramIndex : -1;
+    return -1;
+}
+
+int ParameterMirror::collectRealtimeChanges(MirrorParameterChannel::Entry* dest, int maxEntries) noexcept
+{
+    const juce::SpinLock::ScopedTryLockType lock(realtimeLock);
+    if (!lock.isLocked() || realtime == nullptr)
+        return 0;
+
+    auto& view = *realtime;
+    const auto n = view.params.size();
+    int count = 0;
+
+    for (size_t w = 0; w < view.numWords; ++w)
+    {
+        if (view.pending[w].load(std::memory_order_relaxed) == 0)
+            continue;
+
+        auto bits = view.pending[w].exchange(0, std::memory_order_relaxed);
+        while (bits != 0)
+        {
+            if (count == maxEntries)
+            {
+                view.pending[w].fetch_or(bits, std::memory_order_relaxed);   // Next block
+                return count;
+            }
+
+            const auto i = w * 64 + static_cast<size_t>(lowestSetBit(bits));
+            bits &= bits - 1;
+            if (i >= n)
+                continue;
+
+            const float v = view.params[i]->getValue();
+            const float received = view.received[i];
+            view.received[i] = std::numeric_limits<float>::quiet_NaN();
+
+            // The notification caused by applying a partner's value — don't send it back
+            if (std::abs(v - received) <= kChangeEpsilon)
+                continue;
+
+            dest[count++] = { view.layoutHash, static_cast<uint32_t>(i), v };
+        }
+    }
+
+    return count;
+}
+
+int ParameterMirror::applyRealtimeChanges(MirrorParameterChannel& channel) noexcept
+{
+    const juce::SpinLock::ScopedTryLockType lock(realtimeLock);
+    if (!lock.isLocked() || realtime == nullptr)
+        return 0;
+
+    auto& view = *realtime;
+    int applied = 0;
+
+    channel.drain([&view, &applied](const MirrorParameterChannel::Entry& e)
+    {
+        if (e.layoutHash != view.layoutHash || e.index >= view.params.size())
+            return;   // Partner's chain differs (structural update still in flight)
+
+        auto* param = view.params[e.index];
+        view.received[e.index] = e.value;
+        param->setValue(e.value);
+        param->sendValueChangedMessageToListeners(e.value);   // Plugin editors + our own mirror
+        ++applied;
+    });
+
+    return applied;
+}
+
+void ParameterMirror::requestRealtimeResync()
+{
+    jassert(juce::MessageManager::getInstance()->isThisTheMessageThread());
+
+    const juce::SpinLock::ScopedLockType lock(realtimeLock);
+    if (realtime == nullptr)
+        return;
+
+    for (size_t w = 0; w < realtime->numWords; ++w)
+        realtime->pending[w].store(~uint64_t { 0 }, std::memory_order_relaxed);
+}
+
+int ParameterMirror::collectRealtimeState(MirrorParameterChannel::Entry* dest, int maxEntries,
+                                          uint32_t& cursor, bool& finished) noexcept
+{
+    finished = false;
+    const juce::SpinLock::ScopedTryLockType lock(realtimeLock);
+    if (!lock.isLocked())
+        return 0;   // Being rebuilt — try again next block
+
+    if (realtime == nullptr)
+    {
+        finished = true;
+        return 0;
+    }
+
+    auto& view = *realtime;
+    const auto n = static_cast<uint32_t>(view.params.size());
+    int count = 0;
+    while (cursor < n && count < maxEntries)
+    {
+        dest[count++] = { view.layoutHash, cursor, view.params[cursor]->getValue() };
+        ++cursor;
+    }
+
+    finished = cursor >= n;
+    return count;
+}
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include "ChainNode.h"
+#include "MirrorParameterChannel.h"
+#include <atomic>
+#include <memory>
+#include <vector>
+
+/**
+ * Per-chain mirror of every hosted plugin parameter value, in one contiguous float
+ * array (DFS plugin order, each plugin's getParameters() order).
+ *
+ * Parameter listeners only set a bit in a lock-free "touched" bitmap; once per tick
+ * the message thread re-reads just the touched parameters, compares them against
+ * the mirror and hands the resulting list of changed indices to every consumer
+ * (undo watcher, MirrorManager, bridge). A small round-robin sweep catches plugins
+ * that change values without notifying listeners. Per-tick cost scales with the
+ * number of touched parameters, not the total.
+ *
+ * The same callbacks also set a bit in a second, realtime bitmap that the owning
+ * instance's audio thread drains into MirrorParameterChannels once per block, so
+ * mirrored instances follow each other block-synchronously instead of at tick rate.
+ *
+ * Thread safety:
+ *  - Listener callbacks (any thread, usually audio) only touch atomics.
+ *  - rebuild/refresh and all readers run on the message thread.
+ *  - collectRealtimeChanges/applyRealtimeChanges run on the audio thread and only
+ *    try-lock the realtime view; they skip the block while a rebuild swaps it.
+ */
+class ParameterMirror : private juce::Timer
+{
+public:
+    static constexpr int kTickHz = 30;
+    static constexpr int kSweepPerTick = 64;       // Silent-change sweep budget
+    static constexpr float kChangeEpsilon = 1.0e-6f;
+
+    struct PluginEntry
+    {
+        ChainNodeId nodeId = -1;
+        juce::AudioProcessor* processor = nullptr;      // Unwrapped plugin
+        juce::AudioProcessorGraph::Node::Ptr keepAlive;  // Keeps listeners valid until the next rebuild
+    };
+
+    struct Location
+    {
+        ChainNodeId nodeId = -1;
+        int slotIndex = -1;      // DFS plugin index
+        int paramIndex = -1;
+    };
+
+    class Listener
+    {
+    public:
+        virtual ~Listener() = default;
+        /** Message thread, once per tick with at least one change. Indices are ascending. */
+        virtual void parameterMirrorChanged(const ParameterMirror& mirror, const std::vector<uint32_t>& changed) = 0;
+        /** The layout changed: previously reported indices are no longer valid. */
+        virtual void parameterMirrorRebuilt(const ParameterMirror&) {}
+    };
+
+    ParameterMirror();
+    ~ParameterMirror() override;
+
+    /** Re-register on the chain's plugins (after a graph rebuild). Values are re-read. */
+    void rebuild(std::vector<PluginEntry> plugins);
+    void clear();
+
+    /** One tick: collect touched + swept parameters, diff, notify listeners.
+        Called by the internal timer; callable directly to flush synchronously. */
+    void refresh();
+
+    int getNumParameters() const { return static_cast<int>(params.size()); }
+    float getValue(uint32_t index) const { return values[index]; }
+    const float* getValues() const { return values.data(); }
+    Location getLocation(uint32_t index) const;
+    int findIndex(ChainNodeId nodeId, int paramIndex) const;   // -1 if not mirrored
+
+    /** Host/plugin gestures currently in progress across all mirrored parameters. */
+    int getActiveGestureCount() const { return activeGestureCount.load(std::memory_order_relaxed); }
+
+    /** Parameters re-read by the last refresh (touched + sweep) — for diagnostics/tests. */
+    int getLastReadCount() const { return lastReadCount; }
+
+    void addListener(Listener* listener) { listeners.add(listener); }
+    void removeListener(Listener* listener) { listeners.remove(listener); }
+
+    // ============================================
+    // Realtime (audio thread) mirroring
+    // ============================================
+
+    /** Hash of the plugin/parameter layout; entries from a partner with another layout are dropped. */
+    uint32_t getLayoutHash() const { return layoutHash; }
+
+    /** Audio thread: move up to maxEntries pending local changes into dest. Values that were
+        just applied from a partner are not sent back. Leftovers stay pending for the next block. */
+    int collectRealtimeChanges(MirrorParameterChannel::Entry* dest, int maxEntries) noexcept;
+
+    /** Audio thread: apply everything queued in a partner's channel. Leaves the queue
+        untouched if the view is being rebuilt. Returns the number of values applied. */
+    int applyRealtimeChanges(MirrorParameterChannel& channel) noexcept;
+
+    /** Message thread: mark every parameter pending so the next blocks resend the full state. */
+    void requestRealtimeResync();
+
+    /** Audio thread: current values from cursor onward, for resending the full state to one
+        partner without marking anything pending for the others. Advances cursor; finished is
+        set once it has passed the last parameter. */
+    int collectRealtimeState(MirrorParameterChannel::Entry* dest, int maxEntries,
+                             uint32_t& cursor, bool& finished) noexcept;
+
+private:
+    class PluginListener;
+
+    // Everything the audio thread needs, swapped as a unit on rebuild
+    struct RealtimeView
+    {
+        uint32_t layoutHash = 0;
+        std::vector<juce::AudioProcessorParameter*> params;
+        std::unique_ptr<std::atomic<uint64_t>[]> pending;
+        size_t numWords = 0;
+        std::vector<float> received;   // Last value applied from a partner (NaN = none); audio thread only
+    };
+
+    struct Range
+    {
+        ChainNodeId nodeId;
+        int slotIndex;
+        uint32_t offset;
+        uint32_t count;
+    };
+
+    void timerCallback() override { refresh(); }
+    void markTouched(uint32_t index) noexcept;
+    void gestureChanged(bool starting) noexcept;
+
+    std::vector<Range> ranges;
+    std::vector<juce::AudioProcessorParameter*> params;
+    std::vector<float> values;                     // The mirror
+    std::vector<float> scratch;                    // Sweep reads
+    std::vector<uint64_t> dirty;                   // Dirty bitmap of the last refresh
+    std::vector<uint32_t> changed;                 // Same, as an index list (reused)
+
+    std::unique_ptr<std::atomic<uint64_t>[]> touched;
+    size_t numTouchedWords = 0;
+    std::atomic<bool> anyTouched { false };
+    std::atomic<int> activeGestureCount { 0 };
+
+    std::vector<std::unique_ptr<PluginListener>> pluginListeners;
+    std::vector<juce::AudioProcessorGraph::Node::Ptr> keepAlive;
+
+    uint32_t sweepCursor = 0;
+    int lastReadCount = 0;
+    uint32_t layoutHash = 0;
+
+    std::unique_ptr<RealtimeView> realtime;
+    juce::SpinLock realtimeLock;
+
+    juce::ListenerList<Listener> listeners;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ParameterMirror)
+};
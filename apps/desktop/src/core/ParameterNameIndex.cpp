@@ -0,0 +1,231 @@
+#include "ParameterNameIndex.h"
+#include <algorithm>
+
+namespace
+{
+    enum class CharClass { separator, letter, digit };
+
+    CharClass classify(unsigned char c)
+    {
+        if (c >= '0' && c <= '9')
+            return CharClass::digit;
+        if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c >= 0x80)   // Keep non-ASCII names intact
+            return CharClass::letter;
+        return CharClass::separator;
+    }
+}
+
+// ============================================
+// Normalization
+// ============================================
+
+std::string ParameterNameIndex::normalize(const juce::String& name)
+{
+    const std::string raw = name.toStdString();
+    std::string out;
+    out.reserve(raw.size() + 4);
+
+    CharClass previous = CharClass::separator;
+    for (unsigned char c : raw)
+    {
+        const auto cls = classify(c);
+        if (cls == CharClass::separator)
+        {
+            previous = cls;
+            continue;
+        }
+
+        // New token after a separator, or where letters and digits meet
+        if (!out.empty() && cls != previous)
+            out += ' ';
+
+        out += (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : static_cast<char>(c);
+        previous = cls;
+    }
+    return out;
+}
+
+std::vector<std::string> ParameterNameIndex::tokenize(const std::string& normalized)
+{
+    std::vector<std::string> tokens;
+    size_t from = 0;
+    while (from < normalized.size())
+    {
+        auto to = normalized.find(' ', from);
+        if (to == std::string::npos)
+            to = normalized.size();
+        tokens.push_back(normalized.substr(from, to - from));
+        from = to + 1;
+    }
+    return tokens;
+}
+
+std::vector<ParameterNameIndex::Trigram> ParameterNameIndex::trigramsOf(const std::string& normalized)
+{
+    // Padded, so short names ("q", "mix") still have trigrams and word edges count
+    const std::string padded = " " + normalized + " ";
+    std::vector<Trigram> trigrams;
+    for (size_t i = 0; i + 3 <= padded.size(); ++i)
+        trigrams.push_back(static_cast<Trigram>(static_cast<unsigned char>(padded[i])) << 16
+                           | static_cast<Trigram>(static_cast<unsigned char>(padded[i + 1])) << 8
+                           | static_cast<Trigram>(static_cast<unsigned char>(padded[i + 2])));
+
+    std::sort(trigrams.begin(), trigrams.end());
+    trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+    return trigrams;
+}
+
+int ParameterNameIndex::firstNumber(const std::vector<std::string>& tokens)
+{
+    for (const auto& token : tokens)
+        if (classify(static_cast<unsigned char>(token.front())) == CharClass::digit)
+            return token.size() <= 6 ? std::stoi(token) : -1;
+    return -1;
+}
+
+bool ParameterNameIndex::containsTokens(const std::vector<std::string>& haystack,
+                                        const std::vector<std::string>& needle)
+{
+    // Contiguous run of tokens; a needle token of 3+ characters may be a prefix ("freq")
+    if (needle.empty() || needle.size() > haystack.size())
+        return false;
+
+    for (size_t offset = 0; offset + needle.size() <= haystack.size(); ++offset)
+    {
+        bool all = true;
+        for (size_t j = 0; j < needle.size() && all; ++j)
+        {
+            const auto& h = haystack[offset + j];
+            const auto& n = needle[j];
+            all = h == n || (n.size() >= 3 && h.compare(0, n.size(), n) == 0);
+        }
+        if (all)
+            return true;
+    }
+    return false;
+}
+
+float ParameterNameIndex::dice(const std::vector<Trigram>& a, const std::vector<Trigram>& b)
+{
+    if (a.empty() && b.empty())
+        return 0.0f;
+
+    size_t shared = 0;
+    for (size_t i = 0, j = 0; i < a.size() && j < b.size();)
+    {
+        if (a[i] < b[j])
+            ++i;
+        else if (b[j] < a[i])
+            ++j;
+        else
+        {
+            ++shared;
+            ++i;
+            ++j;
+        }
+    }
+    return 2.0f * static_cast<float>(shared) / static_cast<float>(a.size() + b.size());
+}
+
+// ============================================
+// Construction
+// ============================================
+
+ParameterNameIndex::ParameterNameIndex(const ParameterDiscovery::DiscoveredMap& map)
+{
+    entries.reserve(static_cast<size_t>(map.parameters.size()));
+
+    for (const auto& dp : map.parameters)
+    {
+        if (dp.matched && dp.semantic.isNotEmpty())
+            semanticToIndex[dp.semantic.toStdString()] = dp.juceParamIndex;
+
+        const auto normalized = normalize(dp.juceParamId);
+        if (normalized.empty())
+            continue;
+
+        Entry entry;
+        entry.paramIndex = dp.juceParamIndex;
+        entry.tokens = tokenize(normalized);
+        entry.bandNumber = firstNumber(entry.tokens);
+        entry.trigrams = trigramsOf(normalized);
+
+        const int position = static_cast<int>(entries.size());
+        nameToEntry.emplace(normalized, position);
+        for (auto trigram : entry.trigrams)
+            postings[trigram].push_back(position);
+
+        entries.push_back(std::move(entry));
+    }
+}
+
+// ============================================
+// Lookups
+// ============================================
+
+int ParameterNameIndex::findBySemantic(const juce::String& semantic) const
+{
+    auto it = semanticToIndex.find(semantic.toStdString());
+    return it != semanticToIndex.end() ? it->second : -1;
+}
+
+int ParameterNameIndex::findByName(const juce::String& name) const
+{
+    auto it = nameToEntry.find(normalize(name));
+    return it != nameToEntry.end() ? entries[static_cast<size_t>(it->second)].paramIndex : -1;
+}
+
+std::vector<ParameterNameIndex::Match> ParameterNameIndex::findSimilar(const juce::String& name, int maxResults,
+                                                                       float minConfidence) const
+{
+    std::vector<Match> matches;
+    const auto normalized = normalize(name);
+    if (normalized.empty() || maxResults <= 0)
+        return matches;
+
+    const auto tokens = tokenize(normalized);
+    const auto trigrams = trigramsOf(normalized);
+    const int bandNumber = firstNumber(tokens);
+
+    // Candidates: everything sharing one of the query's rarest trigrams. A real match
+    // shares most of them, and the rare ones keep the candidate list short.
+    std::vector<const std::vector<int>*> lists;
+    for (auto trigram : trigrams)
+        if (auto it = postings.find(trigram); it != postings.end())
+            lists.push_back(&it->second);
+
+    std::sort(lists.begin(), lists.end(), [](const auto* a, const auto* b) { return a->size() < b->size(); });
+    if (lists.size() > static_cast<size_t>(kProbeTrigrams))
+        lists.resize(static_cast<size_t>(kProbeTrigrams));
+
+    std::vector<int> candidates;
+    for (const auto* list : lists)
+        candidates.insert(candidates.end(), list->begin(), list->end());
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+    for (int position : candidates)
+    {
+        const auto& entry = entries[static_cast<size_t>(position)];
+
+        // "Band 3 Gain" never resolves to band 4
+        if (bandNumber > 0 && entry.bandNumber > 0 && entry.bandNumber != bandNumber)
+            continue;
+
+        float confidence = dice(trigrams, entry.trigrams);
+        if (entry.tokens == tokens)
+            confidence = 1.0f;
+        else if (containsTokens(entry.tokens, tokens) || containsTokens(tokens, entry.tokens))
+            confidence = 0.75f + 0.25f * confidence;
+
+        if (confidence >= minConfidence)
+            matches.push_back({ entry.paramIndex, confidence });
+    }
+
+    std::sort(matches.begin(), matches.end(), [](const Match& a, const Match& b) {
+        return a.confidence != b.confidence ? a.confidence > b.confidence : a.paramIndex < b.paramIndex;
+    });
+    if (matches.size() > static_cast<size_t>(maxResults))
+        matches.resize(static_cast<size_t>(maxResults));
+    return matches;
+}
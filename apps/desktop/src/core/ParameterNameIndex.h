@@ -0,0 +1,80 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include "ParameterDiscovery.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * ParameterNameIndex — Resolves seeded parameter names and semantics against one plugin.
+ *
+ * Built once per discovered map (ParameterDiscoveryCache keeps it next to the map), so
+ * applyPendingParameters does a hash lookup or a handful of scored candidates per
+ * pending value instead of lowercasing and comparing every parameter name each time.
+ *
+ * Names are normalized to lowercase alphanumeric tokens, with digits split from letters
+ * ("Band3-Gain" → "band 3 gain"). Lookups:
+ *  - findBySemantic: discovered semantic → parameter (the last one wins, as before).
+ *  - findByName: normalized names equal.
+ *  - findSimilar: candidates come from the query's rarest character trigrams, are
+ *    restricted to the query's band number when it has one, and are ranked by trigram
+ *    similarity, with a floor for names whose tokens contain the other's ("Freq" in
+ *    "Band 1 Frequency"). Confidence is 1 for equal names, down to kMinConfidence.
+ *
+ * Immutable after construction; safe to share between threads.
+ */
+class ParameterNameIndex
+{
+public:
+    explicit ParameterNameIndex(const ParameterDiscovery::DiscoveredMap& map);
+
+    struct Match
+    {
+        int paramIndex = -1;        // AudioProcessor::getParameters() index
+        float confidence = 0.0f;    // 0-1
+    };
+
+    static constexpr float kMinConfidence = 0.7f;
+
+    /** Parameter index for a discovered semantic, or -1. */
+    int findBySemantic(const juce::String& semantic) const;
+
+    /** Parameter whose normalized name equals this one, or -1. */
+    int findByName(const juce::String& name) const;
+
+    /** Best matches first (ties go to the lower parameter index); at most maxResults. */
+    std::vector<Match> findSimilar(const juce::String& name, int maxResults = 1,
+                                   float minConfidence = kMinConfidence) const;
+
+    int getNumParameters() const { return static_cast<int>(entries.size()); }
+    int getNumSemantics() const { return static_cast<int>(semanticToIndex.size()); }
+
+    /** Lowercase tokens joined by single spaces, digits split from letters. */
+    static std::string normalize(const juce::String& name);
+
+private:
+    using Trigram = std::uint32_t;
+
+    struct Entry
+    {
+        int paramIndex = -1;
+        int bandNumber = -1;                 // First number in the name
+        std::vector<std::string> tokens;
+        std::vector<Trigram> trigrams;       // Sorted, unique
+    };
+
+    static std::vector<std::string> tokenize(const std::string& normalized);
+    static std::vector<Trigram> trigramsOf(const std::string& normalized);
+    static int firstNumber(const std::vector<std::string>& tokens);
+    static bool containsTokens(const std::vector<std::string>& haystack, const std::vector<std::string>& needle);
+    static float dice(const std::vector<Trigram>& a, const std::vector<Trigram>& b);
+
+    std::vector<Entry> entries;
+    std::unordered_map<std::string, int> nameToEntry;                  // First entry with that name
+    std::unordered_map<std::string, int> semanticToIndex;
+    std::unordered_map<Trigram, std::vector<int>> postings;           // Trigram → entries, ascending
+
+    static constexpr int kProbeTrigrams = 4;
+};
@@ -0,0 +1,1695 @@
+#include "PluginCatalog.h"
+#include "../utils/PlatformPaths.h"
+#include <algorithm>
+#include <set>
+
+PluginCatalog::PluginCatalog()
+{
+    #if JUCE_PLUGINHOST_AU
+    formatManager.addFormat(new juce::AudioUnitPluginFormat());
+    #if JUCE_DEBUG
+    std::cerr << "PluginCatalog: Added AudioUnit format" << std::endl;
+    #endif
+    #endif
+
+    #if JUCE_PLUGINHOST_VST3
+    formatManager.addFormat(new juce::VST3PluginFormat());
+    #if JUCE_DEBUG
+    std::cerr << "PluginCatalog: Added VST3 format" << std::endl;
+    #endif
+    #endif
+
+    #if JUCE_DEBUG
+    std::cerr << "PluginCatalog: " << formatManager.getNumFormats() << " formats available" << std::endl;
+    for (int i = 0; i < formatManager.getNumFormats(); ++i)
+    {
+        auto* format = formatManager.getFormat(i);
+        std::cerr << "  Format " << i << ": " << format->getName() << std::endl;
+
+        // Show default paths at startup
+        auto paths = format->getDefaultLocationsToSearch();
+        std::cerr << "    Default paths (" << paths.getNumPaths() << "):" << std::endl;
+        for (int j = 0; j < paths.getNumPaths(); ++j)
+            std::cerr << "      " << paths[j].getFullPathName() << std::endl;
+    }
+    #endif
+
+    loadBlacklist();
+    checkForCrashedPlugin();  // Auto-blacklist any plugin that crashed during previous scan
+    loadPluginList();
+    loadCustomScanPaths();
+    loadDeactivatedList();
+    loadProfiles();
+    scanStateCache.load(getScanStateFile());
+    loadAutoScanSettings();
+
+    publishSnapshot();
+    knownPlugins.addChangeListener(this);
+
+    prewarmer.load();
+    prewarmer.scheduleStart();
+}
+
+PluginCatalog::~PluginCatalog() noexcept
+{
+    prewarmer.cancel();
+    knownPlugins.removeChangeListener(this);
+    cancelPendingUpdate();
+    autoScanTimer.stopTimer();
+    pathWatcher.reset();
+    stopTimer();
+    shouldStopScan.store(true);
+
+    // Wait for scanner workers to finish with proper cleanup
+    scanScheduler.reset();
+    scannerWorkers.clear();
+
+    currentScanner.reset();
+    scanning.store(false);
+}
+
+void PluginCatalog::startScan(bool /*rescanAll*/)
+{
+    #if JUCE_DEBUG
+    std::cerr << "PluginCatalog::startScan called" << std::endl;
+    #endif
+
+    if (scanning.load())
+    {
+        #if JUCE_DEBUG
+        std::cerr << "  Already scanning, returning" << std::endl;
+        #endif
+        return;
+    }
+
+    // The scan wants the disk and the message thread more than the prewarm does
+    prewarmer.cancel();
+    ensureLiveListLoaded();
+
+    shouldStopScan.store(false);
+    scanning.store(true);
+    scanProgress.store(0.0f);
+    currentFormatIndex = 0;
+    currentPathIndex = 0;
+
+    #if JUCE_DEBUG
+    std::cerr << "  Starting scan with " << formatManager.getNumFormats() << " formats" << std::endl;
+    #endif
+
+    if (useOutOfProcessScanning)
+    {
+        // Collect all plugins to scan first, then scan them one by one out-of-process
+        collectPluginsToScan();
+    }
+    else
+    {
+        // Fall back to in-process scanning (legacy)
+        initializeScan();
+    }
+}
+
+void PluginCatalog::stopScan()
+{
+    shouldStopScan.store(true);
+    stopTimer();
+
+    // Wait for in-flight helpers to finish before cleaning up (no new ones start)
+    if (scanScheduler)
+        scanScheduler->stop();
+    scanScheduler.reset();
+    scannerWorkers.clear();
+
+    currentScanner.reset();
+    scanning.store(false);
+}
+
+juce::String PluginCatalog::getCurrentlyScanning() const
+{
+    std::lock_guard<std::mutex> lock(scanMutex);
+    return currentlyScanning;
+}
+
+void PluginCatalog::initializeScan()
+{
+    #if JUCE_DEBUG
+    std::cerr << "initializeScan: numFormats=" << formatManager.getNumFormats()
+              << " currentFormatIndex=" << currentFormatIndex << std::endl;
+    #endif
+
+    // Create scanner for first format and path
+    while (currentFormatIndex < formatManager.getNumFormats())
+    {
+        auto* format = formatManager.getFormat(currentFormatIndex);
+
+        // Get search paths using helper (handles manual fallback for AU)
+        currentSearchPaths = getSearchPathsForFormat(format);
+
+        #if JUCE_DEBUG
+        std::cerr << "Format: " << format->getName() << " has " << currentSearchPaths.getNumPaths() << " paths" << std::endl;
+        for (int i = 0; i < currentSearchPaths.getNumPaths(); ++i)
+            std::cerr << "  Path " << i << ": " << currentSearchPaths[i].getFullPathName() << std::endl;
+        #endif
+
+        if (currentPathIndex < currentSearchPaths.getNumPaths())
+        {
+            auto searchPath = juce::FileSearchPath(currentSearchPaths[currentPathIndex].getFullPathName());
+
+            #if JUCE_DEBUG
+            std::cerr << "Starting scan of: " << currentSearchPaths[currentPathIndex].getFullPathName()
+                      << " for format: " << format->getName() << std::endl;
+            #endif
+
+            currentScanner = std::make_unique<juce::PluginDirectoryScanner>(
+                knownPlugins,
+                *format,
+                searchPath,
+                true,  // recursive
+                getDeadMansPedalFile(),  // Track currently scanning plugin to detect crashes
+                true   // allow async plugins
+            );
+
+            // Start timer to process plugins one at a time on main thread
+            // Using a short interval keeps UI responsive
+            startTimer(1); // 1ms interval
+            return;
+        }
+
+        currentPathIndex = 0;
+        currentFormatIndex++;
+    }
+
+    // No more formats to scan
+    finishScan();
+}
+
+void PluginCatalog::timerCallback()
+{
+    if (useOutOfProcessScanning)
+    {
+        mergeScanResults();
+    }
+    else
+    {
+        // In-process scanning (legacy fallback)
+        if (shouldStopScan.load() || !currentScanner)
+        {
+            stopScan();
+            return;
+        }
+
+        juce::String pluginBeingScanned;
+        bool hasMore = currentScanner->scanNextFile(true, pluginBeingScanned);
+
+        if (!pluginBeingScanned.isEmpty())
+        {
+            {
+                std::lock_guard<std::mutex> lock(scanMutex);
+                currentlyScanning = pluginBeingScanned;
+            }
+
+            float progress = currentScanner->getProgress();
+            scanProgress.store(progress);
+
+            #if JUCE_DEBUG
+            std::cerr << "Scanning: " << pluginBeingScanned << " (" << (int)(progress * 100) << "%)" << std::endl;
+            #endif
+
+            savePluginList();
+
+            listeners.call([&](Listener& l) { l.scanProgressChanged(progress, pluginBeingScanned); });
+        }
+
+        if (!hasMore)
+        {
+            stopTimer();
+            currentScanner.reset();
+            currentPathIndex++;
+
+            if (currentPathIndex >= currentSearchPaths.getNumPaths())
+            {
+                currentPathIndex = 0;
+                currentFormatIndex++;
+            }
+
+            initializeScan();
+        }
+    }
+}
+
+void PluginCatalog::finishScan()
+{
+    stopTimer();
+
+    // Join scanner workers if they're still around; persistent helpers exit with their clients
+    scanScheduler.reset();
+    scannerWorkers.clear();
+
+    currentScanner.reset();
+
+    // Clear the dead man's pedal files since scan completed successfully
+    getDeadMansPedalFile().deleteFile();
+    ScanScheduler::clearPedals(getDeadMansPedalFile().getParentDirectory());
+
+    savePluginList();
+    saveBlacklist();  // Save any auto-blacklisted plugins
+    scanStateCache.save(getScanStateFile());
+    scanning.store(false);
+    scanProgress.store(1.0f);
+
+    #if JUCE_DEBUG
+    int effectCount = 0;
+    int instrumentCount = 0;
+    for (const auto& desc : knownPlugins.getTypes())
+    {
+        // Same logic as getPluginListAsJson - instruments have isInstrument=true OR 0 audio inputs
+        bool isLikelyInstrument = desc.isInstrument || desc.numInputChannels == 0;
+        if (isLikelyInstrument)
+            instrumentCount++;
+        else
+            effectCount++;
+    }
+    std::cerr << "Scan complete. Found " << knownPlugins.getNumTypes() << " plugins total." << std::endl;
+    std::cerr << "  Audio effects: " << effectCount << std::endl;
+    std::cerr << "  Instruments (filtered out): " << instrumentCount << std::endl;
+    std::cerr << "  Blacklisted: " << knownPlugins.getBlacklistedFiles().size() << std::endl;
+    #endif
+
+    publishSnapshot();
+    listeners.call([](Listener& l) { l.scanFinished(); });
+}
+
+std::unique_ptr<juce::AudioPluginInstance> PluginCatalog::createPluginInstance(
+    const juce::PluginDescription& desc,
+    double sampleRate,
+    int blockSize,
+    juce::String& errorMessage)
+{
+    return formatManager.createPluginInstance(desc, sampleRate, blockSize, errorMessage);
+}
+
+std::optional<juce::PluginDescription> PluginCatalog::findPluginByIdentifier(const juce::String& identifier) const
+{
+    return getSnapshot()->findByIdentifier(identifier);
+}
+
+std::optional<juce::PluginDescription> PluginCatalog::findPrewarmCandidate(const juce::String& identifier) const
+{
+    auto known = getSnapshot();
+    auto desc = known->findByIdentifier(identifier);
+    if (!desc)
+        return std::nullopt;
+
+    // Never load something the user has switched off or that crashed a scan
+    if (known->blacklist.contains(desc->fileOrIdentifier)
+        || known->deactivated.contains(desc->fileOrIdentifier)
+        || known->deactivated.contains(desc->createIdentifierString()))
+        return std::nullopt;
+
+    return desc;
+}
+
+juce::var PluginCatalog::getPluginListAsJson() const
+{
+    // Built once per snapshot; the bridge asks for this on every editor open
+    return getSnapshot()->getPluginListJson();
+}
+
+void PluginCatalog::savePluginList()
+{
+    ensureLiveListLoaded();
+
+    auto cacheFile = getCacheFile();
+    cacheFile.getParentDirectory().createDirectory();
+
+    if (auto xml = knownPlugins.createXml())
+        xml->writeTo(cacheFile);
+
+    // Written after the XML so loadPluginList() can tell a stale image by its date
+    if (!PluginCatalogImage::build(knownPlugins.getTypes())->writeTo(getBinaryCacheFile()))
+        std::cerr << "ERROR: Failed to write " << getBinaryCacheFile().getFullPathName() << std::endl;
+}
+
+void PluginCatalog::loadPluginList()
+{
+    auto cacheFile = getCacheFile();
+    auto binaryFile = getBinaryCacheFile();
+
+    // Fast path: map the binary image and serve snapshots straight from it. The XML stays
+    // the source of truth — an image older than it (written by a build without the binary
+    // cache) or one that fails validation is ignored.
+    if (binaryFile.existsAsFile()
+        && (!cacheFile.existsAsFile() || binaryFile.getLastModificationTime() >= cacheFile.getLastModificationTime()))
+    {
+        if (auto image = PluginCatalogImage::map(binaryFile))
+        {
+            #if JUCE_DEBUG
+            std::cerr << "Mapped plugin cache: " << image->size() << " types, "
+                      << image->getNumBytes() << " bytes" << std::endl;
+            #endif
+            knownPlugins.clear();
+            coldImage = std::move(image);
+            liveListLoaded = false;
+            return;
+        }
+    }
+
+    coldImage.reset();
+    liveListLoaded = true;
+
+    if (cacheFile.existsAsFile())
+    {
+        if (auto xml = juce::XmlDocument::parse(cacheFile))
+            knownPlugins.recreateFromXml(*xml);
+    }
+}
+
+void PluginCatalog::ensureLiveListLoaded()
+{
+    if (liveListLoaded)
+        return;
+
+    // Set first: addType() broadcasts, and the resulting republish must read the live list
+    liveListLoaded = true;
+
+    if (auto image = std::move(coldImage))
+        for (int i = 0; i < image->size(); ++i)
+            knownPlugins.addType(image->getDescription(i));
+}
+
+juce::File PluginCatalog::getCacheFile() const
+{
+    return PlatformPaths::getPluginCacheDirectory().getChildFile("known-plugins.xml");
+}
+
+juce::File PluginCatalog::getBinaryCacheFile() const
+{
+    return PlatformPaths::getPluginCacheDirectory().getChildFile("known-plugins.bin");
+}
+
+void PluginCatalog::changeListenerCallback(juce::ChangeBroadcaster*)
+{
+    // The live list changed behind our back (e.g. through getKnownPlugins()) — republish
+    publishSnapshot();
+}
+
+//==============================================================================
+// Snapshots
+//==============================================================================
+
+const std::vector<juce::PluginDescription>& PluginCatalog::Snapshot::getTypes() const
+{
+    std::call_once(typesBuilt, [this] {
+        types.reserve(static_cast<size_t>(getNumTypes()));
+        for (int i = 0; i < getNumTypes(); ++i)
+            types.push_back(image->getDescription(i));
+    });
+    return types;
+}
+
+std::optional<juce::PluginDescription> PluginCatalog::Snapshot::findByIdentifier(const juce::String& identifier) const
+{
+    if (image == nullptr)
+        return std::nullopt;
+
+    const int index = image->findByIdentifier(identifier);
+    if (index < 0)
+        return std::nullopt;
+    return image->getDescription(index);
+}
+
+std::optional<juce::PluginDescription> PluginCatalog::Snapshot::findByNameAndManufacturer(const juce::String& name,
+                                                                                          const juce::String& manufacturer) const
+{
+    if (image == nullptr)
+        return std::nullopt;
+
+    const int index = image->findByNameAndManufacturer(name, manufacturer);
+    if (index < 0)
+        return std::nullopt;
+    return image->getDescription(index);
+}
+
+std::vector<juce::PluginDescription> PluginCatalog::Snapshot::findByUniqueId(int uniqueId) const
+{
+    return image != nullptr ? describe(image->findByUniqueId(uniqueId)) : std::vector<juce::PluginDescription>();
+}
+
+std::vector<juce::PluginDescription> PluginCatalog::Snapshot::findByManufacturer(const juce::String& manufacturer) const
+{
+    return image != nullptr ? describe(image->findByManufacturer(manufacturer)) : std::vector<juce::PluginDescription>();
+}
+
+std::vector<juce::PluginDescription> PluginCatalog::Snapshot::findByCategory(const juce::String& category) const
+{
+    return image != nullptr ? describe(image->findByCategory(category)) : std::vector<juce::PluginDescription>();
+}
+
+std::vector<juce::PluginDescription> PluginCatalog::Snapshot::describe(const std::vector<int>& indexes) const
+{
+    std::vector<juce::PluginDescription> found;
+    found.reserve(indexes.size());
+    for (int index : indexes)
+        found.push_back(image->getDescription(index));
+    return found;
+}
+
+const PluginProfile* PluginCatalog::Snapshot::findProfile(const juce::PluginDescription& desc) const
+{
+    if (profiles == nullptr)
+        return nullptr;
+
+    auto it = profiles->find(desc.createIdentifierString());
+    return it != profiles->end() ? &it->second : nullptr;
+}
+
+const juce::var& PluginCatalog::Snapshot::getPluginListJson() const
+{
+    std::call_once(jsonBuilt, [this] {
+        juce::Array<juce::var> pluginArray;
+
+        for (int i = 0; i < getNumTypes(); ++i)
+        {
+            const auto desc = image->getDescription(i);
+
+            // Only include audio effect plugins, not instruments/synths
+            bool isLikelyInstrument = desc.isInstrument || desc.numInputChannels == 0;
+            if (isLikelyInstrument)
+                continue;
+
+            // Filter out deactivated plugins from the main list
+            if (deactivated.contains(desc.fileOrIdentifier))
+                continue;
+
+            auto* obj = new juce::DynamicObject();
+            obj->setProperty("id", desc.createIdentifierString());
+            obj->setProperty("name", desc.name);
+            obj->setProperty("manufacturer", desc.manufacturerName);
+            obj->setProperty("category", desc.category);
+            obj->setProperty("format", desc.pluginFormatName);
+            obj->setProperty("uid", desc.uniqueId);
+            obj->setProperty("fileOrIdentifier", desc.fileOrIdentifier);
+            obj->setProperty("isInstrument", desc.isInstrument);
+            obj->setProperty("numInputChannels", desc.numInputChannels);
+            obj->setProperty("numOutputChannels", desc.numOutputChannels);
+            obj->setProperty("version", desc.version);
+            if (auto* profile = findProfile(desc))
+                obj->setProperty("profile", profile->toVar());
+            pluginArray.add(juce::var(obj));
+        }
+
+        pluginListJson = juce::var(pluginArray);
+    });
+    return pluginListJson;
+}
+
+std::shared_ptr<const PluginCatalog::Snapshot> PluginCatalog::getSnapshot() const
+{
+    return std::atomic_load(&snapshot);
+}
+
+void PluginCatalog::publishSnapshot()
+{
+    auto next = std::make_shared<Snapshot>();
+    next->version = nextSnapshotVersion++;
+    next->image = liveListLoaded ? PluginCatalogImage::build(knownPlugins.getTypes()) : coldImage;
+    next->blacklist = knownPlugins.getBlacklistedFiles();
+    next->deactivated = deactivatedPlugins;
+    next->profiles = profiles;
+
+    std::atomic_store(&snapshot, std::shared_ptr<const Snapshot>(std::move(next)));
+    triggerAsyncUpdate();
+}
+
+void PluginCatalog::handleAsyncUpdate()
+{
+    auto current = getSnapshot();
+    listeners.call([&](Listener& l) { l.pluginCatalogChanged(*current); });
+}
+
+void PluginCatalog::addListener(Listener* listener)
+{
+    listeners.add(listener);
+}
+
+void PluginCatalog::removeListener(Listener* listener)
+{
+    listeners.remove(listener);
+}
+
+juce::FileSearchPath PluginCatalog::getSearchPathsForFormat(juce::AudioPluginFormat* format) const
+{
+    juce::FileSearchPath paths = format->getDefaultLocationsToSearch();
+
+    // JUCE sometimes returns empty paths for AU on macOS - add manual paths as fallback
+    if (paths.getNumPaths() == 0 && format->getName() == "AudioUnit")
+    {
+        paths.add(juce::File("/Library/Audio/Plug-Ins/Components"));
+        paths.add(juce::File::getSpecialLocation(juce::File::userHomeDirectory)
+            .getChildFile("Library/Audio/Plug-Ins/Components"));
+    }
+
+    // Append custom scan paths that match this format (or "All")
+    for (const auto& custom : customScanPaths)
+    {
+        if (custom.format == format->getName() || custom.format == "All")
+        {
+            juce::File dir(custom.path);
+            if (dir.isDirectory())
+                paths.add(dir);
+        }
+    }
+
+    return paths;
+}
+
+//==============================================================================
+// Blacklist Management
+//==============================================================================
+
+void PluginCatalog::addToBlacklist(const juce::String& pluginPath)
+{
+    knownPlugins.addToBlacklist(pluginPath);
+    saveBlacklist();
+    publishSnapshot();
+    #if JUCE_DEBUG
+    std::cerr << "Added to blacklist: " << pluginPath << std::endl;
+    #endif
+}
+
+void PluginCatalog::removeFromBlacklist(const juce::String& pluginPath)
+{
+    knownPlugins.removeFromBlacklist(pluginPath);
+    saveBlacklist();
+    publishSnapshot();
+    #if JUCE_DEBUG
+    std::cerr << "Removed from blacklist: " << pluginPath << std::endl;
+    #endif
+}
+
+juce::StringArray PluginCatalog::getBlacklistedPlugins() const
+{
+    return knownPlugins.getBlacklistedFiles();
+}
+
+bool PluginCatalog::isBlacklisted(const juce::String& pluginPath) const
+{
+    return knownPlugins.getBlacklistedFiles().contains(pluginPath);
+}
+
+void PluginCatalog::clearBlacklist()
+{
+    knownPlugins.clearBlacklistedFiles();
+    saveBlacklist();
+    publishSnapshot();
+    #if JUCE_DEBUG
+    std::cerr << "Cleared plugin blacklist" << std::endl;
+    #endif
+}
+
+juce::var PluginCatalog::getBlacklistAsJson() const
+{
+    juce::Array<juce::var> blacklistArray;
+
+    for (const auto& path : knownPlugins.getBlacklistedFiles())
+    {
+        auto* obj = new juce::DynamicObject();
+        juce::File pluginFile(path);
+
+        obj->setProperty("path", path);
+        obj->setProperty("name", pluginFile.getFileNameWithoutExtension());
+        obj->setProperty("exists", pluginFile.exists());
+
+        blacklistArray.add(juce::var(obj));
+    }
+
+    return juce::var(blacklistArray);
+}
+
+void PluginCatalog::saveBlacklist()
+{
+    auto blacklistFile = getBlacklistFile();
+    blacklistFile.getParentDirectory().createDirectory();
+
+    juce::StringArray blacklist = knownPlugins.getBlacklistedFiles();
+    blacklistFile.replaceWithText(blacklist.joinIntoString("\n"));
+}
+
+void PluginCatalog::loadBlacklist()
+{
+    auto blacklistFile = getBlacklistFile();
+    if (blacklistFile.existsAsFile())
+    {
+        juce::StringArray lines;
+        blacklistFile.readLines(lines);
+
+        for (const auto& line : lines)
+        {
+            if (line.trim().isNotEmpty())
+                knownPlugins.addToBlacklist(line.trim());
+        }
+
+        #if JUCE_DEBUG
+        std::cerr << "Loaded " << lines.size() << " blacklisted plugins" << std::endl;
+        #endif
+    }
+}
+
+void PluginCatalog::checkForCrashedPlugin()
+{
+    auto deadMansPedal = getDeadMansPedalFile();
+    auto pedalDirectory = deadMansPedal.getParentDirectory();
+
+    // Concurrent scans leave one pedal per busy worker. A single survivor is as good as the
+    // in-process pedal; several can't tell us which plugin took the app down, so rescan
+    // those one at a time next scan instead of blacklisting innocent neighbours.
+    auto inFlight = ScanScheduler::readPedals(pedalDirectory);
+    ScanScheduler::clearPedals(pedalDirectory);
+
+    if (inFlight.size() > 1)
+    {
+        #if JUCE_DEBUG
+        std::cerr << "Detected crash while scanning " << inFlight.size()
+                  << " plugins concurrently; rescanning them one at a time" << std::endl;
+        #endif
+        scanSuspects = inFlight;
+    }
+    else if (inFlight.size() == 1 && !deadMansPedal.existsAsFile())
+    {
+        deadMansPedal.replaceWithText(inFlight[0]);
+    }
+
+    if (deadMansPedal.existsAsFile())
+    {
+        juce::String crashedPlugin = deadMansPedal.loadFileAsString().trim();
+
+        if (crashedPlugin.isNotEmpty())
+        {
+            #if JUCE_DEBUG
+            std::cerr << "Detected crash while scanning: " << crashedPlugin << std::endl;
+            std::cerr << "Auto-blacklisting this plugin to prevent future crashes." << std::endl;
+            #endif
+
+            knownPlugins.addToBlacklist(crashedPlugin);
+            saveBlacklist();
+
+            // Notify listeners about the auto-blacklisted plugin (crash from previous session);
+            // at construction nobody is listening yet, the blacklist itself is the record
+            listeners.call([&](Listener& l) { l.pluginBlacklisted(crashedPlugin, ScanFailureReason::Crash); });
+        }
+
+        // Clear the dead man's pedal file
+        deadMansPedal.deleteFile();
+    }
+}
+
+juce::File PluginCatalog::getBlacklistFile() const
+{
+    return PlatformPaths::getPluginCacheDirectory().getChildFile("blacklisted-plugins.txt");
+}
+
+juce::File PluginCatalog::getDeadMansPedalFile() const
+{
+    return PlatformPaths::getPluginCacheDirectory().getChildFile("scanning-plugin.tmp");
+}
+
+juce::File PluginCatalog::getScannerHelperPath() const
+{
+    // Look for the helper in the app bundle's Resources folder
+    auto appBundle = juce::File::getSpecialLocation(juce::File::currentExecutableFile)
+        .getParentDirectory().getParentDirectory();
+
+    auto helperInBundle = appBundle.getChildFile("Resources/PluginScannerHelper");
+    if (helperInBundle.existsAsFile())
+        return helperInBundle;
+
+    // Fallback: look in same directory as executable
+    auto helperBeside = juce::File::getSpecialLocation(juce::File::currentExecutableFile)
+        .getParentDirectory().getChildFile("PluginScannerHelper");
+    if (helperBeside.existsAsFile())
+        return helperBeside;
+
+    // Development fallback: look in build directory
+    auto devHelper = juce::File::getSpecialLocation(juce::File::currentExecutableFile)
+        .getParentDirectory().getParentDirectory().getParentDirectory()
+        .getChildFile("PluginScannerHelper");
+    if (devHelper.existsAsFile())
+        return devHelper;
+
+    return {};
+}
+
+//==============================================================================
+// Out-of-Process Scanning
+//==============================================================================
+
+void PluginCatalog::collectPluginsToScan()
+{
+    pluginsToScan.clear();
+
+    #if JUCE_DEBUG
+    std::cerr << "Collecting plugins to scan..." << std::endl;
+    #endif
+
+    for (const auto& candidate : findPluginsNeedingScan())
+        pluginsToScan.push_back({ candidate.formatName, candidate.path, scanSuspects.contains(candidate.path) });
+
+    // Suspects from a crashed session go first, each on its own
+    std::stable_partition(pluginsToScan.begin(), pluginsToScan.end(),
+                          [](const ScanScheduler::Job& job) { return job.isolated; });
+    scanSuspects.clear();
+
+    #if JUCE_DEBUG
+    std::cerr << "Found " << pluginsToScan.size() << " plugins to scan" << std::endl;
+    #endif
+
+    if (pluginsToScan.empty())
+    {
+        finishScan();
+        return;
+    }
+
+    const int numWorkers = ScanScheduler::resolveConcurrency(scanConcurrency, pluginsToScan.size());
+
+    scannerWorkers.clear();
+    const auto helperPath = getScannerHelperPath();
+    for (int w = 0; w < numWorkers; ++w)
+        scannerWorkers.push_back(std::make_unique<ScannerWorkerClient>(helperPath));
+
+    scanScheduler = std::make_unique<ScanScheduler>(
+        [this](const ScanScheduler::Job& job, int worker) {
+            // Persistent helper first; if it can't be launched (e.g. an older helper without
+            // worker mode), one helper process per plugin as before
+            if (juce::isPositiveAndBelow(worker, static_cast<int>(scannerWorkers.size())))
+            {
+                auto& client = *scannerWorkers[static_cast<size_t>(worker)];
+                if (client.isUsable())
+                {
+                    auto result = client.scan(job.formatName, job.pluginPath);
+                    if (client.isUsable())
+                    {
+                        if (result.scanResult.success && benchmarkDuringScan.load())
+                            result.profiles = client.benchmark(result.discoveredPlugins);
+                        return result;
+                    }
+                }
+            }
+            return scanPluginWithHelper(job.formatName, job.pluginPath);
+        },
+        getDeadMansPedalFile().getParentDirectory());
+    scanScheduler->start(pluginsToScan, numWorkers);
+
+    // Start timer to merge finished results — actual scanning runs on the scheduler's workers
+    startTimer(50);  // 50ms poll interval
+}
+
+void PluginCatalog::mergeScanResults()
+{
+    if (!scanScheduler)
+        return;
+
+    // Check before draining so the final results can't slip in after we decide we're done
+    const bool allDone = scanScheduler->isFinished();
+
+    std::vector<ScanScheduler::Result> batch;
+    scanScheduler->drainResults(batch);
+
+    if (!batch.empty())
+    {
+        bool blacklistChanged = false;
+        bool listChanged = false;
+        bool scanStateChanged = false;
+        bool profilesChanged = false;
+
+        for (const auto& result : batch)
+        {
+            const bool fileBased = ScanStateCache::isFileBased(result.pluginPath);
+
+            if (!result.scanResult.success)
+            {
+                #if JUCE_DEBUG
+                std::cerr << "  -> Failed (reason: " << static_cast<int>(result.scanResult.failureReason)
+                          << "), blacklisting: " << result.pluginPath << std::endl;
+                #endif
+                knownPlugins.addToBlacklist(result.pluginPath);
+                blacklistChanged = true;
+
+                // Blacklisted plugins are never fingerprinted, so they stay skipped until unblacklisted
+                if (fileBased)
+                {
+                    scanStateCache.remove(result.pluginPath);
+                    scanStateChanged = true;
+                }
+
+                listeners.call([&](Listener& l) { l.pluginBlacklisted(result.pluginPath, result.scanResult.failureReason); });
+            }
+            else
+            {
+                // A rescan of a changed bundle replaces what it used to contain
+                removeTypesForFile(result.pluginPath);
+
+                // Add discovered plugins to the known list (main thread only — not thread-safe)
+                for (const auto& desc : result.discoveredPlugins)
+                {
+                    knownPlugins.addType(desc);
+                    #if JUCE_DEBUG
+                    std::cerr << "  Found: " << desc.name << " by " << desc.manufacturerName << std::endl;
+                    #endif
+                }
+                listChanged = true;
+
+                if (result.profiles.size() == result.discoveredPlugins.size() && !result.profiles.empty())
+                {
+                    editProfiles([&](ProfileMap& map) {
+                        for (size_t i = 0; i < result.profiles.size(); ++i)
+                            if (result.profiles[i].isValid())
+                                map[result.discoveredPlugins[i].createIdentifierString()] = result.profiles[i];
+                    });
+                    profilesChanged = true;
+                }
+
+                if (fileBased)
+                {
+                    auto formatName = result.discoveredPlugins.empty() ? juce::String()
+                                                                       : result.discoveredPlugins.front().pluginFormatName;
+                    scanStateCache.record(result.pluginPath, formatName,
+                                          ScanStateCache::fingerprint(juce::File(result.pluginPath)));
+                    scanStateChanged = true;
+                }
+            }
+        }
+
+        // One write per batch rather than per plugin
+        if (blacklistChanged)
+            saveBlacklist();
+        if (listChanged)
+            savePluginList();
+        if (scanStateChanged)
+            scanStateCache.save(getScanStateFile());
+        if (profilesChanged)
+            saveProfiles();
+        publishSnapshot();
+
+        auto inFlight = scanScheduler->getInFlight();
+        auto current = inFlight.isEmpty() ? batch.back().pluginPath : inFlight[0];
+        {
+            std::lock_guard<std::mutex> lock(scanMutex);
+            currentlyScanning = current;
+        }
+
+        float progress = (float)scanScheduler->getNumCompleted() / (float)scanScheduler->getNumJobs();
+        scanProgress.store(progress);
+
+        #if JUCE_DEBUG
+        std::cerr << "Scanned [" << scanScheduler->getNumCompleted() << "/" << scanScheduler->getNumJobs() << "], "
+                  << inFlight.size() << " in flight" << std::endl;
+        #endif
+
+        listeners.call([&](Listener& l) { l.scanProgressChanged(progress, current); });
+    }
+
+    if (shouldStopScan.load())
+    {
+        stopScan();
+        return;
+    }
+
+    if (allDone)
+        finishScan();
+}
+
+ScanScheduler::Result PluginCatalog::scanPluginWithHelper(const juce::String& formatName, const juce::String& pluginPath) const
+{
+    auto helperPath = getScannerHelperPath();
+
+    if (!helperPath.existsAsFile())
+    {
+        // FAIL LOUDLY — never fall back to in-process scanning.
+        // In-process scanning defeats the entire purpose of crash isolation.
+        std::cerr << "ERROR: Scanner helper not found! Searched locations:" << std::endl;
+        std::cerr << "  Bundle:  <app>/Contents/Resources/PluginScannerHelper" << std::endl;
+        std::cerr << "  Beside:  <exe-dir>/PluginScannerHelper" << std::endl;
+        std::cerr << "  Dev:     <build-dir>/PluginScannerHelper" << std::endl;
+        std::cerr << "  Refusing to scan in-process — skipping: " << pluginPath << std::endl;
+        return { { false, ScanFailureReason::ScanFailure }, {}, pluginPath };
+    }
+
+    // Build command line
+    juce::StringArray args;
+    args.add(helperPath.getFullPathName());
+    args.add(formatName);
+    args.add(pluginPath);
+
+    return ScanScheduler::runHelperProcess(args, pluginPath);
+}
+
+std::vector<PluginCatalog::ScanCandidate> PluginCatalog::findPluginsNeedingScan()
+{
+    std::vector<ScanCandidate> candidates;
+
+    // One pass over the known list instead of one per file found
+    std::set<juce::String> knownFiles;
+    auto known = getSnapshot();
+    for (const auto& desc : known->getTypes())
+        knownFiles.insert(desc.fileOrIdentifier);
+
+    const auto blacklisted = knownPlugins.getBlacklistedFiles();
+    std::set<juce::String> seen;
+    bool listChanged = false;
+    bool scanStateChanged = false;
+    int numUnchanged = 0;
+
+    for (int i = 0; i < formatManager.getNumFormats(); ++i)
+    {
+        auto* format = formatManager.getFormat(i);
+        auto searchPaths = getSearchPathsForFormat(format);
+
+        for (int j = 0; j < searchPaths.getNumPaths(); ++j)
+        {
+            auto path = searchPaths[j];
+            #if JUCE_DEBUG
+            std::cerr << "Searching: " << path.getFullPathName() << std::endl;
+            #endif
+
+            auto files = format->searchPathsForPlugins(juce::FileSearchPath(path.getFullPathName()), true, true);
+
+            for (const auto& file : files)
+            {
+                if (!seen.insert(file).second)
+                    continue;
+
+                // Skip if blacklisted
+                if (blacklisted.contains(file))
+                {
+                    #if JUCE_DEBUG
+                    std::cerr << "  Skipping blacklisted: " << file << std::endl;
+                    #endif
+                    continue;
+                }
+
+                const bool known = knownFiles.count(file) != 0;
+
+                // Component IDs and the like: nothing to fingerprint, known means done
+                if (!ScanStateCache::isFileBased(file))
+                {
+                    if (!known)
+                        candidates.push_back({ format->getName(), file, false });
+                    continue;
+                }
+
+                const auto fingerprint = ScanStateCache::fingerprint(juce::File(file));
+                const auto found = scanStateCache.lookup(file, fingerprint);
+
+                switch (found.state)
+                {
+                    case ScanStateCache::State::unchanged:
+                        if (known)
+                        {
+                            ++numUnchanged;
+                            continue;
+                        }
+                        break;   // Removed from the list by the user: rediscover it
+
+                    case ScanStateCache::State::changed:
+                        candidates.push_back({ format->getName(), file, known });
+                        continue;
+
+                    case ScanStateCache::State::moved:
+                        if (moveKnownPlugin(found.movedFrom, file))
+                        {
+                            #if JUCE_DEBUG
+                            std::cerr << "  Moved: " << found.movedFrom << " -> " << file << std::endl;
+                            #endif
+                            scanStateCache.rename(found.movedFrom, file);
+                            knownFiles.insert(file);
+                            listChanged = scanStateChanged = true;
+                            continue;
+                        }
+                        break;
+
+                    case ScanStateCache::State::added:
+                        if (known)
+                        {
+                            // Scanned before fingerprints were kept: adopt it as-is
+                            scanStateCache.record(file, format->getName(), fingerprint);
+                            scanStateChanged = true;
+                            continue;
+                        }
+                        break;
+                }
+
+                candidates.push_back({ format->getName(), file, false });
+            }
+        }
+    }
+
+    if (listChanged)
+    {
+        savePluginList();
+        publishSnapshot();
+    }
+    if (scanStateChanged)
+        scanStateCache.save(getScanStateFile());
+
+    #if JUCE_DEBUG
+    std::cerr << "Skipped " << numUnchanged << " unchanged plugins, " << candidates.size() << " to scan" << std::endl;
+    #endif
+
+    return candidates;
+}
+
+bool PluginCatalog::moveKnownPlugin(const juce::String& from, const juce::String& to)
+{
+    ensureLiveListLoaded();
+
+    bool moved = false;
+    for (auto desc : knownPlugins.getTypes())
+    {
+        if (desc.fileOrIdentifier != from)
+            continue;
+
+        const auto oldKey = desc.createIdentifierString();
+        knownPlugins.removeType(desc);
+        desc.fileOrIdentifier = to;
+        knownPlugins.addType(desc);
+        moved = true;
+
+        // Profiles are keyed by identifier string, which hashes the path
+        const auto newKey = desc.createIdentifierString();
+        if (profiles->count(oldKey) > 0)
+        {
+            editProfiles([&](ProfileMap& map) {
+                map[newKey] = map[oldKey];
+                map.erase(oldKey);
+            });
+            saveProfiles();
+        }
+    }
+
+    // Deactivation is keyed by path too
+    int deactIdx = deactivatedPlugins.indexOf(from);
+    if (moved && deactIdx >= 0)
+    {
+        deactivatedPlugins.set(deactIdx, to);
+        saveDeactivatedList();
+    }
+
+    return moved;
+}
+
+void PluginCatalog::removeTypesForFile(const juce::String& path)
+{
+    ensureLiveListLoaded();
+
+    juce::StringArray profiled;
+    for (const auto& desc : knownPlugins.getTypes())
+    {
+        if (desc.fileOrIdentifier != path)
+            continue;
+
+        if (profiles->count(desc.createIdentifierString()) > 0)
+            profiled.add(desc.createIdentifierString());
+        knownPlugins.removeType(desc);
+    }
+
+    // Measured against the old binary; the rescan measures again if benchmarking is on
+    if (!profiled.isEmpty())
+    {
+        editProfiles([&](ProfileMap& map) {
+            for (const auto& key : profiled)
+                map.erase(key);
+        });
+        saveProfiles();
+    }
+}
+
+juce::File PluginCatalog::getScanStateFile() const
+{
+    return PlatformPaths::getPluginCacheDirectory().getChildFile("scan-state.json");
+}
+
+//==============================================================================
+// Custom Scan Paths
+//==============================================================================
+
+juce::File PluginCatalog::getCustomScanPathsFile() const
+{
+    return PlatformPaths::getPluginCacheDirectory().getChildFile("custom-scan-paths.json");
+}
+
+void PluginCatalog::saveCustomScanPaths()
+{
+    auto file = getCustomScanPathsFile();
+    file.getParentDirectory().createDirectory();
+
+    juce::Array<juce::var> arr;
+    for (const auto& p : customScanPaths)
+    {
+        auto* obj = new juce::DynamicObject();
+        obj->setProperty("path", p.path);
+        obj->setProperty("format", p.format);
+        arr.add(juce::var(obj));
+    }
+
+    auto jsonStr = juce::JSON::toString(juce::var(arr));
+    file.replaceWithText(jsonStr);
+}
+
+void PluginCatalog::loadCustomScanPaths()
+{
+    auto file = getCustomScanPathsFile();
+    if (!file.existsAsFile())
+        return;
+
+    auto parsed = juce::JSON::parse(file.loadFileAsString());
+    if (!parsed.isArray())
+        return;
+
+    customScanPaths.clear();
+    for (int i = 0; i < parsed.size(); ++i)
+    {
+        auto entry = parsed[i];
+        CustomScanPath p;
+        p.path = entry.getProperty("path", "").toString();
+        p.format = entry.getProperty("format", "").toString();
+        if (p.path.isNotEmpty() && p.format.isNotEmpty())
+            customScanPaths.push_back(p);
+    }
+
+    #if JUCE_DEBUG
+    std::cerr << "Loaded " << customScanPaths.size() << " custom scan paths" << std::endl;
+    #endif
+}
+
+juce::var PluginCatalog::getCustomScanPathsAsJson() const
+{
+    auto* result = new juce::DynamicObject();
+    juce::Array<juce::var> pathsArray;
+
+    // Add default paths for each format
+    for (int i = 0; i < formatManager.getNumFormats(); ++i)
+    {
+        auto* format = formatManager.getFormat(i);
+        auto defaultPaths = format->getDefaultLocationsToSearch();
+
+        // Handle AU fallback
+        if (defaultPaths.getNumPaths() == 0 && format->getName() == "AudioUnit")
+        {
+            defaultPaths.add(juce::File("/Library/Audio/Plug-Ins/Components"));
+            defaultPaths.add(juce::File::getSpecialLocation(juce::File::userHomeDirectory)
+                .getChildFile("Library/Audio/Plug-Ins/Components"));
+        }
+
+        for (int j = 0; j < defaultPaths.getNumPaths(); ++j)
+        {
+            auto* obj = new juce::DynamicObject();
+            obj->setProperty("path", defaultPaths[j].getFullPathName());
+            obj->setProperty("format", format->getName());
+            obj->setProperty("isDefault", true);
+            pathsArray.add(juce::var(obj));
+        }
+    }
+
+    // Add custom paths
+    for (const auto& p : customScanPaths)
+    {
+        auto* obj = new juce::DynamicObject();
+        obj->setProperty("path", p.path);
+        obj->setProperty("format", p.format);
+        obj->setProperty("isDefault", false);
+        pathsArray.add(juce::var(obj));
+    }
+
+    result->setProperty("paths", pathsArray);
+    return juce::var(result);
+}
+
+bool PluginCatalog::addCustomScanPath(const juce::String& path, const juce::String& format)
+{
+    // Validate directory exists
+    juce::File dir(path);
+    if (!dir.isDirectory())
+        return false;
+
+    // Validate format
+    if (format != "VST3" && format != "AudioUnit" && format != "All")
+        return false;
+
+    // Check for duplicates
+    for (const auto& existing : customScanPaths)
+    {
+        if (existing.path == path && existing.format == format)
+            return false;
+    }
+
+    customScanPaths.push_back({ path, format });
+    saveCustomScanPaths();
+    updatePathWatcher();
+
+    #if JUCE_DEBUG
+    std::cerr << "Added custom scan path: " << path << " (" << format << ")" << std::endl;
+    #endif
+
+    return true;
+}
+
+bool PluginCatalog::removeCustomScanPath(const juce::String& path, const juce::String& format)
+{
+    for (auto it = customScanPaths.begin(); it != customScanPaths.end(); ++it)
+    {
+        if (it->path == path && it->format == format)
+        {
+            customScanPaths.erase(it);
+            saveCustomScanPaths();
+            updatePathWatcher();
+
+            #if JUCE_DEBUG
+            std::cerr << "Removed custom scan path: " << path << " (" << format << ")" << std::endl;
+            #endif
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//==============================================================================
+// Plugin Deactivation
+//==============================================================================
+
+juce::File PluginCatalog::getDeactivatedPluginsFile() const
+{
+    return PlatformPaths::getPluginCacheDirectory().getChildFile("deactivated-plugins.txt");
+}
+
+void PluginCatalog::saveDeactivatedList()
+{
+    auto file = getDeactivatedPluginsFile();
+    file.getParentDirectory().createDirectory();
+    file.replaceWithText(deactivatedPlugins.joinIntoString("\n"));
+}
+
+void PluginCatalog::loadDeactivatedList()
+{
+    auto file = getDeactivatedPluginsFile();
+    if (!file.existsAsFile())
+        return;
+
+    juce::StringArray lines;
+    file.readLines(lines);
+
+    deactivatedPlugins.clear();
+    for (const auto& line : lines)
+    {
+        if (line.trim().isNotEmpty())
+            deactivatedPlugins.add(line.trim());
+    }
+
+    #if JUCE_DEBUG
+    std::cerr << "Loaded " << deactivatedPlugins.size() << " deactivated plugins" << std::endl;
+    #endif
+}
+
+bool PluginCatalog::isDeactivated(const juce::String& identifier) const
+{
+    return deactivatedPlugins.contains(identifier);
+}
+
+bool PluginCatalog::deactivatePlugin(const juce::String& identifier)
+{
+    if (deactivatedPlugins.contains(identifier))
+        return true;  // Already deactivated
+
+    // Verify the plugin exists in known plugins
+    auto known = getSnapshot()->findByIdentifier(identifier);
+    if (!known || known->fileOrIdentifier != identifier)
+        return false;
+
+    deactivatedPlugins.add(identifier);
+    saveDeactivatedList();
+
+    #if JUCE_DEBUG
+    std::cerr << "Deactivated plugin: " << identifier << std::endl;
+    #endif
+
+    publishSnapshot();
+    listeners.call([](Listener& l) { l.deactivationChanged(); });
+
+    return true;
+}
+
+bool PluginCatalog::reactivatePlugin(const juce::String& identifier)
+{
+    int idx = deactivatedPlugins.indexOf(identifier);
+    if (idx < 0)
+        return false;  // Not deactivated
+
+    deactivatedPlugins.remove(idx);
+    saveDeactivatedList();
+
+    #if JUCE_DEBUG
+    std::cerr << "Reactivated plugin: " << identifier << std::endl;
+    #endif
+
+    publishSnapshot();
+    listeners.call([](Listener& l) { l.deactivationChanged(); });
+
+    return true;
+}
+
+juce::var PluginCatalog::getDeactivatedPluginsAsJson() const
+{
+    juce::Array<juce::var> arr;
+    auto known = getSnapshot();
+
+    for (const auto& identifier : deactivatedPlugins)
+    {
+        // Look up metadata from the known plugins
+        auto desc = known->findByIdentifier(identifier);
+        if (!desc || desc->fileOrIdentifier != identifier)
+            continue;
+
+        auto* obj = new juce::DynamicObject();
+        obj->setProperty("identifier", desc->fileOrIdentifier);
+        obj->setProperty("name", desc->name);
+        obj->setProperty("manufacturer", desc->manufacturerName);
+        obj->setProperty("format", desc->pluginFormatName);
+        arr.add(juce::var(obj));
+    }
+
+    return juce::var(arr);
+}
+
+bool PluginCatalog::removeKnownPlugin(const juce::String& identifier)
+{
+    ensureLiveListLoaded();
+
+    // Find and remove the plugin from knownPlugins
+    bool removed = false;
+    auto types = knownPlugins.getTypes();
+
+    for (int i = 0; i < static_cast<int>(types.size()); ++i)
+    {
+        if (types[i].fileOrIdentifier == identifier)
+        {
+            const auto key = types[i].createIdentifierString();
+            if (profiles->count(key) > 0)
+            {
+                editProfiles([&](ProfileMap& map) { map.erase(key); });
+                saveProfiles();
+            }
+
+            knownPlugins.removeType(types[i]);
+            removed = true;
+            break;
+        }
+    }
+
+    if (!removed)
+        return false;
+
+    // Also remove from deactivated list if present
+    int deactIdx = deactivatedPlugins.indexOf(identifier);
+    if (deactIdx >= 0)
+        deactivatedPlugins.remove(deactIdx);
+
+    savePluginList();
+    saveDeactivatedList();
+    publishSnapshot();
+
+    #if JUCE_DEBUG
+    std::cerr << "Removed known plugin: " << identifier << std::endl;
+    #endif
+
+    return true;
+}
+
+juce::var PluginCatalog::getPluginListIncludingDeactivatedAsJson() const
+{
+    juce::Array<juce::var> pluginArray;
+    auto known = getSnapshot();
+
+    for (const auto& desc : known->getTypes())
+    {
+        // Still filter out instruments (same as getPluginListAsJson)
+        bool isLikelyInstrument = desc.isInstrument || desc.numInputChannels == 0;
+        if (isLikelyInstrument)
+            continue;
+
+        auto* obj = new juce::DynamicObject();
+        obj->setProperty("id", desc.createIdentifierString());
+        obj->setProperty("name", desc.name);
+        obj->setProperty("manufacturer", desc.manufacturerName);
+        obj->setProperty("category", desc.category);
+        obj->setProperty("format", desc.pluginFormatName);
+        obj->setProperty("uid", desc.uniqueId);
+        obj->setProperty("fileOrIdentifier", desc.fileOrIdentifier);
+        obj->setProperty("isInstrument", desc.isInstrument);
+        obj->setProperty("numInputChannels", desc.numInputChannels);
+        obj->setProperty("numOutputChannels", desc.numOutputChannels);
+        obj->setProperty("version", desc.version);
+        obj->setProperty("isDeactivated", deactivatedPlugins.contains(desc.fileOrIdentifier));
+        if (auto* profile = known->findProfile(desc))
+            obj->setProperty("profile", profile->toVar());
+        pluginArray.add(juce::var(obj));
+    }
+
+    return juce::var(pluginArray);
+}
+
+//==============================================================================
+// Plugin Profiles
+//==============================================================================
+
+juce::File PluginCatalog::getProfilesFile() const
+{
+    return PlatformPaths::getPluginCacheDirectory().getChildFile("plugin-profiles.json");
+}
+
+void PluginCatalog::setBenchmarkDuringScan(bool shouldBenchmark)
+{
+    if (benchmarkDuringScan.exchange(shouldBenchmark) != shouldBenchmark)
+        saveProfiles();
+}
+
+void PluginCatalog::editProfiles(const std::function<void(ProfileMap&)>& edit)
+{
+    auto next = std::make_shared<ProfileMap>(*profiles);
+    edit(*next);
+    profiles = std::move(next);
+}
+
+void PluginCatalog::saveProfiles()
+{
+    auto file = getProfilesFile();
+    file.getParentDirectory().createDirectory();
+
+    auto* byIdentifier = new juce::DynamicObject();
+    for (const auto& [identifier, profile] : *profiles)
+        byIdentifier->setProperty(identifier, profile.toVar());
+
+    auto* obj = new juce::DynamicObject();
+    obj->setProperty("benchmarkDuringScan", benchmarkDuringScan.load());
+    obj->setProperty("profiles", juce::var(byIdentifier));
+
+    file.replaceWithText(juce::JSON::toString(juce::var(obj)));
+}
+
+void PluginCatalog::loadProfiles()
+{
+    auto file = getProfilesFile();
+    if (!file.existsAsFile())
+        return;
+
+    auto parsed = juce::JSON::parse(file.loadFileAsString());
+    if (parsed.isVoid())
+        return;
+
+    benchmarkDuringScan.store(static_cast<bool>(parsed.getProperty("benchmarkDuringScan", false)));
+
+    auto loaded = std::make_shared<ProfileMap>();
+    if (auto* byIdentifier = parsed.getProperty("profiles", {}).getDynamicObject())
+    {
+        for (const auto& entry : byIdentifier->getProperties())
+        {
+            auto profile = PluginProfile::fromVar(entry.value);
+            if (profile.isValid())
+                (*loaded)[entry.name.toString()] = std::move(profile);
+        }
+    }
+    profiles = std::move(loaded);
+
+    #if JUCE_DEBUG
+    std::cerr << "Loaded " << profiles->size() << " plugin profiles" << std::endl;
+    #endif
+}
+
+//==============================================================================
+// Auto-Scan Detection
+//==============================================================================
+
+juce::File PluginCatalog::getAutoScanSettingsFile() const
+{
+    return PlatformPaths::getPluginCacheDirectory().getChildFile("auto-scan-settings.json");
+}
+
+void PluginCatalog::saveAutoScanSettings()
+{
+    auto file = getAutoScanSettingsFile();
+    file.getParentDirectory().createDirectory();
+
+    auto* obj = new juce::DynamicObject();
+    obj->setProperty("enabled", autoScanEnabled);
+    obj->setProperty("intervalMs", autoScanIntervalMs);
+    obj->setProperty("lastCheckTime", lastAutoScanCheckTime);
+
+    auto jsonStr = juce::JSON::toString(juce::var(obj));
+    file.replaceWithText(jsonStr);
+}
+
+void PluginCatalog::loadAutoScanSettings()
+{
+    auto file = getAutoScanSettingsFile();
+    if (!file.existsAsFile())
+        return;
+
+    auto parsed = juce::JSON::parse(file.loadFileAsString());
+    if (parsed.isVoid())
+        return;
+
+    autoScanEnabled = static_cast<bool>(parsed.getProperty("enabled", false));
+    autoScanIntervalMs = static_cast<int>(parsed.getProperty("intervalMs", 300000));
+    lastAutoScanCheckTime = static_cast<juce::int64>(parsed.getProperty("lastCheckTime", 0));
+
+    // Restart timer if it was enabled
+    if (autoScanEnabled && autoScanIntervalMs > 0)
+        autoScanTimer.startTimer(autoScanIntervalMs);
+    updatePathWatcher();
+
+    #if JUCE_DEBUG
+    std::cerr << "Loaded auto-scan settings: enabled=" << (autoScanEnabled ? "true" : "false")
+              << " interval=" << autoScanIntervalMs << "ms" << std::endl;
+    #endif
+}
+
+bool PluginCatalog::enableAutoScan(int intervalMs)
+{
+    if (intervalMs < 10000)  // Minimum 10 seconds
+        return false;
+
+    autoScanEnabled = true;
+    autoScanIntervalMs = intervalMs;
+    autoScanTimer.startTimer(intervalMs);
+    saveAutoScanSettings();
+    updatePathWatcher();
+
+    #if JUCE_DEBUG
+    std::cerr << "Auto-scan enabled: interval=" << intervalMs << "ms" << std::endl;
+    #endif
+
+    listeners.call([](Listener& l) { l.autoScanStateChanged(); });
+
+    return true;
+}
+
+bool PluginCatalog::disableAutoScan()
+{
+    autoScanEnabled = false;
+    autoScanTimer.stopTimer();
+    saveAutoScanSettings();
+    updatePathWatcher();
+
+    #if JUCE_DEBUG
+    std::cerr << "Auto-scan disabled" << std::endl;
+    #endif
+
+    listeners.call([](Listener& l) { l.autoScanStateChanged(); });
+
+    return true;
+}
+
+juce::var PluginCatalog::getAutoScanStateAsJson() const
+{
+    auto* obj = new juce::DynamicObject();
+    obj->setProperty("enabled", autoScanEnabled);
+    obj->setProperty("intervalMs", autoScanIntervalMs);
+    obj->setProperty("lastCheckTime", lastAutoScanCheckTime);
+    return juce::var(obj);
+}
+
+juce::var PluginCatalog::checkForNewPlugins()
+{
+    juce::Array<juce::var> newPluginsArray;
+
+    for (const auto& candidate : findPluginsNeedingScan())
+    {
+        auto* obj = new juce::DynamicObject();
+        obj->setProperty("path", candidate.path);
+        obj->setProperty("format", candidate.formatName);
+        obj->setProperty("changed", candidate.changed);
+        newPluginsArray.add(juce::var(obj));
+    }
+
+    lastAutoScanCheckTime = juce::Time::currentTimeMillis();
+    saveAutoScanSettings();
+
+    auto* result = new juce::DynamicObject();
+    result->setProperty("newCount", newPluginsArray.size());
+    result->setProperty("newPlugins", newPluginsArray);
+    return juce::var(result);
+}
+
+void PluginCatalog::AutoScanTimer::timerCallback()
+{
+    // Watched paths report installs as they happen; the periodic walk is only a safety net
+    if (catalog.pathWatcher != nullptr && catalog.pathWatcher->isWatching()
+        && ++catalog.autoScanTicksSinceWalk < kWatchedWalkEvery)
+        return;
+
+    catalog.runAutoScanCheck();
+}
+
+void PluginCatalog::runAutoScanCheck()
+{
+    // Don't check if a scan is already in progress
+    if (scanning.load())
+        return;
+
+    autoScanTicksSinceWalk = 0;
+    auto result = checkForNewPlugins();
+    int count = static_cast<int>(result.getProperty("newCount", 0));
+
+    if (count > 0)
+    {
+        #if JUCE_DEBUG
+        std::cerr << "Auto-scan detected " << count << " new plugin(s)" << std::endl;
+        #endif
+
+        auto plugins = result.getProperty("newPlugins", juce::var());
+        listeners.call([&](Listener& l) { l.newPluginsDetected(count, plugins); });
+    }
+}
+
+void PluginCatalog::updatePathWatcher()
+{
+    if (!autoScanEnabled)
+    {
+        pathWatcher.reset();
+        return;
+    }
+
+    juce::Array<juce::File> directories;
+    for (int i = 0; i < formatManager.getNumFormats(); ++i)
+    {
+        auto searchPaths = getSearchPathsForFormat(formatManager.getFormat(i));
+        for (int j = 0; j < searchPaths.getNumPaths(); ++j)
+            directories.addIfNotAlreadyThere(searchPaths[j]);
+    }
+
+    if (pathWatcher == nullptr)
+    {
+        pathWatcher = std::make_unique<ScanPathWatcher>();
+        pathWatcher->onChange = [this] { runAutoScanCheck(); };
+    }
+    pathWatcher->setPaths(directories);
+}
@@ -0,0 +1,349 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include "PluginCatalogImage.h"
+#include "PluginPrewarmer.h"
+#include "PluginProfile.h"
+#include "ScanPathWatcher.h"
+#include "ScanScheduler.h"
+#include "ScanStateCache.h"
+#include "ScannerWorkerClient.h"
+#include <functional>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+/**
+ * PluginCatalog - The process-wide plugin list, blacklist and scanner
+ *
+ * Used via juce::SharedResourcePointer<PluginCatalog> (like InstanceRegistry): the first
+ * PluginManager creates it and parses the cache files once; the last one to go destroys
+ * it. Every instance in a session shares one KnownPluginList, one scan and one auto-scan
+ * timer instead of each loading and keeping its own.
+ *
+ * All mutation happens on the message thread. After each change the catalog publishes
+ * an immutable, versioned Snapshot of the known types, blacklist and deactivated list;
+ * readers load it atomically and never touch the KnownPluginList, so lookups don't copy
+ * thousands of descriptions the way KnownPluginList::getTypes() does. The types live in a
+ * PluginCatalogImage; the same bytes are saved next to the XML cache and memory-mapped at
+ * startup, so the KnownPluginList itself is only filled in once something needs to edit
+ * it or scan (ensureLiveListLoaded()).
+ *
+ * Listener callbacks arrive on the message thread. pluginCatalogChanged() is coalesced:
+ * one call per batch of changes, carrying the snapshot that was current when it ran.
+ * Scan events (progress, completion, blacklisting) go to every listener as they happen.
+ */
+class PluginCatalog : public juce::ChangeListener,
+                      public juce::Timer,
+                      private juce::AsyncUpdater
+{
+public:
+    PluginCatalog();
+    ~PluginCatalog() noexcept override;
+
+    // ============================================
+    // Snapshots
+    // ============================================
+
+    /** Benchmark results by PluginDescription::createIdentifierString(). */
+    using ProfileMap = std::map<juce::String, PluginProfile>;
+
+    struct Snapshot
+    {
+        uint64_t version = 0;
+        std::shared_ptr<const PluginCatalogImage> image;   // Known types with their hash indexes
+        juce::StringArray blacklist;
+        juce::StringArray deactivated;
+        std::shared_ptr<const ProfileMap> profiles;
+
+        int getNumTypes() const { return image != nullptr ? image->size() : 0; }
+
+        /** Every known type, materialized from the image on first use. */
+        const std::vector<juce::PluginDescription>& getTypes() const;
+
+        /** By fileOrIdentifier or createIdentifierString(). */
+        std::optional<juce::PluginDescription> findByIdentifier(const juce::String& identifier) const;
+
+        /** Cross-format fallback: first type with this name and manufacturer (case-insensitive). */
+        std::optional<juce::PluginDescription> findByNameAndManufacturer(const juce::String& name,
+                                                                         const juce::String& manufacturer) const;
+
+        std::vector<juce::PluginDescription> findByUniqueId(int uniqueId) const;
+        std::vector<juce::PluginDescription> findByManufacturer(const juce::String& manufacturer) const;
+        std::vector<juce::PluginDescription> findByCategory(const juce::String& category) const;
+
+        /** Measured cost of a type, if it has been benchmarked. */
+        const PluginProfile* findProfile(const juce::PluginDescription& desc) const;
+
+        /** The UI's effect list (no instruments, no deactivated), built once per snapshot. */
+        const juce::var& getPluginListJson() const;
+
+    private:
+        std::vector<juce::PluginDescription> describe(const std::vector<int>& indexes) const;
+
+        mutable std::once_flag typesBuilt, jsonBuilt;
+        mutable std::vector<juce::PluginDescription> types;
+        mutable juce::var pluginListJson;
+    };
+
+    /** Current published snapshot (never null). Lock-free for readers. */
+    std::shared_ptr<const Snapshot> getSnapshot() const;
+
+    class Listener
+    {
+    public:
+        virtual ~Listener() = default;
+        /** Known types, blacklist or deactivated list changed (coalesced). */
+        virtual void pluginCatalogChanged(const Snapshot&) {}
+        virtual void scanProgressChanged(float, const juce::String&) {}
+        virtual void scanFinished() {}
+        virtual void pluginBlacklisted(const juce::String&, ScanFailureReason) {}
+        virtual void deactivationChanged() {}
+        virtual void newPluginsDetected(int, const juce::var&) {}
+        virtual void autoScanStateChanged() {}
+    };
+
+    void addListener(Listener* listener);
+    void removeListener(Listener* listener);
+
+    // Scanning
+    void startScan(bool rescanAll = false);
+    void stopScan();
+    bool isScanning() const { return scanning.load(); }
+    float getScanProgress() const { return scanProgress.load(); }
+    juce::String getCurrentlyScanning() const;
+
+    /** Scanner helpers run at once (0 = one per core). Applies from the next scan. */
+    void setScanConcurrency(int numHelpers) { scanConcurrency = juce::jmax(0, numHelpers); }
+    int getScanConcurrency() const { return scanConcurrency; }
+
+    /** Have the scanner helper profile each plugin after scanning it (persisted). */
+    void setBenchmarkDuringScan(bool shouldBenchmark);
+    bool isBenchmarkingDuringScan() const { return benchmarkDuringScan.load(); }
+
+    // Plugin access — the live list is message-thread only; prefer getSnapshot() for reads
+    juce::KnownPluginList& getKnownPlugins() { ensureLiveListLoaded(); return knownPlugins; }
+    const juce::KnownPluginList& getKnownPlugins() const { const_cast<PluginCatalog*>(this)->ensureLiveListLoaded(); return knownPlugins; }
+
+    std::unique_ptr<juce::AudioPluginInstance> createPluginInstance(
+        const juce::PluginDescription& desc,
+        double sampleRate,
+        int blockSize,
+        juce::String& errorMessage);
+
+    std::optional<juce::PluginDescription> findPluginByIdentifier(const juce::String& identifier) const;
+
+    // ============================================
+    // Prewarming
+    // ============================================
+
+    /** Count an instantiation towards the plugins warmed at the next startup. Any thread. */
+    void recordPluginUse(const juce::PluginDescription& desc) { prewarmer.recordUse(desc); }
+
+    /** Real work started (a plugin load, a scan) — stop warming for this session. Any thread. */
+    void cancelPrewarming() { prewarmer.cancel(); }
+
+    juce::var getPrewarmStatusAsJson() const { return prewarmer.getStatusAsJson(); }
+    void setPrewarmSettings(const PluginPrewarmer::Settings& settings) { prewarmer.setSettings(settings); }
+    const PluginPrewarmer::Settings& getPrewarmSettings() const { return prewarmer.getSettings(); }
+
+    // JSON export for React UI
+    juce::var getPluginListAsJson() const;
+
+    // Blacklist management - allows users to skip problematic plugins
+    void addToBlacklist(const juce::String& pluginPath);
+    void removeFromBlacklist(const juce::String& pluginPath);
+    juce::StringArray getBlacklistedPlugins() const;
+    bool isBlacklisted(const juce::String& pluginPath) const;
+    void clearBlacklist();
+    juce::var getBlacklistAsJson() const;
+
+    // ============================================
+    // Custom Scan Paths
+    // ============================================
+    juce::var getCustomScanPathsAsJson() const;
+    bool addCustomScanPath(const juce::String& path, const juce::String& format);
+    bool removeCustomScanPath(const juce::String& path, const juce::String& format);
+
+    // ============================================
+    // Plugin Deactivation
+    // ============================================
+    bool deactivatePlugin(const juce::String& identifier);
+    bool reactivatePlugin(const juce::String& identifier);
+    juce::var getDeactivatedPluginsAsJson() const;
+    bool removeKnownPlugin(const juce::String& identifier);
+    juce::var getPluginListIncludingDeactivatedAsJson() const;
+    bool isDeactivated(const juce::String& identifier) const;
+
+    // ============================================
+    // Auto-Scan Detection
+    // ============================================
+    bool enableAutoScan(int intervalMs);
+    bool disableAutoScan();
+    juce::var getAutoScanStateAsJson() const;
+    juce::var checkForNewPlugins();
+
+    // Persistence
+    void savePluginList();
+    void loadPluginList();
+
+private:
+    void changeListenerCallback(juce::ChangeBroadcaster* source) override;
+    void timerCallback() override;
+    void handleAsyncUpdate() override;
+    void initializeScan();
+    void finishScan();
+
+    /** Rebuild the snapshot from the live state and queue a coalesced notification. */
+    void publishSnapshot();
+
+    /** Fill knownPlugins from the mapped cache image, if startup skipped that. */
+    void ensureLiveListLoaded();
+
+    // Blacklist persistence
+    void saveBlacklist();
+    void loadBlacklist();
+    void checkForCrashedPlugin();
+
+    // Custom scan paths persistence
+    void saveCustomScanPaths();
+    void loadCustomScanPaths();
+
+    // Deactivation persistence
+    void saveDeactivatedList();
+    void loadDeactivatedList();
+
+    // Auto-scan persistence
+    void saveAutoScanSettings();
+    void loadAutoScanSettings();
+    void runAutoScanCheck();
+    void updatePathWatcher();
+
+    // Plugin profiles persistence
+    void saveProfiles();
+    void loadProfiles();
+
+    /** Copy-on-write edit of the profiles (snapshots keep the map they were built with). */
+    void editProfiles(const std::function<void(ProfileMap&)>& edit);
+
+    juce::KnownPluginList knownPlugins;
+    juce::AudioPluginFormatManager formatManager;
+
+    // Startup loads the binary cache into coldImage and leaves knownPlugins empty until needed
+    bool liveListLoaded = true;
+    std::shared_ptr<const PluginCatalogImage> coldImage;
+
+    // Published snapshot — read with std::atomic_load, written on the message thread with std::atomic_store
+    std::shared_ptr<const Snapshot> snapshot = std::make_shared<Snapshot>();
+    uint64_t nextSnapshotVersion = 1;
+
+    juce::ListenerList<Listener> listeners;
+
+    std::atomic<bool> scanning { false };
+    std::atomic<bool> shouldStopScan { false };
+    std::atomic<float> scanProgress { 0.0f };
+    juce::String currentlyScanning;
+    mutable std::mutex scanMutex;
+
+    // Main-thread scanner state
+    std::unique_ptr<juce::PluginDirectoryScanner> currentScanner;
+    int currentFormatIndex = 0;
+    int currentPathIndex = 0;
+    juce::FileSearchPath currentSearchPaths;
+
+    // Out-of-process scanning
+    std::vector<ScanScheduler::Job> pluginsToScan;
+    bool useOutOfProcessScanning = true;
+    int scanConcurrency = 0;              // 0 = ScanScheduler::getDefaultConcurrency()
+    juce::StringArray scanSuspects;       // In flight together when the last session died
+    std::atomic<bool> benchmarkDuringScan { false };
+
+    std::shared_ptr<const ProfileMap> profiles = std::make_shared<ProfileMap>();
+
+    juce::File getCacheFile() const;
+    juce::File getBinaryCacheFile() const;
+    juce::File getBlacklistFile() const;
+    juce::File getDeadMansPedalFile() const;
+    juce::File getScannerHelperPath() const;
+    juce::File getCustomScanPathsFile() const;
+    juce::File getDeactivatedPluginsFile() const;
+    juce::File getAutoScanSettingsFile() const;
+    juce::File getScanStateFile() const;
+    juce::File getProfilesFile() const;
+    juce::FileSearchPath getSearchPathsForFormat(juce::AudioPluginFormat* format) const;
+
+    // Out-of-process scanning methods
+    void collectPluginsToScan();
+    void mergeScanResults();
+
+    // Incremental rescans: search-path files that are new, changed, or unknown. Moved
+    // bundles are re-pointed in the known list here rather than returned.
+    struct ScanCandidate
+    {
+        juce::String formatName;
+        juce::String path;
+        bool changed = false;     // Known, but modified since it was scanned
+    };
+    std::vector<ScanCandidate> findPluginsNeedingScan();
+    bool moveKnownPlugin(const juce::String& from, const juce::String& to);
+    void removeTypesForFile(const juce::String& path);
+
+    ScanStateCache scanStateCache;
+
+    ScanScheduler::Result scanPluginWithHelper(const juce::String& formatName, const juce::String& pluginPath) const;
+
+    // Background scanning state — helpers run on the scheduler's workers, results are
+    // merged here on the message thread
+    std::unique_ptr<ScanScheduler> scanScheduler;
+
+    // One persistent helper per scheduler worker (falls back to a helper per plugin)
+    std::vector<std::unique_ptr<ScannerWorkerClient>> scannerWorkers;
+
+    // Custom scan paths: vector of {path, format} pairs
+    struct CustomScanPath
+    {
+        juce::String path;
+        juce::String format;  // "VST3", "AudioUnit", or "All"
+    };
+    std::vector<CustomScanPath> customScanPaths;
+
+    // Deactivated plugins (identifiers)
+    juce::StringArray deactivatedPlugins;
+
+    // Auto-scan timer (separate from the scan timer used during scanning)
+    class AutoScanTimer : public juce::Timer
+    {
+    public:
+        AutoScanTimer(PluginCatalog& c) : catalog(c) {}
+        void timerCallback() override;
+    private:
+        PluginCatalog& catalog;
+    };
+    AutoScanTimer autoScanTimer { *this };
+    bool autoScanEnabled = false;
+    int autoScanIntervalMs = 300000;  // default 5 minutes
+    juce::int64 lastAutoScanCheckTime = 0;
+
+    // While the search paths are watched, ticks only walk them every kWatchedWalkEvery
+    // (catches in-place binary updates, which happen inside bundles we don't watch)
+    std::unique_ptr<ScanPathWatcher> pathWatcher;
+    int autoScanTicksSinceWalk = 0;
+    static constexpr int kWatchedWalkEvery = 12;
+
+    // Prewarm candidates come from the snapshot and load through createPluginInstance()
+    // above, so they don't cancel themselves. Declared last: it stops before anything it
+    // uses is destroyed.
+    std::optional<juce::PluginDescription> findPrewarmCandidate(const juce::String& identifier) const;
+    PluginPrewarmer prewarmer {
+        [this](const juce::String& identifier) { return findPrewarmCandidate(identifier); },
+        [this](const juce::PluginDescription& desc) {
+            juce::String errorMessage;
+            return createPluginInstance(desc, 44100.0, 512, errorMessage);
+        }
+    };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PluginCatalog)
+};
@@ -0,0 +1,426 @@
+#include "PluginCatalogImage.h"
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+//==============================================================================
+// Layout
+//==============================================================================
+
+namespace
+{
+    constexpr juce::uint32 kMagic = 0x31434350;   // "PCC1"
+    constexpr juce::uint32 kVersion = 1;
+
+    // Hash tables, in file order
+    enum : int { kByIdentifierString, kByFileOrIdentifier, kByUniqueId, kByManufacturer, kByCategory, kNumIndexes };
+
+    // String fields of a record
+    enum : int { kNameString, kDescriptiveNameString, kFormatString, kCategoryString, kManufacturerString,
+                 kVersionString, kFileOrIdentifierString, kIdentifierText, kNumStrings };
+
+    constexpr juce::uint32 kIsInstrument = 1, kHasSharedContainer = 2, kHasARAExtension = 4;
+
+    juce::uint32 fnv1a(const char* bytes, size_t numBytes) noexcept
+    {
+        juce::uint32 hash = 2166136261u;
+        for (size_t i = 0; i < numBytes; ++i)
+        {
+            hash ^= static_cast<juce::uint8>(bytes[i]);
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+    juce::uint32 hashString(const juce::String& s) noexcept
+    {
+        return fnv1a(s.toRawUTF8(), s.getNumBytesAsUTF8());
+    }
+
+    juce::uint32 hashIgnoreCase(const juce::String& s) noexcept
+    {
+        return hashString(s.toLowerCase());
+    }
+
+    juce::uint32 hashInt(int value) noexcept
+    {
+        return fnv1a(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    juce::uint32 alignUp(juce::uint32 value, juce::uint32 alignment) noexcept
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+}
+
+struct PluginCatalogImage::Header
+{
+    juce::uint32 magic;
+    juce::uint32 version;
+    juce::uint32 numRecords;
+    juce::uint32 numBuckets;        // Per table, power of two
+    juce::uint32 recordsOffset;
+    juce::uint32 stringsOffset;
+    juce::uint32 stringsSize;
+    juce::uint32 indexesOffset;     // kNumIndexes tables of numBuckets entries
+    juce::uint32 totalSize;
+    juce::uint32 reserved[7];
+};
+
+struct PluginCatalogImage::Record
+{
+    juce::uint32 strings[kNumStrings];    // Offsets into the string pool
+    juce::int64 lastFileModTime;
+    juce::int64 lastInfoUpdateTime;
+    juce::int32 deprecatedUid;
+    juce::int32 uniqueId;
+    juce::int32 numInputChannels;
+    juce::int32 numOutputChannels;
+    juce::uint32 flags;
+    juce::uint32 next[kNumIndexes];       // Next record + 1 in the same bucket, 0 = end of chain
+};
+
+//==============================================================================
+// Building
+//==============================================================================
+
+std::shared_ptr<const PluginCatalogImage> PluginCatalogImage::build(const juce::Array<juce::PluginDescription>& types)
+{
+    static_assert(sizeof(Header) == 64, "Header layout changed");
+    static_assert(sizeof(Record) == 88, "Record layout changed");
+
+    const auto n = static_cast<juce::uint32>(types.size());
+
+    // Load factor <= 0.5 per table; a power of two so buckets are a mask away
+    juce::uint32 numBuckets = 16;
+    while (numBuckets < n * 2)
+        numBuckets <<= 1;
+
+    // String pool, deduplicated — formats, vendors and categories repeat a lot.
+    // Each entry: uint32 byte count, bytes, NUL. Offset 0 is the empty string.
+    juce::MemoryOutputStream pool;
+    std::unordered_map<std::string, juce::uint32> pooled;
+    auto addString = [&](const juce::String& s) -> juce::uint32 {
+        std::string bytes(s.toRawUTF8(), s.getNumBytesAsUTF8());
+        auto it = pooled.find(bytes);
+        if (it != pooled.end())
+            return it->second;
+
+        const auto offset = static_cast<juce::uint32>(pool.getDataSize());
+        const auto length = static_cast<juce::uint32>(bytes.size());
+        pool.write(&length, sizeof(length));
+        pool.write(bytes.data(), bytes.size());
+        pool.writeByte(0);
+        pooled.emplace(std::move(bytes), offset);
+        return offset;
+    };
+    addString({});
+
+    std::vector<Record> records(n);
+    std::vector<juce::uint32> hashes(static_cast<size_t>(n) * kNumIndexes);
+
+    for (juce::uint32 i = 0; i < n; ++i)
+    {
+        const auto& desc = types.getReference(static_cast<int>(i));
+        auto& r = records[i];
+
+        const auto identifierString = desc.createIdentifierString();
+        r.strings[kNameString] = addString(desc.name);
+        r.strings[kDescriptiveNameString] = addString(desc.descriptiveName);
+        r.strings[kFormatString] = addString(desc.pluginFormatName);
+        r.strings[kCategoryString] = addString(desc.category);
+        r.strings[kManufacturerString] = addString(desc.manufacturerName);
+        r.strings[kVersionString] = addString(desc.version);
+        r.strings[kFileOrIdentifierString] = addString(desc.fileOrIdentifier);
+        r.strings[kIdentifierText] = addString(identifierString);
+        r.lastFileModTime = desc.lastFileModTime.toMilliseconds();
+        r.lastInfoUpdateTime = desc.lastInfoUpdateTime.toMilliseconds();
+        r.deprecatedUid = desc.deprecatedUid;
+        r.uniqueId = desc.uniqueId;
+        r.numInputChannels = desc.numInputChannels;
+        r.numOutputChannels = desc.numOutputChannels;
+        r.flags = (desc.isInstrument ? kIsInstrument : 0u)
+                | (desc.hasSharedContainer ? kHasSharedContainer : 0u)
+                | (desc.hasARAExtension ? kHasARAExtension : 0u);
+
+        auto* h = &hashes[static_cast<size_t>(i) * kNumIndexes];
+        h[kByIdentifierString] = hashString(identifierString);
+        h[kByFileOrIdentifier] = hashString(desc.fileOrIdentifier);
+        h[kByUniqueId] = hashInt(desc.uniqueId);
+        h[kByManufacturer] = hashIgnoreCase(desc.manufacturerName);
+        h[kByCategory] = hashIgnoreCase(desc.category);
+    }
+
+    // Chain in reverse so each bucket lists records in list order
+    std::vector<juce::uint32> buckets(static_cast<size_t>(numBuckets) * kNumIndexes, 0);
+    for (juce::uint32 i = n; i-- > 0;)
+    {
+        for (int index = 0; index < kNumIndexes; ++index)
+        {
+            auto& headSlot = buckets[static_cast<size_t>(index) * numBuckets
+                                     + (hashes[static_cast<size_t>(i) * kNumIndexes + static_cast<size_t>(index)] & (numBuckets - 1))];
+            records[i].next[index] = headSlot;
+            headSlot = i + 1;
+        }
+    }
+
+    Header header {};
+    header.magic = kMagic;
+    header.version = kVersion;
+    header.numRecords = n;
+    header.numBuckets = numBuckets;
+    header.recordsOffset = sizeof(Header);
+    header.stringsOffset = header.recordsOffset + n * static_cast<juce::uint32>(sizeof(Record));
+    header.stringsSize = static_cast<juce::uint32>(pool.getDataSize());
+    header.indexesOffset = alignUp(header.stringsOffset + header.stringsSize, 8);
+    header.totalSize = header.indexesOffset + static_cast<juce::uint32>(buckets.size() * sizeof(juce::uint32));
+
+    juce::MemoryBlock block(header.totalSize, true);
+    auto* bytes = static_cast<char*>(block.getData());
+    std::memcpy(bytes, &header, sizeof(Header));
+    if (n > 0)
+        std::memcpy(bytes + header.recordsOffset, records.data(), records.size() * sizeof(Record));
+    std::memcpy(bytes + header.stringsOffset, pool.getData(), pool.getDataSize());
+    std::memcpy(bytes + header.indexesOffset, buckets.data(), buckets.size() * sizeof(juce::uint32));
+
+    auto image = fromMemory(std::move(block));
+    jassert(image != nullptr);
+    return image;
+}
+
+std::shared_ptr<const PluginCatalogImage> PluginCatalogImage::fromMemory(juce::MemoryBlock block)
+{
+    std::shared_ptr<PluginCatalogImage> image(new PluginCatalogImage());
+    image->ownedData = std::move(block);
+    image->data = static_cast<const char*>(image->ownedData.getData());
+    image->numBytes = image->ownedData.getSize();
+    return image->validate() ? image : nullptr;
+}
+
+std::shared_ptr<const PluginCatalogImage> PluginCatalogImage::map(const juce::File& file)
+{
+    if (!file.existsAsFile())
+        return nullptr;
+
+    std::shared_ptr<PluginCatalogImage> image(new PluginCatalogImage());
+    image->mappedFile = std::make_unique<juce::MemoryMappedFile>(file, juce::MemoryMappedFile::readOnly);
+    if (image->mappedFile->getData() == nullptr)
+        return nullptr;
+
+    image->data = static_cast<const char*>(image->mappedFile->getData());
+    image->numBytes = image->mappedFile->getSize();
+    return image->validate() ? image : nullptr;
+}
+
+bool PluginCatalogImage::writeTo(const juce::File& file) const
+{
+    file.getParentDirectory().createDirectory();
+    return file.replaceWithData(data, numBytes);
+}
+
+//==============================================================================
+// Validation — everything lookups will dereference, checked once up front
+//==============================================================================
+
+bool PluginCatalogImage::validate()
+{
+    if (data == nullptr || numBytes < sizeof(Header))
+        return false;
+
+    Header header;
+    std::memcpy(&header, data, sizeof(Header));
+
+    if (header.magic != kMagic || header.version != kVersion || header.totalSize != numBytes)
+        return false;
+    if (header.numBuckets == 0 || (header.numBuckets & (header.numBuckets - 1)) != 0)
+        return false;
+
+    const auto recordsEnd = static_cast<juce::uint64>(header.recordsOffset)
+                          + static_cast<juce::uint64>(header.numRecords) * sizeof(Record);
+    const auto stringsEnd = static_cast<juce::uint64>(header.stringsOffset) + header.stringsSize;
+    const auto indexesEnd = static_cast<juce::uint64>(header.indexesOffset)
+                          + static_cast<juce::uint64>(header.numBuckets) * kNumIndexes * sizeof(juce::uint32);
+
+    if (header.recordsOffset != sizeof(Header) || recordsEnd > header.stringsOffset
+        || stringsEnd > header.indexesOffset || indexesEnd != numBytes
+        || header.indexesOffset % alignof(juce::uint32) != 0 || header.numRecords > 0x7fffffff)
+        return false;
+
+    // Mapped memory is page aligned; owned blocks come from malloc
+    if (reinterpret_cast<uintptr_t>(data) % alignof(Record) != 0)
+        return false;
+
+    numRecords = static_cast<int>(header.numRecords);
+
+    for (int i = 0; i < numRecords; ++i)
+    {
+        const auto& r = record(i);
+        for (auto offset : r.strings)
+        {
+            juce::uint32 length = 0;
+            if (string(offset, length) == nullptr)
+                return false;
+        }
+        // The builder only ever chains forward, so anything else is damage — and a
+        // backward or self link would send a lookup round its bucket forever
+        for (auto next : r.next)
+            if (next > header.numRecords || (next != 0 && next <= static_cast<juce::uint32>(i) + 1))
+                return false;
+    }
+
+    const auto* buckets = reinterpret_cast<const juce::uint32*>(data + header.indexesOffset);
+    for (juce::uint64 b = 0; b < static_cast<juce::uint64>(header.numBuckets) * kNumIndexes; ++b)
+        if (buckets[b] > header.numRecords)
+            return false;
+
+    return true;
+}
+
+//==============================================================================
+// Access
+//==============================================================================
+
+const PluginCatalogImage::Record& PluginCatalogImage::record(int index) const noexcept
+{
+    const auto* header = reinterpret_cast<const Header*>(data);
+    return reinterpret_cast<const Record*>(data + header->recordsOffset)[index];
+}
+
+const char* PluginCatalogImage::string(juce::uint32 offset, juce::uint32& length) const noexcept
+{
+    const auto* header = reinterpret_cast<const Header*>(data);
+    if (static_cast<juce::uint64>(offset) + 4 > header->stringsSize)
+        return nullptr;
+
+    const char* entry = data + header->stringsOffset + offset;
+    std::memcpy(&length, entry, sizeof(length));
+    if (static_cast<juce::uint64>(offset) + 4 + length + 1 > header->stringsSize || entry[4 + length] != 0)
+        return nullptr;
+
+    return entry + 4;
+}
+
+juce::String PluginCatalogImage::getString(juce::uint32 offset) const
+{
+    juce::uint32 length = 0;
+    const char* bytes = string(offset, length);
+    return bytes != nullptr ? juce::String::fromUTF8(bytes, static_cast<int>(length)) : juce::String();
+}
+
+int PluginCatalogImage::head(int index, juce::uint32 hash) const noexcept
+{
+    const auto* header = reinterpret_cast<const Header*>(data);
+    const auto* buckets = reinterpret_cast<const juce::uint32*>(data + header->indexesOffset);
+    return static_cast<int>(buckets[static_cast<size_t>(index) * header->numBuckets + (hash & (header->numBuckets - 1))]) - 1;
+}
+
+juce::PluginDescription PluginCatalogImage::getDescription(int index) const
+{
+    jassert(juce::isPositiveAndBelow(index, numRecords));
+    const auto& r = record(index);
+
+    juce::PluginDescription desc;
+    desc.name = getString(r.strings[kNameString]);
+    desc.descriptiveName = getString(r.strings[kDescriptiveNameString]);
+    desc.pluginFormatName = getString(r.strings[kFormatString]);
+    desc.category = getString(r.strings[kCategoryString]);
+    desc.manufacturerName = getString(r.strings[kManufacturerString]);
+    desc.version = getString(r.strings[kVersionString]);
+    desc.fileOrIdentifier = getString(r.strings[kFileOrIdentifierString]);
+    desc.lastFileModTime = juce::Time(r.lastFileModTime);
+    desc.lastInfoUpdateTime = juce::Time(r.lastInfoUpdateTime);
+    desc.deprecatedUid = r.deprecatedUid;
+    desc.uniqueId = r.uniqueId;
+    desc.numInputChannels = r.numInputChannels;
+    desc.numOutputChannels = r.numOutputChannels;
+    desc.isInstrument = (r.flags & kIsInstrument) != 0;
+    desc.hasSharedContainer = (r.flags & kHasSharedContainer) != 0;
+    desc.hasARAExtension = (r.flags & kHasARAExtension) != 0;
+    return desc;
+}
+
+template <typename Matches>
+std::vector<int> PluginCatalogImage::collect(int index, juce::uint32 hash, Matches&& matches) const
+{
+    std::vector<int> found;
+    for (int i = head(index, hash); i >= 0; i = static_cast<int>(record(i).next[index]) - 1)
+        if (matches(record(i)))
+            found.push_back(i);
+    return found;
+}
+
+int PluginCatalogImage::findByIdentifier(const juce::String& identifier) const
+{
+    if (numRecords == 0)
+        return -1;
+
+    const auto* key = identifier.toRawUTF8();
+    const auto keyLength = identifier.getNumBytesAsUTF8();
+
+    auto exact = [&](juce::uint32 offset) {
+        juce::uint32 length = 0;
+        const char* bytes = string(offset, length);
+        return length == keyLength && std::memcmp(bytes, key, keyLength) == 0;
+    };
+
+    const auto hash = hashString(identifier);
+    int best = -1;
+
+    // Either form may match; the earliest record wins, as with a linear search
+    for (int i = head(kByFileOrIdentifier, hash); i >= 0; i = static_cast<int>(record(i).next[kByFileOrIdentifier]) - 1)
+        if (exact(record(i).strings[kFileOrIdentifierString]))
+        {
+            best = i;
+            break;
+        }
+
+    for (int i = head(kByIdentifierString, hash); i >= 0; i = static_cast<int>(record(i).next[kByIdentifierString]) - 1)
+        if (exact(record(i).strings[kIdentifierText]))
+        {
+            if (best < 0 || i < best)
+                best = i;
+            break;
+        }
+
+    return best;
+}
+
+int PluginCatalogImage::findByNameAndManufacturer(const juce::String& name, const juce::String& manufacturer) const
+{
+    for (int i : findByManufacturer(manufacturer))
+        if (getString(record(i).strings[kNameString]).equalsIgnoreCase(name))
+            return i;
+    return -1;
+}
+
+std::vector<int> PluginCatalogImage::findByUniqueId(int uniqueId) const
+{
+    if (numRecords == 0)
+        return {};
+    return collect(kByUniqueId, hashInt(uniqueId), [uniqueId](const Record& r) { return r.uniqueId == uniqueId; });
+}
+
+std::vector<int> PluginCatalogImage::findByManufacturer(const juce::String& manufacturer) const
+{
+    if (numRecords == 0)
+        return {};
+
+    return collect(kByManufacturer, hashIgnoreCase(manufacturer), [&](const Record& r) {
+        juce::uint32 length = 0;
+        return juce::CharPointer_UTF8(string(r.strings[kManufacturerString], length))
+                   .compareIgnoreCase(manufacturer.getCharPointer()) == 0;
+    });
+}
+
+std::vector<int> PluginCatalogImage::findByCategory(const juce::String& category) const
+{
+    if (numRecords == 0)
+        return {};
+
+    return collect(kByCategory, hashIgnoreCase(category), [&](const Record& r) {
+        juce::uint32 length = 0;
+        return juce::CharPointer_UTF8(string(r.strings[kCategoryString], length))
+                   .compareIgnoreCase(category.getCharPointer()) == 0;
+    });
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <memory>
+#include <vector>
+
+/**
+ * PluginCatalogImage - Compact binary form of the known plugin list, with hash indexes
+ *
+ * One contiguous, position-independent block: a header, fixed-size records, a
+ * deduplicated string pool and five chained hash tables (identifier string,
+ * fileOrIdentifier, unique ID, manufacturer, category — the last two case-insensitive).
+ * The same bytes are what PluginCatalog keeps in memory for each snapshot and what it
+ * writes next to the XML cache, so at startup the file is memory-mapped and served as-is:
+ * lookups hash into the mapped tables and only the descriptions actually asked for are
+ * turned into PluginDescriptions.
+ *
+ * Native byte order (the cache never leaves the machine); a foreign or truncated file
+ * fails validation in map() and the caller falls back to the XML cache.
+ *
+ * Immutable once built, so safe to share between threads.
+ */
+class PluginCatalogImage
+{
+public:
+    /** Serialize a list. Earlier entries win lookups that match several, like a linear search. */
+    static std::shared_ptr<const PluginCatalogImage> build(const juce::Array<juce::PluginDescription>& types);
+
+    /** Map and validate a file written by writeTo(). nullptr if missing or invalid. */
+    static std::shared_ptr<const PluginCatalogImage> map(const juce::File& file);
+
+    /** Validate a block of bytes (e.g. read by other means). nullptr if invalid. */
+    static std::shared_ptr<const PluginCatalogImage> fromMemory(juce::MemoryBlock data);
+
+    bool writeTo(const juce::File& file) const;
+
+    int size() const noexcept { return numRecords; }
+    size_t getNumBytes() const noexcept { return numBytes; }
+    bool isMapped() const noexcept { return mappedFile != nullptr; }
+
+    juce::PluginDescription getDescription(int index) const;
+
+    /** By createIdentifierString() or fileOrIdentifier. -1 if not found. */
+    int findByIdentifier(const juce::String& identifier) const;
+    int findByNameAndManufacturer(const juce::String& name, const juce::String& manufacturer) const;
+
+    std::vector<int> findByUniqueId(int uniqueId) const;
+    std::vector<int> findByManufacturer(const juce::String& manufacturer) const;
+    std::vector<int> findByCategory(const juce::String& category) const;
+
+private:
+    struct Header;
+    struct Record;
+
+    PluginCatalogImage() = default;
+    bool validate();
+
+    const Record& record(int index) const noexcept;
+    const char* string(juce::uint32 offset, juce::uint32& length) const noexcept;
+    juce::String getString(juce::uint32 offset) const;
+    int head(int index, juce::uint32 hash) const noexcept;
+
+    template <typename Matches>
+    std::vector<int> collect(int index, juce::uint32 hash, Matches&& matches) const;
+
+    juce::MemoryBlock ownedData;
+    std::unique_ptr<juce::MemoryMappedFile> mappedFile;
+    const char* data = nullptr;
+    size_t numBytes = 0;
+    int numRecords = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PluginCatalogImage)
+};
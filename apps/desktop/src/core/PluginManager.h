@@ -1,36 +1,51 @@
 #pragma once
 
 #include <juce_audio_processors/juce_audio_processors.h>
+#include "PluginCatalog.h"
 #include <functional>
-#include <atomic>
 #include <optional>
-#include <thread>
-#include <vector>
 
-enum class ScanFailureReason { None, Crash, ScanFailure, Timeout };
-
-struct ScanPluginResult
-{
-    bool success;
-    ScanFailureReason failureReason;
-};
-
-class PluginManager : public juce::ChangeListener, public juce::Timer
+/**
+ * PluginManager - One instance's view of the shared PluginCatalog
+ *
+ * The plugin list, blacklist, scanner and auto-scan all live in the process-wide
+ * PluginCatalog; every call here forwards to it. What stays per instance are the
+ * callbacks: each instance's bridge wires its own, and catalog events (scan progress,
+ * blacklisting, new plugins, ...) fan out to all of them — so an editor open on any
+ * instance follows a scan started from another.
+ */
+class PluginManager : private PluginCatalog::Listener
 {
 public:
     PluginManager();
-    ~PluginManager() noexcept override;
+    ~PluginManager() override;
 
     // Scanning
-    void startScan(bool rescanAll = false);
-    void stopScan();
-    bool isScanning() const { return scanning.load(); }
-    float getScanProgress() const { return scanProgress.load(); }
-    juce::String getCurrentlyScanning() const;
+    void startScan(bool rescanAll = false) { catalog->startScan(rescanAll); }
+    void stopScan() { catalog->stopScan(); }
+    bool isScanning() const { return catalog->isScanning(); }
+    float getScanProgress() const { return catalog->getScanProgress(); }
+    juce::String getCurrentlyScanning() const { return catalog->getCurrentlyScanning(); }
+
+    /** Scanner helpers run at once (0 = one per core). Applies from the next scan. */
+    void setScanConcurrency(int numHelpers) { catalog->setScanConcurrency(numHelpers); }
+    int getScanConcurrency() const { return catalog->getScanConcurrency(); }
 
-    // Plugin access
-    juce::KnownPluginList& getKnownPlugins() { return knownPlugins; }
-    const juce::KnownPluginList& getKnownPlugins() const { return knownPlugins; }
+    /** Profile each plugin's load and processing cost while scanning it. */
+    void setBenchmarkDuringScan(bool shouldBenchmark) { catalog->setBenchmarkDuringScan(shouldBenchmark); }
+    bool isBenchmarkingDuringScan() const { return catalog->isBenchmarkingDuringScan(); }
+
+    /** Startup warm-up of the most-used plugins (state, caps, progress). */
+    juce::var getPrewarmStatusAsJson() const { return catalog->getPrewarmStatusAsJson(); }
+    void setPrewarmSettings(const PluginPrewarmer::Settings& settings) { catalog->setPrewarmSettings(settings); }
+    const PluginPrewarmer::Settings& getPrewarmSettings() const { return catalog->getPrewarmSettings(); }
+
+    // Plugin access — the live list is message-thread only; prefer getSnapshot() for reads
+    juce::KnownPluginList& getKnownPlugins() { return catalog->getKnownPlugins(); }
+    const juce::KnownPluginList& getKnownPlugins() const { return catalog->getKnownPlugins(); }
+
+    /** Immutable, indexed view of the known plugins (safe from any thread). */
+    std::shared_ptr<const PluginCatalog::Snapshot> getSnapshot() const { return catalog->getSnapshot(); }
 
     std::unique_ptr<juce::AudioPluginInstance> createPluginInstance(
         const juce::PluginDescription& desc,
@@ -40,43 +55,47 @@ public:
 
     std::optional<juce::PluginDescription> findPluginByIdentifier(const juce::String& identifier) const;
 
+    /** Cross-format fallback used when a saved description doesn't load as-is. */
+    std::optional<juce::PluginDescription> findPluginByNameAndManufacturer(const juce::String& name,
+                                                                           const juce::String& manufacturer) const;
+
     // JSON export for React UI
-    juce::var getPluginListAsJson() const;
+    juce::var getPluginListAsJson() const { return catalog->getPluginListAsJson(); }
 
     // Blacklist management - allows users to skip problematic plugins
-    void addToBlacklist(const juce::String& pluginPath);
-    void removeFromBlacklist(const juce::String& pluginPath);
-    juce::StringArray getBlacklistedPlugins() const;
-    bool isBlacklisted(const juce::String& pluginPath) const;
-    void clearBlacklist();
-    juce::var getBlacklistAsJson() const;
+    void addToBlacklist(const juce::String& pluginPath) { catalog->addToBlacklist(pluginPath); }
+    void removeFromBlacklist(const juce::String& pluginPath) { catalog->removeFromBlacklist(pluginPath); }
+    juce::StringArray getBlacklistedPlugins() const { return catalog->getBlacklistedPlugins(); }
+    bool isBlacklisted(const juce::String& pluginPath) const { return catalog->isBlacklisted(pluginPath); }
+    void clearBlacklist() { catalog->clearBlacklist(); }
+    juce::var getBlacklistAsJson() const { return catalog->getBlacklistAsJson(); }
 
     // ============================================
     // Custom Scan Paths
     // ============================================
-    juce::var getCustomScanPathsAsJson() const;
-    bool addCustomScanPath(const juce::String& path, const juce::String& format);
-    bool removeCustomScanPath(const juce::String& path, const juce::String& format);
+    juce::var getCustomScanPathsAsJson() const { return catalog->getCustomScanPathsAsJson(); }
+    bool addCustomScanPath(const juce::String& path, const juce::String& format) { return catalog->addCustomScanPath(path, format); }
+    bool removeCustomScanPath(const juce::String& path, const juce::String& format) { return catalog->removeCustomScanPath(path, format); }
 
     // ============================================
     // Plugin Deactivation
     // ============================================
-    bool deactivatePlugin(const juce::String& identifier);
-    bool reactivatePlugin(const juce::String& identifier);
-    juce::var getDeactivatedPluginsAsJson() const;
-    bool removeKnownPlugin(const juce::String& identifier);
-    juce::var getPluginListIncludingDeactivatedAsJson() const;
-    bool isDeactivated(const juce::String& identifier) const;
+    bool deactivatePlugin(const juce::String& identifier) { return catalog->deactivatePlugin(identifier); }
+    bool reactivatePlugin(const juce::String& identifier) { return catalog->reactivatePlugin(identifier); }
+    juce::var getDeactivatedPluginsAsJson() const { return catalog->getDeactivatedPluginsAsJson(); }
+    bool removeKnownPlugin(const juce::String& identifier) { return catalog->removeKnownPlugin(identifier); }
+    juce::var getPluginListIncludingDeactivatedAsJson() const { return catalog->getPluginListIncludingDeactivatedAsJson(); }
+    bool isDeactivated(const juce::String& identifier) const { return catalog->isDeactivated(identifier); }
 
     // ============================================
     // Auto-Scan Detection
     // ============================================
-    bool enableAutoScan(int intervalMs);
-    bool disableAutoScan();
-    juce::var getAutoScanStateAsJson() const;
-    juce::var checkForNewPlugins();
+    bool enableAutoScan(int intervalMs) { return catalog->enableAutoScan(intervalMs); }
+    bool disableAutoScan() { return catalog->disableAutoScan(); }
+    juce::var getAutoScanStateAsJson() const { return catalog->getAutoScanStateAsJson(); }
+    juce::var checkForNewPlugins() { return catalog->checkForNewPlugins(); }
 
-    // Callbacks
+    // Callbacks (this instance only)
     std::function<void()> onScanComplete;
     std::function<void(float, const juce::String&)> onScanProgress;
     std::function<void(const juce::String&, ScanFailureReason)> onPluginBlacklisted;
@@ -85,106 +104,19 @@ public:
     std::function<void()> onAutoScanStateChanged;
 
     // Persistence
-    void savePluginList();
-    void loadPluginList();
+    void savePluginList() { catalog->savePluginList(); }
+    void loadPluginList() { catalog->loadPluginList(); }
 
 private:
-    void changeListenerCallback(juce::ChangeBroadcaster* source) override;
-    void timerCallback() override;
-    void initializeScan();
-    void finishScan();
-
-    // Blacklist persistence
-    void saveBlacklist();
-    void loadBlacklist();
-    void checkForCrashedPlugin();
-
-    // Custom scan paths persistence
-    void saveCustomScanPaths();
-    void loadCustomScanPaths();
-
-    // Deactivation persistence
-    void saveDeactivatedList();
-    void loadDeactivatedList();
-
-    // Auto-scan persistence
-    void saveAutoScanSettings();
-    void loadAutoScanSettings();
-
-    juce::KnownPluginList knownPlugins;
-    juce::AudioPluginFormatManager formatManager;
-
-    std::atomic<bool> scanning { false };
-    std::atomic<bool> shouldStopScan { false };
-    std::atomic<float> scanProgress { 0.0f };
-    juce::String currentlyScanning;
-    mutable std::mutex scanMutex;
-
-    // Main-thread scanner state
-    std::unique_ptr<juce::PluginDirectoryScanner> currentScanner;
-    int currentFormatIndex = 0;
-    int currentPathIndex = 0;
-    juce::FileSearchPath currentSearchPaths;
-
-    // Out-of-process scanning
-    juce::StringArray pluginsToScan;
-    int currentPluginScanIndex = 0;
-    juce::String currentFormatName;
-    bool useOutOfProcessScanning = true;
-
-    juce::File getCacheFile() const;
-    juce::File getBlacklistFile() const;
-    juce::File getDeadMansPedalFile() const;
-    juce::File getScannerHelperPath() const;
-    juce::File getCustomScanPathsFile() const;
-    juce::File getDeactivatedPluginsFile() const;
-    juce::File getAutoScanSettingsFile() const;
-    juce::FileSearchPath getSearchPathsForFormat(juce::AudioPluginFormat* format) const;
-
-    // Out-of-process scanning methods
-    void collectPluginsToScan();
-    void scanNextPluginOutOfProcess();
-    void processPendingScanResult();
-
-    struct BackgroundScanResult
-    {
-        ScanPluginResult scanResult;
-        std::vector<juce::PluginDescription> discoveredPlugins;
-        juce::String pluginPath;
-    };
-
-    BackgroundScanResult scanPluginWithHelper(const juce::String& formatName, const juce::String& pluginPath);
-
-    // Background scanning state
-    std::thread scanThread;
-    std::atomic<bool> backgroundScanInProgress { false };
-    std::atomic<bool> hasPendingScanResult { false };
-    BackgroundScanResult pendingScanResult;
-
-    // Custom scan paths: vector of {path, format} pairs
-    struct CustomScanPath
-    {
-        juce::String path;
-        juce::String format;  // "VST3", "AudioUnit", or "All"
-    };
-    std::vector<CustomScanPath> customScanPaths;
-
-    // Deactivated plugins (identifiers)
-    juce::StringArray deactivatedPlugins;
-
-    // Auto-scan timer (separate from the scan timer used during scanning)
-    class AutoScanTimer : public juce::Timer
-    {
-    public:
-        AutoScanTimer(PluginManager& pm) : pluginMgr(pm) {}
-        void timerCallback() override;
-    private:
-        PluginManager& pluginMgr;
-    };
-    AutoScanTimer autoScanTimer { *this };
-    bool autoScanEnabled = false;
-    int autoScanIntervalMs = 300000;  // default 5 minutes
-    juce::int64 lastAutoScanCheckTime = 0;
+    // PluginCatalog::Listener
+    void scanProgressChanged(float progress, const juce::String& currentPlugin) override;
+    void scanFinished() override;
+    void pluginBlacklisted(const juce::String& pluginPath, ScanFailureReason reason) override;
+    void deactivationChanged() override;
+    void newPluginsDetected(int count, const juce::var& plugins) override;
+    void autoScanStateChanged() override;
+
+    juce::SharedResourcePointer<PluginCatalog> catalog;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PluginManager)
 };
@@ -0,0 +1,418 @@
+#include "PluginPrewarmer.h"
+#include "../utils/PlatformPaths.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+//==============================================================================
+// UsageStats
+//==============================================================================
+
+namespace
+{
+    constexpr double kMsPerDay = 24.0 * 60.0 * 60.0 * 1000.0;
+
+    double decay(juce::int64 fromMs, juce::int64 toMs)
+    {
+        const double days = juce::jmax(0.0, static_cast<double>(toMs - fromMs) / kMsPerDay);
+        return std::pow(0.5, days / PluginPrewarmer::UsageStats::kHalfLifeDays);
+    }
+}
+
+void PluginPrewarmer::UsageStats::recordUse(const juce::String& identifier, juce::int64 nowMs)
+{
+    auto& entry = entries[identifier];
+    entry.uses = entry.uses * decay(entry.lastUsedMs, nowMs) + 1.0;
+    entry.lastUsedMs = nowMs;
+}
+
+double PluginPrewarmer::UsageStats::getScore(const juce::String& identifier, juce::int64 nowMs) const
+{
+    auto it = entries.find(identifier);
+    return it != entries.end() ? it->second.uses * decay(it->second.lastUsedMs, nowMs) : 0.0;
+}
+
+juce::StringArray PluginPrewarmer::UsageStats::getMostUsed(int maxCount, juce::int64 nowMs) const
+{
+    std::vector<std::pair<double, juce::String>> scored;
+    scored.reserve(entries.size());
+    for (const auto& [identifier, entry] : entries)
+        scored.emplace_back(entry.uses * decay(entry.lastUsedMs, nowMs), identifier);
+
+    std::sort(scored.begin(), scored.end(), [](const auto& a, const auto& b) {
+        return a.first != b.first ? a.first > b.first : a.second < b.second;
+    });
+
+    juce::StringArray result;
+    for (const auto& [score, identifier] : scored)
+    {
+        if (result.size() >= maxCount)
+            break;
+        result.add(identifier);
+    }
+    return result;
+}
+
+juce::var PluginPrewarmer::UsageStats::toJson() const
+{
+    auto* obj = new juce::DynamicObject();
+    for (const auto& [identifier, entry] : entries)
+    {
+        auto* e = new juce::DynamicObject();
+        e->setProperty("uses", entry.uses);
+        e->setProperty("lastUsed", entry.lastUsedMs);
+        obj->setProperty(identifier, juce::var(e));
+    }
+    return juce::var(obj);
+}
+
+void PluginPrewarmer::UsageStats::fromJson(const juce::var& json)
+{
+    entries.clear();
+    if (auto* obj = json.getDynamicObject())
+    {
+        for (const auto& property : obj->getProperties())
+        {
+            Entry entry;
+            entry.uses = property.value.getProperty("uses", 0.0);
+            entry.lastUsedMs = static_cast<juce::int64>(property.value.getProperty("lastUsed", 0));
+            if (entry.uses > 0.0)
+                entries[property.name.toString()] = entry;
+        }
+    }
+}
+
+//==============================================================================
+// Module step — pages plugin binaries in, lowest priority, cancellable between chunks
+//==============================================================================
+
+class PluginPrewarmer::ModuleThread : public juce::Thread
+{
+public:
+    explicit ModuleThread(PluginPrewarmer& o) : juce::Thread("Plugin prewarm"), owner(o) {}
+
+    void run() override
+    {
+        constexpr int chunkSize = 1024 * 1024;
+        juce::HeapBlock<char> buffer(chunkSize);
+
+        for (const auto& candidate : owner.candidates)
+        {
+            for (const auto& file : candidate.files)
+            {
+                juce::FileInputStream in(file);
+                while (in.openedOk() && !in.isExhausted())
+                {
+                    if (threadShouldExit() || owner.cancelled.load())
+                        return;
+
+                    if (in.read(buffer, chunkSize) <= 0)
+                        break;
+
+                    // Leave the disk to anything real
+                    wait(2);
+                }
+            }
+            ++owner.modulesWarmed;
+        }
+    }
+
+private:
+    PluginPrewarmer& owner;
+};
+
+//==============================================================================
+// PluginPrewarmer
+//==============================================================================
+
+PluginPrewarmer::PluginPrewarmer(Resolve r, CreateInstance c)
+    : resolve(std::move(r)), createInstance(std::move(c))
+{
+}
+
+PluginPrewarmer::~PluginPrewarmer()
+{
+    cancelled.store(true);
+    stopTimer();
+    if (moduleThread)
+        moduleThread->stopThread(2000);
+
+    bool pending = false;
+    {
+        const juce::ScopedLock lock(usageLock);
+        pending = unsavedUses > 0;
+    }
+    if (pending)
+        save();
+}
+
+void PluginPrewarmer::recordUse(const juce::PluginDescription& desc)
+{
+    const juce::ScopedLock lock(usageLock);
+    usage.recordUse(desc.createIdentifierString(), juce::Time::currentTimeMillis());
+
+    // Cheap file, but a preset load instantiates a dozen plugins in a row
+    if (++unsavedUses >= 10)
+        save();
+}
+
+void PluginPrewarmer::scheduleStart()
+{
+    if (!settings.enabled || state != State::idle || cancelled.load())
+        return;
+
+    state = State::waiting;
+    startTimer(juce::jmax(1, settings.startDelayMs));
+}
+
+void PluginPrewarmer::cancel()
+{
+    // Any thread: the module thread checks the flag between chunks, the timer on its next tick
+    cancelled.store(true);
+}
+
+bool PluginPrewarmer::isRunning() const
+{
+    return !cancelled.load() && (state == State::waiting || state == State::warming);
+}
+
+void PluginPrewarmer::setSettings(const Settings& newSettings)
+{
+    auto clamped = newSettings;
+    clamped.maxPlugins = juce::jlimit(0, 64, clamped.maxPlugins);
+    clamped.maxMessageThreadShare = juce::jlimit(0.01, 1.0, clamped.maxMessageThreadShare);
+    {
+        const juce::ScopedLock lock(usageLock);   // save() may be reading it from another thread
+        settings = clamped;
+    }
+    save();
+
+    if (!settings.enabled)
+    {
+        cancel();
+        if (state == State::waiting || state == State::warming)
+            timerCallback();   // Settle now rather than on the next tick
+    }
+}
+
+void PluginPrewarmer::timerCallback()
+{
+    if (cancelled.load())
+    {
+        #if JUCE_DEBUG
+        if (state == State::warming)
+            std::cerr << "Plugin prewarm cancelled after " << instancesCreated << " instances" << std::endl;
+        #endif
+
+        stopTimer();
+        state = State::cancelled;
+        return;
+    }
+
+    if (state == State::waiting)
+    {
+        begin();
+        return;
+    }
+
+    if (state == State::warming)
+        warmNextInstance();
+}
+
+void PluginPrewarmer::begin()
+{
+    // Most used first; skip what's gone from the catalog and stop at the byte cap
+    const auto now = juce::Time::currentTimeMillis();
+    juce::int64 budget = settings.maxBytes;
+
+    juce::StringArray mostUsed;
+    {
+        const juce::ScopedLock lock(usageLock);
+        mostUsed = usage.getMostUsed(settings.maxPlugins, now);
+    }
+
+    for (const auto& identifier : mostUsed)
+    {
+        auto desc = resolve(identifier);
+        if (!desc)
+            continue;
+
+        Candidate candidate;
+        candidate.desc = *desc;
+        candidate.files = getModuleFiles(desc->fileOrIdentifier);
+        for (const auto& file : candidate.files)
+            candidate.bytes += file.getSize();
+
+        if (candidate.bytes > budget)
+            continue;
+
+        budget -= candidate.bytes;
+        bytesWarmed += candidate.bytes;
+        candidates.push_back(std::move(candidate));
+    }
+
+    if (candidates.empty())
+    {
+        stopTimer();
+        state = State::done;
+        return;
+    }
+
+    #if JUCE_DEBUG
+    std::cerr << "Prewarming " << candidates.size() << " plugins (" << (bytesWarmed / (1024 * 1024)) << " MB)" << std::endl;
+    #endif
+
+    state = State::warming;
+    moduleThread = std::make_unique<ModuleThread>(*this);
+    moduleThread->startThread(juce::Thread::Priority::background);
+    startTimer(100);
+}
+
+void PluginPrewarmer::warmNextInstance()
+{
+    const bool modulesDone = modulesWarmed.load() >= static_cast<int>(candidates.size());
+
+    if (!settings.createInstances || nextInstance >= candidates.size())
+    {
+        if (modulesDone)
+        {
+            stopTimer();
+            state = State::done;
+        }
+        return;
+    }
+
+    // Wait for this plugin's module step, and for our share of the message thread
+    if (static_cast<int>(nextInstance) >= modulesWarmed.load()
+        || juce::Time::getMillisecondCounterHiRes() < nextInstanceAtMs)
+        return;
+
+    const auto& candidate = candidates[nextInstance++];
+    const double startMs = juce::Time::getMillisecondCounterHiRes();
+    {
+        auto instance = createInstance(candidate.desc);
+        if (instance != nullptr)
+            ++instancesCreated;
+    }
+    const double elapsedMs = juce::Time::getMillisecondCounterHiRes() - startMs;
+
+    // A 400 ms load at a 25% share waits 1.2 s before the next one
+    nextInstanceAtMs = juce::Time::getMillisecondCounterHiRes()
+                     + elapsedMs * (1.0 / settings.maxMessageThreadShare - 1.0);
+
+    #if JUCE_DEBUG
+    std::cerr << "  Prewarmed " << candidate.desc.name << " in " << elapsedMs << " ms" << std::endl;
+    #endif
+}
+
+juce::Array<juce::File> PluginPrewarmer::getModuleFiles(const juce::String& fileOrIdentifier)
+{
+    juce::Array<juce::File> files;
+    if (!juce::File::isAbsolutePath(fileOrIdentifier))
+        return files;
+
+    const juce::File plugin(fileOrIdentifier);
+    if (plugin.existsAsFile())
+    {
+        files.add(plugin);
+        return files;
+    }
+
+    // Bundle: the binary directories under Contents (MacOS, x86_64-linux, ...)
+    for (const auto& dir : plugin.getChildFile("Contents").findChildFiles(juce::File::findDirectories, false))
+        if (dir.getFileName() != "Resources")
+            files.addArray(dir.findChildFiles(juce::File::findFiles, false));
+
+    return files;
+}
+
+juce::var PluginPrewarmer::getStatusAsJson() const
+{
+    auto* obj = new juce::DynamicObject();
+
+    // A cancel from another thread settles on the next tick; report it already
+    auto shownState = state;
+    if (cancelled.load() && (state == State::waiting || state == State::warming))
+        shownState = State::cancelled;
+
+    const char* stateName = "idle";
+    switch (shownState)
+    {
+        case State::idle:      stateName = "idle"; break;
+        case State::waiting:   stateName = "waiting"; break;
+        case State::warming:   stateName = "warming"; break;
+        case State::done:      stateName = "done"; break;
+        case State::cancelled: stateName = "cancelled"; break;
+    }
+
+    obj->setProperty("state", stateName);
+    obj->setProperty("enabled", settings.enabled);
+    obj->setProperty("maxPlugins", settings.maxPlugins);
+    obj->setProperty("createInstances", settings.createInstances);
+    obj->setProperty("maxBytes", settings.maxBytes);
+    obj->setProperty("numCandidates", static_cast<int>(candidates.size()));
+    obj->setProperty("modulesWarmed", modulesWarmed.load());
+    obj->setProperty("instancesCreated", instancesCreated);
+    obj->setProperty("bytesWarmed", bytesWarmed);
+    {
+        const juce::ScopedLock lock(usageLock);
+        obj->setProperty("trackedPlugins", usage.size());
+    }
+    return juce::var(obj);
+}
+
+juce::File PluginPrewarmer::getUsageFile() const
+{
+    return PlatformPaths::getPluginCacheDirectory().getChildFile("plugin-usage.json");
+}
+
+void PluginPrewarmer::save() const
+{
+    auto file = getUsageFile();
+    file.getParentDirectory().createDirectory();
+
+    // recordUse() saves from whichever thread it's on; take everything in one go
+    Settings saved;
+    juce::var plugins;
+    {
+        const juce::ScopedLock lock(usageLock);
+        saved = settings;
+        plugins = usage.toJson();
+        unsavedUses = 0;
+    }
+
+    auto* prewarm = new juce::DynamicObject();
+    prewarm->setProperty("enabled", saved.enabled);
+    prewarm->setProperty("maxPlugins", saved.maxPlugins);
+    prewarm->setProperty("createInstances", saved.createInstances);
+    prewarm->setProperty("maxBytes", saved.maxBytes);
+
+    auto* obj = new juce::DynamicObject();
+    obj->setProperty("prewarm", juce::var(prewarm));
+    obj->setProperty("plugins", plugins);
+
+    file.replaceWithText(juce::JSON::toString(juce::var(obj)));
+}
+
+void PluginPrewarmer::load()
+{
+    auto file = getUsageFile();
+    if (!file.existsAsFile())
+        return;
+
+    auto parsed = juce::JSON::parse(file.loadFileAsString());
+    if (parsed.isVoid())
+        return;
+
+    const juce::ScopedLock lock(usageLock);
+    usage.fromJson(parsed.getProperty("plugins", {}));
+
+    auto prewarm = parsed.getProperty("prewarm", {});
+    if (prewarm.isObject())
+    {
+        settings.enabled = static_cast<bool>(prewarm.getProperty("enabled", true));
+        settings.maxPlugins = juce::jlimit(0, 64, static_cast<int>(prewarm.getProperty("maxPlugins", 8)));
+        settings.createInstances = static_cast<bool>(prewarm.getProperty("createInstances", false));
+        settings.maxBytes = static_cast<juce::int64>(prewarm.getProperty("maxBytes", settings.maxBytes));
+    }
+}
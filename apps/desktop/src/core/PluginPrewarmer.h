@@ -0,0 +1,138 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <vector>
+
+/**
+ * PluginPrewarmer - Loads the session's most-used plugins before anyone asks for them
+ *
+ * Owned by PluginCatalog, so there is one per process. It counts how often each plugin
+ * is instantiated (across sessions, decayed with a 30-day half-life) and, a few seconds
+ * after startup, warms the top N:
+ *
+ *   1. Module step, on a background-priority thread: reads the plugin's binaries (not
+ *      Resources) so the first real load finds them in the page cache. File-based
+ *      plugins only — AudioUnit component IDs have nothing on disk to read.
+ *   2. Instance step, opt-in (Settings::createInstances), on the message thread (formats
+ *      expect it): creates and discards one instance, so the format's module load and the
+ *      plugin's own one-time setup happen now. One plugin per timer tick, paced to a share
+ *      of the message thread. Off by default — third-party constructors can block the UI
+ *      for hundreds of milliseconds or show dialogs, which is worse than a slow first load.
+ *
+ * Both steps count binary sizes against a byte cap. Any real work (an instantiation
+ * through PluginManager, a scan) calls cancel(), which stops both steps between files
+ * or plugins. Prewarming runs at most once per process.
+ *
+ * recordUse() and cancel() may be called from any thread (hosts restore state off the
+ * message thread); everything else is message thread only.
+ */
+class PluginPrewarmer : private juce::Timer
+{
+public:
+    /** Per-plugin use counts, keyed by PluginDescription::createIdentifierString(). */
+    class UsageStats
+    {
+    public:
+        static constexpr double kHalfLifeDays = 30.0;
+
+        void recordUse(const juce::String& identifier, juce::int64 nowMs);
+
+        /** Decayed use count as of nowMs; 0 for plugins never used. */
+        double getScore(const juce::String& identifier, juce::int64 nowMs) const;
+
+        /** Highest score first. */
+        juce::StringArray getMostUsed(int maxCount, juce::int64 nowMs) const;
+
+        int size() const { return static_cast<int>(entries.size()); }
+
+        juce::var toJson() const;
+        void fromJson(const juce::var& json);
+
+    private:
+        struct Entry
+        {
+            double uses = 0.0;          // Decayed to lastUsedMs
+            juce::int64 lastUsedMs = 0;
+        };
+        std::map<juce::String, Entry> entries;
+    };
+
+    struct Settings
+    {
+        bool enabled = true;
+        int maxPlugins = 8;
+        bool createInstances = false;               // Opt-in: runs plugin code on the message thread
+        juce::int64 maxBytes = 512 * 1024 * 1024;   // Binary bytes read and loaded
+        double maxMessageThreadShare = 0.25;         // Instance step duty cycle
+        int startDelayMs = 5000;
+    };
+
+    using Resolve = std::function<std::optional<juce::PluginDescription>(const juce::String& identifier)>;
+    using CreateInstance = std::function<std::unique_ptr<juce::AudioPluginInstance>(const juce::PluginDescription&)>;
+
+    PluginPrewarmer(Resolve resolve, CreateInstance createInstance);
+    ~PluginPrewarmer() override;
+
+    void recordUse(const juce::PluginDescription& desc);
+
+    /** Start the delayed warm-up (no-op if disabled, already started, or cancelled). */
+    void scheduleStart();
+
+    /** Real work started — stop warming for the rest of the session. */
+    void cancel();
+
+    bool isRunning() const;
+
+    void setSettings(const Settings& newSettings);
+    const Settings& getSettings() const { return settings; }
+
+    juce::var getStatusAsJson() const;
+
+    void save() const;
+    void load();
+
+    /** The binaries the module step reads for a plugin (empty if it isn't file-based). */
+    static juce::Array<juce::File> getModuleFiles(const juce::String& fileOrIdentifier);
+
+private:
+    class ModuleThread;
+
+    struct Candidate
+    {
+        juce::PluginDescription desc;
+        juce::Array<juce::File> files;
+        juce::int64 bytes = 0;
+    };
+
+    void timerCallback() override;
+    void begin();
+    void warmNextInstance();
+    juce::File getUsageFile() const;
+
+    Resolve resolve;
+    CreateInstance createInstance;
+    Settings settings;                           // Written under usageLock; save() reads it from any thread
+
+    juce::CriticalSection usageLock;
+    UsageStats usage;
+    mutable int unsavedUses = 0;
+
+    enum class State { idle, waiting, warming, done, cancelled };
+    State state = State::idle;
+
+    std::vector<Candidate> candidates;           // Fixed once warming begins
+    std::atomic<int> modulesWarmed { 0 };        // Candidates whose module step finished
+    std::atomic<bool> cancelled { false };
+    size_t nextInstance = 0;
+    double nextInstanceAtMs = 0.0;
+    int instancesCreated = 0;
+    juce::int64 bytesWarmed = 0;
+    std::unique_ptr<ModuleThread> moduleThread;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PluginPrewarmer)
+};
@@ -0,0 +1,183 @@
+#include "PluginProfile.h"
+#include <algorithm>
+#include <cmath>
+
+//==============================================================================
+// PluginProfile
+//==============================================================================
+
+std::optional<double> PluginProfile::estimateLoad(double sampleRate, int blockSize) const
+{
+    if (!isValid() || sampleRate <= 0.0 || blockSize <= 0)
+        return std::nullopt;
+
+    // Closest configuration on a log scale, so 64 vs 128 counts as far as 512 vs 1024
+    const BlockCost* best = nullptr;
+    double bestDistance = 0.0;
+    for (const auto& cost : blockCosts)
+    {
+        if (cost.sampleRate <= 0.0 || cost.blockSize <= 0)
+            continue;
+
+        const double distance = std::abs(std::log2(sampleRate / cost.sampleRate))
+                              + std::abs(std::log2(static_cast<double>(blockSize) / cost.blockSize));
+        if (best == nullptr || distance < bestDistance)
+        {
+            best = &cost;
+            bestDistance = distance;
+        }
+    }
+
+    if (best == nullptr)
+        return std::nullopt;
+
+    const double microsPerSample = best->medianMicros / best->blockSize;
+    return microsPerSample * sampleRate / 1.0e6;
+}
+
+juce::var PluginProfile::toVar() const
+{
+    auto* obj = new juce::DynamicObject();
+    obj->setProperty("instantiateMs", instantiateMs);
+    obj->setProperty("prepareMs", prepareMs);
+    obj->setProperty("latencySamples", latencySamples);
+    obj->setProperty("tailSeconds", tailSeconds);
+
+    juce::Array<juce::var> costs;
+    for (const auto& cost : blockCosts)
+    {
+        auto* c = new juce::DynamicObject();
+        c->setProperty("sampleRate", cost.sampleRate);
+        c->setProperty("blockSize", cost.blockSize);
+        c->setProperty("medianMicros", cost.medianMicros);
+        c->setProperty("worstMicros", cost.worstMicros);
+        costs.add(juce::var(c));
+    }
+    obj->setProperty("blockCosts", costs);
+
+    return juce::var(obj);
+}
+
+PluginProfile PluginProfile::fromVar(const juce::var& v)
+{
+    PluginProfile profile;
+    if (!v.isObject())
+        return profile;
+
+    profile.instantiateMs = v.getProperty("instantiateMs", -1.0);
+    profile.prepareMs = v.getProperty("prepareMs", -1.0);
+    profile.latencySamples = v.getProperty("latencySamples", 0);
+    profile.tailSeconds = v.getProperty("tailSeconds", 0.0);
+
+    if (auto* costs = v.getProperty("blockCosts", {}).getArray())
+    {
+        for (const auto& c : *costs)
+        {
+            BlockCost cost;
+            cost.sampleRate = c.getProperty("sampleRate", 0.0);
+            cost.blockSize = c.getProperty("blockSize", 0);
+            cost.medianMicros = c.getProperty("medianMicros", 0.0);
+            cost.worstMicros = c.getProperty("worstMicros", 0.0);
+            if (cost.sampleRate > 0.0 && cost.blockSize > 0)
+                profile.blockCosts.push_back(cost);
+        }
+    }
+
+    return profile;
+}
+
+//==============================================================================
+// PluginProfiler
+//==============================================================================
+
+const std::vector<PluginProfiler::Config>& PluginProfiler::getStandardConfigs()
+{
+    static const std::vector<Config> configs {
+        { 48000.0, 128 },
+        { 48000.0, 512 },
+        { 44100.0, 512 },
+        { 96000.0, 512 },
+        { 48000.0, 1024 }
+    };
+    return configs;
+}
+
+PluginProfile PluginProfiler::measure(juce::AudioPluginFormatManager& formatManager,
+                                      const juce::PluginDescription& desc, double deadlineMs,
+                                      const InspectInstance& inspect)
+{
+    using Clock = juce::Time;
+    PluginProfile profile;
+    const auto& configs = getStandardConfigs();
+
+    const double startMs = Clock::getMillisecondCounterHiRes();
+    juce::String errorMessage;
+    auto instance = formatManager.createPluginInstance(desc, configs.front().sampleRate,
+                                                       configs.front().blockSize, errorMessage);
+    if (instance == nullptr)
+        return profile;
+
+    const double instantiateMs = Clock::getMillisecondCounterHiRes() - startMs;
+
+    if (inspect)
+        inspect(*instance);
+
+    juce::ScopedNoDenormals noDenormals;
+    juce::Random random(0x5eed);
+    juce::MidiBuffer midi;
+    std::vector<double> blockMicros;
+
+    for (const auto& config : configs)
+    {
+        if (Clock::getMillisecondCounterHiRes() > deadlineMs)
+            break;
+
+        const double prepareStartMs = Clock::getMillisecondCounterHiRes();
+        instance->prepareToPlay(config.sampleRate, config.blockSize);
+        if (profile.prepareMs < 0.0)
+        {
+            profile.prepareMs = Clock::getMillisecondCounterHiRes() - prepareStartMs;
+            profile.latencySamples = instance->getLatencySamples();
+            profile.tailSeconds = instance->getTailLengthSeconds();
+        }
+
+        const int numChannels = juce::jmax(1, instance->getTotalNumInputChannels(),
+                                           instance->getTotalNumOutputChannels());
+        juce::AudioBuffer<float> buffer(numChannels, config.blockSize);
+
+        blockMicros.clear();
+        for (int block = 0; block < kWarmupBlocks + kMeasuredBlocks; ++block)
+        {
+            // Fresh noise each block — a plugin fed its own output can settle into silence
+            for (int ch = 0; ch < numChannels; ++ch)
+            {
+                auto* samples = buffer.getWritePointer(ch);
+                for (int i = 0; i < config.blockSize; ++i)
+                    samples[i] = (random.nextFloat() - 0.5f) * 0.5f;
+            }
+            midi.clear();
+
+            const double blockStartMs = Clock::getMillisecondCounterHiRes();
+            instance->processBlock(buffer, midi);
+            const double elapsedMicros = (Clock::getMillisecondCounterHiRes() - blockStartMs) * 1000.0;
+
+            if (block >= kWarmupBlocks)
+                blockMicros.push_back(elapsedMicros);
+        }
+
+        instance->releaseResources();
+
+        std::sort(blockMicros.begin(), blockMicros.end());
+        PluginProfile::BlockCost cost;
+        cost.sampleRate = config.sampleRate;
+        cost.blockSize = config.blockSize;
+        cost.medianMicros = blockMicros[blockMicros.size() / 2];
+        cost.worstMicros = blockMicros.back();
+        profile.blockCosts.push_back(cost);
+    }
+
+    // Only valid once at least one configuration was measured
+    if (!profile.blockCosts.empty())
+        profile.instantiateMs = instantiateMs;
+    return profile;
+}
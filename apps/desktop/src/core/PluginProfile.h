@@ -0,0 +1,79 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <functional>
+#include <optional>
+#include <vector>
+
+/**
+ * PluginProfile - What one plugin costs to load and run, measured by the scanner helper
+ *
+ * Filled in by PluginProfiler::measure() in the helper process right after a successful
+ * scan (when benchmarking is enabled), sent back over ScannerProtocol and kept in the
+ * PluginCatalog keyed by identifier string. ChainProcessor sums estimateLoad() over a
+ * chain to predict its CPU before a plugin is inserted.
+ *
+ * Block costs are wall-clock microseconds per processBlock() on white noise, measured
+ * after a short warm-up. They're a relative guide — the helper runs without the host's
+ * other load and on whatever core the OS picked.
+ */
+struct PluginProfile
+{
+    struct BlockCost
+    {
+        double sampleRate = 0.0;
+        int blockSize = 0;
+        double medianMicros = 0.0;
+        double worstMicros = 0.0;
+    };
+
+    double instantiateMs = -1.0;     // < 0 = not measured
+    double prepareMs = -1.0;
+    int latencySamples = 0;
+    double tailSeconds = 0.0;
+    std::vector<BlockCost> blockCosts;
+
+    bool isValid() const { return instantiateMs >= 0.0 && !blockCosts.empty(); }
+
+    /** Share of one core spent in processBlock at this rate and block size (1.0 = all of it).
+        Uses the closest measured configuration, scaled by its per-sample cost. */
+    std::optional<double> estimateLoad(double sampleRate, int blockSize) const;
+
+    juce::var toVar() const;
+    static PluginProfile fromVar(const juce::var& v);
+};
+
+/**
+ * PluginProfiler - Runs the measurements behind a PluginProfile
+ *
+ * Instantiates the plugin, prepares it for each standard configuration and times
+ * processBlock() on seeded noise. Meant for the scanner helper: a plugin that crashes
+ * here takes the process with it.
+ */
+namespace PluginProfiler
+{
+    struct Config
+    {
+        double sampleRate;
+        int blockSize;
+    };
+
+    /** 44.1/48/96 kHz at the block sizes hosts commonly run. */
+    const std::vector<Config>& getStandardConfigs();
+
+    inline constexpr int kWarmupBlocks = 8;
+    inline constexpr int kMeasuredBlocks = 64;
+
+    /** Time allowed for all the plugins of one scanned file. */
+    inline constexpr int kBudgetMs = 10000;
+
+    /** Called with the fresh instance before it's prepared — lets the helper do other
+        per-instance work (parameter discovery) without loading the plugin twice. */
+    using InspectInstance = std::function<void(juce::AudioPluginInstance&)>;
+
+    /** Measure one plugin. Configurations that would run past deadlineMs (a
+        Time::getMillisecondCounterHiRes() value) are skipped; invalid profile if the
+        plugin can't be instantiated. */
+    PluginProfile measure(juce::AudioPluginFormatManager& formatManager, const juce::PluginDescription& desc,
+                          double deadlineMs, const InspectInstance& inspect = {});
+}
@@ -2,7 +2,8 @@
 #include "../utils/PlatformPaths.h"
 
 PresetManager::PresetManager(ChainProcessor& chainProcessor)
-    : chain(chainProcessor)
+    : chain(chainProcessor),
+      prefetcher(chainProcessor.getPluginManager())
 {
     // Ensure presets directory exists
     getPresetsDirectory().createDirectory();
@@ -90,6 +91,9 @@ bool PresetManager::savePreset(const juce::String& name, const juce::String& cat
     if (!xml)
         return false;
 
+    // Plugin chunks go to the blob store; the preset references them by hash
+    blobStore->externaliseChunks(*xml, true);
+
     // Create category directory if needed
     auto categoryDir = getPresetsDirectory().getChildFile(category);
     categoryDir.createDirectory();
@@ -111,17 +115,31 @@ bool PresetManager::savePreset(const juce::String& name, const juce::String& cat
     return true;
 }
 
-bool PresetManager::loadPreset(const juce::File& presetFile)
+void PresetManager::loadPreset(const juce::File& presetFile, std::function<void(bool success)> onDone)
 {
+    auto finish = [&onDone](bool success) {
+        if (onDone)
+            onDone(success);
+    };
+
     if (!presetFile.existsAsFile())
-        return false;
+    {
+        finish(false);
+        return;
+    }
 
     auto xml = juce::XmlDocument::parse(presetFile);
     if (!xml || !xml->hasTagName("PluginChainPreset"))
-        return false;
+    {
+        finish(false);
+        return;
+    }
 
     lastMissingPlugins.clear();
 
+    if (blobStore->resolveChunks(*xml) > 0)
+        DBG("Preset " + presetFile.getFileName() + " references missing chunks, those plugins load with default state");
+
     // Check plugin availability before loading
     juce::StringArray missingPlugins;
     std::function<void(const juce::XmlElement&)> checkNode = [&](const juce::XmlElement& nodeXml)
@@ -137,17 +155,7 @@ bool PresetManager::loadPreset(const juce::File& presetFile)
                 if (!chain.getPluginManager().findPluginByIdentifier(desc.fileOrIdentifier))
                 {
                     // Fallback: try matching by name+manufacturer (handles cross-format presets)
-                    bool foundByName = false;
-                    for (const auto& knownDesc : chain.getPluginManager().getKnownPlugins().getTypes())
-                    {
-                        if (knownDesc.name.equalsIgnoreCase(desc.name) &&
-                            knownDesc.manufacturerName.equalsIgnoreCase(desc.manufacturerName))
-                        {
-                            foundByName = true;
-                            break;
-                        }
-                    }
-                    if (!foundByName)
+                    if (!chain.getPluginManager().findPluginByNameAndManufacturer(desc.name, desc.manufacturerName))
                         missingPlugins.add(desc.name);
                 }
             }
@@ -177,18 +185,65 @@ bool PresetManager::loadPreset(const juce::File& presetFile)
             msg
         );
 
-        return false;
+        finish(false);
+        return;
+    }
+
+    // Adopt prefetched instances if this preset was staged for the current audio config.
+    // Instantiation already happened, so the swap is quick and happens without blocking the
+    // message thread while the audio thread crossfades.
+    auto staged = prefetcher.take(presetFile, chain.getCurrentSampleRate(), chain.getCurrentBlockSize());
+    auto* chainTree = xml->getChildByName("ChainTree");
+
+    if (!staged.empty() && isV2Preset(*xml) && chainTree != nullptr)
+    {
+        // The processor's swap only replaces the live chain once the new one is playing, so
+        // there is nothing to roll back; the chain's own swap tears the old one down first
+        auto snapshot = stagedSwapHandler ? juce::MemoryBlock() : chain.captureSnapshot();
+        std::shared_ptr<juce::XmlElement> meta;
+        if (auto* metaXml = xml->getChildByName("MetaData"))
+            meta = std::make_shared<juce::XmlElement>(*metaXml);
+
+        auto landed = [this, alive = aliveFlag, presetFile, meta, snapshot = std::move(snapshot),
+                       onDone = std::move(onDone)](ChainProcessor::RestoreResult result) {
+            if (!alive->load(std::memory_order_acquire))
+                return;
+
+            lastMissingPlugins = result.missingPlugins;
+            if (!result.success && snapshot.getSize() > 0)
+                chain.restoreSnapshot(snapshot);
+            else if (result.success)
+                setCurrentPreset(presetFile, meta.get());
+
+            if (onDone)
+                onDone(result.success);
+        };
+
+        auto chainXml = std::make_unique<juce::XmlElement>(*chainTree);
+        if (stagedSwapHandler)
+            stagedSwapHandler(std::move(chainXml), std::move(staged), std::move(landed));
+        else
+            chain.restoreChainFromXmlAsync(std::move(chainXml), std::move(staged), std::move(landed));
+        return;
     }
 
     if (!parsePresetXml(*xml, lastMissingPlugins))
-        return false;
+    {
+        finish(false);
+        return;
+    }
 
-    // Update current preset info
+    setCurrentPreset(presetFile, xml->getChildByName("MetaData"));
+    finish(true);
+}
+
+void PresetManager::setCurrentPreset(const juce::File& presetFile, const juce::XmlElement* meta)
+{
     currentPreset = std::make_unique<PresetInfo>();
     currentPreset->file = presetFile;
     currentPreset->lastModified = presetFile.getLastModificationTime();
 
-    if (auto* meta = xml->getChildByName("MetaData"))
+    if (meta != nullptr)
     {
         currentPreset->name = meta->getStringAttribute("name", presetFile.getFileNameWithoutExtension());
         currentPreset->category = meta->getStringAttribute("category", "Uncategorized");
@@ -203,8 +258,15 @@ bool PresetManager::loadPreset(const juce::File& presetFile)
 
     if (onPresetLoaded)
         onPresetLoaded(currentPreset.get());
+}
 
-    return true;
+bool PresetManager::prefetchPreset(const juce::File& presetFile)
+{
+    // Nothing to gain from staging the preset that's already loaded
+    if (currentPreset && currentPreset->file == presetFile && !dirty)
+        return false;
+
+    return prefetcher.prefetch(presetFile, chain.getCurrentSampleRate(), chain.getCurrentBlockSize());
 }
 
 bool PresetManager::deletePreset(const juce::File& presetFile)
@@ -212,9 +274,13 @@ bool PresetManager::deletePreset(const juce::File& presetFile)
     if (!presetFile.existsAsFile())
         return false;
 
+    prefetcher.cancel(presetFile);
+
     if (!presetFile.deleteFile())
         return false;
 
+    blobStore->scheduleLibraryGarbageCollection();
+
     // Clear current preset if it was the deleted one
     if (currentPreset && currentPreset->file == presetFile)
         currentPreset.reset();
@@ -228,6 +294,8 @@ bool PresetManager::renamePreset(const juce::File& presetFile, const juce::Strin
     if (!presetFile.existsAsFile())
         return false;
 
+    prefetcher.cancel(presetFile);
+
     // Parse the XML to update the metadata name
     auto xml = juce::XmlDocument::parse(presetFile);
     if (!xml || !xml->hasTagName("PluginChainPreset"))
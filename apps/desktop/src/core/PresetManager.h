@@ -2,7 +2,10 @@
 
 #include <juce_core/juce_core.h>
 #include "ChainProcessor.h"
+#include "PresetPrefetcher.h"
+#include <atomic>
 #include <functional>
+#include <memory>
 
 struct PresetInfo
 {
@@ -26,14 +29,22 @@ class PresetManager
 {
 public:
     PresetManager(ChainProcessor& chainProcessor);
-    ~PresetManager() = default;
+    ~PresetManager() { aliveFlag->store(false, std::memory_order_release); }
 
     // Preset operations
     bool savePreset(const juce::String& name, const juce::String& category);
-    bool loadPreset(const juce::File& presetFile);
+    // A prefetched preset is swapped in asynchronously (see stagedSwapHandler), so onDone
+    // (message thread) may run after this returns; otherwise it runs before.
+    void loadPreset(const juce::File& presetFile, std::function<void(bool success)> onDone);
     bool deletePreset(const juce::File& presetFile);
     bool renamePreset(const juce::File& presetFile, const juce::String& newName);
 
+    // Prefetch (UI hover / next-previous): stage a preset's plugins so loadPreset() is a quick swap
+    bool prefetchPreset(const juce::File& presetFile);
+    void cancelPrefetch(const juce::File& presetFile) { prefetcher.cancel(presetFile); }
+    void cancelAllPrefetches() { prefetcher.cancelAll(); }
+    PresetPrefetcher& getPrefetcher() { return prefetcher; }
+
     // Preset discovery
     void scanPresets();
     juce::Array<PresetInfo> getPresetList() const { return presets; }
@@ -51,6 +62,11 @@ public:
     std::function<void()> onPresetListChanged;
     std::function<void(const PresetInfo*)> onPresetLoaded;
 
+    // Set by the processor to crossfade a prefetched preset in on a second chain, keeping the
+    // old one audible until the new one plays. Without it the chain fades out, swaps, fades in.
+    std::function<void(std::unique_ptr<juce::XmlElement> chainXml, std::vector<StagedPluginInstance> staged,
+                       std::function<void(ChainProcessor::RestoreResult)> onDone)> stagedSwapHandler;
+
     // Paths
     juce::File getPresetsDirectory() const;
     juce::Array<juce::String> getCategories() const;
@@ -61,13 +77,18 @@ public:
 private:
     std::unique_ptr<juce::XmlElement> createPresetXml(const juce::String& name, const juce::String& category);
     bool parsePresetXml(const juce::XmlElement& xml, juce::StringArray& missingPlugins);
+    void setCurrentPreset(const juce::File& presetFile, const juce::XmlElement* meta);
 
     ChainProcessor& chain;
+    PresetPrefetcher prefetcher;
+    juce::SharedResourcePointer<BlobStore> blobStore;
     juce::Array<PresetInfo> presets;
     std::unique_ptr<PresetInfo> currentPreset;
     bool dirty = false;
     juce::StringArray lastMissingPlugins;
 
+    std::shared_ptr<std::atomic<bool>> aliveFlag { std::make_shared<std::atomic<bool>>(true) };
+
     static constexpr const char* PRESET_EXTENSION = ".pcmpreset";
     static constexpr const char* PRESET_VERSION = "2.0";
 
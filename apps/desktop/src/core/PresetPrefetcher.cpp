@@ -0,0 +1,294 @@
+#include "PresetPrefetcher.h"
+#include "../utils/ProChainLogger.h"
+
+PresetPrefetcher::PresetPrefetcher(PluginManager& pm)
+    : pluginManager(pm)
+{
+}
+
+PresetPrefetcher::~PresetPrefetcher()
+{
+    stopTimer();
+    entries.clear();
+}
+
+bool PresetPrefetcher::prefetch(const juce::File& presetFile, double sampleRate, int blockSize)
+{
+    jassert(juce::MessageManager::getInstance()->isThisTheMessageThread());
+
+    if (auto* existing = findEntry(presetFile))
+    {
+        // Already staged for a different config or the file was re-saved — restage from scratch
+        if (existing->sampleRate != sampleRate || existing->blockSize != blockSize
+            || existing->fileModTime != presetFile.getLastModificationTime())
+        {
+            cancel(presetFile);
+        }
+        else
+        {
+            existing->lastUsed = ++useCounter;
+            if (!existing->isComplete())
+                startTimer(1);
+            return true;
+        }
+    }
+
+    if (!presetFile.existsAsFile())
+        return false;
+
+    auto xml = juce::XmlDocument::parse(presetFile);
+    if (!xml || !xml->hasTagName("PluginChainPreset"))
+        return false;
+
+    auto* chainTree = xml->getChildByName("ChainTree");
+    if (!chainTree)
+        return false;  // V1 presets go through the regular load path
+
+    // Inline referenced chunks so staging applies the same bytes the commit path will
+    blobStore->resolveChunks(*chainTree);
+
+    auto entry = std::make_unique<StagedPreset>();
+    entry->file = presetFile;
+    entry->fileModTime = presetFile.getLastModificationTime();
+    entry->sampleRate = sampleRate;
+    entry->blockSize = blockSize;
+    entry->lastUsed = ++useCounter;
+
+    std::function<void(const juce::XmlElement&)> collect = [&](const juce::XmlElement& nodeXml)
+    {
+        auto type = nodeXml.getStringAttribute("type");
+        if (type == "plugin")
+        {
+            if (!nodeXml.getBoolAttribute("isDryPath", false) && nodeXml.getChildByName("PLUGIN"))
+                entry->pluginNodes.push_back(&nodeXml);
+        }
+        else if (type == "group")
+        {
+            for (auto* childXml : nodeXml.getChildWithTagNameIterator("Node"))
+                collect(*childXml);
+        }
+    };
+    for (auto* nodeXml : chainTree->getChildWithTagNameIterator("Node"))
+        collect(*nodeXml);
+
+    entry->xml = std::move(xml);
+
+    PCLOG("prefetch — " + presetFile.getFileName() + " (" + juce::String(static_cast<int>(entry->pluginNodes.size())) + " plugins)");
+
+    entries.push_back(std::move(entry));
+    enforceBudget(entries.back().get());
+    startTimer(1);
+    return true;
+}
+
+void PresetPrefetcher::cancel(const juce::File& presetFile)
+{
+    jassert(juce::MessageManager::getInstance()->isThisTheMessageThread());
+
+    entries.erase(std::remove_if(entries.begin(), entries.end(),
+                                 [&](const std::unique_ptr<StagedPreset>& e) { return e->file == presetFile; }),
+                  entries.end());
+
+    if (entries.empty())
+        stopTimer();
+}
+
+void PresetPrefetcher::cancelAll()
+{
+    jassert(juce::MessageManager::getInstance()->isThisTheMessageThread());
+    stopTimer();
+    entries.clear();
+}
+
+bool PresetPrefetcher::isReady(const juce::File& presetFile) const
+{
+    auto* entry = findEntry(presetFile);
+    return entry != nullptr && entry->isComplete() && !entry->overBudget;
+}
+
+std::vector<StagedPluginInstance> PresetPrefetcher::take(const juce::File& presetFile, double sampleRate, int blockSize)
+{
+    jassert(juce::MessageManager::getInstance()->isThisTheMessageThread());
+
+    std::vector<StagedPluginInstance> result;
+    auto* entry = findEntry(presetFile);
+    if (!entry)
+        return result;
+
+    bool usable = entry->isComplete()
+               && !entry->overBudget
+               && entry->sampleRate == sampleRate
+               && entry->blockSize == blockSize
+               && entry->fileModTime == presetFile.getLastModificationTime();
+
+    if (usable)
+        result = std::move(entry->instances);
+
+    cancel(presetFile);
+    return result;
+}
+
+void PresetPrefetcher::setMemoryBudget(size_t newMaxBytes, int newMaxPresets)
+{
+    maxBytes = newMaxBytes;
+    maxPresets = juce::jmax(1, newMaxPresets);
+    enforceBudget(nullptr);
+}
+
+size_t PresetPrefetcher::getEstimatedBytesInUse() const
+{
+    size_t total = 0;
+    for (const auto& e : entries)
+        total += e->estimatedBytes;
+    return total;
+}
+
+juce::var PresetPrefetcher::getStatusAsJson() const
+{
+    juce::Array<juce::var> arr;
+    for (const auto& e : entries)
+    {
+        auto* obj = new juce::DynamicObject();
+        obj->setProperty("path", e->file.getFullPathName());
+        obj->setProperty("staged", static_cast<int>(e->instances.size()));
+        obj->setProperty("total", static_cast<int>(e->pluginNodes.size()));
+        obj->setProperty("ready", e->isComplete() && !e->overBudget);
+        obj->setProperty("overBudget", e->overBudget);
+        arr.add(juce::var(obj));
+    }
+
+    auto* result = new juce::DynamicObject();
+    result->setProperty("presets", arr);
+    result->setProperty("estimatedBytes", static_cast<juce::int64>(getEstimatedBytesInUse()));
+    result->setProperty("budgetBytes", static_cast<juce::int64>(maxBytes));
+    return juce::var(result);
+}
+
+void PresetPrefetcher::timerCallback()
+{
+    // Most recently requested preset first — that's the one the user is about to commit
+    StagedPreset* target = nullptr;
+    for (auto& e : entries)
+    {
+        if (!e->isComplete() && (target == nullptr || e->lastUsed > target->lastUsed))
+            target = e.get();
+    }
+
+    if (target == nullptr)
+    {
+        stopTimer();
+        return;
+    }
+
+    stageNextPlugin(*target);
+    enforceBudget(target);
+}
+
+void PresetPrefetcher::stageNextPlugin(StagedPreset& preset)
+{
+    const auto& nodeXml = *preset.pluginNodes[preset.nextToStage++];
+
+    StagedPluginInstance staged;
+    juce::PluginDescription desc;
+    desc.loadFromXml(*nodeXml.getChildByName("PLUGIN"));
+    staged.fileOrIdentifier = desc.fileOrIdentifier;
+
+    juce::String errorMessage;
+    auto instance = pluginManager.createPluginInstance(desc, preset.sampleRate, preset.blockSize, errorMessage);
+
+    // Same cross-format fallback as ChainProcessor::xmlToNode()
+    if (!instance)
+    {
+        auto known = pluginManager.getSnapshot();
+        for (const auto& knownDesc : known->findByManufacturer(desc.manufacturerName))
+        {
+            if (knownDesc.name.equalsIgnoreCase(desc.name) &&
+                knownDesc.manufacturerName.equalsIgnoreCase(desc.manufacturerName))
+            {
+                juce::String fallbackError;
+                instance = pluginManager.createPluginInstance(knownDesc, preset.sampleRate, preset.blockSize, fallbackError);
+                if (instance)
+                {
+                    desc = knownDesc;
+                    break;
+                }
+            }
+        }
+    }
+
+    if (!instance)
+    {
+        // Leave it for the commit path to report as missing
+        PCLOG("prefetch — could not stage " + desc.name + ": " + errorMessage);
+        return;
+    }
+
+    instance->prepareToPlay(preset.sampleRate, preset.blockSize);
+
+    auto stateBase64 = nodeXml.getStringAttribute("state");
+    size_t stateBytes = 0;
+    if (stateBase64.isNotEmpty())
+    {
+        juce::MemoryBlock state;
+        state.fromBase64Encoding(stateBase64);
+        stateBytes = state.getSize();
+
+        const size_t maxPresetSize = 10 * 1024 * 1024;
+        if (stateBytes <= maxPresetSize)
+        {
+            instance->setStateInformation(state.getData(), static_cast<int>(state.getSize()));
+            staged.appliedStateHash = stateBase64.hashCode64();
+        }
+    }
+
+    staged.description = desc;
+    staged.instance = std::move(instance);
+    preset.instances.push_back(std::move(staged));
+    preset.estimatedBytes += kEstimatedBytesPerInstance + stateBytes;
+}
+
+void PresetPrefetcher::enforceBudget(const StagedPreset* keep)
+{
+    // Evict least recently used presets until within both caps
+    auto overCaps = [this]
+    {
+        return getEstimatedBytesInUse() > maxBytes || static_cast<int>(entries.size()) > maxPresets;
+    };
+
+    while (overCaps() && entries.size() > 1)
+    {
+        auto victim = entries.end();
+        for (auto it = entries.begin(); it != entries.end(); ++it)
+        {
+            if (it->get() == keep)
+                continue;
+            if (victim == entries.end() || (*it)->lastUsed < (*victim)->lastUsed)
+                victim = it;
+        }
+        if (victim == entries.end())
+            break;
+
+        PCLOG("prefetch — evicting " + (*victim)->file.getFileName());
+        entries.erase(victim);
+    }
+
+    // A single preset larger than the whole budget: stop staging and release what we have.
+    // The commit falls back to a regular load.
+    if (keep != nullptr && getEstimatedBytesInUse() > maxBytes)
+    {
+        if (auto* entry = findEntry(keep->file))
+        {
+            entry->overBudget = true;
+            entry->instances.clear();
+            entry->estimatedBytes = 0;
+        }
+    }
+}
+
+PresetPrefetcher::StagedPreset* PresetPrefetcher::findEntry(const juce::File& file) const
+{
+    for (const auto& e : entries)
+        if (e->file == file)
+            return e.get();
+    return nullptr;
+}
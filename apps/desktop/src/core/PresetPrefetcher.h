@@ -0,0 +1,91 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include "ChainProcessor.h"
+#include <memory>
+#include <vector>
+
+/**
+ * Stages plugin instances for presets the user is *about* to load
+ * (hover in the browser, next/previous stepping) so that committing the
+ * preset is a graph swap instead of a full instantiate-everything load.
+ *
+ * Plugin formats (AU in particular) require instantiation on the message
+ * thread, so staging is spread across timer ticks — one plugin per tick —
+ * keeping the UI responsive and making cancellation cheap between plugins.
+ *
+ * Staged instances are prepared at the chain's current sample rate/block
+ * size and have their preset chunk applied, so the commit path only needs
+ * to insert them into the graph (see ChainProcessor::restoreChainFromXml).
+ *
+ * Memory is bounded by an estimated byte budget and a cap on the number of
+ * staged presets; the least recently requested preset is evicted first.
+ */
+class PresetPrefetcher : private juce::Timer
+{
+public:
+    PresetPrefetcher(PluginManager& pluginManager);
+    ~PresetPrefetcher() override;
+
+    /** Begin staging a preset. Returns false if the file can't be parsed or is not a V2 preset.
+        Re-requesting an already staged preset just marks it most recently used. */
+    bool prefetch(const juce::File& presetFile, double sampleRate, int blockSize);
+
+    /** Drop a staged (or in-progress) preset. */
+    void cancel(const juce::File& presetFile);
+
+    /** Drop everything that is staged — e.g. the user left the preset browser. */
+    void cancelAll();
+
+    /** True once every plugin in the preset has been staged (or failed to stage). */
+    bool isReady(const juce::File& presetFile) const;
+
+    /** Take ownership of a fully staged preset's instances for the given audio config.
+        Returns an empty vector (and drops the entry) if it's not ready, the file changed
+        on disk, or the sample rate/block size no longer matches. */
+    std::vector<StagedPluginInstance> take(const juce::File& presetFile, double sampleRate, int blockSize);
+
+    // Budget (defaults: 256 MB estimated, 2 presets)
+    void setMemoryBudget(size_t maxBytes, int maxStagedPresets);
+    size_t getEstimatedBytesInUse() const;
+
+    juce::var getStatusAsJson() const;
+
+private:
+    struct StagedPreset
+    {
+        juce::File file;
+        juce::Time fileModTime;
+        double sampleRate = 0.0;
+        int blockSize = 0;
+
+        // Plugin <Node> elements in document order, with the XML they live in
+        std::unique_ptr<juce::XmlElement> xml;
+        std::vector<const juce::XmlElement*> pluginNodes;
+        size_t nextToStage = 0;
+
+        std::vector<StagedPluginInstance> instances;
+        size_t estimatedBytes = 0;
+        bool overBudget = false;
+        uint32_t lastUsed = 0;
+
+        bool isComplete() const { return overBudget || nextToStage >= pluginNodes.size(); }
+    };
+
+    void timerCallback() override;
+    void stageNextPlugin(StagedPreset& preset);
+    void enforceBudget(const StagedPreset* keep);
+    StagedPreset* findEntry(const juce::File& file) const;
+
+    // Rough per-instance cost — plugin heap usage is not observable from the host
+    static constexpr size_t kEstimatedBytesPerInstance = 8 * 1024 * 1024;
+
+    PluginManager& pluginManager;
+    juce::SharedResourcePointer<BlobStore> blobStore;
+    std::vector<std::unique_ptr<StagedPreset>> entries;
+    size_t maxBytes = 256 * 1024 * 1024;
+    int maxPresets = 2;
+    uint32_t useCounter = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PresetPrefetcher)
+};
@@ -0,0 +1,483 @@
+#include "RealtimeScheduler.h"
+#include "../utils/ProChainLogger.h"
+#include <cmath>
+#include <thread>
+
+//==============================================================================
+class RealtimeScheduler::Worker : public juce::Thread
+{
+public:
+    Worker(RealtimeScheduler& s, int i)
+        : juce::Thread("ProChain RT Worker " + juce::String(i + 1)), scheduler(s), cursor(i) {}
+
+    void run() override
+    {
+        while (!threadShouldExit())
+        {
+            scheduler.maybeRebalance();
+
+            if (scheduler.runNextJob(cursor))
+                continue;
+
+            // Sleeping count first, then re-check: a submit either sees us asleep and signals,
+            // or we see its job here.
+            scheduler.sleepingWorkers.fetch_add(1);
+            if (scheduler.pendingJobs.load() == 0)
+                scheduler.wakeEvent.wait(RealtimeScheduler::kRebalanceIntervalMs);
+            scheduler.sleepingWorkers.fetch_sub(1);
+        }
+    }
+
+private:
+    RealtimeScheduler& scheduler;
+    int cursor;   // Round-robin start, staggered per worker
+};
+
+//==============================================================================
+void RealtimeScheduler::JobQueue::reset() noexcept
+{
+    for (size_t i = 0; i < cells.size(); ++i)
+        cells[i].sequence.store(i, std::memory_order_relaxed);
+    enqueuePos.store(0, std::memory_order_relaxed);
+    dequeuePos.store(0, std::memory_order_release);
+}
+
+bool RealtimeScheduler::JobQueue::push(const Job& job) noexcept
+{
+    auto pos = enqueuePos.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        auto& cell = cells[pos & kMask];
+        const auto seq = cell.sequence.load(std::memory_order_acquire);
+        const auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+        if (diff == 0)
+        {
+            if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                cell.job = job;
+                cell.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (diff < 0)
+        {
+            return false;   // Full
+        }
+        else
+        {
+            pos = enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool RealtimeScheduler::JobQueue::pop(Job& job) noexcept
+{
+    auto pos = dequeuePos.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        auto& cell = cells[pos & kMask];
+        const auto seq = cell.sequence.load(std::memory_order_acquire);
+        const auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+
+        if (diff == 0)
+        {
+            if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                job = cell.job;
+                cell.sequence.store(pos + kMask + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (diff < 0)
+        {
+            return false;   // Empty
+        }
+        else
+        {
+            pos = dequeuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+int RealtimeScheduler::JobQueue::size() const noexcept
+{
+    const auto head = dequeuePos.load(std::memory_order_relaxed);
+    const auto tail = enqueuePos.load(std::memory_order_relaxed);
+    return tail > head ? static_cast<int>(tail - head) : 0;
+}
+
+//==============================================================================
+RealtimeScheduler::Client::Client(RealtimeScheduler& s, int ownerId)
+    : scheduler(s), slot(s.registerClient(ownerId))
+{
+}
+
+RealtimeScheduler::Client::~Client()
+{
+    scheduler.unregisterClient(slot);
+}
+
+bool RealtimeScheduler::Client::submit(JobFunction fn, void* context) noexcept
+{
+    return scheduler.submit(slot, { fn, context });
+}
+
+void RealtimeScheduler::Client::waitUntilDone() noexcept
+{
+    if (slot < 0)
+        return;
+
+    auto& s = scheduler.slots[static_cast<size_t>(slot)];
+
+    // Help first: whatever no worker has picked up yet runs right here
+    while (scheduler.runOne(s)) {}
+
+    while (s.running.load() > 0)
+        std::this_thread::yield();
+}
+
+bool RealtimeScheduler::Client::isIdle() const noexcept
+{
+    if (slot < 0)
+        return true;
+
+    const auto& s = scheduler.slots[static_cast<size_t>(slot)];
+    return s.running.load() == 0 && s.queue.size() == 0;
+}
+
+RealtimeScheduler::ClientStats RealtimeScheduler::Client::getStats() const
+{
+    return scheduler.getStats(slot);
+}
+
+//==============================================================================
+RealtimeScheduler::RealtimeScheduler()
+    : RealtimeScheduler(getDefaultNumWorkers())
+{
+}
+
+RealtimeScheduler::RealtimeScheduler(int workerCount)
+    : numWorkers(juce::jmax(1, workerCount)),
+      slots(std::make_unique<Slot[]>(static_cast<size_t>(kMaxClients)))
+{
+}
+
+RealtimeScheduler::~RealtimeScheduler()
+{
+    jassert(slotLimit.load() == 0);   // Every Client must be gone before the scheduler
+
+    for (auto& w : workers)
+        w->signalThreadShouldExit();
+
+    for (auto& w : workers)
+    {
+        wakeEvent.signal();
+        w->stopThread(2000);
+    }
+}
+
+int RealtimeScheduler::getDefaultNumWorkers()
+{
+    return juce::jmax(1, juce::SystemStats::getNumPhysicalCpus() - 1);
+}
+
+void RealtimeScheduler::startWorkers()
+{
+    // Called under clientLock
+    if (!workers.empty())
+        return;
+
+    const auto options = juce::Thread::RealtimeOptions{}.withPriority(8);
+    for (int i = 0; i < numWorkers; ++i)
+    {
+        auto worker = std::make_unique<Worker>(*this, i);
+        if (!worker->startRealtimeThread(options))
+        {
+            PCLOG("RealtimeScheduler: worker " + juce::String(i + 1) + " fell back to highest priority");
+            worker->startThread(juce::Thread::Priority::highest);
+        }
+        workers.push_back(std::move(worker));
+    }
+
+    lastRebalanceTicks.store(juce::Time::getHighResolutionTicks());
+    PCLOG("RealtimeScheduler: started " + juce::String(numWorkers) + " workers");
+}
+
+int RealtimeScheduler::registerClient(int ownerId)
+{
+    std::lock_guard<std::mutex> lock(clientLock);
+
+    for (int i = 0; i < kMaxClients; ++i)
+    {
+        auto& s = slots[static_cast<size_t>(i)];
+        if (s.inUse)
+            continue;
+
+        s.inUse = true;
+        s.ownerId = ownerId;
+        s.queue.reset();
+
+        // `running` and the busy counters are left alone: a late worker's claim on the old
+        // client still balances, and rebalance() only ever looks at busy-time deltas
+        s.allowed.store(numWorkers);
+        s.jobsCompleted.store(0);
+        s.jobsRejected.store(0);
+        s.utilization.store(0.0f);
+        s.share.store(0.0f);
+        s.open.store(true);
+
+        if (i >= slotLimit.load())
+            slotLimit.store(i + 1);
+
+        startWorkers();
+        return i;
+    }
+
+    jassertfalse;   // More than kMaxClients instances — this one runs everything inline
+    return -1;
+}
+
+void RealtimeScheduler::unregisterClient(int slot)
+{
+    if (slot < 0)
+        return;
+
+    auto& s = slots[static_cast<size_t>(slot)];
+    s.open.store(false);
+
+    // A worker that incremented `running` before we closed may still be inside a job
+    while (s.running.load() > 0)
+        juce::Thread::sleep(1);
+
+    Job discarded;
+    while (s.queue.pop(discarded))
+        pendingJobs.fetch_sub(1);
+
+    std::lock_guard<std::mutex> lock(clientLock);
+    s.inUse = false;
+    s.ownerId = -1;
+
+    int limit = slotLimit.load();
+    while (limit > 0 && !slots[static_cast<size_t>(limit - 1)].inUse)
+        --limit;
+    slotLimit.store(limit);
+}
+
+bool RealtimeScheduler::submit(int slot, const Job& job) noexcept
+{
+    if (slot < 0)
+        return false;
+
+    auto& s = slots[static_cast<size_t>(slot)];
+    if (!s.open.load() || !s.queue.push(job))
+    {
+        s.jobsRejected.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    pendingJobs.fetch_add(1);
+    if (sleepingWorkers.load() > 0)
+        wakeEvent.signal();
+    return true;
+}
+
+bool RealtimeScheduler::runOne(Slot& s) noexcept
+{
+    // Claim before popping so `running` covers the whole window in which the job exists
+    // outside the queue (unregisterClient and waitUntilDone rely on that)
+    s.running.fetch_add(1);
+
+    Job job;
+    if (!s.open.load() || !s.queue.pop(job))
+    {
+        s.running.fetch_sub(1);
+        return false;
+    }
+
+    pendingJobs.fetch_sub(1);
+    if (pendingJobs.load() > 0 && sleepingWorkers.load() > 0)
+        wakeEvent.signal();   // Pass the wake-up on rather than leave queued work to one worker
+
+    const auto start = juce::Time::getHighResolutionTicks();
+    job.fn(job.context);
+    const auto elapsed = juce::Time::getHighResolutionTicks() - start;
+
+    s.busyTicks.fetch_add(static_cast<uint64_t>(juce::jmax<int64_t>(0, elapsed)), std::memory_order_relaxed);
+    s.jobsCompleted.fetch_add(1, std::memory_order_relaxed);
+    s.running.fetch_sub(1);
+    return true;
+}
+
+bool RealtimeScheduler::runNextJob(int& cursor) noexcept
+{
+    if (pendingJobs.load() == 0)
+        return false;
+
+    const int limit = slotLimit.load();
+    if (limit == 0)
+        return false;
+
+    // Pass 0: clients still inside their fair share. Pass 1: anyone — spare capacity is
+    // lent out rather than left idle.
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        for (int k = 0; k < limit; ++k)
+        {
+            const int index = (cursor + k) % limit;
+            auto& s = slots[static_cast<size_t>(index)];
+
+            if (!s.open.load(std::memory_order_relaxed) || s.queue.size() == 0)
+                continue;
+            if (pass == 0 && s.running.load(std::memory_order_relaxed) >= s.allowed.load(std::memory_order_relaxed))
+                continue;
+
+            if (runOne(s))
+            {
+                cursor = (index + 1) % limit;
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+void RealtimeScheduler::maybeRebalance() noexcept
+{
+    const auto now = juce::Time::getHighResolutionTicks();
+    const auto last = lastRebalanceTicks.load();
+    const auto interval = juce::Time::getHighResolutionTicksPerSecond() * kRebalanceIntervalMs / 1000;
+
+    if (now - last < interval || rebalancing.exchange(true))
+        return;
+
+    // Re-check under the flag: another worker may have just finished a round
+    const auto confirmed = lastRebalanceTicks.load();
+    if (now - confirmed >= interval)
+    {
+        rebalance(now - confirmed);
+        lastRebalanceTicks.store(now);
+    }
+
+    rebalancing.store(false);
+}
+
+void RealtimeScheduler::rebalance(int64_t elapsedTicks) noexcept
+{
+    constexpr float kSmoothing = 0.3f;
+    constexpr float kHeadroom = 1.25f;   // Let a growing client reach past what it used last round
+
+    const int limit = slotLimit.load();
+    const auto elapsed = static_cast<double>(juce::jmax<int64_t>(1, elapsedTicks));
+
+    int numDemanding = 0;
+    for (int i = 0; i < limit; ++i)
+    {
+        auto& s = slots[static_cast<size_t>(i)];
+        if (!s.open.load())
+        {
+            s.demand = 0.0f;
+            continue;
+        }
+
+        const auto busy = s.busyTicks.load(std::memory_order_relaxed);
+        const auto cores = static_cast<float>(static_cast<double>(busy - s.lastBusyTicks) / elapsed);
+        s.lastBusyTicks = busy;
+
+        const float utilization = s.utilization.load(std::memory_order_relaxed) * (1.0f - kSmoothing)
+                                + cores * kSmoothing;
+        s.utilization.store(utilization, std::memory_order_relaxed);
+
+        // A client with queued work wants at least one core whatever its history; an idle
+        // client's demand decays to zero and its capacity goes to the others
+        s.demand = utilization * kHeadroom;
+        if (s.queue.size() > 0 || s.running.load() > 0)
+            s.demand = juce::jmax(s.demand, 1.0f);
+
+        if (s.demand > 0.0f)
+            ++numDemanding;
+    }
+
+    // Max-min fair split of the workers across the demands (water filling)
+    float capacity = static_cast<float>(numWorkers);
+    std::array<bool, static_cast<size_t>(kMaxClients)> settled {};
+    int unsettled = numDemanding;
+
+    while (unsettled > 0)
+    {
+        const float equalShare = capacity / static_cast<float>(unsettled);
+        bool anySettled = false;
+
+        for (int i = 0; i < limit; ++i)
+        {
+            auto& s = slots[static_cast<size_t>(i)];
+            if (settled[static_cast<size_t>(i)] || s.demand <= 0.0f || s.demand > equalShare)
+                continue;
+
+            s.share.store(s.demand, std::memory_order_relaxed);
+            settled[static_cast<size_t>(i)] = true;
+            capacity -= s.demand;
+            --unsettled;
+            anySettled = true;
+        }
+
+        if (!anySettled)
+        {
+            for (int i = 0; i < limit; ++i)
+            {
+                auto& s = slots[static_cast<size_t>(i)];
+                if (!settled[static_cast<size_t>(i)] && s.demand > 0.0f)
+                    s.share.store(equalShare, std::memory_order_relaxed);
+            }
+            break;
+        }
+    }
+
+    for (int i = 0; i < limit; ++i)
+    {
+        auto& s = slots[static_cast<size_t>(i)];
+        if (s.demand <= 0.0f)
+            s.share.store(0.0f, std::memory_order_relaxed);
+
+        const int allowed = static_cast<int>(std::ceil(s.share.load(std::memory_order_relaxed)));
+        s.allowed.store(juce::jlimit(1, numWorkers, allowed), std::memory_order_relaxed);
+    }
+}
+
+RealtimeScheduler::ClientStats RealtimeScheduler::getStats(int slot) const
+{
+    ClientStats stats;
+    if (slot < 0)
+        return stats;
+
+    const auto& s = slots[static_cast<size_t>(slot)];
+    {
+        std::lock_guard<std::mutex> lock(clientLock);
+        stats.ownerId = s.ownerId;
+    }
+    stats.utilization = s.utilization.load(std::memory_order_relaxed);
+    stats.share = s.share.load(std::memory_order_relaxed);
+    stats.queued = s.queue.size();
+    stats.running = s.running.load(std::memory_order_relaxed);
+    stats.jobsCompleted = s.jobsCompleted.load(std::memory_order_relaxed);
+    stats.jobsRejected = s.jobsRejected.load(std::memory_order_relaxed);
+    return stats;
+}
+
+std::vector<RealtimeScheduler::ClientStats> RealtimeScheduler::getStats() const
+{
+    std::vector<int> inUse;
+    {
+        std::lock_guard<std::mutex> lock(clientLock);
+        for (int i = 0; i < slotLimit.load(); ++i)
+            if (slots[static_cast<size_t>(i)].inUse)
+                inUse.push_back(i);
+    }
+
+    std::vector<ClientStats> result;
+    result.reserve(inUse.size());
+    for (int slot : inUse)
+        result.push_back(getStats(slot));
+    return result;
+}
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * Process-wide pool of real-time worker threads shared by every ProChain instance.
+ *
+ * A session with a hundred instances must not start a hundred sets of threads, so
+ * anything that wants to run work off its own audio thread (analysis, later parallel
+ * branches) submits jobs here instead. The pool is sized to the hardware once and
+ * never grows.
+ *
+ * Each instance holds a Client. Every kRebalanceIntervalMs the measured busy time of
+ * each client is turned into a utilization figure (in cores) and the workers are
+ * split max-min fair: clients asking for less than an equal share keep what they use,
+ * and the capacity they leave — including everything an idle instance would have had —
+ * goes to the busy ones. Shares only decide who is served first; a worker with nothing
+ * in-share to do still takes any queued job, so the pool never idles while work waits.
+ *
+ * One scheduler per process — share it via juce::SharedResourcePointer<RealtimeScheduler>,
+ * like InstanceRegistry. Workers start with the first client.
+ *
+ * Thread safety:
+ * - Client construction/destruction and getStats() may be called from any non-audio thread.
+ * - Client::submit() and Client::waitUntilDone() are lock- and allocation-free, and must be
+ *   called from one thread per client (normally that instance's audio thread).
+ */
+class RealtimeScheduler
+{
+public:
+    using JobFunction = void (*)(void* context);
+
+    static constexpr int kMaxClients = 256;
+    static constexpr int kQueueCapacity = 128;       // Per client, power of two
+    static constexpr int kRebalanceIntervalMs = 100;
+
+    struct ClientStats
+    {
+        int ownerId = -1;
+        float utilization = 0.0f;      // Smoothed cores in use
+        float share = 0.0f;            // Cores granted at the last rebalance
+        int queued = 0;
+        int running = 0;
+        uint64_t jobsCompleted = 0;
+        uint64_t jobsRejected = 0;     // Queue full or client closing — the caller ran it inline
+    };
+
+    /** One instance's handle on the pool. Unregisters on destruction, after waiting for its
+        running jobs; jobs still queued at that point are discarded, not run. */
+    class Client
+    {
+    public:
+        Client(RealtimeScheduler& scheduler, int ownerId);
+        ~Client();
+
+        /** Queue a job. Returns false if the queue is full — run it inline instead. */
+        bool submit(JobFunction fn, void* context) noexcept;
+
+        /** Run this client's still-queued jobs on the calling thread, then spin until the
+            ones already taken by workers have finished. */
+        void waitUntilDone() noexcept;
+
+        bool isIdle() const noexcept;
+        ClientStats getStats() const;
+
+    private:
+        RealtimeScheduler& scheduler;
+        int slot;
+
+        JUCE_DECLARE_NON_COPYABLE(Client)
+    };
+
+    RealtimeScheduler();
+    explicit RealtimeScheduler(int numWorkers);
+    ~RealtimeScheduler();
+
+    int getNumWorkers() const noexcept { return numWorkers; }
+    std::vector<ClientStats> getStats() const;
+
+    /** Physical cores minus one, so the host's own audio thread keeps a core to itself. */
+    static int getDefaultNumWorkers();
+
+private:
+    class Worker;
+
+    struct Job
+    {
+        JobFunction fn = nullptr;
+        void* context = nullptr;
+    };
+
+    // Bounded multi-producer/multi-consumer ring (Vyukov): the owner pushes, workers and the
+    // owner (in waitUntilDone) pop.
+    class JobQueue
+    {
+    public:
+        void reset() noexcept;
+        bool push(const Job& job) noexcept;
+        bool pop(Job& job) noexcept;
+        int size() const noexcept;
+
+    private:
+        struct Cell
+        {
+            std::atomic<size_t> sequence { 0 };
+            Job job;
+        };
+
+        static constexpr size_t kMask = static_cast<size_t>(kQueueCapacity) - 1;
+        std::array<Cell, static_cast<size_t>(kQueueCapacity)> cells;
+        std::atomic<size_t> enqueuePos { 0 };
+        std::atomic<size_t> dequeuePos { 0 };
+    };
+
+    struct Slot
+    {
+        std::atomic<bool> open { false };
+        std::atomic<int> running { 0 };      // Claimed and not finished (incremented before the pop)
+        std::atomic<int> allowed { 1 };      // Concurrent jobs within the fair share
+        std::atomic<uint64_t> busyTicks { 0 };
+        std::atomic<uint64_t> jobsCompleted { 0 };
+        std::atomic<uint64_t> jobsRejected { 0 };
+        std::atomic<float> utilization { 0.0f };
+        std::atomic<float> share { 0.0f };
+        JobQueue queue;
+
+        // Rebalance-only
+        uint64_t lastBusyTicks = 0;
+        float demand = 0.0f;
+
+        // clientLock
+        bool inUse = false;
+        int ownerId = -1;
+    };
+
+    int registerClient(int ownerId);
+    void unregisterClient(int slot);
+    ClientStats getStats(int slot) const;
+
+    bool submit(int slot, const Job& job) noexcept;
+    bool runOne(Slot& s) noexcept;
+    bool runNextJob(int& cursor) noexcept;
+    void maybeRebalance() noexcept;
+    void rebalance(int64_t elapsedTicks) noexcept;
+    void startWorkers();
+
+    const int numWorkers;
+    std::unique_ptr<Slot[]> slots;
+    std::atomic<int> slotLimit { 0 };        // Slots at or above this are unused
+    std::atomic<int> pendingJobs { 0 };
+    std::atomic<int> sleepingWorkers { 0 };
+    juce::WaitableEvent wakeEvent;
+
+    std::atomic<bool> rebalancing { false };
+    std::atomic<int64_t> lastRebalanceTicks { 0 };
+
+    mutable std::mutex clientLock;
+    std::vector<std::unique_ptr<Worker>> workers;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RealtimeScheduler)
+};
@@ -0,0 +1,174 @@
+#include "ScanPathWatcher.h"
+
+#if JUCE_LINUX
+ #include <poll.h>
+ #include <sys/inotify.h>
+ #include <unistd.h>
+#endif
+
+namespace
+{
+    // Folders under a search path are watched this deep (vendor/product/...)
+    constexpr int kMaxWatchDepth = 3;
+
+    bool isPluginBundle(const juce::File& dir)
+    {
+        return dir.hasFileExtension("vst3;component;vst;clap;lv2;bundle");
+    }
+}
+
+ScanPathWatcher::ScanPathWatcher()
+    : juce::Thread("ScanPathWatcher")
+{
+}
+
+ScanPathWatcher::~ScanPathWatcher()
+{
+    stopWatching();
+}
+
+void ScanPathWatcher::setPaths(const juce::Array<juce::File>& directories)
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+    stopWatching();
+    paths = directories;
+
+   #if JUCE_LINUX
+    inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotifyFd < 0)
+    {
+        std::cerr << "ERROR: inotify unavailable, auto-scan falls back to periodic walks" << std::endl;
+        return;
+    }
+
+    for (const auto& dir : paths)
+        addWatchesRecursively(dir, 0);
+
+    if (watchedDirectories.empty())
+    {
+        close(inotifyFd);
+        inotifyFd = -1;
+        return;
+    }
+
+    #if JUCE_DEBUG
+    std::cerr << "ScanPathWatcher: watching " << watchedDirectories.size() << " directories" << std::endl;
+    #endif
+
+    watching.store(true);
+    startThread();
+   #endif
+}
+
+void ScanPathWatcher::stopWatching()
+{
+    stopThread(2000);
+    stopTimer();
+    cancelPendingUpdate();
+    watching.store(false);
+
+   #if JUCE_LINUX
+    if (inotifyFd >= 0)
+        close(inotifyFd);
+    inotifyFd = -1;
+
+    const juce::ScopedLock sl(watchLock);
+    watchedDirectories.clear();
+   #endif
+}
+
+void ScanPathWatcher::addWatchesRecursively(const juce::File& directory, int depth)
+{
+   #if JUCE_LINUX
+    if (!directory.isDirectory() || isPluginBundle(directory) || depth > kMaxWatchDepth)
+        return;
+
+    constexpr auto mask = IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_CLOSE_WRITE
+                        | IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR;
+    const int wd = inotify_add_watch(inotifyFd, directory.getFullPathName().toRawUTF8(), mask);
+    if (wd < 0)
+        return;
+
+    {
+        const juce::ScopedLock sl(watchLock);
+        watchedDirectories[wd] = directory;
+    }
+
+    for (const auto& child : directory.findChildFiles(juce::File::findDirectories, false))
+        addWatchesRecursively(child, depth + 1);
+   #else
+    juce::ignoreUnused(directory, depth);
+   #endif
+}
+
+void ScanPathWatcher::run()
+{
+   #if JUCE_LINUX
+    alignas(inotify_event) char buffer[4096];
+
+    while (!threadShouldExit())
+    {
+        pollfd pfd { inotifyFd, POLLIN, 0 };
+        if (poll(&pfd, 1, 250) <= 0)
+            continue;
+
+        bool changed = false;
+        for (;;)
+        {
+            const auto numRead = read(inotifyFd, buffer, sizeof(buffer));
+            if (numRead <= 0)
+                break;
+
+            for (ssize_t offset = 0; offset < numRead;)
+            {
+                const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+                offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+                changed = true;
+
+                if (event->mask & IN_IGNORED)
+                {
+                    const juce::ScopedLock sl(watchLock);
+                    watchedDirectories.erase(event->wd);
+                    continue;
+                }
+
+                // New vendor folder: watch it too, so plugins installed into it are seen
+                if ((event->mask & IN_ISDIR) && (event->mask & (IN_CREATE | IN_MOVED_TO)) && event->len > 0)
+                {
+                    juce::File parent;
+                    int depth = 0;
+                    {
+                        const juce::ScopedLock sl(watchLock);
+                        auto it = watchedDirectories.find(event->wd);
+                        if (it == watchedDirectories.end())
+                            continue;
+                        parent = it->second;
+                    }
+
+                    for (const auto& root : paths)
+                        if (parent.isAChildOf(root))
+                            depth = juce::jmax(depth, parent.getRelativePathFrom(root).retainCharacters("/").length() + 1);
+
+                    addWatchesRecursively(parent.getChildFile(juce::String::fromUTF8(event->name)), depth + 1);
+                }
+            }
+        }
+
+        if (changed)
+            triggerAsyncUpdate();
+    }
+   #endif
+}
+
+void ScanPathWatcher::handleAsyncUpdate()
+{
+    // Restart the debounce: report once the installer has gone quiet
+    startTimer(kDebounceMs);
+}
+
+void ScanPathWatcher::timerCallback()
+{
+    stopTimer();
+    if (onChange)
+        onChange();
+}
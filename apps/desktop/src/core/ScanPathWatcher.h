@@ -0,0 +1,56 @@
+#pragma once
+
+#include <juce_events/juce_events.h>
+#include <atomic>
+#include <functional>
+#include <map>
+
+/**
+ * ScanPathWatcher - Notices plugin installs and removals in the scan search paths
+ *
+ * On Linux the search paths (and the folders under them, not the inside of plugin
+ * bundles) are watched with inotify on a background thread. Changes are debounced —
+ * installers touch many files — and reported once on the message thread through
+ * onChange. With a watcher running, auto-scan only walks the search paths when
+ * something changed instead of on every tick.
+ *
+ * Elsewhere isWatching() is false and auto-scan keeps its periodic walk.
+ */
+class ScanPathWatcher : private juce::Thread,
+                        private juce::AsyncUpdater,
+                        private juce::Timer
+{
+public:
+    static constexpr int kDebounceMs = 1500;
+
+    ScanPathWatcher();
+    ~ScanPathWatcher() override;
+
+    /** Replace the watched directories. Message thread. */
+    void setPaths(const juce::Array<juce::File>& directories);
+
+    /** True while the platform watcher is running on at least one directory. */
+    bool isWatching() const { return watching.load(); }
+
+    /** Called on the message thread after changes settle. */
+    std::function<void()> onChange;
+
+private:
+    void run() override;
+    void handleAsyncUpdate() override;
+    void timerCallback() override;
+
+    void stopWatching();
+    void addWatchesRecursively(const juce::File& directory, int depth);
+
+    std::atomic<bool> watching { false };
+    juce::Array<juce::File> paths;
+
+   #if JUCE_LINUX
+    int inotifyFd = -1;
+    juce::CriticalSection watchLock;
+    std::map<int, juce::File> watchedDirectories;   // Watch descriptor -> directory
+   #endif
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ScanPathWatcher)
+};
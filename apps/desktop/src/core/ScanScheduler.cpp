@@ -0,0 +1,244 @@
+#include "ScanScheduler.h"
+#include "ScannerUtils.h"
+#include <algorithm>
+
+ScanScheduler::ScanScheduler(ScanFunction fn, const juce::File& pedalDir)
+    : scanFunction(std::move(fn)), pedalDirectory(pedalDir)
+{
+}
+
+ScanScheduler::~ScanScheduler()
+{
+    stop();
+    waitUntilFinished();
+}
+
+void ScanScheduler::start(std::vector<Job> newJobs, int numWorkers)
+{
+    jassert(workers.empty());   // One batch per scheduler
+
+    numWorkers = resolveConcurrency(numWorkers, newJobs.size());
+
+    // Isolated jobs only isolate when nothing else can have been claimed before them
+    jassert(std::is_partitioned(newJobs.begin(), newJobs.end(), [](const Job& j) { return j.isolated; }));
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        jobs = std::move(newJobs);
+        inFlight.assign(static_cast<size_t>(numWorkers), {});
+        activeWorkers = numWorkers;
+    }
+
+    if (pedalDirectory != juce::File())
+        pedalDirectory.createDirectory();
+
+    workers.reserve(static_cast<size_t>(numWorkers));
+    for (int w = 0; w < numWorkers; ++w)
+        workers.emplace_back([this, w]() { workerLoop(w); });
+}
+
+void ScanScheduler::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopRequested = true;
+    }
+    dispatchCondition.notify_all();
+}
+
+void ScanScheduler::waitUntilFinished()
+{
+    for (auto& worker : workers)
+        if (worker.joinable())
+            worker.join();
+}
+
+bool ScanScheduler::isFinished() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return activeWorkers == 0;
+}
+
+int ScanScheduler::drainResults(std::vector<Result>& out)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto count = static_cast<int>(finished.size());
+    for (auto& result : finished)
+        out.push_back(std::move(result));
+    finished.clear();
+    return count;
+}
+
+int ScanScheduler::getNumJobs() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return static_cast<int>(jobs.size());
+}
+
+int ScanScheduler::getNumCompleted() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return completed;
+}
+
+juce::StringArray ScanScheduler::getInFlight() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    juce::StringArray paths;
+    for (const auto& path : inFlight)
+        if (path.isNotEmpty())
+            paths.add(path);
+    return paths;
+}
+
+int ScanScheduler::getDefaultConcurrency()
+{
+    // Helpers spend much of their time in plugin bundle loading (disk, codesign checks),
+    // so one per core keeps the machine busy without oversubscribing it
+    return juce::jmax(1, juce::SystemStats::getNumCpus());
+}
+
+int ScanScheduler::resolveConcurrency(int requested, size_t numJobs)
+{
+    if (requested <= 0)
+        requested = getDefaultConcurrency();
+    return juce::jlimit(1, juce::jmax(1, static_cast<int>(numJobs)), requested);
+}
+
+bool ScanScheduler::canStartLocked(const Job& job) const
+{
+    return job.isolated ? running == 0 : !isolatedRunning;
+}
+
+void ScanScheduler::workerLoop(int worker)
+{
+    for (;;)
+    {
+        size_t index = 0;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            dispatchCondition.wait(lock, [this] {
+                return stopRequested || nextJob >= jobs.size() || canStartLocked(jobs[nextJob]);
+            });
+
+            if (stopRequested || nextJob >= jobs.size())
+                break;
+
+            index = nextJob++;
+            ++running;
+            isolatedRunning = jobs[index].isolated;
+            inFlight[static_cast<size_t>(worker)] = jobs[index].pluginPath;
+        }
+
+        const auto& job = jobs[index];
+
+        // Pedal BEFORE the helper starts — if the host dies while it runs, this names it
+        writePedal(worker, job.pluginPath);
+
+        auto result = scanFunction(job, worker);
+        result.pluginPath = job.pluginPath;
+
+        // The helper has exited: whatever happens next isn't this plugin's fault
+        if (pedalDirectory != juce::File())
+            getPedalFile(pedalDirectory, worker).deleteFile();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            finished.push_back(std::move(result));
+            ++completed;
+            --running;
+            if (job.isolated)
+                isolatedRunning = false;
+            inFlight[static_cast<size_t>(worker)].clear();
+        }
+        dispatchCondition.notify_all();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        --activeWorkers;
+    }
+    dispatchCondition.notify_all();
+}
+
+void ScanScheduler::writePedal(int worker, const juce::String& pluginPath) const
+{
+    if (pedalDirectory == juce::File())
+        return;
+
+    // Atomic write pattern (temp file + rename); the temp name stays outside readPedals()' pattern
+    auto pedal = getPedalFile(pedalDirectory, worker);
+    auto tempFile = pedal.withFileExtension("part");
+    tempFile.replaceWithText(pluginPath);
+    tempFile.moveFileTo(pedal);
+}
+
+juce::File ScanScheduler::getPedalFile(const juce::File& dir, int worker)
+{
+    return dir.getChildFile("scanning-plugin-" + juce::String(worker) + ".tmp");
+}
+
+juce::StringArray ScanScheduler::readPedals(const juce::File& dir)
+{
+    juce::StringArray plugins;
+    for (const auto& pedal : dir.findChildFiles(juce::File::findFiles, false, "scanning-plugin-*.tmp"))
+    {
+        auto plugin = pedal.loadFileAsString().trim();
+        if (plugin.isNotEmpty())
+            plugins.addIfNotAlreadyThere(plugin);
+    }
+    return plugins;
+}
+
+void ScanScheduler::clearPedals(const juce::File& dir)
+{
+    for (auto& pedal : dir.findChildFiles(juce::File::findFiles, false, "scanning-plugin-*.tmp"))
+        pedal.deleteFile();
+    for (auto& temp : dir.findChildFiles(juce::File::findFiles, false, "scanning-plugin-*.part"))
+        temp.deleteFile();
+}
+
+ScanScheduler::Result ScanScheduler::runHelperProcess(const juce::StringArray& command,
+                                                      const juce::String& pluginPath, int timeoutMs)
+{
+    juce::ChildProcess child;
+
+    if (!child.start(command, juce::ChildProcess::wantStdOut | juce::ChildProcess::wantStdErr))
+    {
+        std::cerr << "ERROR: Failed to start scanner helper" << std::endl;
+        return { { false, ScanFailureReason::Crash }, {}, pluginPath };
+    }
+
+    // Wait for completion with timeout (per plugin)
+    if (!child.waitForProcessToFinish(timeoutMs))
+    {
+        std::cerr << "ERROR: Scanner helper timed out for: " << pluginPath << std::endl;
+        child.kill();
+
+        // Wait for process to be reaped (up to 5 seconds)
+        if (!child.waitForProcessToFinish(5000))
+            DBG("Scanner process failed to terminate: " + pluginPath);
+
+        return { { false, ScanFailureReason::Timeout }, {}, pluginPath };
+    }
+
+    const auto exitCode = static_cast<int>(child.getExitCode());
+    auto output = child.readAllProcessOutput();
+
+    if (exitCode != 0)
+    {
+        auto reason = ScannerUtils::classifyExitCode(exitCode);
+
+        std::cerr << "ERROR: Scanner helper failed (exit code " << exitCode << ", reason: "
+                  << ScannerUtils::failureReasonToString(reason) << ") for: " << pluginPath << std::endl;
+        return { { false, reason }, {}, pluginPath };
+    }
+
+    // Parse the output — pure function, no shared state mutation
+    auto parsed = ScannerUtils::parseScannerOutput(output);
+
+    if (!parsed.success)
+        return { { false, ScanFailureReason::ScanFailure }, {}, pluginPath };
+
+    return { { true, ScanFailureReason::None }, std::move(parsed.plugins), pluginPath };
+}
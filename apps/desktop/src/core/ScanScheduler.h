@@ -0,0 +1,124 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include "PluginProfile.h"
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+enum class ScanFailureReason { None, Crash, ScanFailure, Timeout };
+
+struct ScanPluginResult
+{
+    bool success;
+    ScanFailureReason failureReason;
+};
+
+/**
+ * ScanScheduler - Runs out-of-process plugin scans N at a time
+ *
+ * Each worker thread claims the next job, drives one scanner helper process for it
+ * (via the ScanFunction) and queues the result. The message thread drains finished
+ * results in batches with drainResults() and merges them into the KnownPluginList —
+ * nothing here touches the list.
+ *
+ * Crash attribution: every worker keeps its own dead man's pedal file naming the plugin
+ * it is scanning, written before the helper starts and removed once it has exited. If
+ * the host dies mid-scan, the pedals left behind name exactly the plugins that were
+ * in flight (see readPedals()).
+ *
+ * Isolated jobs run with nothing else in flight — used to rescan the plugins that were
+ * in flight together when a previous session died, so the next crash names one of them.
+ * Isolated jobs must come first in the job list.
+ */
+class ScanScheduler
+{
+public:
+    struct Job
+    {
+        juce::String formatName;
+        juce::String pluginPath;
+        bool isolated = false;
+    };
+
+    struct Result
+    {
+        ScanPluginResult scanResult { false, ScanFailureReason::None };
+        std::vector<juce::PluginDescription> discoveredPlugins;
+        juce::String pluginPath;
+        std::vector<PluginProfile> profiles;   // Parallel to discoveredPlugins when benchmarked, else empty
+    };
+
+    /** Scans one plugin; called concurrently from worker threads. worker is in
+        [0, number of workers) and stable per thread, for per-worker helper processes. */
+    using ScanFunction = std::function<Result(const Job&, int worker)>;
+
+    static constexpr int kDefaultTimeoutMs = 30000;   // Per plugin
+
+    /** pedalDirectory may be empty: no pedal files are written. */
+    ScanScheduler(ScanFunction scanFunction, const juce::File& pedalDirectory);
+    ~ScanScheduler();
+
+    /** Start scanning jobs with up to numWorkers helpers at once (<= 0: getDefaultConcurrency()). */
+    void start(std::vector<Job> jobs, int numWorkers);
+
+    /** Claim no further jobs. Helpers already running finish (or time out) normally. */
+    void stop();
+
+    /** Block until every worker has exited. */
+    void waitUntilFinished();
+
+    /** True once every job has a result, or after stop() once in-flight scans are done. */
+    bool isFinished() const;
+
+    /** Move every result finished since the last call into out. Returns the count moved. */
+    int drainResults(std::vector<Result>& out);
+
+    int getNumJobs() const;
+    int getNumCompleted() const;
+
+    /** Plugin paths currently being scanned, one per busy worker. */
+    juce::StringArray getInFlight() const;
+
+    static int getDefaultConcurrency();
+
+    /** Workers start() will actually run for this request (<= 0 = default, capped by jobs). */
+    static int resolveConcurrency(int requested, size_t numJobs);
+
+    /** Run a scanner helper command line for one plugin and classify the outcome. */
+    static Result runHelperProcess(const juce::StringArray& command, const juce::String& pluginPath,
+                                   int timeoutMs = kDefaultTimeoutMs);
+
+    /** Pedal file for a worker ("scanning-plugin-<n>.tmp"). */
+    static juce::File getPedalFile(const juce::File& pedalDirectory, int worker);
+
+    /** Plugins named by pedals left in the directory, i.e. in flight when the host died. */
+    static juce::StringArray readPedals(const juce::File& pedalDirectory);
+    static void clearPedals(const juce::File& pedalDirectory);
+
+private:
+    void workerLoop(int worker);
+    bool canStartLocked(const Job& job) const;
+    void writePedal(int worker, const juce::String& pluginPath) const;
+
+    ScanFunction scanFunction;
+    juce::File pedalDirectory;
+
+    mutable std::mutex mutex;
+    std::condition_variable dispatchCondition;
+    std::vector<Job> jobs;                 // Immutable once started
+    std::vector<Result> finished;          // Not yet drained
+    std::vector<juce::String> inFlight;    // Per worker; empty = idle
+    size_t nextJob = 0;
+    int running = 0;
+    int completed = 0;
+    int activeWorkers = 0;
+    bool isolatedRunning = false;
+    bool stopRequested = false;
+
+    std::vector<std::thread> workers;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ScanScheduler)
+};
@@ -0,0 +1,212 @@
+#include "ScanStateCache.h"
+
+#if JUCE_MAC || JUCE_LINUX || JUCE_BSD
+ #include <sys/stat.h>
+#endif
+
+namespace
+{
+    juce::uint64 getInode(const juce::File& file)
+    {
+       #if JUCE_MAC || JUCE_LINUX || JUCE_BSD
+        struct stat info;
+        if (stat(file.getFullPathName().toRawUTF8(), &info) == 0)
+            return static_cast<juce::uint64>(info.st_ino);
+       #else
+        juce::ignoreUnused(file);
+       #endif
+        return 0;
+    }
+
+    /** The files whose change means the plugin changed. Bundles: Info.plist plus the
+        binary directories under Contents (MacOS, x86_64-linux, ...), not Resources. */
+    juce::Array<juce::File> getFingerprintFiles(const juce::File& plugin)
+    {
+        juce::Array<juce::File> files;
+        if (!plugin.isDirectory())
+        {
+            files.add(plugin);
+            return files;
+        }
+
+        auto contents = plugin.getChildFile("Contents");
+        auto plist = contents.getChildFile("Info.plist");
+        if (plist.existsAsFile())
+            files.add(plist);
+
+        for (const auto& dir : contents.findChildFiles(juce::File::findDirectories, false))
+            if (dir.getFileName() != "Resources")
+                files.addArray(dir.findChildFiles(juce::File::findFiles, false));
+
+        return files;
+    }
+
+    /** FNV-1a over the first and last 4 KB plus the length — enough to tell bundles
+        apart after a move without reading whole binaries. */
+    juce::uint64 hashHeadAndTail(const juce::File& file)
+    {
+        constexpr juce::int64 chunk = 4096;
+        juce::FileInputStream in(file);
+        if (!in.openedOk())
+            return 0;
+
+        juce::uint64 hash = 14695981039346656037ull;
+        auto mix = [&hash](const char* data, size_t numBytes) {
+            for (size_t i = 0; i < numBytes; ++i)
+            {
+                hash ^= static_cast<juce::uint8>(data[i]);
+                hash *= 1099511628211ull;
+            }
+        };
+
+        const auto length = in.getTotalLength();
+        mix(reinterpret_cast<const char*>(&length), sizeof(length));
+
+        char buffer[chunk];
+        mix(buffer, static_cast<size_t>(juce::jmax(0, in.read(buffer, static_cast<int>(chunk)))));
+
+        if (length > 2 * chunk && in.setPosition(length - chunk))
+            mix(buffer, static_cast<size_t>(juce::jmax(0, in.read(buffer, static_cast<int>(chunk)))));
+
+        return hash == 0 ? 1 : hash;   // 0 means "not computed"
+    }
+}
+
+ScanStateCache::Fingerprint ScanStateCache::fingerprint(const juce::File& plugin, bool withContentHash)
+{
+    Fingerprint fp;
+    if (!plugin.exists())
+        return fp;
+
+    fp.inode = getInode(plugin);
+    fp.modTime = plugin.getLastModificationTime().toMilliseconds();
+
+    juce::File largest;
+    for (const auto& file : getFingerprintFiles(plugin))
+    {
+        const auto fileSize = file.getSize();
+        fp.size += fileSize;
+        fp.modTime = juce::jmax(fp.modTime, file.getLastModificationTime().toMilliseconds());
+
+        if (largest == juce::File() || fileSize > largest.getSize())
+            largest = file;
+    }
+
+    if (withContentHash && largest != juce::File())
+        fp.contentHash = hashHeadAndTail(largest);
+
+    return fp;
+}
+
+bool ScanStateCache::isFileBased(const juce::String& fileOrIdentifier)
+{
+    return juce::File::isAbsolutePath(fileOrIdentifier);
+}
+
+ScanStateCache::Lookup ScanStateCache::lookup(const juce::String& path, const Fingerprint& current) const
+{
+    auto it = entries.find(path);
+    if (it != entries.end())
+        return { it->second.fingerprint.sameFileAs(current) ? State::unchanged : State::changed, {} };
+
+    // Unknown path: a recorded bundle that has disappeared from its old path and looks the same?
+    juce::uint64 currentHash = current.contentHash;
+    for (const auto& [oldPath, entry] : entries)
+    {
+        const auto& old = entry.fingerprint;
+        const bool sameInode = old.inode != 0 && old.inode == current.inode;
+        const bool sameStat = old.modTime == current.modTime && old.size == current.size;
+        if (!(sameInode || sameStat) || juce::File(oldPath).exists())
+            continue;
+
+        if (old.contentHash != 0)
+        {
+            if (currentHash == 0)
+                currentHash = fingerprint(juce::File(path), true).contentHash;
+            if (currentHash != old.contentHash)
+                continue;
+        }
+
+        return { State::moved, oldPath };
+    }
+
+    return { State::added, {} };
+}
+
+void ScanStateCache::record(const juce::String& path, const juce::String& formatName, Fingerprint fp)
+{
+    if (fp.contentHash == 0)
+        fp.contentHash = fingerprint(juce::File(path), true).contentHash;
+
+    entries[path] = { formatName, fp };
+}
+
+void ScanStateCache::remove(const juce::String& path)
+{
+    entries.erase(path);
+}
+
+void ScanStateCache::rename(const juce::String& from, const juce::String& to)
+{
+    auto it = entries.find(from);
+    if (it == entries.end())
+        return;
+
+    auto entry = it->second;
+    entries.erase(it);
+    entries[to] = entry;
+}
+
+juce::var ScanStateCache::toJson() const
+{
+    juce::Array<juce::var> arr;
+    for (const auto& [path, entry] : entries)
+    {
+        auto* obj = new juce::DynamicObject();
+        obj->setProperty("path", path);
+        obj->setProperty("format", entry.formatName);
+        obj->setProperty("modTime", entry.fingerprint.modTime);
+        obj->setProperty("size", entry.fingerprint.size);
+        obj->setProperty("inode", juce::String::toHexString(static_cast<juce::int64>(entry.fingerprint.inode)));
+        obj->setProperty("hash", juce::String::toHexString(static_cast<juce::int64>(entry.fingerprint.contentHash)));
+        arr.add(juce::var(obj));
+    }
+    return juce::var(arr);
+}
+
+void ScanStateCache::fromJson(const juce::var& json)
+{
+    entries.clear();
+    if (!json.isArray())
+        return;
+
+    for (int i = 0; i < json.size(); ++i)
+    {
+        const auto& item = json[i];
+        auto path = item.getProperty("path", "").toString();
+        if (path.isEmpty())
+            continue;
+
+        Entry entry;
+        entry.formatName = item.getProperty("format", "").toString();
+        entry.fingerprint.modTime = static_cast<juce::int64>(item.getProperty("modTime", 0));
+        entry.fingerprint.size = static_cast<juce::int64>(item.getProperty("size", 0));
+        entry.fingerprint.inode = static_cast<juce::uint64>(item.getProperty("inode", "").toString().getHexValue64());
+        entry.fingerprint.contentHash = static_cast<juce::uint64>(item.getProperty("hash", "").toString().getHexValue64());
+        entries[path] = entry;
+    }
+}
+
+void ScanStateCache::save(const juce::File& file) const
+{
+    file.getParentDirectory().createDirectory();
+    file.replaceWithText(juce::JSON::toString(toJson()));
+}
+
+void ScanStateCache::load(const juce::File& file)
+{
+    if (!file.existsAsFile())
+        return;
+
+    fromJson(juce::JSON::parse(file.loadFileAsString()));
+}
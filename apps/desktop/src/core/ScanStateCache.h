@@ -0,0 +1,88 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <map>
+
+/**
+ * ScanStateCache - What each plugin bundle looked like when it was last scanned
+ *
+ * Keyed by plugin path. Each entry holds a fingerprint: modification time, size and
+ * inode from stat(), plus a cheap content hash (head and tail of the plugin binary).
+ * The stat fields decide whether a bundle changed, so a rescan skips unchanged
+ * bundles without opening them. The hash is only read when recording an entry and
+ * when confirming a move.
+ *
+ * A path the cache has never seen is either new or a bundle that moved. It counts as
+ * moved when an entry whose path no longer exists has the same inode (or the same
+ * size and mtime) and the same content hash. Moved bundles keep their scan results
+ * under the new path instead of being rescanned.
+ *
+ * Only file-based identifiers are tracked (VST3 bundles and similar). Identifiers
+ * like AudioUnit component IDs have nothing on disk to fingerprint.
+ *
+ * Message thread only.
+ */
+class ScanStateCache
+{
+public:
+    struct Fingerprint
+    {
+        juce::int64 modTime = 0;        // Newest of the files that make up the plugin, ms
+        juce::int64 size = 0;           // Total size of those files
+        juce::uint64 inode = 0;         // Of the bundle root; 0 where unavailable
+        juce::uint64 contentHash = 0;   // 0 = not computed
+
+        /** Stat fields only — the hash is a move check, not a change check. */
+        bool sameFileAs(const Fingerprint& other) const
+        {
+            return modTime == other.modTime && size == other.size
+                && (inode == 0 || other.inode == 0 || inode == other.inode);
+        }
+    };
+
+    enum class State
+    {
+        unchanged,   // Recorded fingerprint matches
+        changed,     // Recorded, but the bundle was modified since
+        added,       // Never recorded
+        moved        // Never recorded here, but it's a recorded bundle from movedFrom
+    };
+
+    struct Lookup
+    {
+        State state = State::added;
+        juce::String movedFrom;
+    };
+
+    /** Stat the plugin (for a bundle: Info.plist and the binaries, not Resources). */
+    static Fingerprint fingerprint(const juce::File& plugin, bool withContentHash = false);
+
+    /** True if the identifier is a path fingerprint() can stat. */
+    static bool isFileBased(const juce::String& fileOrIdentifier);
+
+    Lookup lookup(const juce::String& path, const Fingerprint& current) const;
+
+    /** Record a fingerprint, computing the content hash if it's missing. */
+    void record(const juce::String& path, const juce::String& formatName, Fingerprint fingerprint);
+    void remove(const juce::String& path);
+    void rename(const juce::String& from, const juce::String& to);
+
+    bool contains(const juce::String& path) const { return entries.count(path) != 0; }
+    int size() const { return static_cast<int>(entries.size()); }
+    void clear() { entries.clear(); }
+
+    juce::var toJson() const;
+    void fromJson(const juce::var& json);
+
+    void save(const juce::File& file) const;
+    void load(const juce::File& file);
+
+private:
+    struct Entry
+    {
+        juce::String formatName;
+        Fingerprint fingerprint;
+    };
+
+    std::map<juce::String, Entry> entries;
+};
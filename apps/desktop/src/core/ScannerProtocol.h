@@ -0,0 +1,363 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include "PluginProfile.h"
+#include <vector>
+
+/**
+ * Wire format between the host and a persistent PluginScannerHelper worker.
+ *
+ * Messages travel over juce::ChildProcessCoordinator / ChildProcessWorker, which frames
+ * each MemoryBlock on the pipe. Inside a message everything is little-endian and
+ * length-prefixed: a header (kMagic, kVersion, MessageType), then the body. Strings are
+ * an int32 byte count followed by UTF-8 bytes, so decoding never scans for terminators
+ * and a truncated or foreign message is rejected rather than misread.
+ *
+ * Header-only and free of host state so the helper and the tests can share it.
+ */
+namespace ScannerProtocol
+{
+
+/** Passed to launchWorkerProcess(); the helper checks for it to enter worker mode. */
+inline constexpr const char* kWorkerCommandLineId = "prochain-scanner-worker";
+
+inline constexpr juce::int32 kMagic = 0x50435350;   // "PCSP"
+inline constexpr juce::int32 kVersion = 3;
+
+enum class MessageType : juce::int32
+{
+    ScanRequest = 1,
+    ScanResponse = 2,
+    BenchmarkRequest = 3,   // Sent after a successful scan; a crash here costs the profile, not the plugin
+    BenchmarkResponse = 4,
+    Hello = 5,              // Sent right after launch; the echo proves the helper speaks this protocol
+    HelloResponse = 6
+};
+
+/** Helper-side outcome, mirroring the one-shot helper's exit codes. */
+enum class Status : juce::int32
+{
+    Success = 0,
+    NoPlugins = 1,        // findAllTypesForFile returned nothing (likely license/auth)
+    Exception = 2,
+    UnknownFormat = 3
+};
+
+struct ScanRequest
+{
+    juce::uint32 requestId = 0;
+    juce::String formatName;
+    juce::String pluginPath;
+};
+
+struct ScanResponse
+{
+    juce::uint32 requestId = 0;
+    Status status = Status::Success;
+    std::vector<juce::PluginDescription> plugins;
+};
+
+struct BenchmarkRequest
+{
+    juce::uint32 requestId = 0;
+    std::vector<juce::PluginDescription> plugins;
+};
+
+struct BenchmarkResponse
+{
+    juce::uint32 requestId = 0;
+    std::vector<PluginProfile> profiles;   // Parallel to the request's plugins
+};
+
+/** Same body both ways: the helper answers a Hello by echoing its id. */
+struct Hello
+{
+    juce::uint32 requestId = 0;
+};
+
+struct HelloResponse
+{
+    juce::uint32 requestId = 0;
+};
+
+namespace detail
+{
+    inline void writeString(juce::MemoryOutputStream& out, const juce::String& s)
+    {
+        const auto utf8 = s.toUTF8();
+        const auto numBytes = static_cast<int>(utf8.sizeInBytes()) - 1;   // Without the terminator
+        out.writeInt(numBytes);
+        out.write(utf8.getAddress(), static_cast<size_t>(numBytes));
+    }
+
+    inline bool readString(juce::MemoryInputStream& in, juce::String& s)
+    {
+        if (in.getNumBytesRemaining() < 4)
+            return false;
+
+        const auto numBytes = in.readInt();
+        if (numBytes < 0 || numBytes > in.getNumBytesRemaining())
+            return false;
+
+        juce::MemoryBlock bytes(static_cast<size_t>(numBytes));
+        if (in.read(bytes.getData(), numBytes) != numBytes)
+            return false;
+
+        s = juce::String::fromUTF8(static_cast<const char*>(bytes.getData()), numBytes);
+        return true;
+    }
+
+    inline void writeHeader(juce::MemoryOutputStream& out, MessageType type)
+    {
+        out.writeInt(kMagic);
+        out.writeInt(kVersion);
+        out.writeInt(static_cast<juce::int32>(type));
+    }
+
+    inline bool readHeader(juce::MemoryInputStream& in, MessageType expected)
+    {
+        if (in.getNumBytesRemaining() < 12)
+            return false;
+        return in.readInt() == kMagic
+            && in.readInt() == kVersion
+            && in.readInt() == static_cast<juce::int32>(expected);
+    }
+
+    inline void writeDescription(juce::MemoryOutputStream& out, const juce::PluginDescription& d)
+    {
+        writeString(out, d.name);
+        writeString(out, d.descriptiveName);
+        writeString(out, d.pluginFormatName);
+        writeString(out, d.category);
+        writeString(out, d.manufacturerName);
+        writeString(out, d.version);
+        writeString(out, d.fileOrIdentifier);
+        out.writeInt64(d.lastFileModTime.toMilliseconds());
+        out.writeInt64(d.lastInfoUpdateTime.toMilliseconds());
+        out.writeInt(d.deprecatedUid);
+        out.writeInt(d.uniqueId);
+        out.writeInt(d.numInputChannels);
+        out.writeInt(d.numOutputChannels);
+        out.writeByte(static_cast<char>((d.isInstrument ? 1 : 0)
+                                        | (d.hasSharedContainer ? 2 : 0)
+                                        | (d.hasARAExtension ? 4 : 0)));
+    }
+
+    inline bool readDescription(juce::MemoryInputStream& in, juce::PluginDescription& d)
+    {
+        if (!(readString(in, d.name) && readString(in, d.descriptiveName)
+              && readString(in, d.pluginFormatName) && readString(in, d.category)
+              && readString(in, d.manufacturerName) && readString(in, d.version)
+              && readString(in, d.fileOrIdentifier)))
+            return false;
+
+        if (in.getNumBytesRemaining() < 8 + 8 + 4 * 4 + 1)
+            return false;
+
+        d.lastFileModTime = juce::Time(in.readInt64());
+        d.lastInfoUpdateTime = juce::Time(in.readInt64());
+        d.deprecatedUid = in.readInt();
+        d.uniqueId = in.readInt();
+        d.numInputChannels = in.readInt();
+        d.numOutputChannels = in.readInt();
+        const auto flags = static_cast<juce::uint8>(in.readByte());
+        d.isInstrument = (flags & 1) != 0;
+        d.hasSharedContainer = (flags & 2) != 0;
+        d.hasARAExtension = (flags & 4) != 0;
+        return true;
+    }
+
+    inline void writeProfile(juce::MemoryOutputStream& out, const PluginProfile& p)
+    {
+        out.writeDouble(p.instantiateMs);
+        out.writeDouble(p.prepareMs);
+        out.writeInt(p.latencySamples);
+        out.writeDouble(p.tailSeconds);
+        out.writeInt(static_cast<juce::int32>(p.blockCosts.size()));
+        for (const auto& cost : p.blockCosts)
+        {
+            out.writeDouble(cost.sampleRate);
+            out.writeInt(cost.blockSize);
+            out.writeDouble(cost.medianMicros);
+            out.writeDouble(cost.worstMicros);
+        }
+    }
+
+    inline bool readProfile(juce::MemoryInputStream& in, PluginProfile& p)
+    {
+        if (in.getNumBytesRemaining() < 8 + 8 + 4 + 8 + 4)
+            return false;
+
+        p.instantiateMs = in.readDouble();
+        p.prepareMs = in.readDouble();
+        p.latencySamples = in.readInt();
+        p.tailSeconds = in.readDouble();
+        const auto count = in.readInt();
+        if (count < 0 || count > 64 || in.getNumBytesRemaining() < static_cast<juce::int64>(count) * (8 + 4 + 8 + 8))
+            return false;
+
+        p.blockCosts.resize(static_cast<size_t>(count));
+        for (auto& cost : p.blockCosts)
+        {
+            cost.sampleRate = in.readDouble();
+            cost.blockSize = in.readInt();
+            cost.medianMicros = in.readDouble();
+            cost.worstMicros = in.readDouble();
+        }
+        return true;
+    }
+}
+
+inline juce::MemoryBlock encode(const ScanRequest& request)
+{
+    juce::MemoryOutputStream out;
+    detail::writeHeader(out, MessageType::ScanRequest);
+    out.writeInt(static_cast<juce::int32>(request.requestId));
+    detail::writeString(out, request.formatName);
+    detail::writeString(out, request.pluginPath);
+    return out.getMemoryBlock();
+}
+
+inline juce::MemoryBlock encode(const ScanResponse& response)
+{
+    juce::MemoryOutputStream out;
+    detail::writeHeader(out, MessageType::ScanResponse);
+    out.writeInt(static_cast<juce::int32>(response.requestId));
+    out.writeInt(static_cast<juce::int32>(response.status));
+    out.writeInt(static_cast<juce::int32>(response.plugins.size()));
+    for (const auto& desc : response.plugins)
+        detail::writeDescription(out, desc);
+    return out.getMemoryBlock();
+}
+
+inline juce::MemoryBlock encode(const BenchmarkRequest& request)
+{
+    juce::MemoryOutputStream out;
+    detail::writeHeader(out, MessageType::BenchmarkRequest);
+    out.writeInt(static_cast<juce::int32>(request.requestId));
+    out.writeInt(static_cast<juce::int32>(request.plugins.size()));
+    for (const auto& desc : request.plugins)
+        detail::writeDescription(out, desc);
+    return out.getMemoryBlock();
+}
+
+inline juce::MemoryBlock encode(const BenchmarkResponse& response)
+{
+    juce::MemoryOutputStream out;
+    detail::writeHeader(out, MessageType::BenchmarkResponse);
+    out.writeInt(static_cast<juce::int32>(response.requestId));
+    out.writeInt(static_cast<juce::int32>(response.profiles.size()));
+    for (const auto& profile : response.profiles)
+        detail::writeProfile(out, profile);
+    return out.getMemoryBlock();
+}
+
+inline juce::MemoryBlock encode(const Hello& hello)
+{
+    juce::MemoryOutputStream out;
+    detail::writeHeader(out, MessageType::Hello);
+    out.writeInt(static_cast<juce::int32>(hello.requestId));
+    return out.getMemoryBlock();
+}
+
+inline juce::MemoryBlock encode(const HelloResponse& response)
+{
+    juce::MemoryOutputStream out;
+    detail::writeHeader(out, MessageType::HelloResponse);
+    out.writeInt(static_cast<juce::int32>(response.requestId));
+    return out.getMemoryBlock();
+}
+
+inline bool decode(const juce::MemoryBlock& message, ScanRequest& request)
+{
+    juce::MemoryInputStream in(message, false);
+    if (!detail::readHeader(in, MessageType::ScanRequest) || in.getNumBytesRemaining() < 4)
+        return false;
+
+    request.requestId = static_cast<juce::uint32>(in.readInt());
+    return detail::readString(in, request.formatName)
+        && detail::readString(in, request.pluginPath);
+}
+
+inline bool decode(const juce::MemoryBlock& message, ScanResponse& response)
+{
+    juce::MemoryInputStream in(message, false);
+    if (!detail::readHeader(in, MessageType::ScanResponse) || in.getNumBytesRemaining() < 12)
+        return false;
+
+    response.requestId = static_cast<juce::uint32>(in.readInt());
+    response.status = static_cast<Status>(in.readInt());
+    const auto count = in.readInt();
+    if (count < 0 || count > 4096)
+        return false;
+
+    response.plugins.clear();
+    response.plugins.resize(static_cast<size_t>(count));
+    for (auto& desc : response.plugins)
+        if (!detail::readDescription(in, desc))
+            return false;
+
+    return true;
+}
+
+inline bool decode(const juce::MemoryBlock& message, BenchmarkRequest& request)
+{
+    juce::MemoryInputStream in(message, false);
+    if (!detail::readHeader(in, MessageType::BenchmarkRequest) || in.getNumBytesRemaining() < 8)
+        return false;
+
+    request.requestId = static_cast<juce::uint32>(in.readInt());
+    const auto count = in.readInt();
+    if (count < 0 || count > 4096)
+        return false;
+
+    request.plugins.clear();
+    request.plugins.resize(static_cast<size_t>(count));
+    for (auto& desc : request.plugins)
+        if (!detail::readDescription(in, desc))
+            return false;
+
+    return true;
+}
+
+inline bool decode(const juce::MemoryBlock& message, BenchmarkResponse& response)
+{
+    juce::MemoryInputStream in(message, false);
+    if (!detail::readHeader(in, MessageType::BenchmarkResponse) || in.getNumBytesRemaining() < 8)
+        return false;
+
+    response.requestId = static_cast<juce::uint32>(in.readInt());
+    const auto count = in.readInt();
+    if (count < 0 || count > 4096)
+        return false;
+
+    response.profiles.clear();
+    response.profiles.resize(static_cast<size_t>(count));
+    for (auto& profile : response.profiles)
+        if (!detail::readProfile(in, profile))
+            return false;
+
+    return true;
+}
+
+inline bool decode(const juce::MemoryBlock& message, Hello& hello)
+{
+    juce::MemoryInputStream in(message, false);
+    if (!detail::readHeader(in, MessageType::Hello) || in.getNumBytesRemaining() < 4)
+        return false;
+
+    hello.requestId = static_cast<juce::uint32>(in.readInt());
+    return true;
+}
+
+inline bool decode(const juce::MemoryBlock& message, HelloResponse& response)
+{
+    juce::MemoryInputStream in(message, false);
+    if (!detail::readHeader(in, MessageType::HelloResponse) || in.getNumBytesRemaining() < 4)
+        return false;
+
+    response.requestId = static_cast<juce::uint32>(in.readInt());
+    return true;
+}
+
+} // namespace ScannerProtocol
@@ -0,0 +1,247 @@
+#include "ScannerWorkerClient.h"
+
+class ScannerWorkerClient::Coordinator : public juce::ChildProcessCoordinator
+{
+public:
+    explicit Coordinator(ScannerWorkerClient& o) : owner(o) {}
+
+    void handleMessageFromWorker(const juce::MemoryBlock& message) override { owner.handleResponse(message); }
+    void handleConnectionLost() override { owner.handleConnectionLost(); }
+
+private:
+    ScannerWorkerClient& owner;
+};
+
+ScannerWorkerClient::ScannerWorkerClient(const juce::File& helper)
+    : helperExecutable(helper)
+{
+}
+
+ScannerWorkerClient::~ScannerWorkerClient()
+{
+    coordinator.reset();   // Kills the worker process
+}
+
+bool ScannerWorkerClient::ensureLaunched()
+{
+    bool stale = false;
+    {
+        std::lock_guard<std::mutex> lock(replyMutex);
+        stale = connectionLost;
+    }
+
+    // Died between requests (or due for recycling): not any plugin's fault, just respawn
+    if (coordinator != nullptr && (stale || scansSinceLaunch >= kScansPerLaunch))
+        coordinator.reset();
+
+    if (coordinator != nullptr)
+        return true;
+
+    if (!usable || !helperExecutable.existsAsFile())
+    {
+        usable = false;
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(replyMutex);
+        connectionLost = false;
+    }
+
+    coordinator = std::make_unique<Coordinator>(*this);
+
+    // No stdout/stderr capture: nobody would drain the pipes of a long-lived worker
+    if (!coordinator->launchWorkerProcess(helperExecutable, ScannerProtocol::kWorkerCommandLineId, 0, 0))
+    {
+        std::cerr << "ERROR: Failed to launch persistent scanner worker; using one helper per plugin" << std::endl;
+        coordinator.reset();
+        usable = false;
+        return false;
+    }
+
+    ++numLaunches;
+    scansSinceLaunch = 0;
+
+    // Worker-mode support is decided here and only here: a helper that can't echo a Hello
+    // (older build, or not a worker at all) is given up on without costing a plugin timeout
+    if (!handshake())
+    {
+        std::cerr << "ERROR: Scanner helper did not answer in worker mode; using one helper per plugin" << std::endl;
+        coordinator.reset();
+        usable = false;
+        return false;
+    }
+
+    return true;
+}
+
+bool ScannerWorkerClient::handshake()
+{
+    ScannerProtocol::Hello hello;
+    hello.requestId = nextRequestId++;
+    expectReply(hello.requestId);
+
+    if (!coordinator->sendMessageToWorker(ScannerProtocol::encode(hello)))
+        return false;
+
+    replyArrived.wait(kHelloTimeoutMs);
+
+    std::lock_guard<std::mutex> lock(replyMutex);
+    const bool answered = helloReply;
+    helloReply = false;
+    pendingRequestId = 0;
+    return answered;
+}
+
+ScanScheduler::Result ScannerWorkerClient::scan(const juce::String& formatName, const juce::String& pluginPath,
+                                                int timeoutMs)
+{
+    ScannerProtocol::ScanRequest request;
+    request.formatName = formatName;
+    request.pluginPath = pluginPath;
+
+    // One retry covers a worker that died while idle (the send fails before the plugin is involved)
+    bool sent = false;
+    for (int attempt = 0; attempt < 2 && !sent; ++attempt)
+    {
+        if (!ensureLaunched())
+            return { { false, ScanFailureReason::Crash }, {}, pluginPath };
+
+        request.requestId = nextRequestId++;
+        expectReply(request.requestId);
+
+        sent = coordinator->sendMessageToWorker(ScannerProtocol::encode(request));
+        if (!sent)
+            coordinator.reset();
+    }
+
+    if (!sent)
+        return { { false, ScanFailureReason::Crash }, {}, pluginPath };
+
+    ++scansSinceLaunch;
+    replyArrived.wait(timeoutMs);
+
+    std::optional<ScannerProtocol::ScanResponse> response;
+    bool lost = false;
+    {
+        std::lock_guard<std::mutex> lock(replyMutex);
+        response = std::move(reply);
+        reply.reset();
+        pendingRequestId = 0;
+        lost = connectionLost;
+    }
+
+    if (!response)
+    {
+        // Hung or crashed with this plugin in flight — either way the worker is gone; the
+        // next request relaunches it (the Hello already proved worker mode works)
+        coordinator.reset();
+
+        const auto reason = lost ? ScanFailureReason::Crash : ScanFailureReason::Timeout;
+        std::cerr << "ERROR: Scanner worker " << (lost ? "crashed" : "timed out") << " for: " << pluginPath << std::endl;
+        return { { false, reason }, {}, pluginPath };
+    }
+
+    switch (response->status)
+    {
+        case ScannerProtocol::Status::Success:
+            return { { true, ScanFailureReason::None }, std::move(response->plugins), pluginPath };
+        case ScannerProtocol::Status::Exception:
+            return { { false, ScanFailureReason::Crash }, {}, pluginPath };
+        case ScannerProtocol::Status::NoPlugins:
+        case ScannerProtocol::Status::UnknownFormat:
+        default:
+            return { { false, ScanFailureReason::ScanFailure }, {}, pluginPath };
+    }
+}
+
+std::vector<PluginProfile> ScannerWorkerClient::benchmark(const std::vector<juce::PluginDescription>& plugins,
+                                                          int timeoutMs)
+{
+    if (plugins.empty() || !ensureLaunched())
+        return {};
+
+    ScannerProtocol::BenchmarkRequest request;
+    request.requestId = nextRequestId++;
+    request.plugins = plugins;
+    expectReply(request.requestId);
+
+    if (!coordinator->sendMessageToWorker(ScannerProtocol::encode(request)))
+    {
+        coordinator.reset();
+        return {};
+    }
+
+    ++scansSinceLaunch;
+    replyArrived.wait(timeoutMs);
+
+    std::optional<ScannerProtocol::BenchmarkResponse> response;
+    {
+        std::lock_guard<std::mutex> lock(replyMutex);
+        response = std::move(benchmarkReply);
+        benchmarkReply.reset();
+        pendingRequestId = 0;
+    }
+
+    if (!response || response->profiles.size() != plugins.size())
+    {
+        // The scan already succeeded — drop the worker and the profile, keep the plugin
+        coordinator.reset();
+        std::cerr << "ERROR: Scanner worker failed to benchmark: " << plugins.front().fileOrIdentifier << std::endl;
+        return {};
+    }
+
+    return std::move(response->profiles);
+}
+
+void ScannerWorkerClient::expectReply(juce::uint32 requestId)
+{
+    std::lock_guard<std::mutex> lock(replyMutex);
+    pendingRequestId = requestId;
+    reply.reset();
+    benchmarkReply.reset();
+    helloReply = false;
+    replyArrived.reset();
+}
+
+void ScannerWorkerClient::handleResponse(const juce::MemoryBlock& message)
+{
+    ScannerProtocol::ScanResponse response;
+    ScannerProtocol::BenchmarkResponse benchmarkResponse;
+    ScannerProtocol::HelloResponse helloResponse;
+
+    if (ScannerProtocol::decode(message, helloResponse))
+    {
+        std::lock_guard<std::mutex> lock(replyMutex);
+        if (helloResponse.requestId != pendingRequestId)
+            return;
+
+        helloReply = true;
+        replyArrived.signal();
+    }
+    else if (ScannerProtocol::decode(message, response))
+    {
+        std::lock_guard<std::mutex> lock(replyMutex);
+        if (response.requestId != pendingRequestId)
+            return;   // Late reply to a request we already gave up on
+
+        reply = std::move(response);
+        replyArrived.signal();
+    }
+    else if (ScannerProtocol::decode(message, benchmarkResponse))
+    {
+        std::lock_guard<std::mutex> lock(replyMutex);
+        if (benchmarkResponse.requestId != pendingRequestId)
+            return;
+
+        benchmarkReply = std::move(benchmarkResponse);
+        replyArrived.signal();
+    }
+}
+
+void ScannerWorkerClient::handleConnectionLost()
+{
+    std::lock_guard<std::mutex> lock(replyMutex);
+    connectionLost = true;
+    replyArrived.signal();
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <juce_events/juce_events.h>
+#include "ScanScheduler.h"
+#include "ScannerProtocol.h"
+#include <mutex>
+#include <optional>
+
+/**
+ * ScannerWorkerClient - Host side of one persistent PluginScannerHelper worker
+ *
+ * Launches the helper in worker mode on first use, confirms it with a ScannerProtocol
+ * Hello (answered within kHelloTimeoutMs, or the helper has no worker mode and the
+ * client reports itself unusable), then sends it one request per plugin, blocking the calling (ScanScheduler worker) thread until the
+ * reply arrives. One client per scheduler worker: requests never overlap on a client.
+ *
+ * Failure handling matches the one-shot helper: a reply timeout kills the worker
+ * (Timeout), a lost connection means the plugin in flight crashed it (Crash). Either
+ * way the next request respawns the worker, so one bad plugin costs one respawn and the
+ * client stays in persistent mode.
+ * Workers are also recycled every kScansPerLaunch requests, since loaded plugin
+ * modules stay resident in the helper.
+ *
+ * benchmark() asks the same worker to profile what a scan just found. It is a separate
+ * request so that a plugin which scans cleanly but crashes or hangs while processing
+ * only loses its profile.
+ */
+class ScannerWorkerClient
+{
+public:
+    static constexpr int kScansPerLaunch = 64;
+    static constexpr int kHelloTimeoutMs = 5000;
+
+    explicit ScannerWorkerClient(const juce::File& helperExecutable);
+    ~ScannerWorkerClient();
+
+    /** Scan one plugin. Call from one thread at a time. */
+    ScanScheduler::Result scan(const juce::String& formatName, const juce::String& pluginPath,
+                               int timeoutMs = ScanScheduler::kDefaultTimeoutMs);
+
+    /** Profile plugins (normally the result of the previous scan). Empty on crash or timeout. */
+    std::vector<PluginProfile> benchmark(const std::vector<juce::PluginDescription>& plugins,
+                                         int timeoutMs = ScanScheduler::kDefaultTimeoutMs + PluginProfiler::kBudgetMs);
+
+    /** False once launching or the Hello has failed — callers fall back to one process per plugin. */
+    bool isUsable() const { return usable; }
+
+    int getNumLaunches() const { return numLaunches; }
+
+private:
+    class Coordinator;
+
+    bool ensureLaunched();
+    bool handshake();
+    void expectReply(juce::uint32 requestId);
+    void handleResponse(const juce::MemoryBlock& message);
+    void handleConnectionLost();
+
+    juce::File helperExecutable;
+    std::unique_ptr<Coordinator> coordinator;
+    bool usable = true;
+    int numLaunches = 0;
+    int scansSinceLaunch = 0;
+
+    // Reply hand-off from the connection thread
+    std::mutex replyMutex;
+    juce::WaitableEvent replyArrived;
+    juce::uint32 pendingRequestId = 0;
+    bool connectionLost = false;
+    std::optional<ScannerProtocol::ScanResponse> reply;
+    std::optional<ScannerProtocol::BenchmarkResponse> benchmarkReply;
+    bool helloReply = false;
+    juce::uint32 nextRequestId = 1;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ScannerWorkerClient)
+};
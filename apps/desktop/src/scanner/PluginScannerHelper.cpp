@@ -7,9 +7,22 @@
  * Usage: PluginScannerHelper <format> <plugin-path>
  * Output: JSON on stdout with plugin info, or "SCAN_FAILED" on failure
  * Exit codes: 0 = success, 1 = scan failed, other = crash
+ *
+ * Worker mode: launched by the host through juce::ChildProcessCoordinator (see
+ * ScannerWorkerClient), the helper stays alive and answers ScannerProtocol scan requests
+ * one after another, paying process start-up and format setup once instead of per
+ * plugin. A plugin that crashes takes the worker down; the host respawns it.
+ *
+ * When the host has benchmarking enabled it follows a successful scan with a benchmark
+ * request for the same plugins: each is instantiated, prepared and run on noise
+ * (PluginProfiler) and the timings sent back as PluginProfiles. The same instance is run
+ * through ParameterDiscovery and the map written to the shared ParameterDiscoveryCache,
+ * so the first seeded load of the plugin finds it already discovered.
  */
 
 #include <juce_audio_processors/juce_audio_processors.h>
+#include "../core/ParameterDiscoveryCache.h"
+#include "../core/ScannerProtocol.h"
 #include <iostream>
 #include <csignal>
 #include <unistd.h>
@@ -26,6 +39,124 @@ static void crashSignalHandler(int signal)
     _exit(128 + signal);
 }
 
+//==============================================================================
+static void addFormats(juce::AudioPluginFormatManager& formatManager, const juce::String& onlyFormat = {})
+{
+    #if JUCE_PLUGINHOST_AU
+    if (onlyFormat.isEmpty() || onlyFormat == "AudioUnit")
+        formatManager.addFormat(new juce::AudioUnitPluginFormat());
+    #endif
+
+    #if JUCE_PLUGINHOST_VST3
+    if (onlyFormat.isEmpty() || onlyFormat == "VST3")
+        formatManager.addFormat(new juce::VST3PluginFormat());
+    #endif
+}
+
+//==============================================================================
+// Persistent worker: one request at a time, scanned on the message thread
+// (plugin loading — AudioUnits in particular — expects it)
+class ScannerWorker : public juce::ChildProcessWorker
+{
+public:
+    ScannerWorker()
+    {
+        addFormats(formatManager);
+    }
+
+    void handleMessageFromCoordinator(const juce::MemoryBlock& message) override
+    {
+        ScannerProtocol::ScanRequest request;
+        ScannerProtocol::BenchmarkRequest benchmarkRequest;
+        ScannerProtocol::Hello hello;
+
+        // Answered from the message thread too, so the reply also proves scans can run
+        if (ScannerProtocol::decode(message, hello))
+            juce::MessageManager::callAsync([this, hello] {
+                sendMessageToCoordinator(ScannerProtocol::encode(ScannerProtocol::HelloResponse { hello.requestId }));
+            });
+        else if (ScannerProtocol::decode(message, request))
+            juce::MessageManager::callAsync([this, request] { handleScanRequest(request); });
+        else if (ScannerProtocol::decode(message, benchmarkRequest))
+            juce::MessageManager::callAsync([this, benchmarkRequest] { handleBenchmarkRequest(benchmarkRequest); });
+    }
+
+    void handleConnectionLost() override
+    {
+        // Coordinator went away (host quit or gave up on us)
+        juce::JUCEApplicationBase::quit();
+    }
+
+private:
+    void handleScanRequest(const ScannerProtocol::ScanRequest& request)
+    {
+        ScannerProtocol::ScanResponse response;
+        response.requestId = request.requestId;
+
+        juce::AudioPluginFormat* pluginFormat = nullptr;
+        for (auto* format : formatManager.getFormats())
+            if (format->getName() == request.formatName)
+                pluginFormat = format;
+
+        if (pluginFormat == nullptr)
+        {
+            response.status = ScannerProtocol::Status::UnknownFormat;
+        }
+        else
+        {
+            try
+            {
+                juce::OwnedArray<juce::PluginDescription> results;
+                pluginFormat->findAllTypesForFile(results, request.pluginPath);
+
+                for (auto* desc : results)
+                    response.plugins.push_back(*desc);
+
+                response.status = results.isEmpty() ? ScannerProtocol::Status::NoPlugins
+                                                    : ScannerProtocol::Status::Success;
+            }
+            catch (...)
+            {
+                response.status = ScannerProtocol::Status::Exception;
+                response.plugins.clear();
+            }
+        }
+
+        sendMessageToCoordinator(ScannerProtocol::encode(response));
+    }
+
+    void handleBenchmarkRequest(const ScannerProtocol::BenchmarkRequest& request)
+    {
+        ScannerProtocol::BenchmarkResponse response;
+        response.requestId = request.requestId;
+
+        // One budget for the whole file, so a shell with dozens of plugins can't time out
+        const double deadlineMs = juce::Time::getMillisecondCounterHiRes() + PluginProfiler::kBudgetMs;
+
+        for (const auto& desc : request.plugins)
+        {
+            PluginProfile profile;
+            try
+            {
+                profile = PluginProfiler::measure(formatManager, desc, deadlineMs,
+                                                  [this, &desc](juce::AudioPluginInstance& instance) {
+                                                      discoveryCache.getOrDiscover(instance, desc);
+                                                  });
+            }
+            catch (...)
+            {
+                profile = {};
+            }
+            response.profiles.push_back(std::move(profile));
+        }
+
+        sendMessageToCoordinator(ScannerProtocol::encode(response));
+    }
+
+    juce::AudioPluginFormatManager formatManager;
+    ParameterDiscoveryCache discoveryCache;
+};
+
 //==============================================================================
 class ScannerApplication : public juce::JUCEApplicationBase
 {
@@ -43,6 +174,15 @@ public:
         std::signal(SIGBUS,  crashSignalHandler);
         std::signal(SIGFPE,  crashSignalHandler);
 
+        // Launched as a persistent worker? Then serve requests until the host disconnects
+        auto worker = std::make_unique<ScannerWorker>();
+        if (worker->initialiseFromCommandLine(commandLine, ScannerProtocol::kWorkerCommandLineId))
+        {
+            scannerWorker = std::move(worker);
+            return;
+        }
+        worker.reset();
+
         juce::StringArray args = juce::JUCEApplicationBase::getCommandLineParameterArray();
 
         if (args.size() < 2)
@@ -58,16 +198,7 @@ public:
 
         // Initialize the format manager
         juce::AudioPluginFormatManager formatManager;
-
-        #if JUCE_PLUGINHOST_AU
-        if (format == "AudioUnit")
-            formatManager.addFormat(new juce::AudioUnitPluginFormat());
-        #endif
-
-        #if JUCE_PLUGINHOST_VST3
-        if (format == "VST3")
-            formatManager.addFormat(new juce::VST3PluginFormat());
-        #endif
+        addFormats(formatManager, format);
 
         if (formatManager.getNumFormats() == 0)
         {
@@ -117,7 +248,7 @@ public:
         quit();
     }
 
-    void shutdown() override {}
+    void shutdown() override { scannerWorker.reset(); }
     void anotherInstanceStarted(const juce::String&) override {}
     void systemRequestedQuit() override { quit(); }
     void suspended() override {}
@@ -127,6 +258,9 @@ public:
         std::cout << "SCAN_FAILED:Exception" << std::endl;
         setApplicationReturnValue(2);  // Exit 2 = exception caught (crash-like)
     }
+
+private:
+    std::unique_ptr<ScannerWorker> scannerWorker;
 };
 
 //==============================================================================
@@ -0,0 +1,100 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../src/core/AnalysisBus.h"
+#include "../src/audio/AnalysisPublisher.h"
+#include <cmath>
+
+TEST_CASE("AnalysisBus - frames round-trip per slot", "[analysisbus]")
+{
+    AnalysisBus bus;
+
+    const int a = bus.attach(11);
+    const int b = bus.attach(12);
+    REQUIRE(a >= 0);
+    REQUIRE(b >= 0);
+    REQUIRE(a != b);
+
+    std::vector<AnalysisBus::Frame> frames;
+    REQUIRE(bus.readAll(frames) == 0);   // Nothing published yet
+
+    AnalysisBus::Frame frame;
+    frame.lufsShort = -14.0f;
+    frame.peakDb = -1.5f;
+    frame.bandsDb[3] = -20.0f;
+    bus.publish(b, frame);
+
+    REQUIRE(bus.readAll(frames) == 1);
+    REQUIRE(frames.front().instanceId == 12);
+    REQUIRE(frames.front().lufsShort == -14.0f);
+    REQUIRE(frames.front().peakDb == -1.5f);
+    REQUIRE(frames.front().bandsDb[3] == -20.0f);
+
+    bus.detach(b);
+    frames.clear();
+    REQUIRE(bus.readAll(frames) == 0);
+    REQUIRE(bus.attach(13) == b);        // Freed slot is reused
+}
+
+TEST_CASE("AnalysisBus - viewers switch publishers to the display rate", "[analysisbus]")
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+    AnalysisBus bus;
+    AudioMeter meter;
+    FFTProcessor fft;
+    meter.prepareToPlay(48000.0, 512);
+    fft.prepareToPlay(48000.0, 512);
+
+    AnalysisPublisher publisher(bus, 5, meter, fft);
+    REQUIRE_FALSE(bus.hasViewers());
+
+    // Unviewed: ~2 Hz, so a 200 ms window sees at most one timer publish
+    juce::MessageManager::getInstance()->runDispatchLoopUntil(200);
+    std::vector<AnalysisBus::Frame> frames;
+    bus.readAll(frames);
+    const double unviewedStamp = frames.empty() ? 0.0 : frames.front().publishedAtMs;
+
+    bus.addViewer();
+    juce::MessageManager::getInstance()->runDispatchLoopUntil(700);   // One slow tick to notice, then 30 Hz
+    frames.clear();
+    REQUIRE(bus.readAll(frames) == 1);
+    REQUIRE(frames.front().publishedAtMs > unviewedStamp);
+    REQUIRE(juce::Time::getMillisecondCounterHiRes() - frames.front().publishedAtMs < 150.0);
+    bus.removeViewer();
+}
+
+TEST_CASE("AnalysisPublisher - spectrum is reduced into the matching band", "[analysisbus]")
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+    AnalysisBus bus;
+    AudioMeter meter;
+    FFTProcessor fft;
+    constexpr double sampleRate = 48000.0;
+    meter.prepareToPlay(sampleRate, 512);
+    fft.prepareToPlay(sampleRate, 512);
+
+    // 1 kHz sine, enough for one complete FFT frame (computed inline — no scheduler)
+    juce::AudioBuffer<float> buffer(2, FFTProcessor::fftSize);
+    for (int i = 0; i < buffer.getNumSamples(); ++i)
+    {
+        const auto v = 0.5f * static_cast<float>(std::sin(juce::MathConstants<double>::twoPi * 1000.0 * i / sampleRate));
+        buffer.setSample(0, i, v);
+        buffer.setSample(1, i, v);
+    }
+    meter.process(buffer);
+    fft.process(buffer);
+
+    AnalysisPublisher publisher(bus, 9, meter, fft);
+    publisher.publishNow();
+
+    std::vector<AnalysisBus::Frame> frames;
+    REQUIRE(bus.readAll(frames) == 1);
+    const auto& bands = frames.front().bandsDb;
+
+    int loudest = 0;
+    for (int b = 1; b < AnalysisBus::kNumBands; ++b)
+        if (bands[static_cast<size_t>(b)] > bands[static_cast<size_t>(loudest)])
+            loudest = b;
+
+    REQUIRE(AnalysisBus::getBandEdgeHz(loudest) <= 1000.0f * 1.05f);
+    REQUIRE(AnalysisBus::getBandEdgeHz(loudest + 1) >= 1000.0f * 0.95f);
+    REQUIRE(frames.front().peakDb > -10.0f);
+}
@@ -0,0 +1,101 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../src/core/AudioTap.h"
+
+namespace
+{
+    juce::AudioBuffer<float> makeBlock(float value, int numSamples)
+    {
+        juce::AudioBuffer<float> block(2, numSamples);
+        for (int ch = 0; ch < 2; ++ch)
+            juce::FloatVectorOperations::fill(block.getWritePointer(ch), value, numSamples);
+        return block;
+    }
+}
+
+TEST_CASE("AudioTap - subscribers get the previous block regardless of render order", "[audiotap]")
+{
+    constexpr int n = 256;
+    AudioTap tap;
+    tap.addSubscriber();
+    juce::AudioBuffer<float> dest(2, AudioTap::kMaxBlockSamples);
+
+    // Source rendered first this cycle: blocks at 0 and n are both in the ring
+    tap.write(makeBlock(0.1f, n), n, 0);
+    tap.write(makeBlock(0.2f, n), n, n);
+    REQUIRE(tap.read(dest, n, n) == AudioTap::ReadResult::aligned);
+    REQUIRE(dest.getSample(0, 0) == 0.1f);
+    REQUIRE(dest.getSample(1, n - 1) == 0.1f);
+
+    // Source renders after us next cycle: the block at n is still the one we get for 2n
+    REQUIRE(tap.read(dest, n, 2 * n) == AudioTap::ReadResult::aligned);
+    REQUIRE(dest.getSample(0, 0) == 0.2f);
+    tap.write(makeBlock(0.3f, n), n, 2 * n);
+    REQUIRE(tap.read(dest, n, 2 * n) == AudioTap::ReadResult::aligned);
+    REQUIRE(dest.getSample(0, 0) == 0.2f);
+
+    tap.removeSubscriber();
+}
+
+TEST_CASE("AudioTap - falls back to the newest block without a timeline position", "[audiotap]")
+{
+    constexpr int n = 128;
+    AudioTap tap;
+    tap.addSubscriber();
+    juce::AudioBuffer<float> dest(2, AudioTap::kMaxBlockSamples);
+
+    tap.write(makeBlock(0.4f, n), n, -1);
+    tap.write(makeBlock(0.5f, n), n, -1);
+    REQUIRE(tap.read(dest, n, -1) == AudioTap::ReadResult::newest);
+    REQUIRE(dest.getSample(0, 0) == 0.5f);
+
+    // A position with no matching block (transport jumped) also takes the newest
+    REQUIRE(tap.read(dest, n, 100000) == AudioTap::ReadResult::newest);
+    REQUIRE(dest.getSample(1, 0) == 0.5f);
+
+    // Shorter source block than ours: the rest is silence, not stale audio
+    tap.write(makeBlock(0.6f, n / 2), n / 2, -1);
+    REQUIRE(tap.read(dest, n, -1) == AudioTap::ReadResult::newest);
+    REQUIRE(dest.getSample(0, n / 2 - 1) == 0.6f);
+    REQUIRE(dest.getSample(0, n / 2) == 0.0f);
+
+    tap.removeSubscriber();
+}
+
+TEST_CASE("AudioTap - every subscriber reads the same block", "[audiotap]")
+{
+    constexpr int n = 64;
+    AudioTap tap;
+    tap.addSubscriber();
+    tap.addSubscriber();
+    REQUIRE(tap.getNumSubscribers() == 2);
+
+    tap.write(makeBlock(0.7f, n), n, 0);
+
+    juce::AudioBuffer<float> a(2, n), b(2, n);
+    REQUIRE(tap.read(a, n, n) == AudioTap::ReadResult::aligned);
+    REQUIRE(tap.read(b, n, n) == AudioTap::ReadResult::aligned);
+    REQUIRE(a.getSample(0, 10) == 0.7f);
+    REQUIRE(b.getSample(1, 10) == 0.7f);
+
+    tap.removeSubscriber();
+    tap.removeSubscriber();
+}
+
+TEST_CASE("AudioTap - silent until subscribed and written", "[audiotap]")
+{
+    constexpr int n = 64;
+    AudioTap tap;
+    juce::AudioBuffer<float> dest(2, n);
+    juce::FloatVectorOperations::fill(dest.getWritePointer(0), 1.0f, n);
+
+    // No subscribers: writes are dropped (no ring allocated)
+    tap.write(makeBlock(0.8f, n), n, 0);
+    REQUIRE(tap.read(dest, n, n) == AudioTap::ReadResult::silent);
+    REQUIRE(dest.getSample(0, 0) == 0.0f);
+
+    tap.addSubscriber();
+    REQUIRE(tap.read(dest, n, n) == AudioTap::ReadResult::silent);
+    tap.write(makeBlock(0.8f, n), n, 0);
+    REQUIRE(tap.read(dest, n, n) == AudioTap::ReadResult::aligned);
+    tap.removeSubscriber();
+}
@@ -0,0 +1,120 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../src/core/BlobStore.h"
+#include "TestHelpers.h"
+#include <set>
+
+namespace
+{
+    juce::MemoryBlock makeChunk(size_t size, uint8_t seed)
+    {
+        juce::MemoryBlock block(size);
+        for (size_t i = 0; i < size; ++i)
+            static_cast<uint8_t*>(block.getData())[i] = static_cast<uint8_t>(seed + i * 7);
+        return block;
+    }
+}
+
+TEST_CASE("BlobStore - identical chunks share one entry and refetch is a hit", "[blobstore]")
+{
+    TempTestDirectory temp { "ProChainBlobTest" };
+    BlobStore store(temp.dir);
+
+    auto chunk = makeChunk(4096, 1);
+    auto hashA = store.store(chunk, false);
+    auto hashB = store.store(chunk, false);
+
+    REQUIRE(hashA == hashB);
+    REQUIRE(hashA.length() == 64);
+    REQUIRE(store.getStats().memoryEntries == 1);
+
+    auto blob = store.fetch(hashA);
+    REQUIRE(blob != nullptr);
+    REQUIRE(*blob == chunk);
+    REQUIRE(store.getStats().hits == 1);
+    REQUIRE(store.getStats().misses == 0);
+
+    REQUIRE(store.fetch(BlobStore::hashOf(makeChunk(16, 9))) == nullptr);
+    REQUIRE(store.getStats().misses == 1);
+}
+
+TEST_CASE("BlobStore - persisted chunks survive a new store instance", "[blobstore]")
+{
+    TempTestDirectory temp { "ProChainBlobTest" };
+    auto chunk = makeChunk(8192, 3);
+    juce::String hash;
+
+    {
+        BlobStore store(temp.dir);
+        hash = store.store(chunk, true);
+    }
+
+    BlobStore reopened(temp.dir);
+    auto blob = reopened.fetch(hash);
+    REQUIRE(blob != nullptr);
+    REQUIRE(*blob == chunk);
+}
+
+TEST_CASE("BlobStore - evicted snapshot chunks spill to disk", "[blobstore]")
+{
+    TempTestDirectory temp { "ProChainBlobTest" };
+    BlobStore store(temp.dir, 10000);
+
+    auto first = makeChunk(6000, 1);
+    auto second = makeChunk(6000, 2);
+    auto firstHash = store.store(first, false);
+    store.store(second, false);
+
+    // Budget only fits one — the first was evicted but must still be fetchable
+    REQUIRE(store.getStats().memoryEntries == 1);
+    auto blob = store.fetch(firstHash);
+    REQUIRE(blob != nullptr);
+    REQUIRE(*blob == first);
+}
+
+TEST_CASE("BlobStore - XML chunks externalise and resolve", "[blobstore]")
+{
+    TempTestDirectory temp { "ProChainBlobTest" };
+    BlobStore store(temp.dir);
+
+    auto big = makeChunk(4096, 5);
+    auto small = makeChunk(64, 6);
+
+    juce::XmlElement tree("ChainState");
+    auto* a = tree.createNewChildElement("Node");
+    a->setAttribute("state", big.toBase64Encoding());
+    auto* group = tree.createNewChildElement("Node");
+    auto* b = group->createNewChildElement("Node");
+    b->setAttribute("state", big.toBase64Encoding());
+    auto* c = tree.createNewChildElement("Node");
+    c->setAttribute("state", small.toBase64Encoding());
+
+    REQUIRE(store.externaliseChunks(tree, false) == 2);
+    REQUIRE(a->getStringAttribute("stateRef") == b->getStringAttribute("stateRef"));
+    REQUIRE_FALSE(a->hasAttribute("state"));
+    REQUIRE(c->hasAttribute("state"));   // below the inline threshold
+
+    std::set<juce::String> refs;
+    BlobStore::collectReferences(tree, refs);
+    REQUIRE(refs.size() == 1);
+
+    REQUIRE(store.resolveChunks(tree) == 0);
+    juce::MemoryBlock decoded;
+    REQUIRE(decoded.fromBase64Encoding(b->getStringAttribute("state")));
+    REQUIRE(decoded == big);
+    REQUIRE_FALSE(b->hasAttribute("stateRef"));
+}
+
+TEST_CASE("BlobStore - garbage collection keeps live chunks", "[blobstore]")
+{
+    TempTestDirectory temp { "ProChainBlobTest" };
+    BlobStore store(temp.dir);
+
+    auto live = store.store(makeChunk(2048, 1), true);
+    auto dead = store.store(makeChunk(2048, 2), true);
+
+    REQUIRE(store.collectGarbage({ live }, juce::RelativeTime()) == 1);
+
+    BlobStore reopened(temp.dir);
+    REQUIRE(reopened.contains(live));
+    REQUIRE_FALSE(reopened.contains(dead));
+}
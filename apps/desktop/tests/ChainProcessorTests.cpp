@@ -333,3 +333,288 @@ TEST_CASE("ChainProcessor: findChildIndex", "[chain]")
     REQUIRE(ChainNodeHelpers::findChildIndex(parent, 30) == 2);
     REQUIRE(ChainNodeHelpers::findChildIndex(parent, 99) == -1);
 }
+
+// =============================================================================
+// Preset prefetch: restoreChainFromXml adopts staged instances
+// =============================================================================
+
+static std::unique_ptr<juce::XmlElement> makeStagedTestChainXml(const juce::StringArray& names,
+                                                                const juce::String& stateBase64)
+{
+    auto chainXml = std::make_unique<juce::XmlElement>("ChainTree");
+    chainXml->setAttribute("version", 2);
+
+    for (const auto& name : names)
+    {
+        juce::PluginDescription desc;
+        desc.name = name;
+        desc.manufacturerName = "MockVendor";
+        desc.pluginFormatName = "MockFormat";
+        desc.fileOrIdentifier = "/mock/" + name;
+
+        auto* nodeXml = chainXml->createNewChildElement("Node");
+        nodeXml->setAttribute("type", "plugin");
+        nodeXml->addChildElement(desc.createXml().release());
+        nodeXml->setAttribute("state", stateBase64);
+    }
+
+    return chainXml;
+}
+
+TEST_CASE("ChainProcessor: restoreChainFromXml adopts staged instances", "[chain][prefetch]")
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+
+    ChainProcessorFixture fix;
+    fix.chainProcessor.setSwapFadeMs(0.0f);
+
+    juce::String stateText = "MOCK_STATE_Staged";
+    // Chunks use MemoryBlock's own base64 flavour, same as nodeToXml()
+    auto stateBase64 = juce::MemoryBlock(stateText.toRawUTF8(), stateText.getNumBytesAsUTF8()).toBase64Encoding();
+    auto chainXml = makeStagedTestChainXml({ "StagedA", "StagedB" }, stateBase64);
+
+    std::vector<StagedPluginInstance> staged;
+    std::vector<MockPluginInstance*> mocks;
+    for (auto name : { "StagedA", "StagedB" })
+    {
+        auto mock = std::make_unique<MockPluginInstance>(name);
+        mock->prepareToPlay(44100.0, 512);
+        mocks.push_back(mock.get());
+
+        StagedPluginInstance s;
+        s.fileOrIdentifier = juce::String("/mock/") + name;
+        mock->fillInPluginDescription(s.description);
+        s.instance = std::move(mock);
+        // Pretend StagedA already had the chunk applied during prefetch; StagedB didn't
+        s.appliedStateHash = (juce::String(name) == "StagedA") ? stateBase64.hashCode64() : 0;
+        staged.push_back(std::move(s));
+    }
+
+    auto result = fix.chainProcessor.restoreChainFromXml(*chainXml, &staged);
+
+    REQUIRE(result.success);
+    REQUIRE(result.missingPlugins.isEmpty());
+    REQUIRE(staged.empty());
+    REQUIRE(fix.chainProcessor.getNumSlots() == 2);
+
+    // Adopted instances are the ones in the graph
+    REQUIRE(fix.chainProcessor.getSlotProcessor(0) != nullptr);
+
+    // Chunk only re-applied where the staged hash didn't match
+    REQUIRE(mocks[0]->stateRestoreCount == 0);
+    REQUIRE(mocks[1]->stateRestoreCount == 1);
+    REQUIRE(mocks[1]->lastRestoredState == stateText);
+
+    // Audio keeps flowing after the fade-in
+    juce::AudioBuffer<float> buffer(2, 512);
+    juce::MidiBuffer midi;
+    for (int i = 0; i < 4; ++i)
+    {
+        fillTestBuffer(buffer, 0.5f);
+        fix.chainProcessor.processBlock(buffer, midi);
+    }
+    REQUIRE_THAT(buffer.getSample(0, 511), WithinAbs(0.5f, 0.001f));
+}
+
+TEST_CASE("ChainProcessor: staged swap waits for the audio thread's fade-out", "[chain][prefetch]")
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+
+    ChainProcessorFixture fix;
+    fix.chainProcessor.setSwapFadeMs(5.0f);
+
+    auto stateBase64 = juce::MemoryBlock("MOCK_STATE_Swap", 15).toBase64Encoding();
+    auto mock = std::make_unique<MockPluginInstance>("Swap");
+    mock->prepareToPlay(44100.0, 512);
+
+    std::vector<StagedPluginInstance> staged(1);
+    staged[0].fileOrIdentifier = "/mock/Swap";
+    mock->fillInPluginDescription(staged[0].description);
+    staged[0].instance = std::move(mock);
+
+    bool done = false;
+    fix.chainProcessor.restoreChainFromXmlAsync(makeStagedTestChainXml({ "Swap" }, stateBase64), std::move(staged),
+                                                [&done](ChainProcessor::RestoreResult result) {
+                                                    REQUIRE(result.success);
+                                                    done = true;
+                                                });
+
+    // Returns straight away; nothing swaps until the old chain is silent
+    REQUIRE_FALSE(done);
+    REQUIRE(fix.chainProcessor.getNumSlots() == 0);
+
+    juce::AudioBuffer<float> buffer(2, 512);
+    juce::MidiBuffer midi;
+    fillTestBuffer(buffer, 0.5f);
+    fix.chainProcessor.processBlock(buffer, midi);
+    REQUIRE_THAT(buffer.getSample(0, 511), WithinAbs(0.0f, 0.001f));
+
+    // Well inside the no-audio timeout, so this is the audio thread's signal
+    juce::MessageManager::getInstance()->runDispatchLoopUntil(10);
+    REQUIRE(done);
+    REQUIRE(fix.chainProcessor.getNumSlots() == 1);
+}
+
+// =============================================================================
+// Whole-chain loads reuse matching plugin instances
+// =============================================================================
+
+TEST_CASE("ChainProcessor: restoreChainFromXml reuses matching instances", "[chain][reuse]")
+{
+    ChainProcessorTestFixture fix;
+    fix.addMock("EQ");
+    fix.addMock("Comp");
+
+    auto* eq = dynamic_cast<MockPluginInstance*>(fix.chain.getSlotProcessor(0));
+    auto* comp = dynamic_cast<MockPluginInstance*>(fix.chain.getSlotProcessor(1));
+    REQUIRE(eq != nullptr);
+    REQUIRE(comp != nullptr);
+
+    auto xml = fix.chain.serializeChainToXml();
+    REQUIRE(xml != nullptr);
+
+    SECTION("unchanged chunks are not re-applied")
+    {
+        juce::String changed = "MOCK_STATE_CompVariation";
+        int index = 0;
+        for (auto* nodeXml : xml->getChildWithTagNameIterator("Node"))
+        {
+            if (index++ == 1)
+                nodeXml->setAttribute("state", juce::MemoryBlock(changed.toRawUTF8(), changed.getNumBytesAsUTF8()).toBase64Encoding());
+        }
+
+        auto result = fix.chain.restoreChainFromXml(*xml);
+        REQUIRE(result.success);
+        REQUIRE(fix.chain.getNumSlots() == 2);
+
+        // Same instances are still in the graph
+        REQUIRE(fix.chain.getSlotProcessor(0) == eq);
+        REQUIRE(fix.chain.getSlotProcessor(1) == comp);
+
+        REQUIRE(eq->stateRestoreCount == 0);
+        REQUIRE(comp->stateRestoreCount == 1);
+        REQUIRE(comp->lastRestoredState == changed);
+    }
+
+    SECTION("unmatched plugins are removed, matched ones survive a reorder")
+    {
+        // Keep only Comp, now at position 0
+        auto* eqXml = xml->getChildByName("Node");
+        xml->removeChildElement(eqXml, true);
+
+        auto result = fix.chain.restoreChainFromXml(*xml);
+        REQUIRE(result.success);
+        REQUIRE(fix.chain.getNumSlots() == 1);
+        REQUIRE(fix.chain.getSlotProcessor(0) == comp);
+        REQUIRE(comp->stateRestoreCount == 0);
+    }
+
+    fix.processBlock();
+}
+
+TEST_CASE("ChainProcessor: scenes recall parameters at the block boundary", "[chain][scenes]")
+{
+    ChainProcessorTestFixture fix;
+    fix.addMock("EQ");
+    fix.addMock("Comp");  // no parameters — must go through its chunk
+
+    auto* eq = dynamic_cast<MockPluginInstance*>(fix.chain.getSlotProcessor(0));
+    auto* comp = dynamic_cast<MockPluginInstance*>(fix.chain.getSlotProcessor(1));
+    REQUIRE(eq != nullptr);
+    REQUIRE(comp != nullptr);
+
+    auto* gain = new juce::AudioParameterFloat(juce::ParameterID { "gain", 1 }, "Gain", 0.0f, 1.0f, 0.25f);
+    eq->addParameter(gain);
+
+    REQUIRE(fix.chain.captureScene(0, "Verse"));
+    gain->setValue(0.75f);
+    REQUIRE(fix.chain.captureScene(1, "Chorus"));
+    REQUIRE(fix.chain.hasScene(0));
+    REQUIRE_FALSE(fix.chain.hasScene(2));
+
+    SECTION("recall is deferred to the next block and skips chunks for covered plugins")
+    {
+        REQUIRE(fix.chain.recallScene(0));
+        REQUIRE_THAT(gain->getValue(), WithinAbs(0.75, 1e-6));
+
+        fix.processBlock();
+        REQUIRE_THAT(gain->getValue(), WithinAbs(0.25, 1e-6));
+        REQUIRE(eq->stateRestoreCount == 0);
+        REQUIRE(comp->stateRestoreCount == 1);
+    }
+
+    SECTION("morph blends continuous parameters")
+    {
+        REQUIRE(fix.chain.morphScenes(0, 1, 0.5f));
+        fix.processBlock();
+        REQUIRE_THAT(gain->getValue(), WithinAbs(0.5, 1e-6));
+    }
+
+    SECTION("a morph sweep restores a chunk-only plugin once, not per position")
+    {
+        for (int step = 0; step <= 20; ++step)
+            REQUIRE(fix.chain.morphScenes(0, 1, static_cast<float>(step) / 20.0f));
+        REQUIRE(comp->stateRestoreCount == 1);
+
+        // An explicit recall restores it again, even though the chunk is the same
+        REQUIRE(fix.chain.recallScene(1));
+        REQUIRE(comp->stateRestoreCount == 2);
+    }
+
+    SECTION("scenes survive a state roundtrip")
+    {
+        juce::MemoryBlock state;
+        fix.chain.getStateInformation(state);
+        fix.chain.clearScene(0);
+        fix.chain.clearScene(1);
+
+        fix.chain.setStateInformation(state.getData(), static_cast<int>(state.getSize()));
+        REQUIRE(fix.chain.hasScene(0));
+        REQUIRE(fix.chain.hasScene(1));
+        REQUIRE(fix.chain.getScenesAsJson()[1].getProperty("name", {}).toString() == "Chorus");
+    }
+}
+
+TEST_CASE("ChainProcessor: structural operations replay on an identical tree", "[chain][mirror]")
+{
+    ChainProcessorTestFixture leader;
+    ChainProcessorTestFixture follower;
+
+    std::vector<ChainNodeId> ids;
+    for (auto* name : { "EQ", "Comp", "Sat", "Verb" })
+    {
+        ids.push_back(leader.addMock(name));
+        follower.addMock(name);
+    }
+
+    std::vector<juce::var> ops;
+    leader.chain.onStructuralOperation = [&ops](const juce::var& op) { ops.push_back(op); };
+
+    auto shape = [](const ChainProcessor& chain)
+    {
+        std::function<juce::String(const ChainNode&)> describe = [&describe](const ChainNode& node)
+        {
+            if (node.isPlugin())
+                return node.getPlugin().isDryPath ? juce::String("dry") : node.name;
+            juce::String s = node.getGroup().mode == GroupMode::Parallel ? "P(" : "S(";
+            for (const auto& child : node.getGroup().children)
+                s << describe(*child) << ",";
+            return s + ")";
+        };
+        return describe(chain.getRootNode());
+    };
+
+    auto groupId = leader.chain.createGroup({ ids[1], ids[2] }, GroupMode::Serial, "Dynamics");
+    REQUIRE(groupId > 0);
+    REQUIRE(leader.chain.setGroupMode(groupId, GroupMode::Parallel));
+    REQUIRE(leader.chain.moveNode(ids[3], groupId, 0));
+    REQUIRE(leader.chain.removeNode(ids[0]));
+    REQUIRE(leader.chain.dissolveGroup(groupId));
+
+    REQUIRE(ops.size() == 5);
+    for (const auto& op : ops)
+        REQUIRE(follower.chain.applyStructuralOperation(op));
+
+    REQUIRE(shape(follower.chain) == shape(leader.chain));
+    REQUIRE(follower.chain.getFlatPluginList().size() == leader.chain.getFlatPluginList().size());
+}
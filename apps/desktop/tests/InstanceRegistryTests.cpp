@@ -0,0 +1,87 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../src/core/InstanceRegistry.h"
+
+namespace
+{
+    struct RecordingListener : InstanceRegistry::Listener
+    {
+        std::vector<InstanceRegistry::ChangeSet> received;
+
+        void instanceRegistryChanged(const InstanceRegistry::ChangeSet& changes) override
+        {
+            received.push_back(changes);
+        }
+    };
+
+    InstanceInfo makeInfo(const juce::String& trackName, int pluginCount)
+    {
+        InstanceInfo info;
+        info.trackName = trackName;
+        info.pluginCount = pluginCount;
+        return info;
+    }
+
+    void pumpMessages()
+    {
+        juce::MessageManager::getInstance()->runDispatchLoopUntil(50);
+    }
+}
+
+TEST_CASE("InstanceRegistry - snapshots are versioned and share unchanged entries", "[registry]")
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+    InstanceRegistry registry;
+
+    auto a = registry.registerInstance(nullptr, "Kick");
+    auto b = registry.registerInstance(nullptr, "Snare");
+
+    auto before = registry.getSnapshot();
+    REQUIRE(before->version == registry.getVersion());
+    REQUIRE(before->instances.size() == 2);
+
+    registry.updateInstanceInfo(b, makeInfo("Snare", 3));
+    auto after = registry.getSnapshot();
+
+    REQUIRE(after->version == before->version + 1);
+    REQUIRE(after->find(a)->get() == before->find(a)->get());   // Untouched entry is shared
+    REQUIRE((*after->find(b))->pluginCount == 3);
+    REQUIRE((*before->find(b))->pluginCount == 0);              // Old readers keep their view
+
+    // Identical update: no new snapshot
+    registry.updateInstanceInfo(b, makeInfo("Snare", 3));
+    REQUIRE(registry.getVersion() == after->version);
+}
+
+TEST_CASE("InstanceRegistry - notifications are coalesced with the changed IDs", "[registry]")
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+    InstanceRegistry registry;
+    RecordingListener listener;
+
+    auto a = registry.registerInstance(nullptr, "Kick");
+    auto b = registry.registerInstance(nullptr, "Snare");
+    pumpMessages();
+
+    registry.addListener(&listener);
+
+    for (int i = 1; i <= 10; ++i)
+        registry.updateInstanceInfo(a, makeInfo("Kick", i));
+    registry.updateInstanceInfo(b, makeInfo("Snare", 1));
+    pumpMessages();
+
+    REQUIRE(listener.received.size() == 1);
+    const auto& changes = listener.received.front();
+    REQUIRE(changes.instanceIds == std::vector<InstanceId> { a, b });
+    REQUIRE_FALSE(changes.mirrorGroupsChanged);
+    REQUIRE(changes.version == registry.getVersion());
+
+    listener.received.clear();
+    registry.createMirrorGroup(a, b, a);
+    pumpMessages();
+
+    REQUIRE(listener.received.size() == 1);
+    REQUIRE(listener.received.front().mirrorGroupsChanged);
+    REQUIRE(registry.getLeaderForInstance(b) == a);
+
+    registry.removeListener(&listener);
+}
@@ -0,0 +1,129 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../src/core/ParameterDiscoveryCache.h"
+#include "TestHelpers.h"
+
+namespace
+{
+    void addEqParameters(MockPluginInstance& plugin, const juce::String& firstName = "Band 1 Frequency")
+    {
+        plugin.addParameter(new juce::AudioParameterFloat(juce::ParameterID { "freq", 1 }, firstName,
+                                                          juce::NormalisableRange<float>(20.0f, 20000.0f, 0.0f, 0.2f),
+                                                          1000.0f, juce::AudioParameterFloatAttributes().withLabel("Hz")));
+        plugin.addParameter(new juce::AudioParameterFloat(juce::ParameterID { "gain", 1 }, "Band 1 Gain",
+                                                          juce::NormalisableRange<float>(-24.0f, 24.0f), 0.0f,
+                                                          juce::AudioParameterFloatAttributes().withLabel("dB")));
+        plugin.addParameter(new juce::AudioParameterFloat(juce::ParameterID { "q", 1 }, "Band 1 Q",
+                                                          juce::NormalisableRange<float>(0.1f, 30.0f), 1.0f));
+    }
+
+    juce::PluginDescription describe(const MockPluginInstance& plugin, const juce::String& version = "1.0")
+    {
+        juce::PluginDescription desc;
+        plugin.fillInPluginDescription(desc);
+        desc.version = version;
+        return desc;
+    }
+}
+
+TEST_CASE("ParameterDiscoveryCache - second lookup reuses the discovered map", "[discoverycache]")
+{
+    TempTestDirectory temp { "ProChainDiscoveryCacheTest" };
+    ParameterDiscoveryCache cache(temp.dir);
+    MockPluginInstance eq { "CacheEQ" };
+    addEqParameters(eq);
+    const auto desc = describe(eq);
+
+    auto first = cache.getOrDiscover(eq, desc);
+    REQUIRE(first != nullptr);
+    REQUIRE(first->parameters.size() == 3);
+    REQUIRE(first->parameters[0].semantic == "eq_band_1_freq");
+    REQUIRE(cache.getStats().misses == 1);
+
+    auto second = cache.getOrDiscover(eq, desc);
+    REQUIRE(second == first);
+    REQUIRE(cache.getStats().hits == 1);
+}
+
+TEST_CASE("ParameterDiscoveryCache - maps survive a new cache on the same directory", "[discoverycache]")
+{
+    TempTestDirectory temp { "ProChainDiscoveryCacheTest" };
+    MockPluginInstance eq { "CacheEQ" };
+    addEqParameters(eq);
+    const auto desc = describe(eq);
+
+    ParameterDiscovery::DiscoveredMap original;
+    {
+        ParameterDiscoveryCache cache(temp.dir);
+        original = *cache.getOrDiscover(eq, desc);
+    }
+
+    ParameterDiscoveryCache reopened(temp.dir);
+    auto loaded = reopened.find(eq, desc);
+    REQUIRE(loaded != nullptr);
+    REQUIRE(reopened.getStats().hits == 1);
+
+    REQUIRE(loaded->category == original.category);
+    REQUIRE(loaded->eqBandCount == original.eqBandCount);
+    REQUIRE(loaded->matchedCount == original.matchedCount);
+    REQUIRE(loaded->parameters.size() == original.parameters.size());
+    for (int i = 0; i < original.parameters.size(); ++i)
+    {
+        const auto& a = loaded->parameters.getReference(i);
+        const auto& b = original.parameters.getReference(i);
+        REQUIRE(a.juceParamId == b.juceParamId);
+        REQUIRE(a.juceParamIndex == b.juceParamIndex);
+        REQUIRE(a.semantic == b.semantic);
+        REQUIRE(a.physicalUnit == b.physicalUnit);
+        REQUIRE(a.hasNormalisableRange == b.hasNormalisableRange);
+        REQUIRE(a.skewFactor == b.skewFactor);
+        REQUIRE(a.curveSamples.size() == b.curveSamples.size());
+        REQUIRE(a.qRepresentation == b.qRepresentation);
+    }
+}
+
+TEST_CASE("ParameterDiscoveryCache - changed parameters or versions are discovered again", "[discoverycache]")
+{
+    TempTestDirectory temp { "ProChainDiscoveryCacheTest" };
+    ParameterDiscoveryCache cache(temp.dir);
+
+    MockPluginInstance eq { "CacheEQ" };
+    addEqParameters(eq);
+    cache.getOrDiscover(eq, describe(eq));
+
+    SECTION("Renamed parameter, same version and count")
+    {
+        MockPluginInstance updated { "CacheEQ" };
+        addEqParameters(updated, "Band 2 Frequency");
+        REQUIRE(cache.find(updated, describe(updated)) == nullptr);
+        REQUIRE(cache.getStats().invalidated == 1);
+
+        auto rediscovered = cache.getOrDiscover(updated, describe(updated));
+        REQUIRE(rediscovered->parameters[0].semantic == "eq_band_2_freq");
+    }
+
+    SECTION("New version")
+    {
+        REQUIRE(cache.find(eq, describe(eq, "2.0")) == nullptr);
+        REQUIRE(cache.getStats().invalidated == 0);
+    }
+
+    SECTION("Cleared")
+    {
+        cache.clear();
+        REQUIRE(cache.find(eq, describe(eq)) == nullptr);
+        REQUIRE(temp.dir.findChildFiles(juce::File::findFiles, false, "*.json").isEmpty());
+    }
+}
+
+TEST_CASE("ParameterDiscoveryCache - plugins without an identifier aren't cached", "[discoverycache]")
+{
+    TempTestDirectory temp { "ProChainDiscoveryCacheTest" };
+    ParameterDiscoveryCache cache(temp.dir);
+    MockPluginInstance eq { "CacheEQ" };
+    addEqParameters(eq);
+
+    juce::PluginDescription anonymous;
+    anonymous.name = "CacheEQ";
+    REQUIRE(cache.getOrDiscover(eq, anonymous)->parameters.size() == 3);
+    REQUIRE(temp.dir.findChildFiles(juce::File::findFiles, false, "*.json").isEmpty());
+}
@@ -1,6 +1,8 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 #include "core/ParameterDiscovery.h"
+#include <atomic>
+#include <thread>
 
 using Catch::Matchers::WithinAbs;
 using Catch::Matchers::WithinRel;
@@ -239,3 +241,86 @@ TEST_CASE("ParameterDiscovery — parseFloatFromText", "[ParameterDiscovery]")
     CHECK_THAT(ParameterDiscovery::parseFloatFromText("0.25 ms"), WithinAbs(0.25f, 0.01f));
     CHECK_THAT(ParameterDiscovery::parseFloatFromText("no number"), WithinAbs(0.0f, 0.01f));
 }
+
+TEST_CASE("ParameterDiscovery — name classification", "[ParameterDiscovery]")
+{
+    // Same results as the per-pattern std::regex matcher the keyword table replaced,
+    // including its whole-word rules ("Freq_5" is one word) and rule order
+    struct Expected { const char* name; const char* semantic; int bandNumber; };
+    const Expected cases[] = {
+        { "Band 3 Frequency", "eq_band_3_freq", 3 },
+        { "B2 Gain", "eq_band_2_gain", 2 },
+        { "HF Gain", "eq_band_5_gain", 5 },
+        { "Low Mid Gain", "eq_band_1_gain", 1 },
+        { "Band 4 Used", "eq_band_4_active", 4 },
+        { "Band 2 dB/Oct", "eq_band_2_slope", 2 },
+        { "Eq Band Type", "eq_band_1_type", 1 },
+        { "Band 99999999999 Gain", "eq_band_1_gain", 1 },
+        { "Threshold", "comp_threshold", -1 },
+        { "Make-Up", "comp_makeup", -1 },
+        { "Comp Mix", "comp_mix", -1 },
+        { "Pre-Delay", "reverb_predelay", -1 },
+        { "Reverb Type", "reverb_type", -1 },
+        { "Delay Time", "delay_time", -1 },
+        { "Echo Time", "delay_time", -1 },
+        { "Ping-Pong Delay", "delay_spread", -1 },
+        { "Look Ahead", "limiter_lookahead", -1 },
+        { "Gate Range", "gate_range", -1 },
+        { "Output Gain", "output_gain", -1 },
+        { "Dry/Wet", "dry_wet_mix", -1 },
+        { "Polarity", "phase_invert", -1 },
+        { "Bypass", "", -1 },
+        { "Band 1 Bypass", "", -1 },
+        { "Meter Output", "", -1 },
+        { "Freq_5", "", -1 },
+        { "Unknown Knob", "", -1 },
+    };
+
+    for (const auto& expected : cases)
+    {
+        INFO(expected.name);
+        const auto match = ParameterDiscovery::matchParameterName(expected.name);
+        CHECK(match.semantic == juce::String(expected.semantic));
+        CHECK(match.bandNumber == expected.bandNumber);
+    }
+
+    CHECK(ParameterDiscovery::matchParameterName("BAND 3 FREQUENCY").semantic == juce::String("eq_band_3_freq"));
+    CHECK(ParameterDiscovery::matchParameterName("Band 3 Frequency").unit == juce::String("hz"));
+    CHECK(ParameterDiscovery::matchParameterName("Attack").curve == juce::String("logarithmic"));
+}
+
+TEST_CASE("ParameterDiscovery — band numbers", "[ParameterDiscovery]")
+{
+    CHECK(ParameterDiscovery::extractBandNumber("Band 3 Freq") == 3);
+    CHECK(ParameterDiscovery::extractBandNumber("band12 gain") == 12);
+    CHECK(ParameterDiscovery::extractBandNumber("Gain B 7") == 7);
+    CHECK(ParameterDiscovery::extractBandNumber("LF 1") == 1);
+    CHECK(ParameterDiscovery::extractBandNumber("Gain 2  ") == 2);
+    CHECK(ParameterDiscovery::extractBandNumber("HMF Gain") == 4);
+    CHECK(ParameterDiscovery::extractBandNumber("Air") == 5);
+    CHECK(ParameterDiscovery::extractBandNumber("Gain2") == -1);
+    CHECK(ParameterDiscovery::extractBandNumber("Threshold") == -1);
+}
+
+TEST_CASE("ParameterDiscovery — concurrent classification", "[ParameterDiscovery]")
+{
+    // The compiled table is shared; classifying from several threads must agree
+    std::vector<std::thread> threads;
+    std::atomic<int> mismatches { 0 };
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&mismatches] {
+            for (int i = 0; i < 500; ++i)
+            {
+                const int band = i % 8 + 1;
+                if (ParameterDiscovery::matchParameterName("Band " + juce::String(band) + " Gain").semantic
+                    != "eq_band_" + juce::String(band) + "_gain")
+                    ++mismatches;
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    CHECK(mismatches.load() == 0);
+}
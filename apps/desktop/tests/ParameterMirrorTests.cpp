@@ -0,0 +1,227 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include "core/ParameterMirror.h"
+#include "TestHelpers.h"
+
+using Catch::Matchers::WithinAbs;
+
+namespace
+{
+    struct RecordingListener : ParameterMirror::Listener
+    {
+        std::vector<uint32_t> lastChanged;
+        int changeCalls = 0;
+        int rebuildCalls = 0;
+
+        void parameterMirrorChanged(const ParameterMirror&, const std::vector<uint32_t>& changed) override
+        {
+            lastChanged = changed;
+            ++changeCalls;
+        }
+
+        void parameterMirrorRebuilt(const ParameterMirror&) override { ++rebuildCalls; }
+    };
+
+    struct MirrorFixture
+    {
+        juce::ScopedJuceInitialiser_GUI juceInit;
+        MockPluginInstance eq { "EQ" };
+        MockPluginInstance comp { "Comp" };
+        ParameterMirror mirror;
+        RecordingListener listener;
+
+        MirrorFixture(int paramsPerPlugin)
+        {
+            addParams(eq, paramsPerPlugin);
+            addParams(comp, paramsPerPlugin);
+            mirror.addListener(&listener);
+            mirror.rebuild({ { 1, &eq, nullptr }, { 2, &comp, nullptr } });
+        }
+
+        ~MirrorFixture() { mirror.removeListener(&listener); }
+
+        static void addParams(MockPluginInstance& plugin, int count)
+        {
+            for (int i = 0; i < count; ++i)
+                plugin.addParameter(new juce::AudioParameterFloat(juce::ParameterID { "p" + juce::String(i), 1 },
+                                                                  "P" + juce::String(i), 0.0f, 1.0f, 0.5f));
+        }
+    };
+}
+
+TEST_CASE("ParameterMirror - layout is contiguous in plugin order", "[parammirror]")
+{
+    MirrorFixture fix(10);
+
+    REQUIRE(fix.listener.rebuildCalls == 1);
+    REQUIRE(fix.mirror.getNumParameters() == 20);
+    REQUIRE(fix.mirror.findIndex(2, 3) == 13);
+    REQUIRE(fix.mirror.findIndex(2, 10) == -1);
+    REQUIRE(fix.mirror.findIndex(99, 0) == -1);
+
+    auto location = fix.mirror.getLocation(13);
+    REQUIRE(location.nodeId == 2);
+    REQUIRE(location.slotIndex == 1);
+    REQUIRE(location.paramIndex == 3);
+    REQUIRE(fix.mirror.getLocation(20).nodeId == -1);
+}
+
+TEST_CASE("ParameterMirror - notified changes are reported by index", "[parammirror]")
+{
+    MirrorFixture fix(200);
+
+    // Nothing touched: the refresh costs only the sweep budget
+    fix.mirror.refresh();
+    REQUIRE(fix.listener.changeCalls == 0);
+    REQUIRE(fix.mirror.getLastReadCount() == ParameterMirror::kSweepPerTick);
+
+    fix.comp.getParameters()[150]->setValueNotifyingHost(0.9f);
+    fix.mirror.refresh();
+
+    REQUIRE(fix.listener.changeCalls == 1);
+    REQUIRE(fix.listener.lastChanged == std::vector<uint32_t> { 350 });
+    REQUIRE_THAT(fix.mirror.getValue(350), WithinAbs(0.9, 1e-6));
+    REQUIRE(fix.mirror.getLastReadCount() == ParameterMirror::kSweepPerTick + 1);
+}
+
+TEST_CASE("ParameterMirror - sweep catches changes made without notification", "[parammirror]")
+{
+    MirrorFixture fix(100);
+    const int ticksForFullSweep = (fix.mirror.getNumParameters() + ParameterMirror::kSweepPerTick - 1)
+                                / ParameterMirror::kSweepPerTick;
+
+    // setValue() bypasses listeners, like a plugin changing its own state from a preset
+    fix.eq.getParameters()[42]->setValue(0.1f);
+
+    for (int i = 0; i < ticksForFullSweep; ++i)
+        fix.mirror.refresh();
+
+    REQUIRE(fix.listener.changeCalls == 1);
+    REQUIRE(fix.listener.lastChanged == std::vector<uint32_t> { 42 });
+    REQUIRE_THAT(fix.mirror.getValue(42), WithinAbs(0.1, 1e-6));
+}
+
+TEST_CASE("ParameterMirror - sweep window wraps around the end of the mirror", "[parammirror]")
+{
+    MirrorFixture fix(100);
+    REQUIRE(fix.mirror.getNumParameters() % ParameterMirror::kSweepPerTick != 0);
+
+    // Advance the cursor to the last partial window, then change one value either side of the wrap
+    const int fullWindows = fix.mirror.getNumParameters() / ParameterMirror::kSweepPerTick;
+    for (int i = 0; i < fullWindows; ++i)
+        fix.mirror.refresh();
+    REQUIRE(fix.listener.changeCalls == 0);
+
+    fix.comp.getParameters()[99]->setValue(0.2f);   // Mirror index 199, before the wrap
+    fix.eq.getParameters()[3]->setValue(0.7f);      // Mirror index 3, after it
+    fix.mirror.refresh();
+
+    REQUIRE(fix.listener.changeCalls == 1);
+    REQUIRE(fix.listener.lastChanged == std::vector<uint32_t> { 3, 199 });
+    REQUIRE(fix.mirror.getLastReadCount() == ParameterMirror::kSweepPerTick);
+}
+
+TEST_CASE("ParameterMirror - gestures are counted across plugins", "[parammirror]")
+{
+    MirrorFixture fix(4);
+
+    fix.eq.getParameters()[0]->beginChangeGesture();
+    fix.comp.getParameters()[1]->beginChangeGesture();
+    REQUIRE(fix.mirror.getActiveGestureCount() == 2);
+
+    fix.eq.getParameters()[0]->endChangeGesture();
+    fix.comp.getParameters()[1]->endChangeGesture();
+    REQUIRE(fix.mirror.getActiveGestureCount() == 0);
+}
+
+TEST_CASE("ParameterMirror - realtime changes reach a partner without echoing back", "[parammirror][mirror]")
+{
+    MirrorFixture leader(8);
+    MirrorFixture follower(8);
+    MirrorParameterChannel toFollower, toLeader;
+    std::vector<MirrorParameterChannel::Entry> entries(64);
+
+    REQUIRE(leader.mirror.getLayoutHash() == follower.mirror.getLayoutHash());
+
+    leader.comp.getParameters()[5]->setValueNotifyingHost(0.25f);
+
+    int count = leader.mirror.collectRealtimeChanges(entries.data(), 64);
+    REQUIRE(count == 1);
+    REQUIRE(toFollower.push(entries.data(), count) == 1);
+
+    // Follower's next block
+    REQUIRE(follower.mirror.applyRealtimeChanges(toFollower) == 1);
+    REQUIRE_THAT(follower.comp.getParameters()[5]->getValue(), WithinAbs(0.25, 1e-6));
+
+    // Applying notified the follower's own listeners, but that value came from the leader
+    REQUIRE(follower.mirror.collectRealtimeChanges(entries.data(), 64) == 0);
+
+    // A genuine follower edit still goes the other way
+    follower.eq.getParameters()[2]->setValueNotifyingHost(0.75f);
+    count = follower.mirror.collectRealtimeChanges(entries.data(), 64);
+    REQUIRE(count == 1);
+    toLeader.push(entries.data(), count);
+    REQUIRE(leader.mirror.applyRealtimeChanges(toLeader) == 1);
+    REQUIRE_THAT(leader.eq.getParameters()[2]->getValue(), WithinAbs(0.75, 1e-6));
+}
+
+TEST_CASE("ParameterMirror - realtime entries from another layout are dropped", "[parammirror][mirror]")
+{
+    MirrorFixture leader(8);
+    MirrorFixture follower(6);
+    MirrorParameterChannel channel;
+    std::vector<MirrorParameterChannel::Entry> entries(64);
+
+    REQUIRE(leader.mirror.getLayoutHash() != follower.mirror.getLayoutHash());
+
+    leader.eq.getParameters()[1]->setValueNotifyingHost(0.9f);
+    const int count = leader.mirror.collectRealtimeChanges(entries.data(), 64);
+    channel.push(entries.data(), count);
+
+    REQUIRE(follower.mirror.applyRealtimeChanges(channel) == 0);
+    REQUIRE(channel.getNumReady() == 0);
+    REQUIRE_THAT(follower.eq.getParameters()[1]->getValue(), WithinAbs(0.5, 1e-6));
+}
+
+TEST_CASE("ParameterMirror - realtime backlog beyond the per-block budget carries over", "[parammirror][mirror]")
+{
+    MirrorFixture fix(8);
+    std::vector<MirrorParameterChannel::Entry> entries(4);
+
+    fix.mirror.requestRealtimeResync();
+
+    int total = 0;
+    for (int block = 0; block < 4; ++block)
+        total += fix.mirror.collectRealtimeChanges(entries.data(), 4);
+
+    REQUIRE(total == fix.mirror.getNumParameters());
+    REQUIRE(fix.mirror.collectRealtimeChanges(entries.data(), 4) == 0);
+}
+
+TEST_CASE("ParameterMirror - full state for one partner walks every parameter once", "[parammirror][mirror]")
+{
+    MirrorFixture leader(8);
+    MirrorFixture follower(8);
+    MirrorParameterChannel channel;
+    std::vector<MirrorParameterChannel::Entry> entries(5);
+
+    leader.comp.getParameters()[7]->setValue(0.125f);
+
+    uint32_t cursor = 0;
+    bool finished = false;
+    int blocks = 0;
+    while (!finished)
+    {
+        const int count = leader.mirror.collectRealtimeState(entries.data(), 5, cursor, finished);
+        REQUIRE(channel.push(entries.data(), count) == count);
+        ++blocks;
+    }
+
+    REQUIRE(blocks == 4);   // 16 parameters, 5 per block
+    REQUIRE(channel.getNumReady() == leader.mirror.getNumParameters());
+    REQUIRE(follower.mirror.applyRealtimeChanges(channel) == 16);
+    REQUIRE_THAT(follower.comp.getParameters()[7]->getValue(), WithinAbs(0.125, 1e-6));
+
+    // Nothing was marked pending for anyone else
+    REQUIRE(leader.mirror.collectRealtimeChanges(entries.data(), 5) == 0);
+}
@@ -0,0 +1,135 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../src/core/ParameterNameIndex.h"
+#include "../src/core/ParameterDiscoveryCache.h"
+#include "TestHelpers.h"
+
+namespace
+{
+    ParameterDiscovery::DiscoveredMap makeMap(const juce::StringArray& names)
+    {
+        ParameterDiscovery::DiscoveredMap map;
+        for (int i = 0; i < names.size(); ++i)
+        {
+            ParameterDiscovery::DiscoveredParameter dp;
+            dp.juceParamId = names[i];
+            dp.juceParamIndex = i;
+            map.parameters.add(dp);
+        }
+        return map;
+    }
+
+    ParameterDiscovery::DiscoveredMap makeEqMap(int numBands)
+    {
+        juce::StringArray names;
+        for (int band = 1; band <= numBands; ++band)
+            for (const auto* suffix : { "Frequency", "Gain", "Q", "Used" })
+                names.add("Band " + juce::String(band) + " " + suffix);
+        names.addArray({ "Output Level", "Output Pan", "Auto Gain" });
+        return makeMap(names);
+    }
+}
+
+TEST_CASE("ParameterNameIndex - normalization", "[nameindex]")
+{
+    REQUIRE(ParameterNameIndex::normalize("Band 3 Gain") == "band 3 gain");
+    REQUIRE(ParameterNameIndex::normalize("Band3-Gain") == "band 3 gain");
+    REQUIRE(ParameterNameIndex::normalize("  HP_Freq12k ") == "hp freq 12 k");
+    REQUIRE(ParameterNameIndex::normalize("--").empty());
+}
+
+TEST_CASE("ParameterNameIndex - semantic lookup", "[nameindex]")
+{
+    auto map = makeMap({ "Frequency", "Gain", "Frequency 2" });
+    map.parameters.getReference(0).matched = true;
+    map.parameters.getReference(0).semantic = "eq_band_1_freq";
+    map.parameters.getReference(1).matched = true;
+    map.parameters.getReference(1).semantic = "eq_band_1_gain";
+    map.parameters.getReference(2).matched = true;
+    map.parameters.getReference(2).semantic = "eq_band_1_freq";
+
+    ParameterNameIndex index(map);
+    REQUIRE(index.getNumSemantics() == 2);
+    REQUIRE(index.findBySemantic("eq_band_1_gain") == 1);
+    REQUIRE(index.findBySemantic("eq_band_1_freq") == 2);    // Last one wins
+    REQUIRE(index.findBySemantic("comp_threshold") == -1);
+}
+
+TEST_CASE("ParameterNameIndex - exact name lookup ignores case and punctuation", "[nameindex]")
+{
+    ParameterNameIndex index(makeEqMap(24));
+    REQUIRE(index.getNumParameters() == 24 * 4 + 3);
+    REQUIRE(index.findByName("Band 5 Used") == 4 * 4 + 3);
+    REQUIRE(index.findByName("band5_used") == 4 * 4 + 3);
+    REQUIRE(index.findByName("Band 25 Used") == -1);
+}
+
+TEST_CASE("ParameterNameIndex - similar names are ranked", "[nameindex]")
+{
+    ParameterNameIndex index(makeEqMap(24));
+
+    SECTION("Equal names score 1")
+    {
+        auto matches = index.findSimilar("band 3 gain");
+        REQUIRE(matches.size() == 1);
+        REQUIRE(matches[0].paramIndex == 2 * 4 + 1);
+        REQUIRE(matches[0].confidence == 1.0f);
+    }
+
+    SECTION("Abbreviated token")
+    {
+        auto matches = index.findSimilar("Band3 Freq");
+        REQUIRE(matches.size() == 1);
+        REQUIRE(matches[0].paramIndex == 2 * 4);
+        REQUIRE(matches[0].confidence >= ParameterNameIndex::kMinConfidence);
+        REQUIRE(matches[0].confidence < 1.0f);
+    }
+
+    SECTION("Band numbers must agree")
+    {
+        REQUIRE(index.findSimilar("Band 30 Gain").empty());
+
+        for (const auto& match : index.findSimilar("Band 12 Q", 10))
+            REQUIRE(match.paramIndex / 4 == 11);
+    }
+
+    SECTION("Best first, ties to the lower index")
+    {
+        auto matches = index.findSimilar("Freq", 3);
+        REQUIRE(matches.size() == 3);
+        REQUIRE(matches[0].paramIndex == 0);
+        REQUIRE(matches[1].paramIndex == 4);
+        REQUIRE(matches[0].confidence >= matches[1].confidence);
+        REQUIRE(matches[1].confidence >= matches[2].confidence);
+    }
+
+    SECTION("Unrelated or merely similar-looking names are rejected")
+    {
+        REQUIRE(index.findSimilar("Sidechain").empty());
+        REQUIRE(index.findSimilar("Band 3 Slope").empty());
+        REQUIRE(index.findSimilar("").empty());
+    }
+}
+
+TEST_CASE("ParameterNameIndex - cached alongside the discovered map", "[nameindex][discoverycache]")
+{
+    TempTestDirectory temp { "ProChainNameIndexTest" };
+    {
+        ParameterDiscoveryCache cache(temp.dir);
+        MockPluginInstance eq { "IndexEQ" };
+        eq.addParameter(new juce::AudioParameterFloat(juce::ParameterID { "freq", 1 }, "Band 1 Frequency",
+                                                      20.0f, 20000.0f, 1000.0f));
+        eq.addParameter(new juce::AudioParameterBool(juce::ParameterID { "used", 1 }, "Band 1 Used", false));
+
+        juce::PluginDescription desc;
+        eq.fillInPluginDescription(desc);
+
+        auto first = cache.getNameIndex(eq, desc);
+        REQUIRE(first->findByName("Band 1 Used") == 1);
+        REQUIRE(first->findBySemantic("eq_band_1_freq") == 0);
+        REQUIRE(cache.getNameIndex(eq, desc) == first);
+
+        juce::PluginDescription anonymous;
+        anonymous.name = "IndexEQ";
+        REQUIRE(cache.getNameIndex(eq, anonymous) != first);
+    }
+}
@@ -0,0 +1,301 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include "automation/ParameterProxyPool.h"
+#include "core/ChainProcessor.h"
+#include "TestHelpers.h"
+
+using Catch::Matchers::WithinAbs;
+
+namespace
+{
+    // Host-side processor the proxies register on (owns them, like PluginChainManagerProcessor)
+    struct PoolFixture : ChainProcessorTestFixture
+    {
+        MockPluginInstance host { "Host" };
+        ParameterProxyPool pool;
+
+        PoolFixture()
+        {
+            ParameterProxyPool::Settings settings;
+            settings.hostParameterCount = 16;
+            settings.legacySlotLayout = false;
+            pool.createAndRegister(host, settings);
+            chain.onParameterBindingChanged = [this]() { pool.rebindAll(chain); };
+        }
+
+        juce::AudioParameterFloat* addFloatParam(ChainNodeId nodeId, const juce::String& id)
+        {
+            auto* mock = dynamic_cast<MockPluginInstance*>(chain.getNodeProcessor(nodeId));
+            auto* param = new juce::AudioParameterFloat(juce::ParameterID { id, 1 }, id, 0.0f, 1.0f, 0.5f);
+            mock->addParameter(param);
+            return param;
+        }
+    };
+}
+
+TEST_CASE("ParameterProxyPool - dynamic layout registers only the configured count", "[automation]")
+{
+    PoolFixture fix;
+
+    REQUIRE_FALSE(fix.pool.isLegacyLayout());
+    REQUIRE(fix.pool.getNumHostParameters() == 16);
+    REQUIRE(fix.host.getParameters().size() == 16 + ParameterProxyPool::kNumMacros);
+    REQUIRE(fix.host.getParameters()[0]->getName(64) == "Param 1");
+}
+
+TEST_CASE("ParameterProxyPool - default registration keeps the legacy parameter IDs", "[automation]")
+{
+    MockPluginInstance host { "Host" };
+    ParameterProxyPool pool;
+    pool.createAndRegister(host);
+
+    REQUIRE(pool.isLegacyLayout());
+    REQUIRE(pool.getNumHostParameters() == ParameterProxyPool::kMaxSlots * ParameterProxyPool::kMaxParamsPerSlot);
+
+    auto* first = dynamic_cast<juce::AudioProcessorParameterWithID*>(host.getParameters()[0]);
+    REQUIRE(first != nullptr);
+    REQUIRE(first->getParameterID() == "s01_p000");
+}
+
+TEST_CASE("ParameterProxyPool - dynamic build defaults register 64 parameters plus macros", "[automation]")
+{
+    TempTestDirectory temp { "ProChainAutomationSettings" };
+    const auto file = temp.dir.getChildFile("automation-settings.json");
+
+    // No settings file: the default count
+    auto settings = ParameterProxyPool::loadSettings(file);
+    REQUIRE(settings.hostParameterCount == ParameterProxyPool::kDefaultHostParameters);
+    REQUIRE(settings.legacySlotLayout == !PROCHAIN_DYNAMIC_HOST_PARAMETERS);
+
+    MockPluginInstance host { "Host" };
+    ParameterProxyPool pool;
+    settings.legacySlotLayout = false;   // What the ProChain Dynamic target builds with
+    pool.createAndRegister(host, settings);
+    REQUIRE(host.getParameters().size() == ParameterProxyPool::kDefaultHostParameters + ParameterProxyPool::kNumMacros);
+
+    auto* first = dynamic_cast<juce::AudioProcessorParameterWithID*>(host.getParameters()[0]);
+    REQUIRE(first != nullptr);
+    REQUIRE(first->getParameterID() == "p0001");
+
+    SECTION("the saved count is clamped and never changes the layout")
+    {
+        ParameterProxyPool::Settings saved;
+        saved.hostParameterCount = 100000;
+        saved.legacySlotLayout = !saved.legacySlotLayout;
+        ParameterProxyPool::saveSettings(saved, file);
+
+        auto loaded = ParameterProxyPool::loadSettings(file);
+        REQUIRE(loaded.hostParameterCount == ParameterProxyPool::kMaxHostParameters);
+        REQUIRE(loaded.legacySlotLayout == !PROCHAIN_DYNAMIC_HOST_PARAMETERS);
+    }
+}
+
+TEST_CASE("ParameterProxyPool - mappings beyond this instance's count survive a save", "[automation]")
+{
+    PoolFixture fix;
+
+    juce::XmlElement saved("ParameterMap");
+    auto* beyond = saved.createNewChildElement("Map");
+    beyond->setAttribute("host", 40);
+    beyond->setAttribute("node", 3);
+    beyond->setAttribute("index", 2);
+    beyond->setAttribute("paramId", "mix");
+
+    fix.pool.mappingsFromXml(saved);
+    auto xml = fix.pool.mappingsToXml();
+
+    auto* kept = xml->getChildByName("Map");
+    REQUIRE(kept != nullptr);
+    REQUIRE(kept->getIntAttribute("host") == 40);
+    REQUIRE(kept->getStringAttribute("paramId") == "mix");
+}
+
+TEST_CASE("ParameterProxyPool - mappings follow the node across chain edits", "[automation]")
+{
+    PoolFixture fix;
+    auto eqId = fix.addMock("EQ");
+    auto compId = fix.addMock("Comp");
+    auto* threshold = fix.addFloatParam(compId, "threshold");
+
+    auto hostIndex = fix.pool.assign(fix.chain, compId, 0);
+    REQUIRE(hostIndex == 0);
+    REQUIRE(fix.pool.findHostIndex(compId, 0) == 0);
+
+    auto* proxy = fix.host.getParameters()[hostIndex];
+    REQUIRE(proxy->getName(64) == "[Comp] threshold");
+
+    // Reordering must not change what the host parameter controls
+    REQUIRE(fix.chain.moveNode(compId, 0, 0));
+    REQUIRE(fix.chain.moveNode(eqId, 0, 0));
+
+    proxy->setValue(0.8f);
+    REQUIRE_THAT(threshold->getValue(), WithinAbs(0.8, 1e-6));
+
+    // Assigning the same parameter again moves the mapping instead of duplicating it
+    REQUIRE(fix.pool.assign(fix.chain, compId, 0, 5) == 5);
+    REQUIRE(fix.pool.getMapping(0).isFree());
+    REQUIRE(fix.host.getParameters()[0]->getName(64) == "Param 1");
+}
+
+TEST_CASE("ParameterProxyPool - mappings survive an XML roundtrip and keep orphans reserved", "[automation]")
+{
+    PoolFixture fix;
+    auto compId = fix.addMock("Comp");
+    auto* threshold = fix.addFloatParam(compId, "threshold");
+    REQUIRE(fix.pool.assign(fix.chain, compId, 0, 3) == 3);
+
+    auto xml = fix.pool.mappingsToXml();
+    auto* orphan = xml->createNewChildElement("Map");
+    orphan->setAttribute("host", 7);
+    orphan->setAttribute("node", 999);
+    orphan->setAttribute("index", 0);
+    orphan->setAttribute("paramId", "missing");
+
+    fix.pool.clearMappings();
+    REQUIRE(fix.pool.getMapping(3).isFree());
+
+    fix.pool.mappingsFromXml(*xml);
+    fix.pool.rebindAll(fix.chain);
+
+    REQUIRE(fix.pool.getMapping(3).paramId == "threshold");
+    fix.host.getParameters()[3]->setValue(0.25f);
+    REQUIRE_THAT(threshold->getValue(), WithinAbs(0.25, 1e-6));
+
+    // Plugin not in the chain: slot stays reserved but unbound
+    REQUIRE_FALSE(fix.pool.getMapping(7).isFree());
+    REQUIRE(fix.host.getParameters()[7]->getName(64) == "Param 8");
+    REQUIRE(fix.pool.assign(fix.chain, compId, 0) == 3);
+}
+
+TEST_CASE("ParameterProxyPool - legacy slots stay with their plugin", "[automation]")
+{
+    ChainProcessorTestFixture fix;
+    MockPluginInstance host { "Host" };
+    ParameterProxyPool pool;
+
+    ParameterProxyPool::Settings settings;
+    settings.legacySlotLayout = true;
+    pool.createAndRegister(host, settings);
+    fix.chain.onParameterBindingChanged = [&]() { pool.rebindAll(fix.chain); };
+
+    auto firstId = fix.addMock("First");
+    auto secondId = fix.addMock("Second");
+    REQUIRE(pool.getSlotNodeId(0) == firstId);
+    REQUIRE(pool.getSlotNodeId(1) == secondId);
+
+    // Reorder: no proxy is touched
+    REQUIRE(fix.chain.moveNode(secondId, 0, 0));
+    REQUIRE(pool.getLastRebindChangeCount() == 0);
+    REQUIRE(pool.getSlotNodeId(0) == firstId);
+    REQUIRE(pool.getSlotNodeId(1) == secondId);
+
+    // Removal frees the slot; the next plugin takes it
+    REQUIRE(fix.chain.removeNode(firstId));
+    REQUIRE(pool.getSlotNodeId(0) == -1);
+    auto thirdId = fix.addMock("Third");
+    REQUIRE(pool.getSlotNodeId(0) == thirdId);
+    REQUIRE(pool.getSlotNodeId(1) == secondId);
+}
+
+TEST_CASE("ParameterProxyPool - macros drive several children through their curves", "[automation][macros]")
+{
+    PoolFixture fix;
+    auto eqId = fix.addMock("EQ");
+    auto compId = fix.addMock("Comp");
+    auto* gain = fix.addFloatParam(eqId, "gain");
+    auto* threshold = fix.addFloatParam(compId, "threshold");
+    auto* mode = fix.addFloatParam(compId, "mode");
+
+    MacroTarget linear;
+    linear.nodeId = eqId;
+    linear.paramIndex = 0;
+    linear.rangeStart = 0.2f;
+    linear.rangeEnd = 0.6f;
+
+    MacroTarget inverted;
+    inverted.nodeId = compId;
+    inverted.paramIndex = 0;
+    inverted.rangeStart = 1.0f;
+    inverted.rangeEnd = 0.0f;
+    inverted.curve = MacroCurve::SCurve;
+
+    MacroTarget stepped;
+    stepped.nodeId = compId;
+    stepped.paramIndex = 1;
+    stepped.curve = MacroCurve::Stepped;
+    stepped.steps = 3;
+
+    REQUIRE(fix.pool.addMacroTarget(fix.chain, 0, linear));
+    REQUIRE(fix.pool.addMacroTarget(fix.chain, 0, inverted));
+    REQUIRE(fix.pool.addMacroTarget(fix.chain, 0, stepped));
+    REQUIRE(fix.pool.getMacro(0).targets.size() == 3);
+
+    auto* macro = fix.pool.getMacroParameter(0);
+    macro->setValue(0.25f);
+    fix.pool.processMacros();
+
+    REQUIRE_THAT(gain->getValue(), WithinAbs(linear.evaluate(0.25f), 1e-5));
+    REQUIRE_THAT(gain->getValue(), WithinAbs(0.3, 1e-5));
+    REQUIRE_THAT(threshold->getValue(), WithinAbs(inverted.evaluate(0.25f), 1e-5));
+    REQUIRE_THAT(mode->getValue(), WithinAbs(0.0, 1e-6));
+
+    SECTION("children are left alone until their mapped value moves")
+    {
+        // Hand-edit a child; a macro move that stays on the same step mustn't overwrite it
+        mode->setValue(0.9f);
+        macro->setValue(0.30f);
+        fix.pool.processMacros();
+        REQUIRE_THAT(mode->getValue(), WithinAbs(0.9, 1e-6));
+        REQUIRE_THAT(gain->getValue(), WithinAbs(0.32, 1e-5));
+
+        macro->setValue(0.5f);
+        fix.pool.processMacros();
+        REQUIRE_THAT(mode->getValue(), WithinAbs(0.5, 1e-6));
+    }
+
+    SECTION("macros survive an XML roundtrip")
+    {
+        fix.pool.setMacroName(0, "Intensity");
+        auto xml = fix.pool.mappingsToXml();
+        fix.pool.clearMappings();
+        REQUIRE(fix.pool.getMacro(0).targets.empty());
+
+        fix.pool.mappingsFromXml(*xml);
+        fix.pool.rebindAll(fix.chain);
+        REQUIRE(fix.pool.getMacro(0).targets.size() == 3);
+        REQUIRE(macro->getName(64) == "Intensity");
+
+        macro->setValue(1.0f);
+        fix.pool.processMacros();
+        REQUIRE_THAT(gain->getValue(), WithinAbs(0.6, 1e-5));
+        REQUIRE_THAT(threshold->getValue(), WithinAbs(0.0, 1e-5));
+        REQUIRE_THAT(mode->getValue(), WithinAbs(1.0, 1e-6));
+    }
+}
+
+TEST_CASE("ParameterProxyPool - learn takes the parameter the user grabs, not one that moves", "[automation]")
+{
+    PoolFixture fix;
+    auto compId = fix.addMock("Comp");
+    auto* threshold = fix.addFloatParam(compId, "threshold");
+    auto* ratio = fix.addFloatParam(compId, "ratio");
+
+    int learned = -1;
+    fix.pool.onLearned = [&](int hostIndex) { learned = hostIndex; };
+    REQUIRE(fix.pool.startLearn(fix.chain, 2));
+
+    // Automation, preset loads and modulation change values without a gesture
+    threshold->setValueNotifyingHost(0.7f);
+    juce::MessageManager::getInstance()->runDispatchLoopUntil(50);
+    REQUIRE(learned == -1);
+    REQUIRE(fix.pool.isLearning());
+
+    ratio->beginChangeGesture();
+    ratio->setValueNotifyingHost(0.3f);
+    ratio->endChangeGesture();
+    juce::MessageManager::getInstance()->runDispatchLoopUntil(50);
+
+    REQUIRE(learned == 2);
+    REQUIRE_FALSE(fix.pool.isLearning());
+    REQUIRE(fix.pool.findHostIndex(compId, 1) == 2);
+}
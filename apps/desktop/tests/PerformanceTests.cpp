@@ -3,8 +3,12 @@
 #include "../src/PluginProcessor.h"
 #include "../src/core/ChainProcessor.h"
 #include "../src/core/PluginManager.h"
+#include "../src/core/ParameterDiscovery.h"
+#include "../src/core/ParameterNameIndex.h"
 #include "../src/audio/BranchGainProcessor.h"
 #include "../src/audio/DryWetMixProcessor.h"
+#include "../src/automation/ParameterProxyPool.h"
+#include "TestHelpers.h"
 #include <chrono>
 
 TEST_CASE("Performance - dbToLinear function", "[performance][benchmark]")
@@ -240,3 +244,139 @@ TEST_CASE("Memory - move operations are efficient", "[memory][performance]")
     REQUIRE(duration.count() < 1000);
     REQUIRE(nodes.size() == 100);
 }
+
+TEST_CASE("Performance - proxy rebinding after moveNode on a full chain", "[performance][automation]")
+{
+    ChainProcessorTestFixture fix;
+    MockPluginInstance host { "Host" };
+    ParameterProxyPool pool;
+
+    ParameterProxyPool::Settings settings;
+    settings.legacySlotLayout = true;
+    pool.createAndRegister(host, settings);
+
+    // 16 plugins x 128 parameters: every legacy proxy has a target
+    std::vector<ChainNodeId> ids;
+    for (int i = 0; i < ParameterProxyPool::kMaxSlots; ++i)
+    {
+        auto id = fix.addMock("Plugin" + juce::String(i));
+        auto* mock = dynamic_cast<MockPluginInstance*>(fix.chain.getNodeProcessor(id));
+        for (int p = 0; p < ParameterProxyPool::kMaxParamsPerSlot; ++p)
+            mock->addParameter(new juce::AudioParameterFloat(juce::ParameterID { "p" + juce::String(p), 1 },
+                                                             "P" + juce::String(p), 0.0f, 1.0f, 0.5f));
+        ids.push_back(id);
+    }
+    pool.rebindAll(fix.chain);
+    REQUIRE(pool.getLastRebindChangeCount() == ParameterProxyPool::kMaxSlots * ParameterProxyPool::kMaxParamsPerSlot);
+
+    // Move the last plugin to the front — identity binding leaves every proxy alone
+    REQUIRE(fix.chain.moveNode(ids.back(), 0, 0));
+
+    auto start = std::chrono::high_resolution_clock::now();
+    pool.rebindAll(fix.chain);
+    auto end = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    INFO("rebindAll after moveNode: " << duration.count() << " microseconds");
+    REQUIRE(pool.getLastRebindChangeCount() == 0);
+    REQUIRE(pool.getSlotNodeId(ParameterProxyPool::kMaxSlots - 1) == ids.back());
+
+    BENCHMARK("rebindAll after moveNode (16 slots)")
+    {
+        pool.rebindAll(fix.chain);
+        return pool.getLastRebindChangeCount();
+    };
+
+    // Baseline: the cost every edit used to pay (unbind + rebind all 2048 proxies)
+    BENCHMARK("full rebind from scratch (16 slots)")
+    {
+        pool.clearMappings();
+        pool.rebindAll(fix.chain);
+        return pool.getLastRebindChangeCount();
+    };
+}
+
+TEST_CASE("Performance - parameter discovery on a 400-parameter EQ", "[performance][discovery]")
+{
+    // 50 bands x 8 parameters, named the way large EQs name them
+    const char* suffixes[] = { "Frequency", "Gain", "Q", "Shape", "Used", "Slope", "Dyn Threshold", "Solo" };
+    juce::StringArray names;
+    MockPluginInstance eq { "BigEQ" };
+    for (int band = 1; band <= 50; ++band)
+    {
+        for (const auto* suffix : suffixes)
+        {
+            const auto name = "Band " + juce::String(band) + " " + suffix;
+            names.add(name);
+            eq.addParameter(new juce::AudioParameterFloat(juce::ParameterID { "p" + juce::String(names.size()), 1 },
+                                                          name, 0.0f, 1.0f, 0.5f));
+        }
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    int matched = 0;
+    for (const auto& name : names)
+        if (ParameterDiscovery::matchParameterName(name).semantic.isNotEmpty())
+            ++matched;
+    auto end = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    INFO("Classified 400 names in " << duration.count() << " microseconds");
+    REQUIRE(matched == 350);   // Everything but the solo switches
+    REQUIRE(duration.count() < 20000);
+
+    BENCHMARK("matchParameterName x 400")
+    {
+        int count = 0;
+        for (const auto& name : names)
+            count += ParameterDiscovery::matchParameterName(name).bandNumber;
+        return count;
+    };
+
+    BENCHMARK("discoverParameterMap (400 parameters)")
+    {
+        return ParameterDiscovery::discoverParameterMap(&eq, "BigEQ", "Test").matchedCount;
+    };
+}
+
+TEST_CASE("Performance - seeded parameter names resolved on a 400-parameter EQ", "[performance][nameindex]")
+{
+    const char* suffixes[] = { "Frequency", "Gain", "Q", "Shape", "Used", "Slope", "Dyn Threshold", "Solo" };
+    ParameterDiscovery::DiscoveredMap map;
+    juce::StringArray queries;
+    for (int band = 1; band <= 50; ++band)
+    {
+        for (const auto* suffix : suffixes)
+        {
+            ParameterDiscovery::DiscoveredParameter dp;
+            dp.juceParamId = "Band " + juce::String(band) + " " + suffix;
+            dp.juceParamIndex = map.parameters.size();
+            map.parameters.add(dp);
+            queries.add("band" + juce::String(band) + "_" + juce::String(suffix).toLowerCase());
+        }
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    ParameterNameIndex index(map);
+    int resolved = 0;
+    for (int i = 0; i < queries.size(); ++i)
+    {
+        auto matches = index.findSimilar(queries[i]);
+        if (!matches.empty() && matches.front().paramIndex == i)
+            ++resolved;
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    INFO("Indexed and resolved 400 names in " << duration.count() << " microseconds");
+    REQUIRE(resolved == 400);
+    REQUIRE(duration.count() < 50000);
+
+    BENCHMARK("ParameterNameIndex::findSimilar x 400")
+    {
+        int count = 0;
+        for (const auto& query : queries)
+            count += static_cast<int>(index.findSimilar(query).size());
+        return count;
+    };
+}
@@ -0,0 +1,161 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../src/core/PluginCatalogImage.h"
+#include "TestHelpers.h"
+
+namespace
+{
+    juce::PluginDescription makeDescription(const juce::String& name, const juce::String& manufacturer,
+                                            const juce::String& format, int uniqueId,
+                                            const juce::String& category = "Dynamics")
+    {
+        juce::PluginDescription desc;
+        desc.name = name;
+        desc.descriptiveName = name + " (stereo)";
+        desc.manufacturerName = manufacturer;
+        desc.pluginFormatName = format;
+        desc.category = category;
+        desc.version = "1.2.3";
+        desc.fileOrIdentifier = "/tmp/ProChainImageTests/" + name + "." + format.toLowerCase();
+        desc.uniqueId = uniqueId;
+        desc.deprecatedUid = uniqueId + 1;
+        desc.numInputChannels = 2;
+        desc.numOutputChannels = 2;
+        desc.lastFileModTime = juce::Time(1700000000000);
+        desc.hasSharedContainer = true;
+        return desc;
+    }
+
+    juce::Array<juce::PluginDescription> makeList()
+    {
+        juce::Array<juce::PluginDescription> types;
+        types.add(makeDescription("Comp", "Acme", "VST3", 100));
+        types.add(makeDescription("Comp", "Acme", "AudioUnit", 100));
+        types.add(makeDescription("Verb", "ACME", "VST3", 200, "Reverb"));
+        types.add(makeDescription("Synth", "Other Co", "VST3", 300, "Instrument"));
+        types.getReference(3).isInstrument = true;
+        types.getReference(3).numInputChannels = 0;
+        return types;
+    }
+}
+
+TEST_CASE("PluginCatalogImage - descriptions round-trip through the image", "[plugincatalogimage]")
+{
+    const auto types = makeList();
+    auto image = PluginCatalogImage::build(types);
+    REQUIRE(image != nullptr);
+    REQUIRE(image->size() == types.size());
+
+    for (int i = 0; i < types.size(); ++i)
+    {
+        const auto desc = image->getDescription(i);
+        const auto& original = types.getReference(i);
+        REQUIRE(desc.isDuplicateOf(original));
+        REQUIRE(desc.name == original.name);
+        REQUIRE(desc.descriptiveName == original.descriptiveName);
+        REQUIRE(desc.manufacturerName == original.manufacturerName);
+        REQUIRE(desc.category == original.category);
+        REQUIRE(desc.version == original.version);
+        REQUIRE(desc.deprecatedUid == original.deprecatedUid);
+        REQUIRE(desc.numInputChannels == original.numInputChannels);
+        REQUIRE(desc.isInstrument == original.isInstrument);
+        REQUIRE(desc.hasSharedContainer == original.hasSharedContainer);
+        REQUIRE(desc.lastFileModTime == original.lastFileModTime);
+    }
+}
+
+TEST_CASE("PluginCatalogImage - indexed lookups", "[plugincatalogimage]")
+{
+    const auto types = makeList();
+    auto image = PluginCatalogImage::build(types);
+
+    // Either identifier form
+    REQUIRE(image->findByIdentifier(types[2].fileOrIdentifier) == 2);
+    REQUIRE(image->findByIdentifier(types[1].createIdentifierString()) == 1);
+    REQUIRE(image->findByIdentifier("/tmp/ProChainImageTests/Missing.vst3") == -1);
+
+    // Several matches come back in list order; the first one wins single lookups
+    REQUIRE(image->findByUniqueId(100) == std::vector<int> { 0, 1 });
+    REQUIRE(image->findByUniqueId(999).empty());
+    REQUIRE(image->findByNameAndManufacturer("comp", "ACME") == 0);
+    REQUIRE(image->findByNameAndManufacturer("Comp", "Other Co") == -1);
+
+    // Manufacturer and category ignore case
+    REQUIRE(image->findByManufacturer("acme") == std::vector<int> { 0, 1, 2 });
+    REQUIRE(image->findByCategory("REVERB") == std::vector<int> { 2 });
+    REQUIRE(image->findByCategory("Delay").empty());
+}
+
+TEST_CASE("PluginCatalogImage - written images map back", "[plugincatalogimage]")
+{
+    TempTestDirectory temp { "ProChainImageTests" };
+    const auto file = temp.dir.getChildFile("known-plugins.bin");
+    const auto types = makeList();
+    REQUIRE(PluginCatalogImage::build(types)->writeTo(file));
+
+    auto mapped = PluginCatalogImage::map(file);
+    REQUIRE(mapped != nullptr);
+    REQUIRE(mapped->isMapped());
+    REQUIRE(mapped->size() == types.size());
+    REQUIRE(mapped->findByIdentifier(types[3].createIdentifierString()) == 3);
+    REQUIRE(mapped->getDescription(3).name == "Synth");
+
+    mapped.reset();  // Unmap before the directory goes
+}
+
+TEST_CASE("PluginCatalogImage - damaged images are rejected", "[plugincatalogimage]")
+{
+    TempTestDirectory temp { "ProChainImageTests" };
+    auto image = PluginCatalogImage::build(makeList());
+    const auto file = temp.dir.getChildFile("known-plugins.bin");
+    REQUIRE(image->writeTo(file));
+
+    juce::MemoryBlock bytes;
+    REQUIRE(file.loadFileAsData(bytes));
+    REQUIRE(PluginCatalogImage::fromMemory(bytes) != nullptr);
+
+    SECTION("Truncated")
+    {
+        bytes.setSize(bytes.getSize() - 4);
+        REQUIRE(PluginCatalogImage::fromMemory(bytes) == nullptr);
+    }
+
+    SECTION("Wrong magic")
+    {
+        static_cast<char*>(bytes.getData())[0] ^= 0x55;
+        REQUIRE(PluginCatalogImage::fromMemory(bytes) == nullptr);
+    }
+
+    SECTION("Bucket pointing past the records")
+    {
+        // Bucket tables sit at the end; make the last entry reference a record that doesn't exist
+        auto* last = reinterpret_cast<juce::uint32*>(static_cast<char*>(bytes.getData()) + bytes.getSize()) - 1;
+        *last = 1000;
+        REQUIRE(PluginCatalogImage::fromMemory(bytes) == nullptr);
+    }
+
+    SECTION("Bucket chain looping back on itself")
+    {
+        // Records follow the 64-byte header, 88 bytes each, ending in five uint32 next links
+        // (by identifier, file, uniqueId, manufacturer, category). Records 0 and 1 share
+        // uniqueId 100, so 0 -> 1 already; pointing 1 back at 0 closes the loop.
+        auto* record1Next = reinterpret_cast<juce::uint32*>(static_cast<char*>(bytes.getData()) + 64 + 88 + 88 - 5 * 4);
+        record1Next[2] = 1;
+        REQUIRE(PluginCatalogImage::fromMemory(bytes) == nullptr);
+    }
+
+    SECTION("Missing file")
+    {
+        file.deleteFile();
+        REQUIRE(PluginCatalogImage::map(file) == nullptr);
+    }
+}
+
+TEST_CASE("PluginCatalogImage - empty list", "[plugincatalogimage]")
+{
+    auto image = PluginCatalogImage::build({});
+    REQUIRE(image != nullptr);
+    REQUIRE(image->size() == 0);
+    REQUIRE(image->findByIdentifier("anything") == -1);
+    REQUIRE(image->findByManufacturer("Acme").empty());
+    REQUIRE(PluginCatalogImage::fromMemory(juce::MemoryBlock()) == nullptr);
+}
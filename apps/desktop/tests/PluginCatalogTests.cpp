@@ -0,0 +1,82 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../src/core/PluginManager.h"
+
+namespace
+{
+    juce::PluginDescription makeTestDescription()
+    {
+        juce::PluginDescription desc;
+        desc.name = "CatalogTestComp";
+        desc.manufacturerName = "CatalogTestVendor";
+        desc.pluginFormatName = "VST3";
+        desc.fileOrIdentifier = "/tmp/ProChainCatalogTests/CatalogTestComp.vst3";
+        desc.uniqueId = 4242;
+        desc.numInputChannels = 2;
+        desc.numOutputChannels = 2;
+        return desc;
+    }
+}
+
+TEST_CASE("PluginCatalog - instances share one catalog", "[plugincatalog]")
+{
+    PluginManager first;
+    PluginManager second;
+
+    REQUIRE(&first.getKnownPlugins() == &second.getKnownPlugins());
+
+    const juce::String path = "/tmp/ProChainCatalogTests/Shared.component";
+    first.addToBlacklist(path);
+    REQUIRE(second.isBlacklisted(path));
+
+    second.removeFromBlacklist(path);
+    REQUIRE_FALSE(first.isBlacklisted(path));
+}
+
+TEST_CASE("PluginCatalog - snapshots are immutable and republished on change", "[plugincatalog]")
+{
+    PluginManager manager;
+    const juce::String path = "/tmp/ProChainCatalogTests/Snapshot.component";
+
+    auto before = manager.getSnapshot();
+    REQUIRE(before != nullptr);
+    REQUIRE_FALSE(before->blacklist.contains(path));
+
+    manager.addToBlacklist(path);
+    auto after = manager.getSnapshot();
+    REQUIRE(after->version > before->version);
+    REQUIRE(after->blacklist.contains(path));
+    REQUIRE_FALSE(before->blacklist.contains(path));   // Readers holding the old one are unaffected
+
+    manager.removeFromBlacklist(path);
+    REQUIRE_FALSE(manager.getSnapshot()->blacklist.contains(path));
+}
+
+TEST_CASE("PluginCatalog - lookups and events reach every instance", "[plugincatalog]")
+{
+    PluginManager first;
+    PluginManager second;
+
+    int firstEvents = 0, secondEvents = 0;
+    first.onDeactivationChanged = [&] { ++firstEvents; };
+    second.onDeactivationChanged = [&] { ++secondEvents; };
+
+    const auto desc = makeTestDescription();
+    first.getKnownPlugins().addType(desc);
+    REQUIRE(first.deactivatePlugin(desc.fileOrIdentifier));
+
+    REQUIRE(firstEvents == 1);
+    REQUIRE(secondEvents == 1);
+    REQUIRE(second.isDeactivated(desc.fileOrIdentifier));
+
+    // Indexed lookups by either identifier form and by name + manufacturer
+    REQUIRE(second.findPluginByIdentifier(desc.fileOrIdentifier).has_value());
+    REQUIRE(second.findPluginByIdentifier(desc.createIdentifierString()).has_value());
+    auto byName = second.findPluginByNameAndManufacturer("catalogtestcomp", "CATALOGTESTVENDOR");
+    REQUIRE(byName.has_value());
+    REQUIRE(byName->fileOrIdentifier == desc.fileOrIdentifier);
+    REQUIRE_FALSE(second.findPluginByNameAndManufacturer("CatalogTestComp", "Someone Else").has_value());
+
+    REQUIRE(second.removeKnownPlugin(desc.fileOrIdentifier));
+    REQUIRE_FALSE(first.findPluginByIdentifier(desc.fileOrIdentifier).has_value());
+    REQUIRE_FALSE(first.isDeactivated(desc.fileOrIdentifier));
+}
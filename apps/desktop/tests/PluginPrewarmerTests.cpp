@@ -0,0 +1,94 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include "../src/core/PluginPrewarmer.h"
+#include "TestHelpers.h"
+
+using Catch::Matchers::WithinRel;
+
+namespace
+{
+    constexpr juce::int64 kDayMs = 24LL * 60 * 60 * 1000;
+    constexpr juce::int64 kNow = 1700000000000LL;
+}
+
+TEST_CASE("PluginPrewarmer - use counts decay with a 30 day half-life", "[pluginprewarmer]")
+{
+    PluginPrewarmer::UsageStats usage;
+    usage.recordUse("VST3-Comp-1", kNow);
+    usage.recordUse("VST3-Comp-1", kNow);
+
+    REQUIRE_THAT(usage.getScore("VST3-Comp-1", kNow), WithinRel(2.0, 1e-9));
+    REQUIRE_THAT(usage.getScore("VST3-Comp-1", kNow + 30 * kDayMs), WithinRel(1.0, 1e-9));
+
+    // A later use adds to the decayed count
+    usage.recordUse("VST3-Comp-1", kNow + 30 * kDayMs);
+    REQUIRE_THAT(usage.getScore("VST3-Comp-1", kNow + 30 * kDayMs), WithinRel(2.0, 1e-9));
+
+    REQUIRE(usage.getScore("VST3-Unknown-2", kNow) == 0.0);
+}
+
+TEST_CASE("PluginPrewarmer - most used ranks recent use above old habits", "[pluginprewarmer]")
+{
+    PluginPrewarmer::UsageStats usage;
+
+    // Used heavily three months ago
+    for (int i = 0; i < 6; ++i)
+        usage.recordUse("VST3-Old-1", kNow - 90 * kDayMs);
+
+    // Used a little this week
+    usage.recordUse("VST3-Recent-2", kNow - 2 * kDayMs);
+    usage.recordUse("VST3-Recent-2", kNow - kDayMs);
+    usage.recordUse("VST3-Once-3", kNow);
+
+    const auto ranked = usage.getMostUsed(10, kNow);
+    REQUIRE(ranked == juce::StringArray { "VST3-Recent-2", "VST3-Once-3", "VST3-Old-1" });
+    REQUIRE(usage.getMostUsed(1, kNow) == juce::StringArray { "VST3-Recent-2" });
+    REQUIRE(usage.getMostUsed(0, kNow).isEmpty());
+}
+
+TEST_CASE("PluginPrewarmer - usage round-trips through JSON", "[pluginprewarmer]")
+{
+    PluginPrewarmer::UsageStats usage;
+    usage.recordUse("VST3-Comp-1", kNow - 10 * kDayMs);
+    usage.recordUse("AudioUnit-Verb-2", kNow);
+
+    PluginPrewarmer::UsageStats restored;
+    restored.fromJson(juce::JSON::parse(juce::JSON::toString(usage.toJson())));
+
+    REQUIRE(restored.size() == 2);
+    REQUIRE_THAT(restored.getScore("VST3-Comp-1", kNow), WithinRel(usage.getScore("VST3-Comp-1", kNow), 1e-9));
+    REQUIRE(restored.getMostUsed(2, kNow) == usage.getMostUsed(2, kNow));
+
+    // Garbage is dropped rather than trusted
+    restored.fromJson(juce::JSON::parse(R"({"VST3-Bad-3": {"uses": -4}, "VST3-Bad-4": 12})"));
+    REQUIRE(restored.size() == 0);
+}
+
+TEST_CASE("PluginPrewarmer - module files are the bundle's binaries", "[pluginprewarmer]")
+{
+    TempTestDirectory temp { "ProChainPrewarmerTests" };
+    const auto& root = temp.dir;
+    const auto bundle = root.getChildFile("Comp.vst3");
+    const auto binary = bundle.getChildFile("Contents/x86_64-linux/Comp.so");
+    const auto resource = bundle.getChildFile("Contents/Resources/presets.xml");
+    REQUIRE(binary.create());
+    REQUIRE(resource.create());
+
+    const auto files = PluginPrewarmer::getModuleFiles(bundle.getFullPathName());
+    REQUIRE(files.size() == 1);
+    REQUIRE(files[0] == binary);
+
+    // Single-file plugins are their own binary
+    REQUIRE(PluginPrewarmer::getModuleFiles(binary.getFullPathName()) == juce::Array<juce::File> { binary });
+
+    // Component IDs and missing paths have nothing to read
+    REQUIRE(PluginPrewarmer::getModuleFiles("AudioUnit:Effects/aufx,comp,Acme").isEmpty());
+    REQUIRE(PluginPrewarmer::getModuleFiles(root.getChildFile("Missing.vst3").getFullPathName()).isEmpty());
+}
+
+TEST_CASE("PluginPrewarmer - defaults warm modules only", "[pluginprewarmer]")
+{
+    const PluginPrewarmer::Settings defaults;
+    REQUIRE(defaults.enabled);
+    REQUIRE_FALSE(defaults.createInstances);
+}
@@ -1,6 +1,7 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 #include "PluginProcessor.h"
+#include "TestHelpers.h"
 
 using Catch::Matchers::WithinAbs;
 
@@ -379,3 +380,159 @@ TEST_CASE("Processor: multiple instances", "[lifecycle]")
     // Each should have a unique instance ID
     REQUIRE(proc1.getInstanceId() != proc2.getInstanceId());
 }
+
+TEST_CASE("Processor: A/B compare slot switch and state roundtrip", "[lifecycle][ab]")
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+
+    PluginChainManagerProcessor proc;
+    proc.prepareToPlay(44100.0, 512);
+
+    REQUIRE_FALSE(proc.hasCompareSlot());
+    REQUIRE(proc.storeCompareSlot());
+    REQUIRE(proc.hasCompareSlot());
+
+    // Both chains empty → switching must stay transparent through the crossfade
+    proc.setActiveABSlot(PluginChainManagerProcessor::ABSlot::B);
+    proc.setCompareKeepWarm(false);
+
+    juce::AudioBuffer<float> buffer(2, 512);
+    juce::MidiBuffer midi;
+    for (int i = 0; i < 8; ++i)
+    {
+        for (int ch = 0; ch < 2; ++ch)
+            juce::FloatVectorOperations::fill(buffer.getWritePointer(ch), 0.25f, 512);
+        proc.processBlock(buffer, midi);
+        REQUIRE_THAT(buffer.getSample(0, 256), WithinAbs(0.25f, 0.001f));
+    }
+
+    REQUIRE(proc.getLatencySamples() == 0);
+
+    juce::MemoryBlock state;
+    proc.getStateInformation(state);
+
+    PluginChainManagerProcessor restored;
+    restored.prepareToPlay(44100.0, 512);
+    restored.setStateInformation(state.getData(), static_cast<int>(state.getSize()));
+    REQUIRE(restored.hasCompareSlot());
+    REQUIRE(restored.getActiveABSlot() == PluginChainManagerProcessor::ABSlot::B);
+    REQUIRE_FALSE(restored.isCompareKeepWarm());
+
+    restored.clearCompareSlot();
+    REQUIRE_FALSE(restored.hasCompareSlot());
+    REQUIRE(restored.getActiveABSlot() == PluginChainManagerProcessor::ABSlot::A);
+}
+
+TEST_CASE("Processor: A/B swap finishes without suspending the host", "[lifecycle][ab]")
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+
+    PluginChainManagerProcessor proc;
+    proc.prepareToPlay(44100.0, 512);
+    REQUIRE(proc.storeCompareSlot());
+
+    juce::AudioBuffer<float> buffer(2, 512);
+    juce::MidiBuffer midi;
+    auto renderBlock = [&]() {
+        for (int ch = 0; ch < 2; ++ch)
+            juce::FloatVectorOperations::fill(buffer.getWritePointer(ch), 0.25f, 512);
+        proc.processBlock(buffer, midi);
+        REQUIRE_THAT(buffer.getSample(0, 0), WithinAbs(0.25f, 0.001f));
+        REQUIRE_THAT(buffer.getSample(1, 511), WithinAbs(0.25f, 0.001f));
+    };
+
+    renderBlock();
+    REQUIRE(proc.swapCompareSlot());
+    REQUIRE(proc.isCompareSwapInProgress());
+    REQUIRE_FALSE(proc.swapCompareSlot());   // One at a time
+
+    // The crossfade to the copy runs on the audio thread; no silent blocks along the way
+    for (int i = 0; i < 50 && proc.isCompareSwapInProgress(); ++i)
+    {
+        renderBlock();
+        juce::MessageManager::getInstance()->runDispatchLoopUntil(10);
+    }
+
+    REQUIRE_FALSE(proc.isCompareSwapInProgress());
+    REQUIRE(proc.getActiveABSlot() == PluginChainManagerProcessor::ABSlot::B);
+    renderBlock();
+}
+
+TEST_CASE("Processor: staged preset swap crossfades while the old chain keeps playing", "[lifecycle][ab][prefetch]")
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+
+    PluginChainManagerProcessor proc;
+    proc.prepareToPlay(44100.0, 512);
+
+    juce::PluginDescription desc;
+    desc.name = "Incoming";
+    desc.manufacturerName = "MockVendor";
+    desc.pluginFormatName = "MockFormat";
+    desc.fileOrIdentifier = "/mock/Incoming";
+
+    auto chainXml = std::make_unique<juce::XmlElement>("ChainTree");
+    chainXml->setAttribute("version", 2);
+    auto* nodeXml = chainXml->createNewChildElement("Node");
+    nodeXml->setAttribute("type", "plugin");
+    nodeXml->addChildElement(desc.createXml().release());
+
+    auto mock = std::make_unique<MockPluginInstance>("Incoming");
+    mock->prepareToPlay(44100.0, 512);
+    std::vector<StagedPluginInstance> staged(1);
+    staged[0].fileOrIdentifier = desc.fileOrIdentifier;
+    mock->fillInPluginDescription(staged[0].description);
+    staged[0].instance = std::move(mock);
+
+    bool landed = false;
+    proc.swapInStagedPreset(std::move(chainXml), std::move(staged), [&landed](ChainProcessor::RestoreResult result) {
+        REQUIRE(result.success);
+        landed = true;
+    });
+
+    // The incoming preset went to slot B; the live chain is untouched until B is heard
+    REQUIRE(proc.isPresetSwapInProgress());
+    REQUIRE_FALSE(landed);
+    REQUIRE(proc.getChainProcessor().getFlatPluginList().empty());
+    REQUIRE_FALSE(proc.storeCompareSlot());
+
+    juce::AudioBuffer<float> buffer(2, 512);
+    juce::MidiBuffer midi;
+    for (int i = 0; i < 100 && proc.isPresetSwapInProgress(); ++i)
+    {
+        // Old chain, crossfade, new chain and back: never a silent or dipped block
+        for (int ch = 0; ch < 2; ++ch)
+            juce::FloatVectorOperations::fill(buffer.getWritePointer(ch), 0.25f, 512);
+        proc.processBlock(buffer, midi);
+        REQUIRE_THAT(buffer.getSample(0, 0), WithinAbs(0.25f, 0.001f));
+        REQUIRE_THAT(buffer.getSample(1, 511), WithinAbs(0.25f, 0.001f));
+        juce::MessageManager::getInstance()->runDispatchLoopUntil(10);
+    }
+
+    REQUIRE_FALSE(proc.isPresetSwapInProgress());
+    REQUIRE(landed);
+    REQUIRE_FALSE(proc.hasCompareSlot());
+    REQUIRE(proc.getActiveABSlot() == PluginChainManagerProcessor::ABSlot::A);
+}
+
+TEST_CASE("Processor: host blocks larger than prepared are processed in chunks", "[lifecycle][ab]")
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+
+    PluginChainManagerProcessor proc;
+    proc.prepareToPlay(44100.0, 256);
+    REQUIRE(proc.storeCompareSlot());
+    proc.setActiveABSlot(PluginChainManagerProcessor::ABSlot::B);
+
+    juce::AudioBuffer<float> buffer(2, 1000);
+    juce::MidiBuffer midi;
+    for (int block = 0; block < 4; ++block)
+    {
+        for (int ch = 0; ch < 2; ++ch)
+            juce::FloatVectorOperations::fill(buffer.getWritePointer(ch), 0.5f, 1000);
+        proc.processBlock(buffer, midi);
+
+        for (int i : { 0, 255, 256, 999 })
+            REQUIRE_THAT(buffer.getSample(0, i), WithinAbs(0.5f, 0.001f));
+    }
+}
@@ -0,0 +1,67 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include "../src/core/PluginProfile.h"
+
+using Catch::Matchers::WithinRel;
+
+namespace
+{
+    PluginProfile makeProfile()
+    {
+        PluginProfile profile;
+        profile.instantiateMs = 40.0;
+        profile.prepareMs = 5.0;
+        profile.latencySamples = 128;
+        profile.tailSeconds = 0.5;
+        profile.blockCosts.push_back({ 48000.0, 128, 64.0, 200.0 });    // 0.5 us/sample
+        profile.blockCosts.push_back({ 48000.0, 512, 512.0, 900.0 });   // 1.0 us/sample
+        profile.blockCosts.push_back({ 96000.0, 512, 1024.0, 1500.0 }); // 2.0 us/sample
+        return profile;
+    }
+}
+
+TEST_CASE("PluginProfile - load estimates use the closest measured configuration", "[pluginprofile]")
+{
+    const auto profile = makeProfile();
+
+    // Exact match: 1 us/sample * 48000 samples/s = 4.8% of a core
+    REQUIRE_THAT(*profile.estimateLoad(48000.0, 512), WithinRel(0.048, 1e-9));
+
+    // 44.1k/512 is nearest to 48k/512; scaled to the requested rate
+    REQUIRE_THAT(*profile.estimateLoad(44100.0, 512), WithinRel(0.0441, 1e-9));
+
+    // Small blocks pick the 128 measurement
+    REQUIRE_THAT(*profile.estimateLoad(48000.0, 64), WithinRel(0.024, 1e-9));
+
+    // High rates pick the 96k measurement
+    REQUIRE_THAT(*profile.estimateLoad(88200.0, 512), WithinRel(0.1764, 1e-9));
+}
+
+TEST_CASE("PluginProfile - unmeasured profiles give no estimate", "[pluginprofile]")
+{
+    PluginProfile empty;
+    REQUIRE_FALSE(empty.isValid());
+    REQUIRE_FALSE(empty.estimateLoad(48000.0, 512).has_value());
+
+    auto profile = makeProfile();
+    REQUIRE_FALSE(profile.estimateLoad(0.0, 512).has_value());
+    REQUIRE_FALSE(profile.estimateLoad(48000.0, 0).has_value());
+}
+
+TEST_CASE("PluginProfile - survives a JSON round-trip", "[pluginprofile]")
+{
+    const auto profile = makeProfile();
+    const auto json = juce::JSON::toString(profile.toVar());
+    const auto restored = PluginProfile::fromVar(juce::JSON::parse(json));
+
+    REQUIRE(restored.isValid());
+    REQUIRE(restored.instantiateMs == profile.instantiateMs);
+    REQUIRE(restored.prepareMs == profile.prepareMs);
+    REQUIRE(restored.latencySamples == profile.latencySamples);
+    REQUIRE(restored.tailSeconds == profile.tailSeconds);
+    REQUIRE(restored.blockCosts.size() == profile.blockCosts.size());
+    REQUIRE(restored.blockCosts[2].sampleRate == 96000.0);
+    REQUIRE(restored.blockCosts[2].worstMicros == 1500.0);
+
+    REQUIRE_FALSE(PluginProfile::fromVar(juce::var()).isValid());
+}
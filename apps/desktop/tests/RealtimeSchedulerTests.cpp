@@ -0,0 +1,124 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../src/core/RealtimeScheduler.h"
+
+namespace
+{
+    void countJob(void* context)
+    {
+        static_cast<std::atomic<int>*>(context)->fetch_add(1);
+    }
+
+    void blockingJob(void* context)
+    {
+        static_cast<juce::WaitableEvent*>(context)->wait(5000);
+    }
+
+    void spinJob(void*)
+    {
+        const auto until = juce::Time::getMillisecondCounterHiRes() + 2.0;
+        while (juce::Time::getMillisecondCounterHiRes() < until) {}
+    }
+
+    bool waitFor(const std::function<bool()>& condition)
+    {
+        for (int i = 0; i < 2000 && !condition(); ++i)
+            juce::Thread::sleep(1);
+        return condition();
+    }
+}
+
+TEST_CASE("RealtimeScheduler - every submitted job runs once", "[scheduler]")
+{
+    RealtimeScheduler scheduler(2);
+    RealtimeScheduler::Client client(scheduler, 7);
+    std::atomic<int> counter { 0 };
+
+    int submitted = 0;
+    for (int i = 0; i < 1000; ++i)
+    {
+        if (client.submit(&countJob, &counter))
+            ++submitted;
+        else
+            countJob(&counter);   // Full queue: the caller runs it, like the audio thread would
+
+        if (i % 64 == 63)
+            client.waitUntilDone();
+    }
+    client.waitUntilDone();
+
+    REQUIRE(counter.load() == 1000);
+    REQUIRE(client.isIdle());
+
+    const auto stats = client.getStats();
+    REQUIRE(stats.ownerId == 7);
+    REQUIRE(stats.jobsCompleted == static_cast<uint64_t>(submitted));
+    REQUIRE(stats.jobsRejected == static_cast<uint64_t>(1000 - submitted));
+}
+
+TEST_CASE("RealtimeScheduler - a full queue rejects instead of blocking", "[scheduler]")
+{
+    RealtimeScheduler scheduler(1);
+    RealtimeScheduler::Client client(scheduler, 1);
+    juce::WaitableEvent release;
+    std::atomic<int> counter { 0 };
+
+    // Occupy the only worker so nothing drains
+    REQUIRE(client.submit(&blockingJob, &release));
+    REQUIRE(waitFor([&] { return client.getStats().running == 1; }));
+
+    for (int i = 0; i < RealtimeScheduler::kQueueCapacity; ++i)
+        REQUIRE(client.submit(&countJob, &counter));
+    REQUIRE_FALSE(client.submit(&countJob, &counter));
+    REQUIRE(client.getStats().jobsRejected == 1);
+
+    release.signal();
+    client.waitUntilDone();
+    REQUIRE(counter.load() == RealtimeScheduler::kQueueCapacity);
+}
+
+TEST_CASE("RealtimeScheduler - idle clients donate their share", "[scheduler]")
+{
+    RealtimeScheduler scheduler(2);
+    RealtimeScheduler::Client busy(scheduler, 1);
+    RealtimeScheduler::Client idle(scheduler, 2);
+
+    // Keep the busy client's queue non-empty across a few rebalance rounds
+    const auto until = juce::Time::getMillisecondCounterHiRes() + 4.0 * RealtimeScheduler::kRebalanceIntervalMs;
+    while (juce::Time::getMillisecondCounterHiRes() < until)
+    {
+        while (busy.submit(&spinJob, nullptr)) {}
+        juce::Thread::sleep(1);
+    }
+
+    const auto busyStats = busy.getStats();
+    const auto idleStats = idle.getStats();
+    busy.waitUntilDone();
+
+    REQUIRE(busyStats.utilization > 0.0f);
+    REQUIRE(busyStats.share >= 1.0f);
+    REQUIRE(idleStats.share == 0.0f);
+    REQUIRE(scheduler.getStats().size() == 2);
+}
+
+TEST_CASE("RealtimeScheduler - clients unregister and free their slot", "[scheduler]")
+{
+    RealtimeScheduler scheduler(1);
+    std::atomic<int> counter { 0 };
+
+    {
+        RealtimeScheduler::Client first(scheduler, 1);
+        RealtimeScheduler::Client second(scheduler, 2);
+        REQUIRE(scheduler.getStats().size() == 2);
+
+        REQUIRE(first.submit(&countJob, &counter));
+        first.waitUntilDone();
+    }
+
+    REQUIRE(scheduler.getStats().empty());
+
+    RealtimeScheduler::Client reused(scheduler, 3);
+    const auto stats = reused.getStats();
+    REQUIRE(stats.ownerId == 3);
+    REQUIRE(stats.jobsCompleted == 0);
+    REQUIRE(counter.load() == 1);
+}
@@ -0,0 +1,117 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../src/core/ScanStateCache.h"
+#include "TestHelpers.h"
+
+namespace
+{
+    /** Minimal VST3-style bundle: Info.plist, one binary, one resource. */
+    juce::File makeBundle(const juce::File& parent, const juce::String& name)
+    {
+        auto bundle = parent.getChildFile(name + ".vst3");
+        auto contents = bundle.getChildFile("Contents");
+        contents.getChildFile("x86_64-linux").createDirectory();
+        contents.getChildFile("Resources").createDirectory();
+        contents.getChildFile("Info.plist").replaceWithText("<plist>" + name + "</plist>");
+        contents.getChildFile("x86_64-linux").getChildFile(name + ".so").replaceWithText("binary:" + name);
+        contents.getChildFile("Resources").getChildFile("presets.txt").replaceWithText("presets");
+        return bundle;
+    }
+
+    juce::File getBinary(const juce::File& bundle)
+    {
+        return bundle.getChildFile("Contents/x86_64-linux").getChildFile(bundle.getFileNameWithoutExtension() + ".so");
+    }
+}
+
+TEST_CASE("ScanStateCache - unchanged bundles are skipped, modified ones are not", "[scanner][scanstate]")
+{
+    TempTestDirectory temp { "ScanStateCacheTests" };
+    auto bundle = makeBundle(temp.dir, "Comp");
+    const auto path = bundle.getFullPathName();
+
+    ScanStateCache cache;
+    REQUIRE(cache.lookup(path, ScanStateCache::fingerprint(bundle)).state == ScanStateCache::State::added);
+
+    cache.record(path, "VST3", ScanStateCache::fingerprint(bundle));
+    REQUIRE(cache.lookup(path, ScanStateCache::fingerprint(bundle)).state == ScanStateCache::State::unchanged);
+
+    // Resources aren't part of the fingerprint
+    bundle.getChildFile("Contents/Resources/presets.txt").appendText("more presets");
+    REQUIRE(cache.lookup(path, ScanStateCache::fingerprint(bundle)).state == ScanStateCache::State::unchanged);
+
+    // The binary is
+    getBinary(bundle).appendText("patched");
+    REQUIRE(cache.lookup(path, ScanStateCache::fingerprint(bundle)).state == ScanStateCache::State::changed);
+}
+
+TEST_CASE("ScanStateCache - a renamed bundle is detected as moved", "[scanner][scanstate]")
+{
+    TempTestDirectory temp { "ScanStateCacheTests" };
+    auto bundle = makeBundle(temp.dir, "Reverb");
+    makeBundle(temp.dir, "Delay");
+
+    ScanStateCache cache;
+    cache.record(bundle.getFullPathName(), "VST3", ScanStateCache::fingerprint(bundle));
+    cache.record(temp.dir.getChildFile("Delay.vst3").getFullPathName(), "VST3",
+                 ScanStateCache::fingerprint(temp.dir.getChildFile("Delay.vst3")));
+
+    auto vendorDir = temp.dir.getChildFile("Vendor");
+    vendorDir.createDirectory();
+    auto moved = vendorDir.getChildFile("Reverb.vst3");
+    REQUIRE(bundle.moveFileTo(moved));
+
+    const auto found = cache.lookup(moved.getFullPathName(), ScanStateCache::fingerprint(moved));
+    REQUIRE(found.state == ScanStateCache::State::moved);
+    REQUIRE(found.movedFrom == bundle.getFullPathName());
+
+    cache.rename(found.movedFrom, moved.getFullPathName());
+    REQUIRE_FALSE(cache.contains(bundle.getFullPathName()));
+    REQUIRE(cache.lookup(moved.getFullPathName(), ScanStateCache::fingerprint(moved)).state
+            == ScanStateCache::State::unchanged);
+}
+
+TEST_CASE("ScanStateCache - a copy is new while the original still exists", "[scanner][scanstate]")
+{
+    TempTestDirectory temp { "ScanStateCacheTests" };
+    auto bundle = makeBundle(temp.dir, "Chorus");
+
+    ScanStateCache cache;
+    cache.record(bundle.getFullPathName(), "VST3", ScanStateCache::fingerprint(bundle));
+
+    auto copy = temp.dir.getChildFile("Copy").getChildFile("Chorus.vst3");
+    copy.getParentDirectory().createDirectory();
+    REQUIRE(bundle.copyDirectoryTo(copy));
+
+    REQUIRE(cache.lookup(copy.getFullPathName(), ScanStateCache::fingerprint(copy)).state
+            == ScanStateCache::State::added);
+}
+
+TEST_CASE("ScanStateCache - survives a JSON round-trip", "[scanner][scanstate]")
+{
+    TempTestDirectory temp { "ScanStateCacheTests" };
+    auto bundle = makeBundle(temp.dir, "EQ");
+    auto single = temp.dir.getChildFile("Legacy.so");
+    single.replaceWithText("single-file plugin");
+
+    ScanStateCache cache;
+    cache.record(bundle.getFullPathName(), "VST3", ScanStateCache::fingerprint(bundle));
+    cache.record(single.getFullPathName(), "VST", ScanStateCache::fingerprint(single));
+
+    auto file = temp.dir.getChildFile("scan-state.json");
+    cache.save(file);
+
+    ScanStateCache reloaded;
+    reloaded.load(file);
+    REQUIRE(reloaded.size() == 2);
+    REQUIRE(reloaded.lookup(bundle.getFullPathName(), ScanStateCache::fingerprint(bundle)).state
+            == ScanStateCache::State::unchanged);
+    REQUIRE(reloaded.lookup(single.getFullPathName(), ScanStateCache::fingerprint(single)).state
+            == ScanStateCache::State::unchanged);
+}
+
+TEST_CASE("ScanStateCache - only absolute paths are fingerprinted", "[scanner][scanstate]")
+{
+    REQUIRE(ScanStateCache::isFileBased("/Library/Audio/Plug-Ins/VST3/Comp.vst3"));
+    REQUIRE_FALSE(ScanStateCache::isFileBased("AudioUnit:Effects/aufx,Comp,Acme"));
+    REQUIRE_FALSE(ScanStateCache::isFileBased(""));
+}
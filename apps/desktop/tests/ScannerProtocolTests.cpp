@@ -0,0 +1,212 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../src/core/ScannerProtocol.h"
+
+namespace
+{
+    juce::PluginDescription makeDescription(const juce::String& name, int uid)
+    {
+        juce::PluginDescription desc;
+        desc.name = name;
+        desc.descriptiveName = name + " (stereo)";
+        desc.pluginFormatName = "VST3";
+        desc.category = "Fx|Dynamics";
+        desc.manufacturerName = "Acme";
+        desc.version = "1.2.3";
+        desc.fileOrIdentifier = "/Library/Audio/Plug-Ins/VST3/" + name + ".vst3";
+        desc.lastFileModTime = juce::Time(1700000000000);
+        desc.lastInfoUpdateTime = juce::Time(1700000001000);
+        desc.deprecatedUid = uid;
+        desc.uniqueId = uid + 1;
+        desc.numInputChannels = 2;
+        desc.numOutputChannels = 2;
+        return desc;
+    }
+}
+
+TEST_CASE("ScannerProtocol - scan request round-trips", "[scanner][protocol]")
+{
+    ScannerProtocol::ScanRequest request;
+    request.requestId = 42;
+    request.formatName = "AudioUnit";
+    request.pluginPath = "AudioUnit:Effects/aufx,Comp,Acme";
+
+    ScannerProtocol::ScanRequest decoded;
+    REQUIRE(ScannerProtocol::decode(ScannerProtocol::encode(request), decoded));
+    REQUIRE(decoded.requestId == 42);
+    REQUIRE(decoded.formatName == request.formatName);
+    REQUIRE(decoded.pluginPath == request.pluginPath);
+}
+
+TEST_CASE("ScannerProtocol - scan response round-trips descriptions and flags", "[scanner][protocol]")
+{
+    ScannerProtocol::ScanResponse response;
+    response.requestId = 7;
+    response.status = ScannerProtocol::Status::Success;
+    response.plugins.push_back(makeDescription(juce::String(juce::CharPointer_UTF8("Compress\xc3\xb6r")), 100));
+    response.plugins.push_back(makeDescription("Synth", 200));
+    response.plugins[1].isInstrument = true;
+    response.plugins[1].hasSharedContainer = true;
+    response.plugins[1].numInputChannels = 0;
+
+    ScannerProtocol::ScanResponse decoded;
+    REQUIRE(ScannerProtocol::decode(ScannerProtocol::encode(response), decoded));
+    REQUIRE(decoded.requestId == 7);
+    REQUIRE(decoded.status == ScannerProtocol::Status::Success);
+    REQUIRE(decoded.plugins.size() == 2);
+
+    for (size_t i = 0; i < decoded.plugins.size(); ++i)
+    {
+        const auto& expected = response.plugins[i];
+        const auto& actual = decoded.plugins[i];
+        REQUIRE(actual.name == expected.name);
+        REQUIRE(actual.descriptiveName == expected.descriptiveName);
+        REQUIRE(actual.category == expected.category);
+        REQUIRE(actual.manufacturerName == expected.manufacturerName);
+        REQUIRE(actual.version == expected.version);
+        REQUIRE(actual.fileOrIdentifier == expected.fileOrIdentifier);
+        REQUIRE(actual.lastFileModTime == expected.lastFileModTime);
+        REQUIRE(actual.lastInfoUpdateTime == expected.lastInfoUpdateTime);
+        REQUIRE(actual.deprecatedUid == expected.deprecatedUid);
+        REQUIRE(actual.uniqueId == expected.uniqueId);
+        REQUIRE(actual.numInputChannels == expected.numInputChannels);
+        REQUIRE(actual.isInstrument == expected.isInstrument);
+        REQUIRE(actual.hasSharedContainer == expected.hasSharedContainer);
+        REQUIRE(actual.hasARAExtension == expected.hasARAExtension);
+        REQUIRE(actual.isDuplicateOf(expected));
+    }
+}
+
+TEST_CASE("ScannerProtocol - truncated messages are rejected", "[scanner][protocol]")
+{
+    ScannerProtocol::ScanResponse response;
+    response.requestId = 1;
+    response.plugins.push_back(makeDescription("Reverb", 300));
+    const auto encoded = ScannerProtocol::encode(response);
+
+    // Every proper prefix must fail cleanly rather than read past the end
+    for (size_t size = 0; size < encoded.getSize(); ++size)
+    {
+        juce::MemoryBlock truncated(encoded.getData(), size);
+        ScannerProtocol::ScanResponse decoded;
+        REQUIRE_FALSE(ScannerProtocol::decode(truncated, decoded));
+    }
+
+    ScannerProtocol::ScanRequest request;
+    request.formatName = "VST3";
+    request.pluginPath = "/tmp/Plugin.vst3";
+    const auto encodedRequest = ScannerProtocol::encode(request);
+    for (size_t size = 0; size < encodedRequest.getSize(); ++size)
+    {
+        juce::MemoryBlock truncated(encodedRequest.getData(), size);
+        ScannerProtocol::ScanRequest decoded;
+        REQUIRE_FALSE(ScannerProtocol::decode(truncated, decoded));
+    }
+}
+
+TEST_CASE("ScannerProtocol - foreign and mistyped messages are rejected", "[scanner][protocol]")
+{
+    ScannerProtocol::ScanRequest request;
+    request.requestId = 3;
+    request.formatName = "VST3";
+    request.pluginPath = "/tmp/Plugin.vst3";
+    auto encoded = ScannerProtocol::encode(request);
+
+    // A request is not a response
+    ScannerProtocol::ScanResponse response;
+    REQUIRE_FALSE(ScannerProtocol::decode(encoded, response));
+
+    // Wrong magic
+    auto corrupted = encoded;
+    static_cast<char*>(corrupted.getData())[0] ^= 0x5a;
+    ScannerProtocol::ScanRequest decoded;
+    REQUIRE_FALSE(ScannerProtocol::decode(corrupted, decoded));
+
+    // Negative string length
+    juce::MemoryOutputStream out;
+    out.writeInt(ScannerProtocol::kMagic);
+    out.writeInt(ScannerProtocol::kVersion);
+    out.writeInt(static_cast<juce::int32>(ScannerProtocol::MessageType::ScanRequest));
+    out.writeInt(9);
+    out.writeInt(-5);
+    REQUIRE_FALSE(ScannerProtocol::decode(out.getMemoryBlock(), decoded));
+}
+
+TEST_CASE("ScannerProtocol - benchmark messages round-trip", "[scanner][protocol]")
+{
+    ScannerProtocol::BenchmarkRequest request;
+    request.requestId = 11;
+    request.plugins.push_back(makeDescription("Comp", 100));
+    request.plugins.push_back(makeDescription("Verb", 200));
+
+    ScannerProtocol::BenchmarkRequest decodedRequest;
+    REQUIRE(ScannerProtocol::decode(ScannerProtocol::encode(request), decodedRequest));
+    REQUIRE(decodedRequest.requestId == 11);
+    REQUIRE(decodedRequest.plugins.size() == 2);
+    REQUIRE(decodedRequest.plugins[1].isDuplicateOf(request.plugins[1]));
+
+    // A benchmark request is not a scan request
+    ScannerProtocol::ScanRequest scanRequest;
+    REQUIRE_FALSE(ScannerProtocol::decode(ScannerProtocol::encode(request), scanRequest));
+
+    ScannerProtocol::BenchmarkResponse response;
+    response.requestId = 11;
+    PluginProfile measured;
+    measured.instantiateMs = 12.5;
+    measured.prepareMs = 3.25;
+    measured.latencySamples = 64;
+    measured.tailSeconds = 1.5;
+    measured.blockCosts.push_back({ 48000.0, 512, 210.0, 480.0 });
+    response.profiles.push_back(measured);
+    response.profiles.push_back({});   // Couldn't be measured
+
+    const auto encoded = ScannerProtocol::encode(response);
+    ScannerProtocol::BenchmarkResponse decoded;
+    REQUIRE(ScannerProtocol::decode(encoded, decoded));
+    REQUIRE(decoded.requestId == 11);
+    REQUIRE(decoded.profiles.size() == 2);
+    REQUIRE(decoded.profiles[0].isValid());
+    REQUIRE(decoded.profiles[0].latencySamples == 64);
+    REQUIRE(decoded.profiles[0].tailSeconds == 1.5);
+    REQUIRE(decoded.profiles[0].blockCosts.size() == 1);
+    REQUIRE(decoded.profiles[0].blockCosts[0].blockSize == 512);
+    REQUIRE(decoded.profiles[0].blockCosts[0].medianMicros == 210.0);
+    REQUIRE_FALSE(decoded.profiles[1].isValid());
+
+    for (size_t size = 0; size < encoded.getSize(); ++size)
+    {
+        juce::MemoryBlock truncated(encoded.getData(), size);
+        ScannerProtocol::BenchmarkResponse partial;
+        REQUIRE_FALSE(ScannerProtocol::decode(truncated, partial));
+    }
+}
+
+TEST_CASE("ScannerProtocol - hello round-trips and is distinct from other messages", "[scanner][protocol]")
+{
+    ScannerProtocol::Hello hello;
+    hello.requestId = 5;
+
+    const auto encoded = ScannerProtocol::encode(hello);
+    ScannerProtocol::Hello decodedHello;
+    REQUIRE(ScannerProtocol::decode(encoded, decodedHello));
+    REQUIRE(decodedHello.requestId == 5);
+
+    // A hello is not its own reply, nor a scan request
+    ScannerProtocol::HelloResponse notAReply;
+    REQUIRE_FALSE(ScannerProtocol::decode(encoded, notAReply));
+    ScannerProtocol::ScanRequest notAScan;
+    REQUIRE_FALSE(ScannerProtocol::decode(encoded, notAScan));
+
+    ScannerProtocol::HelloResponse response;
+    response.requestId = 5;
+    ScannerProtocol::HelloResponse decodedResponse;
+    REQUIRE(ScannerProtocol::decode(ScannerProtocol::encode(response), decodedResponse));
+    REQUIRE(decodedResponse.requestId == 5);
+
+    // A helper built against an older protocol version is not mistaken for a worker
+    juce::MemoryOutputStream out;
+    out.writeInt(ScannerProtocol::kMagic);
+    out.writeInt(ScannerProtocol::kVersion - 1);
+    out.writeInt(static_cast<juce::int32>(ScannerProtocol::MessageType::HelloResponse));
+    out.writeInt(5);
+    REQUIRE_FALSE(ScannerProtocol::decode(out.getMemoryBlock(), decodedResponse));
+}
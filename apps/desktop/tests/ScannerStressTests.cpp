@@ -1,7 +1,10 @@
 #include <catch2/catch_test_macros.hpp>
 #include "../src/core/PluginManager.h"
+#include "TestHelpers.h"
 #include <thread>
 #include <chrono>
+#include <map>
+#include <set>
 
 #if JUCE_MAC
 #include <cstdlib>
@@ -172,3 +175,176 @@ TEST_CASE("Scanner blacklist persistence", "[scanner]")
     manager2.removeFromBlacklist(testPlugin);
     manager2.savePluginList();
 }
+
+//==============================================================================
+// ScanScheduler with fake helpers: /bin/sh one-liners that behave like
+// PluginScannerHelper succeeding, failing, crashing (its signal handler exits
+// 128 + signal) or hanging past the per-plugin timeout.
+
+#if JUCE_MAC || JUCE_LINUX
+namespace
+{
+    enum class FakeOutcome { Success, ScanFailure, Crash, Hang };
+
+    juce::StringArray makeFakeHelper(FakeOutcome outcome, const juce::String& pluginPath)
+    {
+        juce::String script;
+        switch (outcome)
+        {
+            case FakeOutcome::Success:
+                script = "sleep 0.02; printf 'SCAN_SUCCESS:1\\nPLUGIN_START\\nname=Fake\\nfileOrIdentifier="
+                         + pluginPath + "\\nPLUGIN_END\\n'";
+                break;
+            case FakeOutcome::ScanFailure: script = "echo SCAN_FAILED:No plugins found; exit 1"; break;
+            case FakeOutcome::Crash:       script = "sleep 0.01; echo SCAN_FAILED:Signal; exit 139"; break;
+            case FakeOutcome::Hang:        script = "exec sleep 30"; break;
+        }
+        return { "/bin/sh", "-c", script };
+    }
+
+    struct ConcurrencyProbe
+    {
+        std::atomic<int> current { 0 };
+        std::atomic<int> peak { 0 };
+
+        void enter()
+        {
+            const int now = ++current;
+            int seen = peak.load();
+            while (now > seen && !peak.compare_exchange_weak(seen, now)) {}
+        }
+        void leave() { --current; }
+    };
+}
+
+TEST_CASE("ScanScheduler stress - fake helpers crash, hang or succeed at random", "[scanner][stress]")
+{
+    constexpr int numJobs = 48;
+    constexpr int numWorkers = 8;
+    constexpr int timeoutMs = 300;
+
+    TempTestDirectory temp { "ProChainScanPedals" };
+    const auto& pedalDir = temp.dir;
+
+    juce::Random random(20240611);
+    std::map<juce::String, FakeOutcome> expected;
+    std::vector<ScanScheduler::Job> jobs;
+    for (int i = 0; i < numJobs; ++i)
+    {
+        auto path = "/fake/Plugin" + juce::String(i) + ".vst3";
+        expected[path] = static_cast<FakeOutcome>(random.nextInt(4));
+        jobs.push_back({ "VST3", path, false });
+    }
+
+    ConcurrencyProbe probe;
+    std::atomic<int> pedalMisses { 0 };
+
+    ScanScheduler scheduler([&](const ScanScheduler::Job& job, int) {
+        probe.enter();
+        // Crash attribution: our pedal names us for as long as the helper runs
+        if (!ScanScheduler::readPedals(pedalDir).contains(job.pluginPath))
+            ++pedalMisses;
+        auto result = ScanScheduler::runHelperProcess(makeFakeHelper(expected.at(job.pluginPath), job.pluginPath),
+                                                      job.pluginPath, timeoutMs);
+        probe.leave();
+        return result;
+    }, pedalDir);
+
+    scheduler.start(jobs, numWorkers);
+
+    // Drain in batches the way PluginManager's timer does
+    std::vector<ScanScheduler::Result> results;
+    while (!scheduler.isFinished())
+    {
+        scheduler.drainResults(results);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    scheduler.drainResults(results);
+
+    REQUIRE(static_cast<int>(results.size()) == numJobs);
+    REQUIRE(scheduler.getNumCompleted() == numJobs);
+    CHECK(pedalMisses.load() == 0);
+    CHECK(probe.peak.load() > 1);
+    CHECK(probe.peak.load() <= numWorkers);
+    CHECK(ScanScheduler::readPedals(pedalDir).isEmpty());
+
+    std::set<juce::String> seen;
+    for (const auto& result : results)
+    {
+        INFO(result.pluginPath);
+        REQUIRE(seen.insert(result.pluginPath).second);   // Exactly one result per plugin
+
+        switch (expected.at(result.pluginPath))
+        {
+            case FakeOutcome::Success:
+                CHECK(result.scanResult.success);
+                REQUIRE(result.discoveredPlugins.size() == 1);
+                CHECK(result.discoveredPlugins.front().fileOrIdentifier == result.pluginPath);
+                break;
+            case FakeOutcome::ScanFailure:
+                CHECK(result.scanResult.failureReason == ScanFailureReason::ScanFailure);
+                break;
+            case FakeOutcome::Crash:
+                CHECK(result.scanResult.failureReason == ScanFailureReason::Crash);
+                break;
+            case FakeOutcome::Hang:
+                CHECK(result.scanResult.failureReason == ScanFailureReason::Timeout);
+                break;
+        }
+    }
+}
+
+TEST_CASE("ScanScheduler runs crash suspects one at a time", "[scanner]")
+{
+    std::vector<ScanScheduler::Job> jobs;
+    for (int i = 0; i < 4; ++i)
+        jobs.push_back({ "VST3", "/fake/Suspect" + juce::String(i) + ".vst3", true });
+    for (int i = 0; i < 12; ++i)
+        jobs.push_back({ "VST3", "/fake/Plugin" + juce::String(i) + ".vst3", false });
+
+    ConcurrencyProbe probe;
+    std::atomic<int> suspectOverlaps { 0 };
+
+    ScanScheduler scheduler([&](const ScanScheduler::Job& job, int) {
+        probe.enter();
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        if (job.isolated && probe.current.load() != 1)
+            ++suspectOverlaps;
+        probe.leave();
+        return ScanScheduler::Result { { true, ScanFailureReason::None }, {}, job.pluginPath };
+    }, {});
+
+    scheduler.start(jobs, 4);
+    scheduler.waitUntilFinished();
+
+    std::vector<ScanScheduler::Result> results;
+    REQUIRE(scheduler.drainResults(results) == 16);
+    CHECK(suspectOverlaps.load() == 0);
+    CHECK(probe.peak.load() > 1);   // The rest still ran concurrently
+
+    // Suspects finish first, in order
+    for (int i = 0; i < 4; ++i)
+        CHECK(results[static_cast<size_t>(i)].pluginPath == "/fake/Suspect" + juce::String(i) + ".vst3");
+}
+
+TEST_CASE("ScanScheduler stop leaves remaining jobs unclaimed", "[scanner]")
+{
+    std::vector<ScanScheduler::Job> jobs;
+    for (int i = 0; i < 32; ++i)
+        jobs.push_back({ "VST3", "/fake/Plugin" + juce::String(i) + ".vst3", false });
+
+    ScanScheduler scheduler([](const ScanScheduler::Job& job, int) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(25));
+        return ScanScheduler::Result { { true, ScanFailureReason::None }, {}, job.pluginPath };
+    }, {});
+
+    scheduler.start(jobs, 2);
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    scheduler.stop();
+    scheduler.waitUntilFinished();
+
+    REQUIRE(scheduler.isFinished());
+    CHECK(scheduler.getNumCompleted() < 32);
+    CHECK(scheduler.getNumCompleted() > 0);
+}
+#endif
@@ -151,6 +151,27 @@ inline void settleTestSmoothing(juce::AudioProcessor &proc,
   }
 }
 
+// =============================================================================
+// TempTestDirectory
+//
+// A fresh, empty directory under the system temp directory, removed with its
+// contents when the fixture goes out of scope (also when a REQUIRE fails).
+// =============================================================================
+
+struct TempTestDirectory {
+  juce::File dir;
+
+  explicit TempTestDirectory(const juce::String &prefix = "ProChainTest")
+      : dir(juce::File::getSpecialLocation(juce::File::tempDirectory)
+                .getNonexistentChildFile(prefix, "")) {
+    dir.createDirectory();
+  }
+
+  ~TempTestDirectory() { dir.deleteRecursively(); }
+
+  JUCE_DECLARE_NON_COPYABLE(TempTestDirectory)
+};
+
 // =============================================================================
 // ChainProcessorTestFixture
 //
@@ -10,16 +10,25 @@ import type {
   GainSettings,
   BlacklistedPluginEvent,
   OtherInstanceInfo,
+  RealtimeBudget,
+  SessionAnalysisFrame,
   MirrorState,
+  PluginParametersChangedEvent,
   CustomScanPath,
   DeactivatedPlugin,
   AutoScanState,
   NewPluginsDetectedEvent,
   InlineEditorState,
   AutomationSlotWarning,
+  ParameterMappingState,
+  MacroInfo,
+  MacroCurve,
   LatencyWarning,
   BackupInfo,
   ExportedChainData,
+  ChainCpuEstimate,
+  PrewarmStatus,
+  PrewarmSettings,
 } from './types';
 
 type EventHandler<T> = (data: T) => void;
@@ -118,6 +127,8 @@ class JuceBridge {
       'mirrorUpdateApplied',
       'sendChainComplete',
       'pluginParameterChangeSettled',
+      'pluginParametersChanged',
+      'sessionAnalysis',
       'templateListChanged',
       'deactivationChanged',
       'newPluginsDetected',
@@ -332,6 +343,18 @@ class JuceBridge {
     return this.callNative<ApiResponse>('loadPreset', path);
   }
 
+  /** Stage a preset's plugins in the background so a following loadPreset is near-instant. */
+  async prefetchPreset(path: string): Promise<ApiResponse> {
+    return this.callNative<ApiResponse>('prefetchPreset', path);
+  }
+
+  /** Cancel a prefetch; with no path, drops everything staged. */
+  async cancelPrefetch(path?: string): Promise<ApiResponse> {
+    return path === undefined
+      ? this.callNative<ApiResponse>('cancelPrefetch')
+      : this.callNative<ApiResponse>('cancelPrefetch', path);
+  }
+
   async deletePreset(path: string): Promise<ApiResponse> {
     return this.callNative<ApiResponse>('deletePreset', path);
   }
@@ -882,6 +905,29 @@ class JuceBridge {
     return this.callNative<OtherInstanceInfo[]>('getOtherInstances');
   }
 
+  /**
+   * Worker pool shared by all instances in the process, with per-instance utilization.
+   */
+  async getRealtimeBudget(): Promise<RealtimeBudget> {
+    return this.callNative<RealtimeBudget>('getRealtimeBudget');
+  }
+
+  /**
+   * Show/hide the session overview. While enabled this editor counts as a viewer, every
+   * instance publishes at display rate, and 'sessionAnalysis' fires with all of them.
+   */
+  async setSessionOverviewEnabled(enabled: boolean): Promise<void> {
+    return this.callNative<void>('setSessionOverviewEnabled', enabled);
+  }
+
+  async getSessionOverview(): Promise<SessionAnalysisFrame[]> {
+    return this.callNative<SessionAnalysisFrame[]>('getSessionOverview');
+  }
+
+  onSessionAnalysis(handler: EventHandler<SessionAnalysisFrame[]>): () => void {
+    return this.on('sessionAnalysis', handler);
+  }
+
   /**
    * Copy the full chain (with presets) from another instance to this one.
    */
@@ -962,6 +1008,13 @@ class JuceBridge {
     return this.on('mirrorUpdateApplied', handler);
   }
 
+  /**
+   * Subscribe to hosted plugin parameter changes (batched per mirror tick, ~30 Hz).
+   */
+  onPluginParametersChanged(handler: EventHandler<PluginParametersChangedEvent>): () => void {
+    return this.on('pluginParametersChanged', handler);
+  }
+
   // ============================================
   // Oversampling Control
   // ============================================
@@ -993,6 +1046,123 @@ class JuceBridge {
     return this.callNative<number>('getOversamplingLatencyMs');
   }
 
+  // ============================================
+  // A/B Compare Slots
+  // ============================================
+
+  /**
+   * Get the A/B compare state (whether B holds a chain, which slot is audible).
+   */
+  async getABState(): Promise<{
+    success: boolean;
+    hasB?: boolean;
+    active?: 'A' | 'B';
+    keepWarm?: boolean;
+    swapping?: boolean;   // A swap is crossfading; select is ignored until it finishes
+    latencySamples?: number;
+    error?: string;
+  }> {
+    return this.callNative('getABState');
+  }
+
+  /**
+   * Run an A/B command: store the live chain in B, clear B, swap A/B contents,
+   * select the audible slot ('A' | 'B'), or set whether the inactive chain keeps processing.
+   */
+  async abCommand(
+    command: 'store' | 'clear' | 'swap' | 'select' | 'keepWarm',
+    arg?: 'A' | 'B' | boolean
+  ): Promise<{ success: boolean; hasB?: boolean; active?: 'A' | 'B'; keepWarm?: boolean; error?: string }> {
+    return arg === undefined
+      ? this.callNative('abCommand', command)
+      : this.callNative('abCommand', command, arg);
+  }
+
+  // ============================================
+  // Parameter Scenes
+  // ============================================
+
+  /**
+   * List the scene slots (empty slots included) with plugin counts.
+   * numChunkPlugins = plugins recalled from their full state chunk instead of parameters.
+   */
+  async getScenes(): Promise<{
+    success: boolean;
+    scenes: Array<{ index: number; empty: boolean; name?: string; numPlugins?: number; numChunkPlugins?: number }>;
+  }> {
+    return this.callNative('getScenes');
+  }
+
+  /**
+   * Run a scene command: capture the current parameter values into a slot, recall a slot,
+   * morph between two slots (position 0 = first, 1 = second), or clear a slot.
+   */
+  async sceneCommand(
+    command: 'capture' | 'recall' | 'morph' | 'clear',
+    index: number,
+    ...rest: Array<string | number>
+  ): Promise<{ success: boolean; scenes: Array<{ index: number; empty: boolean; name?: string }> }> {
+    return this.callNative('sceneCommand', command, index, ...rest);
+  }
+
+  // ============================================
+  // Host Automation Mappings
+  // ============================================
+
+  /**
+   * List the host automation parameters that are mapped to a plugin parameter.
+   */
+  async getParameterMappings(): Promise<ParameterMappingState> {
+    return this.callNative('getParameterMappings');
+  }
+
+  /**
+   * Run a mapping command: assign (nodeId, paramIndex, hostIndex?), unassign (hostIndex),
+   * learn (hostIndex? — maps the next plugin parameter touched), cancelLearn,
+   * or settings (hostParameterCount — applies to instances created afterwards).
+   * Mappings need the dynamic host-parameter layout (see legacyLayout).
+   */
+  async parameterMappingCommand(
+    command: 'assign' | 'unassign' | 'learn' | 'cancelLearn' | 'settings',
+    ...rest: number[]
+  ): Promise<ParameterMappingState> {
+    return this.callNative('parameterMappingCommand', command, ...rest);
+  }
+
+  /**
+   * List the macro controls and the child parameters each one drives.
+   */
+  async getMacros(): Promise<{ success: boolean; macros: MacroInfo[] }> {
+    return this.callNative('getMacros');
+  }
+
+  /**
+   * Add (or update) a macro target. The macro value is shaped by the curve, then mapped
+   * to rangeStart..rangeEnd of the child parameter (normalized).
+   */
+  async addMacroTarget(
+    macroIndex: number,
+    nodeId: number,
+    paramIndex: number,
+    rangeStart: number,
+    rangeEnd: number,
+    curve: MacroCurve,
+    steps = 4
+  ): Promise<{ success: boolean; macros: MacroInfo[] }> {
+    return this.callNative('macroCommand', 'addTarget', macroIndex, nodeId, paramIndex, rangeStart, rangeEnd, curve, steps);
+  }
+
+  /**
+   * Run a macro command: removeTarget (targetIndex), rename (name), clear, or setValue (0-1).
+   */
+  async macroCommand(
+    command: 'removeTarget' | 'rename' | 'clear' | 'setValue',
+    macroIndex: number,
+    ...rest: Array<string | number>
+  ): Promise<{ success: boolean; macros: MacroInfo[] }> {
+    return this.callNative('macroCommand', command, macroIndex, ...rest);
+  }
+
   // ============================================
   // Custom Scan Paths
   // ============================================
@@ -1053,6 +1223,30 @@ class JuceBridge {
     return this.callNative<{ newCount: number; newPlugins: Array<{ path: string; format: string }> }>('checkForNewPlugins');
   }
 
+  // ============================================
+  // Plugin Profiling
+  // ============================================
+
+  async setBenchmarkDuringScan(enabled: boolean): Promise<{ success: boolean; benchmarkDuringScan: boolean }> {
+    return this.callNative<{ success: boolean; benchmarkDuringScan: boolean }>('setBenchmarkDuringScan', enabled);
+  }
+
+  async estimateChainCpu(addingPluginId?: string): Promise<ChainCpuEstimate> {
+    return this.callNative<ChainCpuEstimate>('estimateChainCpu', addingPluginId ?? '');
+  }
+
+  // ============================================
+  // Plugin Prewarming
+  // ============================================
+
+  async getPrewarmStatus(): Promise<PrewarmStatus> {
+    return this.callNative<PrewarmStatus>('getPrewarmStatus');
+  }
+
+  async setPrewarmSettings(settings: PrewarmSettings): Promise<{ success: boolean; status: PrewarmStatus }> {
+    return this.callNative<{ success: boolean; status: PrewarmStatus }>('setPrewarmSettings', settings);
+  }
+
   // ============================================
   // Scanner Event Subscriptions
   // ============================================
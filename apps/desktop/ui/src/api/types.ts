@@ -11,8 +11,43 @@ export interface PluginDescription {
   numInputChannels: number;
   numOutputChannels: number;
   version: string;
+  profile?: PluginProfile;  // Present once the plugin has been benchmarked during a scan
 }
 
+// Load and processing cost measured by the scanner helper
+export interface PluginProfile {
+  instantiateMs: number;
+  prepareMs: number;
+  latencySamples: number;
+  tailSeconds: number;
+  blockCosts: Array<{ sampleRate: number; blockSize: number; medianMicros: number; worstMicros: number }>;
+}
+
+// Predicted chain CPU from plugin profiles (load: share of one core)
+export interface ChainCpuEstimate {
+  load: number;
+  numProfiled: number;
+  numUnprofiled: number;
+  sampleRate: number;
+  blockSize: number;
+}
+
+// Startup warm-up of the most-used plugins
+export interface PrewarmStatus {
+  state: 'idle' | 'waiting' | 'warming' | 'done' | 'cancelled';
+  enabled: boolean;
+  maxPlugins: number;
+  createInstances: boolean;
+  maxBytes: number;
+  numCandidates: number;
+  modulesWarmed: number;
+  instancesCreated: number;
+  bytesWarmed: number;
+  trackedPlugins: number;
+}
+
+export type PrewarmSettings = Partial<Pick<PrewarmStatus, 'enabled' | 'maxPlugins' | 'createInstances' | 'maxBytes'>>;
+
 // A slot in the plugin chain
 export interface ChainSlot {
   index: number;
@@ -342,6 +377,33 @@ export interface OtherInstanceInfo {
   isFollower: boolean;
 }
 
+export interface RealtimeBudgetInstance {
+  instanceId: number;
+  isSelf: boolean;
+  utilization: number;     // Smoothed cores in use
+  share: number;           // Cores granted at the last rebalance
+  queued: number;
+  running: number;
+  jobsCompleted: number;
+  jobsRejected: number;    // Ran inline because the queue was full
+}
+
+export interface RealtimeBudget {
+  workers: number;
+  instances: RealtimeBudgetInstance[];
+}
+
+export interface SessionAnalysisFrame {
+  instanceId: number;
+  isSelf: boolean;
+  trackName?: string;
+  lufs: number;            // Short-term LUFS of the instance output
+  peakDb: number;
+  rmsDb: number;
+  bandsDb: number[];       // 32 log-spaced bands, 20 Hz - 20 kHz
+  ageMs: number;           // Unviewed instances publish at 2 Hz, so frames can be up to ~500 ms old
+}
+
 export interface MirrorPartner {
   id: number;
   trackName: string;
@@ -354,6 +416,17 @@ export interface MirrorState {
   partners: MirrorPartner[];
 }
 
+export interface PluginParameterChange {
+  nodeId: number;
+  paramIndex: number;
+  value: number;           // Normalized 0..1
+}
+
+export interface PluginParametersChangedEvent {
+  changes: PluginParameterChange[];
+  truncated: boolean;      // More changed than fit in one event — re-read via readPluginParameters
+}
+
 // =============================================
 // Scanner management types
 // =============================================
@@ -398,6 +471,45 @@ export interface AutomationSlotWarning {
   unautomatablePlugins: string[];
 }
 
+// Host automation parameter mapped to a plugin parameter (dynamic layout)
+export interface ParameterMapping {
+  hostIndex: number;
+  nodeId: number;
+  paramIndex: number;
+  paramName: string;
+  pluginName: string;
+  bound: boolean;          // false while the mapped plugin is missing from the chain
+}
+
+export type MacroCurve = 'linear' | 'log' | 'scurve' | 'stepped';
+
+// Child parameter driven by a macro; range is in normalized child values (start > end inverts)
+export interface MacroTarget {
+  nodeId: number;
+  paramIndex: number;
+  paramName: string;
+  rangeStart: number;
+  rangeEnd: number;
+  curve: MacroCurve;
+  steps: number;
+}
+
+export interface MacroInfo {
+  index: number;
+  name: string;
+  value: number;
+  targets: MacroTarget[];
+}
+
+export interface ParameterMappingState {
+  success: boolean;
+  legacyLayout: boolean;
+  numHostParameters: number;
+  learning: boolean;
+  mappings: ParameterMapping[];
+  settingsHostParameterCount: number;   // Saved setting — applies to newly created instances
+}
+
 // Unified chain item for merged local + cloud view
 export type UnifiedChainItem =
   | { source: 'local'; data: PresetInfo }